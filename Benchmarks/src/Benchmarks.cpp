@@ -0,0 +1,722 @@
+// WLVERSE [https://wlverse.web.app]
+// Benchmarks.cpp
+//
+// Timings for the engine's hot paths, kept out of the unit tests so that
+// the test runs stay fast. This project is not built with the solution,
+// build and run it on its own in Release:
+//   Benchmarks.exe            runs every benchmark
+//   Benchmarks.exe picking    runs the benchmarks whose name contains "picking"
+//
+// Each benchmark prints what it measured and checks that the fast and the
+// slow path agree. The exit code is the number of failed checks.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#include "pch.h"
+
+#include <FlexEngine.h>
+using namespace FlexEngine;
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+  using Clock = std::chrono::high_resolution_clock;
+
+  double MillisecondsSince(Clock::time_point start)
+  {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  }
+
+  int failed_checks = 0;
+
+  void Check(bool condition, const char* what)
+  {
+    if (condition) return;
+    std::printf("  FAILED: %s\n", what);
+    ++failed_checks;
+  }
+
+  struct Benchmark
+  {
+    const char* name;
+    std::function<void()> run;
+  };
+
+}
+
+namespace B_SpatialIndex
+{
+
+  // Deterministic boxes scattered over a large world, same as the unit tests
+  static std::vector<AABBTree::Box> GenerateBoxes(std::size_t count, uint32_t seed)
+  {
+    std::vector<AABBTree::Box> boxes;
+    boxes.reserve(count);
+
+    uint32_t state = seed;
+    auto next = [&state]() { state = state * 1664525u + 1013904223u; return (state >> 8) / float(1 << 24); };
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      float x = next() * 20000.0f;
+      float y = next() * 20000.0f;
+      float w = 8.0f + next() * 120.0f;
+      float h = 8.0f + next() * 120.0f;
+      boxes.push_back({ x, y, x + w, y + h });
+    }
+    return boxes;
+  }
+
+  // Brute force picking (what the editor used to do) vs the spatial index,
+  // including the cost of a full resync and of updating only the entities that moved.
+  static void Picking(std::size_t count)
+  {
+    const int frames = 60;
+    const std::size_t moving = count / 200;
+
+    auto boxes = GenerateBoxes(count, 5);
+    auto probes = GenerateBoxes(frames, 6);
+
+    SpatialIndex index;
+    index.BeginSync();
+    for (std::size_t i = 0; i < boxes.size(); ++i)
+      index.Update(i + 1, Vector2(boxes[i].min_x, boxes[i].min_y), Vector2(boxes[i].max_x, boxes[i].max_y));
+    index.EndSync();
+
+    std::size_t brute_hits = 0;
+    auto start = Clock::now();
+    for (auto& probe : probes)
+      for (auto& box : boxes)
+        if (box.Contains(probe.min_x, probe.min_y)) ++brute_hits;
+    double brute_ms = MillisecondsSince(start) / frames;
+
+    std::size_t index_hits = 0;
+    std::vector<SpatialIndex::EntityID> picked;
+    start = Clock::now();
+    for (auto& probe : probes)
+    {
+      picked.clear();
+      index.Pick(Vector2(probe.min_x, probe.min_y), picked);
+      index_hits += picked.size();
+    }
+    double query_ms = MillisecondsSince(start) / frames;
+
+    // static scene, every entity re-synced each frame
+    start = Clock::now();
+    for (int f = 0; f < frames; ++f)
+    {
+      index.BeginSync();
+      for (std::size_t i = 0; i < boxes.size(); ++i)
+        index.Update(i + 1, Vector2(boxes[i].min_x, boxes[i].min_y), Vector2(boxes[i].max_x, boxes[i].max_y));
+      index.EndSync();
+    }
+    double sync_ms = MillisecondsSince(start) / frames;
+
+    // what physics does now, only the entities whose bounds changed
+    start = Clock::now();
+    for (int f = 0; f < frames; ++f)
+    {
+      for (std::size_t i = 0; i < moving; ++i)
+      {
+        AABBTree::Box& box = boxes[i * (count / moving)];
+        box.min_x += 1.0f;
+        box.max_x += 1.0f;
+        index.Update(i * (count / moving) + 1, Vector2(box.min_x, box.min_y), Vector2(box.max_x, box.max_y));
+      }
+    }
+    double changed_ms = MillisecondsSince(start) / frames;
+
+    Check(brute_hits == index_hits, "the index picks the same entities as brute force");
+    Check(index.Size() == count, "updating the moved entities keeps every entity");
+
+    std::printf(
+      "  %zu entities: brute force %.4f ms/pick, index %.4f ms/pick, full sync %.4f ms/frame, %zu moved %.4f ms/frame\n",
+      count, brute_ms, query_ms, sync_ms, moving, changed_ms
+    );
+  }
+
+}
+
+namespace B_Reflection
+{
+
+  struct TestInner
+  { FLX_REFL_SERIALIZABLE
+    float x = 0.0f;
+    int y = 0;
+  };
+
+  // Same shape as the unit tests' round trip struct, covers every reflected kind
+  struct TestOuter
+  { FLX_REFL_SERIALIZABLE
+    int a = 0;
+    unsigned b = 0;
+    int64_t c = 0;
+    uint64_t d = 0;
+    double e = 0.0;
+    float f = 0.0f;
+    bool g = false;
+    std::string h;
+    std::vector<TestInner> v;
+    std::unordered_map<std::string, int> m;
+    std::pair<int, std::string> p;
+    std::shared_ptr<TestInner> sp;
+    std::shared_ptr<TestInner> sn;
+  };
+
+  FLX_REFL_REGISTER_START(TestInner)
+    FLX_REFL_REGISTER_PROPERTY(x)
+    FLX_REFL_REGISTER_PROPERTY(y)
+  FLX_REFL_REGISTER_END;
+
+  FLX_REFL_REGISTER_START(TestOuter)
+    FLX_REFL_REGISTER_PROPERTY(a)
+    FLX_REFL_REGISTER_PROPERTY(b)
+    FLX_REFL_REGISTER_PROPERTY(c)
+    FLX_REFL_REGISTER_PROPERTY(d)
+    FLX_REFL_REGISTER_PROPERTY(e)
+    FLX_REFL_REGISTER_PROPERTY(f)
+    FLX_REFL_REGISTER_PROPERTY(g)
+    FLX_REFL_REGISTER_PROPERTY(h)
+    FLX_REFL_REGISTER_PROPERTY(v)
+    FLX_REFL_REGISTER_PROPERTY(m)
+    FLX_REFL_REGISTER_PROPERTY(p)
+    FLX_REFL_REGISTER_PROPERTY(sp)
+    FLX_REFL_REGISTER_PROPERTY(sn)
+  FLX_REFL_REGISTER_END;
+
+  static TestOuter MakeTestOuter()
+  {
+    TestOuter o;
+    o.a = -123456;
+    o.b = 4000000000u;
+    o.c = -(1ll << 60);
+    o.d = ~0ull;
+    o.e = 3.25;
+    o.f = -1.5f;
+    o.g = true;
+    o.h = "he\"llo\n";
+    for (int i = 0; i < 100; ++i) o.v.push_back({ i * 0.5f, -i });
+    o.m["one"] = 1;
+    o.m["neg"] = -7;
+    o.p = { 9, "nine" };
+    o.sp = std::make_shared<TestInner>(TestInner{ 2.0f, 3 });
+    return o;
+  }
+
+  // Save + load of the same data through the json path (Serialize, RapidJSON parse, Deserialize)
+  // and the binary path.
+  static void Throughput()
+  {
+    std::vector<TestOuter> data(2000, MakeTestOuter());
+    Reflection::TypeDescriptor* type_desc = Reflection::TypeResolver<std::vector<TestOuter>>::Get();
+
+    auto start = Clock::now();
+    std::stringstream ss;
+    type_desc->Serialize(&data, ss);
+    std::string json = ss.str();
+    double json_save_ms = MillisecondsSince(start);
+
+    start = Clock::now();
+    Document document;
+    document.Parse(json.c_str());
+    std::vector<TestOuter> from_json;
+    type_desc->Deserialize(&from_json, document);
+    double json_load_ms = MillisecondsSince(start);
+
+    start = Clock::now();
+    Reflection::BinaryWriter out;
+    type_desc->SerializeBinary(&data, out);
+    double binary_save_ms = MillisecondsSince(start);
+
+    start = Clock::now();
+    std::vector<TestOuter> from_binary;
+    Reflection::BinaryReader in(out.GetBuffer());
+    type_desc->DeserializeBinary(&from_binary, in);
+    double binary_load_ms = MillisecondsSince(start);
+
+    Check(from_json.size() == data.size() && from_json.back().v.size() == data.back().v.size(), "json loads every element");
+    Check(from_binary.size() == data.size() && from_binary.back().v.size() == data.back().v.size(), "binary loads every element");
+
+    std::printf("  json: %zu bytes, save %.3f ms, load %.3f ms\n", json.size(), json_save_ms, json_load_ms);
+    std::printf("  binary: %zu bytes, save %.3f ms, load %.3f ms\n", out.Size(), binary_save_ms, binary_load_ms);
+  }
+
+}
+
+namespace B_BattleSim
+{
+
+  using namespace BattleSim;
+  using Asset::MoveEffect;
+  using Asset::MoveTarget;
+
+  static MoveData MakeMove(int speed, std::vector<Asset::MoveOp> ops)
+  {
+    MoveData move;
+    move.name = "Benchmark Move";
+    move.speed = speed;
+    move.ops = std::move(ops);
+    return move;
+  }
+
+  static CharacterData MakeCharacter(int id, int slot, int health, int speed, std::vector<MoveData> moves)
+  {
+    CharacterData character;
+    character.name = "Character " + std::to_string(id);
+    character.character_id = id;
+    character.slot = slot;
+    character.health = health;
+    character.speed = speed;
+    character.moves = std::move(moves);
+    return character;
+  }
+
+  // The unit tests' mixed battle: two drifters against three enemies with a mix of effects
+  static BattleData MakeMixedBattle()
+  {
+    BattleData battle;
+    battle.name = "Mixed";
+    battle.characters = {
+      MakeCharacter(1, 0, 60, 4, {
+        MakeMove(8, { { MoveEffect::Damage, MoveTarget::Single_Enemy, 12 } }),
+        MakeMove(10, { { MoveEffect::Damage, MoveTarget::Adjacent_Enemies, 6 }, { MoveEffect::Speed_Down, MoveTarget::Adjacent_Enemies, 3 } }),
+        MakeMove(6, { { MoveEffect::Attack_Up, MoveTarget::Self, 2 } })
+      }),
+      MakeCharacter(2, 1, 50, 6, {
+        MakeMove(9, { { MoveEffect::Heal, MoveTarget::Single_Ally, 10 } }),
+        MakeMove(8, { { MoveEffect::Damage, MoveTarget::Next_Enemy, 8 }, { MoveEffect::Stun, MoveTarget::Next_Enemy, 1 } }),
+        MakeMove(7, { { MoveEffect::Shield, MoveTarget::All_Allies, 1 } })
+      }),
+      MakeCharacter(3, 0, 40, 5, {
+        MakeMove(8, { { MoveEffect::Damage, MoveTarget::Single_Enemy, 9 } }),
+        MakeMove(9, { { MoveEffect::Attack_Down, MoveTarget::All_Enemies, 2 } }),
+        MakeMove(12, { { MoveEffect::Damage, MoveTarget::All_Enemies, 5 } })
+      }),
+      MakeCharacter(3, 1, 40, 7, {
+        MakeMove(8, { { MoveEffect::Damage, MoveTarget::Single_Enemy, 9 } }),
+        MakeMove(9, { { MoveEffect::Protect, MoveTarget::All_Allies, 2 } }),
+        MakeMove(10, { { MoveEffect::Strip, MoveTarget::Single_Enemy, 0 }, { MoveEffect::Damage, MoveTarget::Single_Enemy, 4 } })
+      }),
+      MakeCharacter(4, 2, 70, 9, {
+        MakeMove(12, { { MoveEffect::Damage, MoveTarget::Single_Enemy, 15 } }),
+        MakeMove(10, { { MoveEffect::Heal, MoveTarget::All_Allies, 15 } }),
+        MakeMove(14, { { MoveEffect::Cleanse, MoveTarget::All_Allies, 0 }, { MoveEffect::Speed_Up, MoveTarget::All_Allies, 4 } })
+      })
+    };
+    return battle;
+  }
+
+  // Battles per second on one thread and on every core
+  static void Throughput()
+  {
+    BattleData battle = MakeMixedBattle();
+    const int count = 100000;
+
+    auto start = Clock::now();
+    Summary single = SimulateMany(battle, 1, count, 1);
+    double single_s = MillisecondsSince(start) / 1000.0;
+
+    start = Clock::now();
+    Summary multi = SimulateMany(battle, 1, count, 0);
+    double multi_s = MillisecondsSince(start) / 1000.0;
+
+    Check(single.wins == multi.wins, "the thread count does not change the results");
+
+    std::printf("  %d battles, win rate %.3f, avg turns %.2f\n", count, single.WinRate(), single.AverageTurns());
+    std::printf("  1 thread: %.0f battles/s, all threads: %.0f battles/s\n", count / single_s, count / multi_s);
+  }
+
+}
+
+namespace B_ChangeTicks
+{
+
+  // A mostly static town: every entity's transform is rebuilt each frame (what the
+  // rendering layer used to do) vs only the entities that moved since the last frame.
+  static void StaticTown()
+  {
+    const int frames = 60;
+    const std::size_t count = 5000;
+    const std::size_t moving = 25; // the player, npcs and a few props
+
+    std::shared_ptr<FlexECS::Scene> scene = std::make_shared<FlexECS::Scene>();
+    FlexECS::Scene::SetActiveScene(scene);
+
+    std::vector<FlexECS::Entity> entities;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      FlexECS::Entity entity = FlexECS::Scene::CreateEntity("Town " + std::to_string(i));
+      entity.AddComponent<Position>({ Vector3(static_cast<float>(i % 100), static_cast<float>(i / 100), 0.0f) });
+      entity.AddComponent<Rotation>({});
+      entity.AddComponent<Scale>({ Vector3::One });
+      entity.AddComponent<Transform>({});
+      entities.push_back(entity);
+    }
+
+    auto update_transform = [](FlexECS::Entity& entity)
+    {
+      Matrix4x4 translation_matrix = Matrix4x4::Translate(Matrix4x4::Identity, entity.ReadComponent<Position>()->position);
+      Matrix4x4 rotation_matrix = Quaternion::FromEulerAnglesDeg(entity.ReadComponent<Rotation>()->rotation).ToRotationMatrix();
+      Matrix4x4 scale_matrix = Matrix4x4::Scale(Matrix4x4::Identity, entity.ReadComponent<Scale>()->scale);
+      entity.GetComponent<Transform>()->transform = translation_matrix * rotation_matrix * scale_matrix;
+    };
+
+    auto move = [&](int frame)
+    {
+      for (std::size_t i = 0; i < moving; ++i) entities[i * (count / moving)].GetComponent<Position>()->position.x += 0.1f * frame;
+    };
+
+    std::size_t full_visits = 0;
+    auto start = Clock::now();
+    for (int f = 0; f < frames; ++f)
+    {
+      move(f);
+      for (auto& entity : scene->CachedQuery<Position, Rotation, Scale, Transform>())
+      {
+        update_transform(entity);
+        ++full_visits;
+      }
+      FrameArena::NewFrame();
+    }
+    double full_ms = MillisecondsSince(start) / frames;
+
+    FlexECS::ChangeCursor cursor;
+    scene->ChangedQuery<FlexECS::Changed<Position, Rotation, Scale>, Position, Rotation, Scale, Transform>(cursor);
+
+    std::size_t changed_visits = 0;
+    start = Clock::now();
+    for (int f = 0; f < frames; ++f)
+    {
+      move(f);
+      for (auto& entity : scene->ChangedQuery<FlexECS::Changed<Position, Rotation, Scale>, Position, Rotation, Scale, Transform>(cursor))
+      {
+        update_transform(entity);
+        ++changed_visits;
+      }
+      FrameArena::NewFrame();
+    }
+    double changed_ms = MillisecondsSince(start) / frames;
+
+    Check(full_visits == count * frames, "the full pass visits every entity");
+    Check(changed_visits == moving * frames, "the changed pass visits only the moved entities");
+
+    std::printf(
+      "  %zu entities, %zu moving: every transform %.4f ms/frame, changed only %.4f ms/frame\n",
+      count, moving, full_ms, changed_ms
+    );
+  }
+
+}
+
+namespace B_Tween
+{
+
+  // A pause menu with its buttons sliding and fading: every animation resolving its
+  // entity by name and lerping by hand each frame (what the layers did) vs one tween update.
+  static void AnimatedMenu()
+  {
+    const int frames = 120;
+    const std::size_t count = 500;
+    const float dt = 1.0f / 60.0f;
+
+    FlexECS::Scene::SetActiveScene(std::make_shared<FlexECS::Scene>());
+
+    std::vector<std::string> names;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      names.push_back("Menu Button " + std::to_string(i));
+      FlexECS::Entity entity = FlexECS::Scene::CreateEntity(names.back());
+      entity.AddComponent<Position>({});
+      entity.AddComponent<Sprite>({});
+    }
+
+    float timer = 0.0f;
+    auto start = Clock::now();
+    for (int f = 0; f < frames; ++f)
+    {
+      timer += dt;
+      float t = std::min(timer / 2.0f, 1.0f);
+      for (const std::string& name : names)
+      {
+        FlexECS::Entity entity = FlexECS::Scene::GetEntityByName(name);
+        entity.GetComponent<Position>()->position.x = 0.0f + (100.0f - 0.0f) * t;
+        entity.GetComponent<Position>()->position.y = 0.0f + (50.0f - 0.0f) * t;
+        entity.GetComponent<Sprite>()->opacity = 0.0f + (1.0f - 0.0f) * t;
+      }
+    }
+    double manual_ms = MillisecondsSince(start) / frames;
+
+    for (const std::string& name : names)
+    {
+      FlexECS::Entity entity = FlexECS::Scene::GetEntityByName(name);
+      TweenSystem::FromTo(entity, TweenField::PositionX, 0.0f, 100.0f, 2.0f);
+      TweenSystem::FromTo(entity, TweenField::PositionY, 0.0f, 50.0f, 2.0f);
+      TweenSystem::FromTo(entity, TweenField::Opacity, 0.0f, 1.0f, 2.0f);
+    }
+
+    start = Clock::now();
+    for (int f = 0; f < frames; ++f) TweenSystem::Update(dt);
+    double tween_ms = MillisecondsSince(start) / frames;
+
+    Check(TweenSystem::GetLaneCount() == count * 3, "every field gets its own tween lane");
+    TweenSystem::Clear();
+
+    std::printf(
+      "  %zu animated fields: by name and hand %.4f ms/frame, tweens %.4f ms/frame\n",
+      count * 3, manual_ms, tween_ms
+    );
+  }
+
+}
+
+namespace B_ReflectionLayout
+{
+
+  // The component part of a binary scene save and load, every component of every entity
+  // written and read through the compiled layouts and member by member.
+  static void SceneComponents()
+  {
+    const std::size_t count = 20000;
+
+    std::vector<Position> positions(count);
+    std::vector<Scale> scales(count);
+    std::vector<Rigidbody> bodies(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      positions[i].position = Vector3(static_cast<float>(i), 2.0f, 3.0f);
+      bodies[i].velocity = Vector2(1.0f, static_cast<float>(i));
+    }
+
+    Reflection::TypeDescriptor_Struct* types[] = {
+      static_cast<Reflection::TypeDescriptor_Struct*>(Reflection::TypeResolver<Position>::Get()),
+      static_cast<Reflection::TypeDescriptor_Struct*>(Reflection::TypeResolver<Scale>::Get()),
+      static_cast<Reflection::TypeDescriptor_Struct*>(Reflection::TypeResolver<Rigidbody>::Get())
+    };
+    void* columns[] = { positions.data(), scales.data(), bodies.data() };
+
+    auto run = [&](bool compiled, std::vector<std::string>& rows)
+    {
+      rows.clear();
+      auto start = Clock::now();
+      for (std::size_t c = 0; c < 3; ++c)
+      {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          const char* data = static_cast<const char*>(columns[c]) + i * types[c]->size;
+          Reflection::BinaryWriter out(types[c]->size);
+          if (compiled) types[c]->SerializeBinary(data, out);
+          else types[c]->Internal_SerializeBinaryMembers(data, out);
+          rows.push_back(std::move(out.GetBuffer()));
+        }
+      }
+      double save_ms = MillisecondsSince(start);
+
+      start = Clock::now();
+      alignas(16) char loaded[64];
+      for (std::size_t c = 0; c < 3; ++c)
+      {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          Reflection::BinaryReader in(rows[c * count + i]);
+          if (compiled) types[c]->DeserializeBinary(loaded, in);
+          else types[c]->Internal_DeserializeBinaryMembers(loaded, in);
+        }
+      }
+      double load_ms = MillisecondsSince(start);
+      return std::make_pair(save_ms, load_ms);
+    };
+
+    std::vector<std::string> member_rows;
+    std::vector<std::string> compiled_rows;
+    auto [member_save_ms, member_load_ms] = run(false, member_rows);
+    auto [compiled_save_ms, compiled_load_ms] = run(true, compiled_rows);
+
+    Check(member_rows == compiled_rows, "compiled layouts write the same bytes as member by member");
+
+    std::printf("  member by member: save %.3f ms, load %.3f ms\n", member_save_ms, member_load_ms);
+    std::printf("  compiled layout: save %.3f ms, load %.3f ms\n", compiled_save_ms, compiled_load_ms);
+  }
+
+}
+
+namespace B_FrameSpike
+{
+
+  struct FrameTimes
+  {
+    double total_ms = 0.0;
+    double worst_ms = 0.0;
+    int frames = 0;
+
+    void Add(double ms)
+    {
+      total_ms += ms;
+      worst_ms = std::max(worst_ms, ms);
+      ++frames;
+    }
+
+    double Average() const { return frames ? total_ms / frames : 0.0; }
+  };
+
+  // The per-frame scratch containers of the rendering and physics layers (the
+  // sprite sort list, pick candidates and query results), allocated from the heap
+  // (before the frame arena) vs from the frame arena.
+  template <template <typename> class Container>
+  static FrameTimes ScratchFrames(int frames, std::size_t sprites, std::size_t& checksum)
+  {
+    std::vector<std::string> names;
+    for (std::size_t i = 0; i < sprites; ++i) names.push_back("Sprite " + std::to_string((i * 7919) % sprites));
+
+    // the arena grows to fit a whole frame in its first frames, those are not timed
+    const int warmup = 10;
+
+    FrameTimes times;
+    for (int f = 0; f < warmup + frames; ++f)
+    {
+      auto start = Clock::now();
+
+      Container<std::pair<std::string_view, std::size_t>> sorted;
+      for (std::size_t i = 0; i < sprites; ++i) sorted.emplace_back(names[i], i);
+      std::sort(sorted.begin(), sorted.end());
+
+      for (int query = 0; query < 32; ++query)
+      {
+        Container<std::size_t> results;
+        for (std::size_t i = query; i < sprites; i += 3) results.push_back(i);
+        checksum += results.size();
+      }
+
+      checksum += sorted.front().second;
+      FrameArena::NewFrame();
+      if (f >= warmup) times.Add(MillisecondsSince(start));
+    }
+    return times;
+  }
+
+  template <typename T>
+  using HeapVector = std::vector<T>;
+
+  static void ScratchContainers()
+  {
+    const int frames = 600;
+    const std::size_t sprites = 4000;
+
+    std::size_t heap_checksum = 0;
+    std::size_t arena_checksum = 0;
+    FrameTimes heap = ScratchFrames<HeapVector>(frames, sprites, heap_checksum);
+    FrameTimes arena = ScratchFrames<FrameVector>(frames, sprites, arena_checksum);
+
+    FrameArena::Stats stats = FrameArena::GetStats();
+    Check(heap_checksum == arena_checksum, "both containers see the same data");
+
+    std::printf("  std::vector: avg %.4f ms/frame, worst %.4f ms\n", heap.Average(), heap.worst_ms);
+    std::printf(
+      "  FrameVector: avg %.4f ms/frame, worst %.4f ms (arena high water %zu bytes, %llu overflow blocks)\n",
+      arena.Average(), arena.worst_ms, stats.high_water_mark, static_cast<unsigned long long>(stats.overflow_count)
+    );
+  }
+
+  // The frame that switches scenes: Scene::Load on the main thread (before the
+  // SceneLoader) vs a preload on a worker where the main thread only polls and takes.
+  static void SceneTransition(std::size_t count)
+  {
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / "flx_benchmarks";
+    std::filesystem::create_directories(directory);
+
+    std::shared_ptr<FlexECS::Scene> scene = std::make_shared<FlexECS::Scene>();
+    FlexECS::Scene::SetActiveScene(scene);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      FlexECS::Entity entity = FlexECS::Scene::CreateEntity("Town " + std::to_string(i));
+      entity.AddComponent<Position>({ Vector3(static_cast<float>(i % 100), static_cast<float>(i / 100), 0.0f) });
+      entity.AddComponent<Rotation>({});
+      entity.AddComponent<Scale>({ Vector3::One });
+      entity.AddComponent<Transform>({});
+      entity.AddComponent<Sprite>({});
+    }
+
+    File file;
+    file.path = Path(directory / "transition.flxscene");
+    scene->Save(file, FlxFmtEncoding::Binary);
+
+    auto start = Clock::now();
+    std::shared_ptr<FlexECS::Scene> sync_scene = FlexECS::Scene::Load(file);
+    double sync_ms = MillisecondsSince(start);
+
+    // a 60 fps main loop that polls the loader every frame
+    FrameTimes poll;
+    FlexECS::SceneLoader::LoadAsync(file.path);
+    while (true)
+    {
+      start = Clock::now();
+      bool ready = FlexECS::SceneLoader::IsReady(file.path);
+      poll.Add(MillisecondsSince(start));
+      if (ready) break;
+      std::this_thread::sleep_for(std::chrono::milliseconds(16));
+    }
+
+    start = Clock::now();
+    std::shared_ptr<FlexECS::Scene> async_scene = FlexECS::SceneLoader::Take(file.path);
+    double take_ms = MillisecondsSince(start);
+    FlexECS::SceneTemplateCache::Evict(file.path);
+
+    Check(
+      sync_scene->CachedQuery<Position, Sprite>().size() == count && async_scene->CachedQuery<Position, Sprite>().size() == count,
+      "both loads see every entity"
+    );
+
+    std::printf("  %zu entities: Scene::Load on the main thread %.3f ms\n", count, sync_ms);
+    std::printf(
+      "  preloaded: %d frames of polling, worst poll %.4f ms, Take %.3f ms\n",
+      poll.frames, poll.worst_ms, take_ms
+    );
+  }
+
+}
+
+int main(int argc, char** argv)
+{
+  std::vector<Benchmark> benchmarks = {
+    { "picking 10k", []() { B_SpatialIndex::Picking(10000); } },
+    { "picking 100k", []() { B_SpatialIndex::Picking(100000); } },
+    { "json vs binary", []() { B_Reflection::Throughput(); } },
+    { "battle sim", []() { B_BattleSim::Throughput(); } },
+    { "static town", []() { B_ChangeTicks::StaticTown(); } },
+    { "animated menu", []() { B_Tween::AnimatedMenu(); } },
+    { "scene components", []() { B_ReflectionLayout::SceneComponents(); } },
+    { "frame scratch containers", []() { B_FrameSpike::ScratchContainers(); } },
+    { "scene transition", []() { B_FrameSpike::SceneTransition(20000); } },
+  };
+
+  for (const Benchmark& benchmark : benchmarks)
+  {
+    // guard: only the benchmarks named on the command line
+    bool selected = (argc < 2);
+    for (int i = 1; i < argc; ++i)
+    {
+      if (std::string(benchmark.name).find(argv[i]) != std::string::npos) selected = true;
+    }
+    if (!selected) continue;
+
+    std::printf("%s\n", benchmark.name);
+    benchmark.run();
+  }
+
+  return failed_checks;
+}
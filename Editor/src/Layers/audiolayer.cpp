@@ -28,10 +28,8 @@ namespace Editor
     Profiler::StartCounter("Audio Loop");
 
     // Audio
-    for (auto& element : FlexECS::Scene::GetActiveScene()->CachedQuery<Audio>())
+    for (auto& element : FlexECS::Scene::GetActiveScene()->ActiveQuery<Audio>())
     {
-      if (!element.GetComponent<Transform>()->is_active) continue; // skip non active entities
-
       FlexEngine::Audio* audio = element.GetComponent<Audio>();
       if (audio->should_play)
       {
@@ -42,25 +40,22 @@ namespace Editor
           continue;
         }
 
-        if (audio->is_looping)
-        {
-          FMODWrapper::Core::PlayLoopingSound(FLX_STRING_GET(*element.GetComponent<EntityName>()),
-                                              FLX_ASSET_GET(Asset::Sound, AssetKey{ FLX_STRING_GET(element.GetComponent<Audio>()->audio_file) }));
-        }
-        else
-        {
-          FMODWrapper::Core::PlaySound(FLX_STRING_GET(*element.GetComponent<EntityName>()),
-                                       FLX_ASSET_GET(Asset::Sound, FLX_STRING_GET(element.GetComponent<Audio>()->audio_file)));
-        }
+        // replaying restarts the sound, same as playing under the same name did
+        FMODWrapper::Core::StopVoice(audio->voice);
+
+        // the voice handle replaces looking channels up by entity name
+        audio->voice = FMODWrapper::Core::PlayVoice(FLX_ASSET_GET(Asset::Sound, FLX_STRING_GET(audio->audio_file)),
+                                                    audio->is_looping ? FMODWrapper::Core::CHANNELGROUP::BGM : FMODWrapper::Core::CHANNELGROUP::SFX,
+                                                    audio->is_looping);
 
-        element.GetComponent<Audio>()->should_play = false;
+        audio->should_play = false;
       }
 
       if (audio->change_mode)
       {
         audio->change_mode = false;
         audio->is_looping = !audio->is_looping;
-        FMODWrapper::Core::ChangeLoopProperty(FLX_STRING_GET(*element.GetComponent<EntityName>()), audio->is_looping);
+        FMODWrapper::Core::SetVoiceLooping(audio->voice, audio->is_looping);
       }
     }
   
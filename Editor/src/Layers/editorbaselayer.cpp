@@ -116,9 +116,10 @@ namespace Editor
                                           } });
               }
 
-              if (ImGui::MenuItem("Save As", "Ctrl+Shift+S"))
+              // Binary scenes load faster but only while the component layouts stay the same
+              auto save_as = [this, &function_queue](FlxFmtEncoding encoding)
               {
-                  function_queue.Insert({ [this]()
+                  function_queue.Insert({ [this, encoding]()
                                           {
                                             FileList files = FileList::Browse(
                                               "Save Scene", current_save_directory, current_save_name + ".flxscene",
@@ -142,7 +143,7 @@ namespace Editor
                                             File& file = File::Open(Path(file_path));
 
                                             // save the scene
-                                            FlexECS::Scene::SaveActiveScene(file);
+                                            FlexECS::Scene::GetActiveScene()->Save(file, encoding);
                                             Log::Info("Saved scene to: " + file.path.string());
 
                                             // update the current save directory and name
@@ -151,6 +152,15 @@ namespace Editor
 
                                             Window::FrameBufferManager.GetFrameBuffer("Scene")->Clear();
                                           } });
+              };
+
+              if (ImGui::MenuItem("Save As", "Ctrl+Shift+S"))
+              {
+                  save_as(FlxFmtEncoding::Json);
+              }
+              if (ImGui::MenuItem("Save As Binary"))
+              {
+                  save_as(FlxFmtEncoding::Binary);
               }
               if (ImGui::MenuItem("Settings", "Ctrl+S"))
               {
@@ -66,7 +66,7 @@ namespace Editor
         }
 
         // --- PARTICLE UPDATE: Process all Particle components ---
-        std::vector<FlexECS::EntityID> m_entities_to_delete;
+        FrameVector<FlexECS::EntityID> m_entities_to_delete;
 
         for (auto& elem : FlexECS::Scene::GetActiveScene()->CachedQuery<ParticleSystem::Particle>())
         {
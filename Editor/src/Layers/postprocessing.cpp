@@ -16,19 +16,25 @@ namespace Editor
     Renderer2D_GlobalPPSettings PostProcessing::m_globalsettings = Renderer2D_GlobalPPSettings();
     int PostProcessing::postProcessZIndex = INT_MAX;
 
+    PostProcessGraph PostProcessing::m_localgraph;
+    PostProcessGraph PostProcessing::m_globalgraph;
+    std::vector<OpenGLFrameBufferManager::Handle> PostProcessing::m_transientbuffers;
+    OpenGLFrameBufferManager::Handle PostProcessing::m_localbuffer = OpenGLFrameBufferManager::InvalidHandle;
+    OpenGLFrameBufferManager::Handle PostProcessing::m_globalbuffer = OpenGLFrameBufferManager::InvalidHandle;
+    OpenGLFrameBufferManager::Handle PostProcessing::m_finalbuffer = OpenGLFrameBufferManager::InvalidHandle;
+    OpenGLFrameBufferManager::Handle PostProcessing::m_overlaybuffer = OpenGLFrameBufferManager::InvalidHandle;
+
     void PostProcessing::Init()
     {
         // Initialize framebuffers for local and global post-processing.
         // These framebuffers should be set up with the desired resolution and attachments.
         // The below part should be handled by renderer if framebuffermanager is under it
         Vector2 window_size = Vector2(static_cast<float>(Application::GetCurrentWindow()->GetWidth()), static_cast<float>(Application::GetCurrentWindow()->GetHeight()));
-        Window::FrameBufferManager.AddFrameBuffer("Local Post Processing", window_size);
-        Window::FrameBufferManager.AddFrameBuffer("Global Post Processing", window_size);
-        Window::FrameBufferManager.AddFrameBuffer("Final Post Processing", window_size);
-        Window::FrameBufferManager.AddFrameBuffer("Pass 1", window_size);
-        Window::FrameBufferManager.AddFrameBuffer("Pass 2", window_size);
-        Window::FrameBufferManager.AddFrameBuffer("Pass 3", window_size);
-        Window::FrameBufferManager.AddFrameBuffer("Pass 4", window_size);
+        m_localbuffer = Window::FrameBufferManager.AddFrameBuffer("Local Post Processing", window_size);
+        m_globalbuffer = Window::FrameBufferManager.AddFrameBuffer("Global Post Processing", window_size);
+        m_finalbuffer = Window::FrameBufferManager.AddFrameBuffer("Final Post Processing", window_size);
+        m_overlaybuffer = Window::FrameBufferManager.AddFrameBuffer("Overlay Post Processing", window_size);
+        // The framebuffers between effects are added by the graphs when they need them.
     }
 
     void PostProcessing::Exit()
@@ -43,30 +49,21 @@ namespace Editor
         if (!CameraManager::has_main_camera) return;
 
         #pragma region Clearing Framebuffers
-        Window::FrameBufferManager.SetCurrentFrameBuffer("Local Post Processing");
-        OpenGLRenderer::ClearFrameBuffer();
-        Window::FrameBufferManager.SetCurrentFrameBuffer("Global Post Processing");
-        OpenGLRenderer::ClearFrameBuffer();
-        Window::FrameBufferManager.SetCurrentFrameBuffer("Final Post Processing");
+        Window::FrameBufferManager.SetCurrentFrameBuffer(m_localbuffer);
         OpenGLRenderer::ClearFrameBuffer();
-        Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
+        Window::FrameBufferManager.SetCurrentFrameBuffer(m_globalbuffer);
         OpenGLRenderer::ClearFrameBuffer();
-        Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 2");
+        Window::FrameBufferManager.SetCurrentFrameBuffer(m_finalbuffer);
         OpenGLRenderer::ClearFrameBuffer();
-        Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 3");
-        OpenGLRenderer::ClearFrameBuffer();
-        Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 4");
+        Window::FrameBufferManager.SetCurrentFrameBuffer(m_overlaybuffer);
         OpenGLRenderer::ClearFrameBuffer();
         #pragma endregion
 
         #pragma region Update Settings
         // Finalizing Post Processing
         Vector2 windowSize = Vector2((float)FlexEngine::Application::GetCurrentWindow()->GetWidth(), (float)FlexEngine::Application::GetCurrentWindow()->GetHeight());
-        for (auto& element : FlexECS::Scene::GetActiveScene()->CachedQuery<PostProcessingMarker, Transform>())
+        for (auto& element : FlexECS::Scene::GetActiveScene()->ActiveQuery<PostProcessingMarker, Transform>())
         {
-            if (!element.GetComponent<Transform>()->is_active)
-                continue;
-
             auto positionComponent = element.GetComponent<Position>();
             positionComponent->position = Vector3(0, 0, 0);
             auto rotationComponent = element.GetComponent<Rotation>();
@@ -103,6 +100,11 @@ namespace Editor
                 m_globalsettings.blurPasses = blur->blurPasses;
             }
 
+            // The bloom chain blurs with the same values.
+            m_globalsettings.bloomBlurIntensity = m_globalsettings.blurIntensity;
+            m_globalsettings.bloomBlurDistance = m_globalsettings.blurDistance;
+            m_globalsettings.bloomBlurPasses = m_globalsettings.blurPasses;
+
             if (element.HasComponent<PostProcessingChromaticAbberation>())
             {
                 auto chroma = element.GetComponent<PostProcessingChromaticAbberation>();
@@ -176,18 +178,15 @@ namespace Editor
 
     void PostProcessing::ProcessLocalPostProcessing()
     {
-        Window::FrameBufferManager.SetCurrentFrameBuffer("Global Post Processing");
+        Window::FrameBufferManager.SetCurrentFrameBuffer(m_globalbuffer);
 
         auto scene = FlexECS::Scene::GetActiveScene();
 
         FunctionQueue prePostProcessingQueue;
 
         // Render all sprite objects with a z-index lower than the post-process marker's.
-        for (auto& element : scene->CachedQuery<Transform, Sprite, Position, Rotation, Scale>())
+        for (auto& element : scene->ActiveQuery<Transform, Sprite, Position, Rotation, Scale>())
         {
-            if (!element.GetComponent<Transform>()->is_active)
-                continue;
-
             int entityZIndex = element.HasComponent<ZIndex>() ? element.GetComponent<ZIndex>()->z : 0;
 
             if (entityZIndex < postProcessZIndex)
@@ -236,11 +235,8 @@ namespace Editor
         }
 
         // Render all text objects with a z-index lower than the post-process marker's.
-        for (auto& element : scene->CachedQuery<Transform, Text>())
+        for (auto& element : scene->ActiveQuery<Transform, Text>())
         {
-            if (!element.GetComponent<Transform>()->is_active)
-                continue;
-
             int entityZIndex = element.HasComponent<ZIndex>() ? element.GetComponent<ZIndex>()->z : 0;
 
             if (entityZIndex < postProcessZIndex)
@@ -283,6 +279,8 @@ namespace Editor
                     static_cast<Renderer2DText::AlignmentY>(textComponent->alignment.second)
                 };
                 textProps.m_textboxDimensions = textComponent->textboxDimensions;
+                textProps.m_visible_glyphs = textComponent->visible_glyphs;
+                textProps.m_glyph_fade = textComponent->glyph_fade;
                 textProps.m_linespacing = 12.0f;
 
                 prePostProcessingQueue.Insert({ [textProps]() {
@@ -299,13 +297,9 @@ namespace Editor
     {
         if (!CameraManager::has_main_camera) return;
 
-        Window::FrameBufferManager.SetCurrentFrameBuffer("Local Post Processing");
-        GLuint localtexture = Window::FrameBufferManager.GetFrameBuffer("Local Post Processing")->GetColorAttachment();
-        GLuint globaltexture = Window::FrameBufferManager.GetFrameBuffer("Global Post Processing")->GetColorAttachment();
-        GLuint pass1texture = Window::FrameBufferManager.GetFrameBuffer("Pass 1")->GetColorAttachment();
-        GLuint pass2texture = Window::FrameBufferManager.GetFrameBuffer("Pass 2")->GetColorAttachment();
-        GLuint pass3texture = Window::FrameBufferManager.GetFrameBuffer("Pass 3")->GetColorAttachment();
-        GLuint pass4texture = Window::FrameBufferManager.GetFrameBuffer("Pass 4")->GetColorAttachment();
+        Window::FrameBufferManager.SetCurrentFrameBuffer(m_localbuffer);
+        GLuint globaltexture = Window::FrameBufferManager.GetFrameBuffer(m_globalbuffer)->GetColorAttachment();
+        GLuint overlaytexture = Window::FrameBufferManager.GetFrameBuffer(m_overlaybuffer)->GetColorAttachment();
         // Draw Entity in local framebuffer
         if (entity.HasComponent<Sprite>())
         {
@@ -360,6 +354,8 @@ namespace Editor
                 static_cast<Renderer2DText::AlignmentY>(textComponent->alignment.second)
             };
             textProps.m_textboxDimensions = textComponent->textboxDimensions;
+            textProps.m_visible_glyphs = textComponent->visible_glyphs;
+            textProps.m_glyph_fade = textComponent->glyph_fade;
             textProps.m_linespacing = 12.0f;
 
             OpenGLRenderer::DrawTexture2D(*CameraManager::GetMainGameCamera(), textProps);
@@ -369,377 +365,116 @@ namespace Editor
             return;
         }
 
-        // ---------- Bloom Pipeline ---------- (GLOW)
-        if (entity.HasComponent<PostProcessingBloom>()) 
+        // Effects of this entity, applied in the same order as the global ones.
+        // Film Grain and Warp are not needed here (Not going to implement)
+        Renderer2D_GlobalPPSettings settings = m_globalsettings;
+        settings.enableBloom = entity.HasComponent<PostProcessingBloom>();
+        settings.enableGaussianBlur = entity.HasComponent<PostProcessingGaussianBlur>();
+        settings.enableChromaticAberration = entity.HasComponent<PostProcessingChromaticAbberation>();
+        settings.enableColorGrading = entity.HasComponent<PostProcessingColorGrading>();
+        settings.enableVignette = entity.HasComponent<PostProcessingVignette>();
+        settings.enablePixelate = entity.HasComponent<PostProcessingPixelate>();
+        settings.enableFilmGrain = false;
+        settings.enableWarp = false;
+
+        // The bloom chain keeps the generic blur values, the entity's blur only applies to the Gaussian blur.
+        if (settings.enableBloom)
         {
-            // Step 1: Brightness Extraction - isolate bright areas based on the bloom threshold.
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-            OpenGLRenderer::ApplyBrightnessPass(localtexture, entity.GetComponent<PostProcessingBloom>()->threshold);
-
-            // Step 2: Gaussian Blur as part of the bloom chain.
-            GLuint inputTex = pass1texture;
-            bool horizontal = true; // Start with a horizontal blur.
-            for (int i = 0; i < m_globalsettings.blurPasses; ++i) // Uses generic values for this
-            {
-                if (horizontal)
-                    Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 2");
-                else
-                    Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 3");
-                OpenGLRenderer::ApplyGaussianBlur(inputTex, m_globalsettings.blurDistance, m_globalsettings.blurIntensity, horizontal); // Uses generic values for this
-                inputTex = horizontal ? pass2texture : pass3texture;
-                horizontal = !horizontal;
-            }
-
-            // Step 3: Final Bloom Composition - combine the blurred highlights back with the original scene.
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-            OpenGLRenderer::ApplyBloomFinalComposition(localtexture, pass2texture, pass3texture, entity.GetComponent<PostProcessingBloom>()->intensity, entity.GetComponent<PostProcessingBloom>()->radius);
-
-            // Step 4: Update Local FrameBuffer
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Local Post Processing");
-            ReplicateFrameBufferAttachment(pass1texture);
-
-            // Step 6: Reset
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-            OpenGLRenderer::ClearFrameBuffer();
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 2");
-            OpenGLRenderer::ClearFrameBuffer();
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 3");
-            OpenGLRenderer::ClearFrameBuffer();
+            auto bloom = entity.GetComponent<PostProcessingBloom>();
+            settings.bloomThreshold = bloom->threshold;
+            settings.bloomIntensity = bloom->intensity;
+            settings.bloomRadius = bloom->radius;
         }
 
-        // Apply a full-screen Gaussian blur on the scene if enabled. (Avoid using, looks weird)
-        if (entity.HasComponent<PostProcessingGaussianBlur>())
+        if (settings.enableGaussianBlur)
         {
-            GLuint inputTex = localtexture;
-            bool horizontal = true; // Start with a horizontal blur.
-            for (int i = 0; i < entity.GetComponent<PostProcessingGaussianBlur>()->blurPasses; ++i)
-            {
-                if (horizontal)
-                    Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-                else
-                    Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 2");
-                OpenGLRenderer::ApplyGaussianBlur(inputTex, entity.GetComponent<PostProcessingGaussianBlur>()->distance, 
-                    entity.GetComponent<PostProcessingGaussianBlur>()->intensity, horizontal);
-                inputTex = horizontal ? pass1texture : pass2texture;
-                horizontal = !horizontal;
-            }
-
-            // Merge results
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Local Post Processing");
-            OpenGLRenderer::ApplyBlurFinalComposition(pass1texture, pass2texture);
-
-            // Reset frame buffers
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-            OpenGLRenderer::ClearFrameBuffer();
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 2");
-            OpenGLRenderer::ClearFrameBuffer();
+            auto blur = entity.GetComponent<PostProcessingGaussianBlur>();
+            settings.blurIntensity = blur->intensity;
+            settings.blurDistance = blur->distance;
+            settings.blurPasses = blur->blurPasses;
         }
 
-        // Chromatic Aberration: apply color separation if enabled. (Glitching effect)
-        if (entity.HasComponent<PostProcessingChromaticAbberation>())
+        if (settings.enableChromaticAberration)
         {
-            GLuint inputTex = localtexture;
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-            OpenGLRenderer::ApplyChromaticAberration(
-                inputTex,
-                entity.GetComponent<PostProcessingChromaticAbberation>()->intensity,
-                entity.GetComponent<PostProcessingChromaticAbberation>()->redOffset,
-                entity.GetComponent<PostProcessingChromaticAbberation>()->greenOffset,
-                entity.GetComponent<PostProcessingChromaticAbberation>()->blueOffset,
-                entity.GetComponent<PostProcessingChromaticAbberation>()->edgeRadius,
-                entity.GetComponent<PostProcessingChromaticAbberation>()->edgeSoftness
-            );
-
-            // Update Local FrameBuffer
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Local Post Processing");
-            ReplicateFrameBufferAttachment(pass1texture);
-
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-            OpenGLRenderer::ClearFrameBuffer();
+            auto chroma = entity.GetComponent<PostProcessingChromaticAbberation>();
+            settings.chromaIntensity = chroma->intensity;
+            settings.chromaRedOffset = chroma->redOffset;
+            settings.chromaGreenOffset = chroma->greenOffset;
+            settings.chromaBlueOffset = chroma->blueOffset;
+            settings.chromaEdgeRadius = chroma->edgeRadius;
+            settings.chromaEdgeSoftness = chroma->edgeSoftness;
         }
 
-        // Color Grading / Tone Mapping: adjust brightness, contrast, and saturation. (Not ideal, supposed to use color add to sprite, use vignette instead for brightness)
-        if (entity.HasComponent<PostProcessingColorGrading>())
+        if (settings.enableColorGrading)
         {
-            GLuint inputTex = localtexture;
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-            OpenGLRenderer::ApplyColorGrading(
-                inputTex,
-                entity.GetComponent<PostProcessingColorGrading>()->brightness,
-                entity.GetComponent<PostProcessingColorGrading>()->contrast,
-                entity.GetComponent<PostProcessingColorGrading>()->saturation
-            );
-
-            // Update Local FrameBuffer
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Local Post Processing");
-            ReplicateFrameBufferAttachment(pass1texture);
-
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-            OpenGLRenderer::ClearFrameBuffer();
+            auto colorGrade = entity.GetComponent<PostProcessingColorGrading>();
+            settings.colorBrightness = colorGrade->brightness;
+            settings.colorContrast = colorGrade->contrast;
+            settings.colorSaturation = colorGrade->saturation;
         }
 
-        // Vignette: darken edges to draw attention to the center. (Make brighter or darker)
-        if (entity.HasComponent<PostProcessingVignette>()) 
+        if (settings.enableVignette)
         {
-            GLuint inputTex = localtexture;
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-            OpenGLRenderer::ApplyVignette(
-                inputTex,
-                entity.GetComponent<PostProcessingVignette>()->intensity,
-                entity.GetComponent<PostProcessingVignette>()->radius,
-                entity.GetComponent<PostProcessingVignette>()->softness
-            );
-
-            // Update Local FrameBuffer
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Local Post Processing");
-            ReplicateFrameBufferAttachment(pass1texture);
-
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-            OpenGLRenderer::ClearFrameBuffer();
+            auto vignette = entity.GetComponent<PostProcessingVignette>();
+            settings.vignetteIntensity = vignette->intensity;
+            settings.vignetteRadius = vignette->radius;
+            settings.vignetteSoftness = vignette->softness;
         }
 
-        // Pixelate: optionally apply a pixelation effect as a final overlay. (Pixelate)
-        if (entity.HasComponent<PostProcessingPixelate>()) 
+        if (settings.enablePixelate)
         {
-            GLuint inputTex = localtexture;
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-            OpenGLRenderer::ApplyPixelate(
-                inputTex,
-                (float)entity.GetComponent<PostProcessingPixelate>()->pixelWidth,
-                (float)entity.GetComponent<PostProcessingPixelate>()->pixelHeight
-            );
-
-            // Update Local FrameBuffer
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Local Post Processing");
-            ReplicateFrameBufferAttachment(pass1texture);
-
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-            OpenGLRenderer::ClearFrameBuffer();
+            auto pixelate = entity.GetComponent<PostProcessingPixelate>();
+            settings.pixelWidth = pixelate->pixelWidth;
+            settings.pixelHeight = pixelate->pixelHeight;
         }
 
-        // Film Grain is not needed here (Not going to implement)
-        
+        // Only recompiles when this entity has different effects from the last one.
+        m_localgraph.Compile(PostProcessGraph::Describe(settings), false);
+        OpenGLFrameBufferManager::Handle result = m_localgraph.Execute(
+            Window::FrameBufferManager, m_transientbuffers,
+            m_localbuffer, OpenGLFrameBufferManager::InvalidHandle, settings
+        );
+        GLuint resulttexture = Window::FrameBufferManager.GetFrameBuffer(result)->GetColorAttachment();
+
         // Merge results from local frame buffer to global frame buffer
-        Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 4");
-        OpenGLRenderer::ApplyOverlay(globaltexture, localtexture);
-        Window::FrameBufferManager.SetCurrentFrameBuffer("Global Post Processing");
-        ReplicateFrameBufferAttachment(pass4texture);
+        Window::FrameBufferManager.SetCurrentFrameBuffer(m_overlaybuffer);
+        OpenGLRenderer::ApplyOverlay(globaltexture, resulttexture);
+        Window::FrameBufferManager.SetCurrentFrameBuffer(m_globalbuffer);
+        ReplicateFrameBufferAttachment(overlaytexture);
 
         // Clear local frame buffer
-        Window::FrameBufferManager.SetCurrentFrameBuffer("Local Post Processing");
+        Window::FrameBufferManager.SetCurrentFrameBuffer(m_localbuffer);
         OpenGLRenderer::ClearFrameBuffer();
-        Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 4");
+        Window::FrameBufferManager.SetCurrentFrameBuffer(m_overlaybuffer);
         OpenGLRenderer::ClearFrameBuffer();
-        Window::FrameBufferManager.SetCurrentFrameBuffer("Global Post Processing");
+        Window::FrameBufferManager.SetCurrentFrameBuffer(m_globalbuffer);
     }
 
     void PostProcessing::DrawGlobalPostProcessing()
     {
         if (!CameraManager::has_main_camera) return;
 
-        Window::FrameBufferManager.SetCurrentFrameBuffer("Global Post Processing");
-        GLuint globaltexture = Window::FrameBufferManager.GetFrameBuffer("Global Post Processing")->GetColorAttachment();
-        GLuint pass1texture = Window::FrameBufferManager.GetFrameBuffer("Pass 1")->GetColorAttachment();
-        GLuint pass2texture = Window::FrameBufferManager.GetFrameBuffer("Pass 2")->GetColorAttachment();
-        GLuint pass3texture = Window::FrameBufferManager.GetFrameBuffer("Pass 3")->GetColorAttachment();
-        // ---------- Bloom Pipeline ----------
-        if (m_globalsettings.enableBloom)
-        {
-            // Step 1: Brightness Extraction - isolate bright areas based on the bloom threshold.
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-            OpenGLRenderer::ApplyBrightnessPass(globaltexture, m_globalsettings.bloomThreshold);
-
-            // Step 2: Gaussian Blur as part of the bloom chain.
-            GLuint inputTex = pass1texture;
-            bool horizontal = true; // Start with a horizontal blur.
-            for (int i = 0; i < m_globalsettings.blurPasses; ++i)
-            {
-                if (horizontal)
-                    Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 2");
-                else
-                    Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 3");
-                OpenGLRenderer::ApplyGaussianBlur(inputTex, m_globalsettings.blurDistance, m_globalsettings.blurIntensity, horizontal);
-                inputTex = horizontal ? pass2texture : pass3texture;
-                horizontal = !horizontal;
-            }
-
-            // Step 3: Final Bloom Composition - combine the blurred highlights back with the original scene.
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-            OpenGLRenderer::ApplyBloomFinalComposition(globaltexture, pass2texture, pass3texture, m_globalsettings.bloomIntensity, m_globalsettings.bloomRadius);
-
-            // Step 4: Update Global FrameBuffer
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Global Post Processing");
-            ReplicateFrameBufferAttachment(pass1texture);
-
-            // Step 6: Reset
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-            OpenGLRenderer::ClearFrameBuffer();
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 2");
-            OpenGLRenderer::ClearFrameBuffer();
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 3");
-            OpenGLRenderer::ClearFrameBuffer();
-        }
-
-        // Apply a full-screen Gaussian blur on the scene if enabled.
-        if (m_globalsettings.enableGaussianBlur)
-        {
-            GLuint inputTex = globaltexture;
-            bool horizontal = true; // Start with a horizontal blur.
-            for (int i = 0; i < m_globalsettings.blurPasses; ++i)
-            {
-                if (horizontal)
-                    Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-                else
-                    Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 2");
-                OpenGLRenderer::ApplyGaussianBlur(inputTex, m_globalsettings.blurDistance, m_globalsettings.blurIntensity, horizontal);
-                inputTex = horizontal ? pass1texture : pass2texture;
-                horizontal = !horizontal;
-            }
-
-            // Merge results
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Global Post Processing");
-            OpenGLRenderer::ApplyBlurFinalComposition(pass1texture, pass2texture);
-
-            // Reset frame buffers
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-            OpenGLRenderer::ClearFrameBuffer();
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 2");
-            OpenGLRenderer::ClearFrameBuffer();
-        }
-
-        // Chromatic Aberration: apply color separation if enabled.
-        if (m_globalsettings.enableChromaticAberration)
-        {
-            GLuint inputTex = globaltexture;
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-            OpenGLRenderer::ApplyChromaticAberration(
-                inputTex,
-                m_globalsettings.chromaIntensity,
-                m_globalsettings.chromaRedOffset,
-                m_globalsettings.chromaGreenOffset,
-                m_globalsettings.chromaBlueOffset,
-                m_globalsettings.chromaEdgeRadius,
-                m_globalsettings.chromaEdgeSoftness
-            );
-
-            // Update Global FrameBuffer
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Global Post Processing");
-            ReplicateFrameBufferAttachment(pass1texture);
-
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-            OpenGLRenderer::ClearFrameBuffer();
-        }
-
-        // Color Grading / Tone Mapping: adjust brightness, contrast, and saturation.
-        if (m_globalsettings.enableColorGrading)
-        {
-            GLuint inputTex = globaltexture;
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-            OpenGLRenderer::ApplyColorGrading(
-                inputTex,
-                m_globalsettings.colorBrightness,
-                m_globalsettings.colorContrast,
-                m_globalsettings.colorSaturation
-            );
-
-            // Update Global FrameBuffer
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Global Post Processing");
-            ReplicateFrameBufferAttachment(pass1texture);
+        // Only recompiles when an effect is toggled or a pass count changes,
+        // the last pass draws straight into the final post processing buffer.
+        m_globalgraph.Compile(PostProcessGraph::Describe(m_globalsettings), true);
+        OpenGLFrameBufferManager::Handle result = m_globalgraph.Execute(
+            Window::FrameBufferManager, m_transientbuffers,
+            m_globalbuffer, m_finalbuffer, m_globalsettings
+        );
 
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-            OpenGLRenderer::ClearFrameBuffer();
-        }
-
-        // Vignette: darken edges to draw attention to the center.
-        if (m_globalsettings.enableVignette)
+        // No effects enabled, draw to final post processing buffer
+        if (result != m_finalbuffer)
         {
-            GLuint inputTex = globaltexture;
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-            OpenGLRenderer::ApplyVignette(
-                inputTex,
-                m_globalsettings.vignetteIntensity,
-                m_globalsettings.vignetteRadius,
-                m_globalsettings.vignetteSoftness
-            );
-
-            // Update Global FrameBuffer
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Global Post Processing");
-            ReplicateFrameBufferAttachment(pass1texture);
-
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-            OpenGLRenderer::ClearFrameBuffer();
+            Window::FrameBufferManager.SetCurrentFrameBuffer(m_finalbuffer);
+            ReplicateFrameBufferAttachment(Window::FrameBufferManager.GetFrameBuffer(result)->GetColorAttachment());
         }
-
-        // Film Grain: overlay a subtle noise effect.
-        if (m_globalsettings.enableFilmGrain)
-        {
-            GLuint inputTex = globaltexture;
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-            OpenGLRenderer::ApplyFilmGrain(
-                inputTex,
-                m_globalsettings.filmGrainIntensity,
-                m_globalsettings.filmGrainSize,
-                m_globalsettings.filmGrainAnimate
-            );
-
-            // Update Global FrameBuffer
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Global Post Processing");
-            ReplicateFrameBufferAttachment(pass1texture);
-
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-            OpenGLRenderer::ClearFrameBuffer();
-        }
-
-        // Pixelate: optionally apply a pixelation effect as a final overlay.
-        if (m_globalsettings.enablePixelate)
-        {
-            GLuint inputTex = globaltexture;
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-            OpenGLRenderer::ApplyPixelate(
-                inputTex,
-                (float)m_globalsettings.pixelWidth,
-                (float)m_globalsettings.pixelHeight
-            );
-
-            // Update Global FrameBuffer
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Global Post Processing");
-            ReplicateFrameBufferAttachment(pass1texture);
-
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-            OpenGLRenderer::ClearFrameBuffer();
-        }
-
-        // Warp: add a warp effect on the overlay
-        if (m_globalsettings.enableWarp)
-        {
-            GLuint inputTex = globaltexture;
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-            OpenGLRenderer::ApplyWarpEffect(
-                inputTex,
-                m_globalsettings.warpStrength,
-                m_globalsettings.warpRadius
-            );
-
-            // Update Global FrameBuffer
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Global Post Processing");
-            ReplicateFrameBufferAttachment(pass1texture);
-
-            Window::FrameBufferManager.SetCurrentFrameBuffer("Pass 1");
-            OpenGLRenderer::ClearFrameBuffer();
-        }
-
-        // Draw to final post processing buffer
-        Window::FrameBufferManager.SetCurrentFrameBuffer("Final Post Processing");
-        ReplicateFrameBufferAttachment(globaltexture);
     }
 
     void PostProcessing::ReplicateFrameBufferAttachment(GLuint texture)
     {
         Vector2 windowSize = Vector2((float)FlexEngine::Application::GetCurrentWindow()->GetWidth(), (float)FlexEngine::Application::GetCurrentWindow()->GetHeight());
-        for (auto& element : FlexECS::Scene::GetActiveScene()->CachedQuery<PostProcessingMarker>())
+        for (auto& element : FlexECS::Scene::GetActiveScene()->ActiveQuery<PostProcessingMarker>())
         {
-            if (!element.GetComponent<Transform>()->is_active)
-                continue;
             Matrix4x4 transform = element.GetComponent<Transform>()->transform;
 
             OpenGLRenderer::DrawTexture2D(texture, transform, windowSize);
@@ -44,6 +44,16 @@ namespace Editor
 
         static Renderer2D_GlobalPPSettings m_globalsettings;
         static int postProcessZIndex;
+
+        // Effect chains, compiled when the enabled effects change.
+        static PostProcessGraph m_localgraph;
+        static PostProcessGraph m_globalgraph;
+        static std::vector<OpenGLFrameBufferManager::Handle> m_transientbuffers; // Shared by both graphs, they never run at the same time.
+
+        static OpenGLFrameBufferManager::Handle m_localbuffer;
+        static OpenGLFrameBufferManager::Handle m_globalbuffer;
+        static OpenGLFrameBufferManager::Handle m_finalbuffer;
+        static OpenGLFrameBufferManager::Handle m_overlaybuffer;
     };
 
 } // namespace Game
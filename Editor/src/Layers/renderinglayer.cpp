@@ -42,6 +42,8 @@ namespace Editor
 
     void RenderingLayer::Update()
     {
+        FLX_MEMORY_TAG(Renderer);
+
         OpenGLFrameBuffer::Unbind();
 
         if (!CameraManager::has_main_camera) return;
@@ -55,6 +57,10 @@ namespace Editor
 
         #pragma region Transformation Calculations
         // Update Transform component to obtain the true world representation of the entity
+        // The scene view's picking index is refreshed here as well since the transform is already at hand
+        SceneView* scene_view = Editor::GetInstance().GetPanel<SceneView>();
+        SpatialIndex& picking_index = scene_view->GetPickingIndex();
+        picking_index.BeginSync();
         for (auto& element : FlexECS::Scene::GetActiveScene()->CachedQuery<Sprite, Position, Rotation, Scale, Transform>())
         {
             auto sprite = element.GetComponent<Sprite>();
@@ -67,22 +73,22 @@ namespace Editor
             Matrix4x4 model = Matrix4x4::Identity;
 
             // However, spritesheets have a different scale...
-            if (element.HasComponent<Animator>() && FLX_STRING_GET(element.GetComponent<Animator>()->spritesheet_handle) != "")
+            const AnimationClip* clip = nullptr;
+            if (element.HasComponent<Animator>())
             {
                 auto& animator = *element.GetComponent<Animator>();
-                auto& asset_spritesheet = FLX_ASSET_GET(Asset::Spritesheet, FLX_STRING_GET(animator.spritesheet_handle));
-                auto& sprite_info = FLX_ASSET_GET(Asset::Texture, asset_spritesheet.texture);
+                clip = AnimatorSystem::GetClip(animator.spritesheet_asset, animator.spritesheet_handle);
+            }
 
-                model.Scale(Vector3(static_cast<float>(sprite_info.GetWidth()) / asset_spritesheet.columns,
-                    static_cast<float>(sprite_info.GetHeight()) / asset_spritesheet.rows,
-                    1));
+            if (clip)
+            {
+                model.Scale(Vector3(clip->frame_size.x, clip->frame_size.y, 1));
 
                 sprite->model_matrix = model;
             }
-            else if (FLX_STRING_GET(sprite->sprite_handle) != "")
+            else if (auto sprite_info = FLX_ASSET_GET_CACHED(sprite->sprite_asset, sprite->sprite_handle))
             {
-                auto& sprite_info = FLX_ASSET_GET(Asset::Texture, FLX_STRING_GET(sprite->sprite_handle));
-                model.Scale(Vector3(static_cast<float>(sprite_info.GetWidth()), static_cast<float>(sprite_info.GetHeight()), 1));
+                model.Scale(Vector3(static_cast<float>(sprite_info->GetWidth()), static_cast<float>(sprite_info->GetHeight()), 1));
                 sprite->model_matrix = model;
             }
 
@@ -91,7 +97,10 @@ namespace Editor
             Matrix4x4 scale_matrix = Matrix4x4::Scale(Matrix4x4::Identity, scale);
 
             transform->transform = translation_matrix * rotation_matrix * scale_matrix * sprite->model_matrix;
+
+            scene_view->UpdatePickingBounds(element, transform->transform, position.z);
         }
+        picking_index.EndSync();
         
 
         for (auto& element : FlexECS::Scene::GetActiveScene()->CachedQuery<VideoPlayer, Position, Rotation, Scale, Transform>())
@@ -102,14 +111,14 @@ namespace Editor
           auto scale = element.GetComponent<Scale>()->scale;
           auto transform = element.GetComponent<Transform>();
 
-          if (FLX_STRING_GET(video->video_file) == "") continue;
+          auto video_info = FLX_ASSET_GET_CACHED(video->video_asset, video->video_file);
+          if (!video_info) continue;
 
           // "Model scale" in this case refers to the scale of the object itself...
           Matrix4x4 model = Matrix4x4::Identity;
 
-          auto& video_info = FLX_ASSET_GET(VideoDecoder, FLX_STRING_GET(video->video_file));
-          model.Scale(Vector3(static_cast<float>(video_info.GetWidth()),
-            static_cast<float>(video_info.GetHeight()),
+          model.Scale(Vector3(static_cast<float>(video_info->GetWidth()),
+            static_cast<float>(video_info->GetHeight()),
             1.f));
 
           Matrix4x4 translation_matrix = Matrix4x4::Translate(Matrix4x4::Identity, position);
@@ -122,82 +131,23 @@ namespace Editor
 
         #pragma region Animator System
 
-        // animator system updates the time for all animators
-        // TODO: move this to a different layer
-        for (auto& element : FlexECS::Scene::GetActiveScene()->CachedQuery<Animator, Sprite>())
-        {
-            Animator& animator = *element.GetComponent<Animator>();
-
-            if (!animator.should_play || FLX_STRING_GET(element.GetComponent<Animator>()->spritesheet_handle) == "") continue;
-
-            animator.frame_time += Application::GetCurrentWindow()->GetFramerateController().GetDeltaTime();
-
-            auto& asset_spritesheet = FLX_ASSET_GET(Asset::Spritesheet, FLX_STRING_GET(animator.spritesheet_handle));
-
-            // calculate the total frames
-            if (animator.total_frames != asset_spritesheet.columns * asset_spritesheet.rows)
-                animator.total_frames = asset_spritesheet.columns * asset_spritesheet.rows;
-
-            // TODO: debug why this is happening
-            if (animator.current_frame >= asset_spritesheet.frame_times.size()) animator.current_frame = 0;
-
-            // get the current frame time
-            animator.current_frame_time = asset_spritesheet.frame_times[animator.current_frame];
-
-            // handling of animations
-            // move to the next frame
-            // loop if looping
-            // stop if not looping
-            // return to default and continue looping if return_to_default is true
-            if (animator.frame_time >= animator.current_frame_time)
-            {
-                // skip frames if needed
-                while (animator.frame_time >= animator.current_frame_time)
-                {
-                    animator.current_frame++;
-                    animator.frame_time -= animator.current_frame_time;
-                }
-
-                // loop
-                if (animator.is_looping && animator.current_frame >= animator.total_frames)
-                {
-                    animator.current_frame = 0;
-                }
-
-                // not looping
-                if (!animator.is_looping && animator.current_frame >= animator.total_frames)
-                {
-                    // return to default and continue looping
-                    if (animator.return_to_default)
-                    {
-                        animator.spritesheet_handle = animator.default_spritesheet_handle;
-                        animator.is_looping = true;
-                    }
-                    // stop at the last frame
-                    else
-                    {
-                        animator.current_frame = animator.total_frames - 1;
-                        animator.should_play = false;
-                    }
-                }
-            }
-        }
+        // advances every animator in one batch and writes the frame and its uv into the animator
+        AnimatorSystem::Update(Application::GetCurrentWindow()->GetFramerateController().GetDeltaTime());
 
         #pragma endregion
 
         PostProcessing::Update();
 
-        FunctionQueue editor_queue, game_queue;
+        // the queues are flushed every frame, keeping them around reuses their storage
+        static FunctionQueue editor_queue, game_queue;
 
-        if (!FlexPrefs::GetBool("editor.batching"))
+        if (!EngineSettings::editor_batching.Get())
         {
             #pragma region Sprite Renderer System
 
             // render all sprites
-            for (auto& element : FlexECS::Scene::GetActiveScene()->CachedQuery<Transform, Sprite, Position, Rotation, Scale>())
+            for (auto& element : FlexECS::Scene::GetActiveScene()->ActiveQuery<Transform, Sprite, Position, Rotation, Scale>())
             {
-                if (!element.GetComponent<Transform>()->is_active) continue;
-
                 Sprite& sprite = *element.GetComponent<Sprite>();
 
                 Renderer2DProps props;
@@ -234,10 +184,8 @@ namespace Editor
             #pragma region Text Renderer System
 
             // Text
-            for (auto& element : FlexECS::Scene::GetActiveScene()->CachedQuery<Text>())
+            for (auto& element : FlexECS::Scene::GetActiveScene()->ActiveQuery<Text>())
             {
-                if (!element.GetComponent<Transform>()->is_active) continue;
-
                 const auto textComponent = element.GetComponent<Text>();
 
                 Renderer2DText sample;
@@ -262,6 +210,8 @@ namespace Editor
                 sample.m_alignment = std::pair{ static_cast<Renderer2DText::AlignmentX>(textComponent->alignment.first),
                                                 static_cast<Renderer2DText::AlignmentY>(textComponent->alignment.second) };
                 sample.m_textboxDimensions = textComponent->textboxDimensions;
+                sample.m_visible_glyphs = textComponent->visible_glyphs;
+                sample.m_glyph_fade = textComponent->glyph_fade;
 
                 game_queue.Insert({ [sample]() {OpenGLRenderer::DrawTexture2D(*CameraManager::GetMainGameCamera(), sample); }, "", index });
                 editor_queue.Insert({ [sample]() {OpenGLRenderer::DrawTexture2D(Editor::GetInstance().m_editorCamera, sample); }, "", index });
@@ -273,11 +223,8 @@ namespace Editor
             // Insert the global post-processing draw call into the game queue.
             auto ppIndex = PostProcessing::GetPostProcessZIndex();
             Vector2 windowSize = Vector2((float)FlexEngine::Application::GetCurrentWindow()->GetWidth(), (float)FlexEngine::Application::GetCurrentWindow()->GetHeight());
-            for (auto& element : FlexECS::Scene::GetActiveScene()->CachedQuery<PostProcessingMarker>())
+            for (auto& element : FlexECS::Scene::GetActiveScene()->ActiveQuery<PostProcessingMarker>())
             {
-                if (!element.GetComponent<Transform>()->is_active)
-                    continue;
-
                 Window::FrameBufferManager.SetCurrentFrameBuffer("Final Post Processing");
                 GLuint texture = Window::FrameBufferManager.GetCurrentFrameBuffer()->GetColorAttachment();
                 Matrix4x4 transform = element.GetComponent<Transform>()->transform;
@@ -297,22 +244,19 @@ namespace Editor
         {
             #pragma region Batch Sprite Renderer System
 
-            std::vector<std::pair<std::string, FlexECS::Entity>> sortedEntities;
+            // the keys point into the scene string storage, which is not modified while batching
+            FrameVector<std::pair<std::string_view, FlexECS::Entity>> sortedEntities;
             //Sprite
-            for (auto& entity : FlexECS::Scene::GetActiveScene()->CachedQuery<Transform, Sprite, Position, Rotation, Scale>())
+            for (auto& entity : FlexECS::Scene::GetActiveScene()->ActiveQuery<Transform, Sprite, Position, Rotation, Scale>())
             {
-                if (!entity.GetComponent<Transform>()->is_active) continue;
-
                 if (entity.HasComponent<Animator>())
                     sortedEntities.emplace_back(FLX_STRING_GET(entity.GetComponent<Animator>()->spritesheet_handle), entity);
                 else
                     sortedEntities.emplace_back(FLX_STRING_GET(entity.GetComponent<Sprite>()->sprite_handle), entity);
             }
             //Text
-            for (auto& entity : FlexECS::Scene::GetActiveScene()->CachedQuery<Transform, Text, Position, Rotation, Scale>())
+            for (auto& entity : FlexECS::Scene::GetActiveScene()->ActiveQuery<Transform, Text, Position, Rotation, Scale>())
             {
-                if (!entity.GetComponent<Transform>()->is_active) continue;
-
                 sortedEntities.emplace_back(FLX_STRING_GET(entity.GetComponent<Text>()->fonttype), entity);
             }
 
@@ -326,7 +270,7 @@ namespace Editor
 
             //QUEUE
             Renderer2DSpriteBatch currentBatch;
-            std::string currentTexture = "";
+            std::string_view currentTexture = "";
 
             for (auto& [batchKey, entity] : sortedEntities)
             {
@@ -365,6 +309,8 @@ namespace Editor
                         sample.m_alignment = std::pair{ static_cast<Renderer2DText::AlignmentX>(textComponent->alignment.first),
                                                         static_cast<Renderer2DText::AlignmentY>(textComponent->alignment.second) };
                         sample.m_textboxDimensions = textComponent->textboxDimensions;
+                        sample.m_visible_glyphs = textComponent->visible_glyphs;
+                        sample.m_glyph_fade = textComponent->glyph_fade;
                         sample.m_linespacing = 12.0f;
                         game_queue.Insert({ [sample]() {OpenGLRenderer::DrawTexture2D(*CameraManager::GetMainGameCamera(), sample); }, "", index });
                         editor_queue.Insert({ [sample]() {OpenGLRenderer::DrawTexture2D(Editor::GetInstance().m_editorCamera, sample); }, "", index });
@@ -398,12 +344,12 @@ namespace Editor
     }
 
     #pragma region Batch helper
-    void RenderingLayer::AddBatchToQueue(FunctionQueue& queue, const std::string& texture, const Renderer2DSpriteBatch& batch, bool isEditor)
+    void RenderingLayer::AddBatchToQueue(FunctionQueue& queue, std::string_view texture, const Renderer2DSpriteBatch& batch, bool isEditor)
     {
         if (!batch.m_zindex.empty())
         {
             Renderer2DProps props;
-            props.asset = texture;
+            props.asset = std::string(texture);
             //props.vbo_id = vbo_id;
             // Send camera data as parameter instead of ID.
             queue.Insert({ [props, batch, isEditor]() { OpenGLRenderer::DrawBatchTexture2D(props, batch, (isEditor ? Editor::GetInstance().m_editorCamera : *CameraManager::GetMainGameCamera())); }, "", batch.m_zindex.back() });
@@ -433,8 +379,7 @@ namespace Editor
 
             //batch.m_colorAddData.push_back(colorAdd + anim->color_to_add);
             //batch.m_colorMultiplyData.push_back(colorMul * anim->color_to_multiply);
-            auto& asset_spritesheet = FLX_ASSET_GET(Asset::Spritesheet, FLX_STRING_GET(entity.GetComponent<Animator>()->spritesheet_handle));
-            batch.m_UVmap.push_back(asset_spritesheet.GetUV(anim->current_frame)); //No choice, must do here, cannot be in engine
+            batch.m_UVmap.push_back(anim->current_uv); // written by the animator system
         }
         else
         {
@@ -42,7 +42,7 @@ namespace Editor
     virtual void OnDetach() override;
     virtual void Update() override;
 
-    void AddBatchToQueue(FunctionQueue& queue, const std::string& texture, const Renderer2DSpriteBatch& batch, bool isEditor);
+    void AddBatchToQueue(FunctionQueue& queue, std::string_view texture, const Renderer2DSpriteBatch& batch, bool isEditor);
     void AddEntityToBatch(FlexECS::Entity& entity, Renderer2DSpriteBatch& batch);
   };
 
@@ -68,22 +68,7 @@ namespace Editor
     if (!is_scripting_dll_loaded) return;
 
     // call stop for all scripts
-    for (FlexECS::Entity& entity : FlexECS::Scene::GetActiveScene()->CachedQuery<Script>())
-    {
-      auto& script_component = *entity.GetComponent<Script>();
-      auto script = ScriptRegistry::GetScript(FLX_STRING_GET(script_component.script_name));
-
-      // guard
-      if (!script)
-      {
-        Log::Warning("Script: " + FLX_STRING_GET(script_component.script_name) + " does not exist.");
-        continue;
-      }
-
-      // always remember to set the context before calling functions
-      script->Internal_SetContext(entity);
-      script->Stop();
-    }
+    ScriptRegistry::StopScripts();
 
     // unload the scripting DLL
     if (hmodule_scripting) FreeLibrary(hmodule_scripting);
@@ -177,83 +162,8 @@ namespace Editor
 
     Profiler::StartCounter("Scripting");
 
-    // process all scripts, multiple of the same script can exist
-    // order is not guaranteed and should never be
-    // call awake, start, update, and stop
-    for (FlexECS::Entity& entity : FlexECS::Scene::GetActiveScene()->CachedQuery<Transform, Script>())
-    {
-      Transform& transform = *entity.GetComponent<Transform>();
-      if (!transform.is_active) continue; // skip non active entities
-
-      auto& script_component = *entity.GetComponent<Script>();
-      auto script = ScriptRegistry::GetScript(FLX_STRING_GET(script_component.script_name));
-
-      // guard
-      if (!script)
-      {
-        Log::Warning("Script: " + FLX_STRING_GET(script_component.script_name) + " does not exist.");
-        continue;
-      }
-
-      // awake is called once when the script is created
-      if (!script_component.is_awake)
-      {
-        // always remember to set the context before calling functions
-        script->Internal_SetContext(entity);
-        script->Awake();
-        script_component.is_awake = true;
-      }
-
-      // start is called once when the object is enabled for the first time
-      if (transform.is_active && !script_component.is_start && script_component.is_awake)
-      {
-        // always remember to set the context before calling functions
-        script->Internal_SetContext(entity);
-        script->Start();
-        script_component.is_start = true;
-      }
-
-      // update is called every frame for awake and start objects
-      if (script_component.is_start && script_component.is_awake)
-      {
-        // always remember to set the context before calling functions
-        script->Internal_SetContext(entity);
-        script->Update();
-
-        // for debugging
-        ScriptRegistry::Internal_Debug_LogScript(FLX_STRING_GET(*entity.GetComponent<EntityName>()), script->GetName());
-      }
-
-      if (!transform.is_active && script_component.is_start)
-      {
-        // always remember to set the context before calling functions
-        script->Internal_SetContext(entity);
-        script->Stop();
-        script_component.is_start = false;
-      }
-    }
-
-    // process callback for scripts
-    for (FlexECS::Entity& entity : FlexECS::Scene::GetActiveScene()->CachedQuery<Transform, Script, BoundingBox2D>())
-    {
-      auto& bb = *entity.GetComponent<BoundingBox2D>();
-
-      if (bb.is_mouse_over || bb.is_mouse_over_cached)
-      {
-        auto& script_name = FLX_STRING_GET(entity.GetComponent<Script>()->script_name);
-        auto script = ScriptRegistry::GetScript(script_name);
-        FLX_NULLPTR_ASSERT(script, "An expected script is missing from the script registry: " + script_name);
-
-        script->Internal_SetContext(entity);
-
-        if (bb.is_mouse_over && !bb.is_mouse_over_cached)
-          script->OnMouseEnter();
-        else if (bb.is_mouse_over)
-          script->OnMouseStay();
-        else if (!bb.is_mouse_over && bb.is_mouse_over_cached)
-          script->OnMouseExit();
-      }
-    }
+    // awake, start, batched update and mouse callbacks, timed per script in the profiler
+    ScriptRegistry::UpdateScripts();
     
     Profiler::EndCounter("Scripting");
   }
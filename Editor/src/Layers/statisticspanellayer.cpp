@@ -93,6 +93,22 @@ namespace Editor
             ImGui::TreePop();
           }
 
+          if (ImGui::TreeNode("Frame Times"))
+          {
+            auto& frameratecontroller = window->GetFramerateController();
+            FrameTimeHistogram::Stats stats = frameratecontroller.GetFrameTimeHistogram().GetStats();
+            ImGui::Text("Frame Pacing: %s", frameratecontroller.IsFramePacing() ? "On" : "Off");
+            ImGui::Text("Last %llu Frames", static_cast<unsigned long long>(stats.frames));
+            ImGui::Text("  Average: %.3f ms", stats.average_ms);
+            ImGui::Text("  p50: %.3f ms", stats.p50_ms);
+            ImGui::Text("  p95: %.3f ms", stats.p95_ms);
+            ImGui::Text("  p99: %.3f ms", stats.p99_ms);
+            ImGui::Text("  Max: %.3f ms", stats.max_ms);
+            ImGui::Text("  Spikes (> %.1f ms): %llu", frameratecontroller.GetFrameTimeHistogram().GetSpikeThreshold(), static_cast<unsigned long long>(stats.spikes));
+
+            ImGui::TreePop();
+          }
+
           if (ImGui::TreeNode("Layers"))
           {
             auto& layerstack = window->GetLayerStack();
@@ -122,6 +138,91 @@ namespace Editor
 
     #pragma endregion
 
+    #pragma region Memory
+
+    if (ImGui::CollapsingHeader("Memory", tree_node_flags))
+    {
+      FrameArena::Stats arena = FrameArena::GetStats();
+      ImGui::Text("Frame Arena");
+      ImGui::Text("  Used Last Frame: %.1f KB", arena.used_last_frame / 1024.0);
+      ImGui::Text("  High Water Mark: %.1f KB", arena.high_water_mark / 1024.0);
+      ImGui::Text("  Capacity: %.1f KB", arena.capacity / 1024.0);
+      ImGui::Text("  Overflow Blocks: %llu", static_cast<unsigned long long>(arena.overflow_count));
+      ImGui::Text("Double Buffered Arena");
+      ImGui::Text("  Used Last Frame: %.1f KB", arena.double_buffered_used_last_frame / 1024.0);
+      ImGui::Text("  High Water Mark: %.1f KB", arena.double_buffered_high_water_mark / 1024.0);
+      ImGui::Separator();
+
+      HeapCounter::Stats heap = HeapCounter::GetStats();
+      ImGui::Text("Heap (engine and application)");
+      ImGui::Text("  Allocations: %llu", static_cast<unsigned long long>(heap.allocations));
+      ImGui::Text("  Frees: %llu", static_cast<unsigned long long>(heap.frees));
+      ImGui::Text("  Live: %llu", static_cast<unsigned long long>(heap.allocations - heap.frees));
+      ImGui::Text("  Allocations Last Frame: %llu", static_cast<unsigned long long>(heap.allocations_last_frame));
+      ImGui::Text("  Bytes Last Frame: %.1f KB", heap.bytes_allocated_last_frame / 1024.0);
+      ImGui::Separator();
+
+      bool tracking = HeapCounter::IsTracking();
+      if (ImGui::Checkbox("Track Allocations", &tracking)) HeapCounter::SetTracking(tracking);
+      ImGui::SameLine();
+      if (ImGui::Button("Take Snapshot"))
+      {
+        m_memory_snapshot = HeapCounter::TakeSnapshot();
+        m_has_memory_snapshot = true;
+      }
+      if (m_has_memory_snapshot)
+      {
+        ImGui::SameLine();
+        if (ImGui::Button("Clear Snapshot")) m_has_memory_snapshot = false;
+      }
+
+      // live memory by tag, with the change since the snapshot
+      HeapCounter::Snapshot current = HeapCounter::TakeSnapshot();
+      HeapCounter::Snapshot diff = HeapCounter::Diff(m_memory_snapshot, current);
+      int column_count = m_has_memory_snapshot ? 8 : 6;
+      if (ImGui::BeginTable("Memory Tags", column_count, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp))
+      {
+        ImGui::TableSetupColumn("Tag");
+        ImGui::TableSetupColumn("Live KB");
+        ImGui::TableSetupColumn("Blocks");
+        ImGui::TableSetupColumn("Peak KB");
+        ImGui::TableSetupColumn("Allocs/Frame");
+        ImGui::TableSetupColumn("External KB");
+        if (m_has_memory_snapshot)
+        {
+          ImGui::TableSetupColumn("Live KB Since Snapshot");
+          ImGui::TableSetupColumn("Blocks Since Snapshot");
+        }
+        ImGui::TableHeadersRow();
+
+        for (std::size_t i = 0; i < current.tags.size(); ++i)
+        {
+          const HeapCounter::TagStats& stats = current.tags[i];
+          const HeapCounter::TagStats& change = diff.tags[i];
+
+          // guard: nothing was ever tracked for this tag
+          if (stats.allocations == 0 && stats.external_bytes == 0) continue;
+
+          ImGui::TableNextRow();
+          ImGui::TableNextColumn(); ImGui::TextUnformatted(HeapCounter::GetTagName(static_cast<MemoryTag>(i)));
+          ImGui::TableNextColumn(); ImGui::Text("%.1f", stats.live_bytes / 1024.0);
+          ImGui::TableNextColumn(); ImGui::Text("%lld", static_cast<long long>(stats.live_allocations));
+          ImGui::TableNextColumn(); ImGui::Text("%.1f", stats.peak_bytes / 1024.0);
+          ImGui::TableNextColumn(); ImGui::Text("%lld", static_cast<long long>(stats.allocations_last_frame));
+          ImGui::TableNextColumn(); ImGui::Text("%.1f", stats.external_bytes / 1024.0);
+          if (m_has_memory_snapshot)
+          {
+            ImGui::TableNextColumn(); ImGui::Text("%+.1f", change.live_bytes / 1024.0);
+            ImGui::TableNextColumn(); ImGui::Text("%+lld", static_cast<long long>(change.live_allocations));
+          }
+        }
+
+        ImGui::EndTable();
+      }
+    }
+
+    #pragma endregion
+
     #pragma region Renderer
 
     if (ImGui::CollapsingHeader("Renderer", tree_node_flags))
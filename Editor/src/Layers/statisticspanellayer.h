@@ -26,6 +26,11 @@ namespace Editor
     virtual void OnAttach() override;
     virtual void OnDetach() override;
     virtual void Update() override;
+
+  private:
+    // compared against the live memory in the Memory section
+    bool m_has_memory_snapshot = false;
+    HeapCounter::Snapshot m_memory_snapshot;
   };
 
 }
\ No newline at end of file
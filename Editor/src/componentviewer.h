@@ -175,13 +175,17 @@ void COMPONENT_VIEWER_##TYPE(FlexEngine::FlexECS::Entity entity) \
 	std::string& path_##name = FLX_STRING_GET(entity.GetComponent<T>()->name); \
 	EditorGUI::ShaderPath(path_##name);
 
+	// Sprite, spritesheet and video paths are stored as a new string instead of edited in place,
+	// the asset handle cached next to the StringIndex only notices a different index.
 	#define COMPONENT_VIEWER_TEXTURE_PATH(name) \
-	std::string& path_##name = FLX_STRING_GET(entity.GetComponent<T>()->name); \
-	EditorGUI::TexturePath(path_##name);
+	std::string path_##name = FLX_STRING_GET(entity.ReadComponent<T>()->name); \
+	EditorGUI::TexturePath(path_##name); \
+	if (path_##name != FLX_STRING_GET(entity.ReadComponent<T>()->name)) entity.GetComponent<T>()->name = FLX_STRING_NEW(path_##name);
 
 	#define COMPONENT_VIEWER_SPRITESHEET_PATH(name) \
-	std::string& path_##name = FLX_STRING_GET(entity.GetComponent<T>()->name); \
-	EditorGUI::SpritesheetPath(path_##name);
+	std::string path_##name = FLX_STRING_GET(entity.ReadComponent<T>()->name); \
+	EditorGUI::SpritesheetPath(path_##name); \
+	if (path_##name != FLX_STRING_GET(entity.ReadComponent<T>()->name)) entity.GetComponent<T>()->name = FLX_STRING_NEW(path_##name);
 
 	#define COMPONENT_VIEWER_AUDIO_PATH(name) \
 	std::string& path_##name = FLX_STRING_GET(entity.GetComponent<T>()->name); \
@@ -192,8 +196,9 @@ void COMPONENT_VIEWER_##TYPE(FlexEngine::FlexECS::Entity entity) \
 	EditorGUI::FontPath(path_##name);
 
 	#define COMPONENT_VIEWER_VIDEO_PATH(name) \
-	std::string& path_##name = FLX_STRING_GET(entity.GetComponent<T>()->name); \
-	EditorGUI::VideoPath(path_##name);
+	std::string path_##name = FLX_STRING_GET(entity.ReadComponent<T>()->name); \
+	EditorGUI::VideoPath(path_##name); \
+	if (path_##name != FLX_STRING_GET(entity.ReadComponent<T>()->name)) entity.GetComponent<T>()->name = FLX_STRING_NEW(path_##name);
 
 	#define COMPONENT_VIEWER_STRING(name) \
 	std::string& str_##name = FLX_STRING_GET(entity.GetComponent<T>()->name); \
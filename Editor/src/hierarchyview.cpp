@@ -23,11 +23,403 @@ namespace Editor
 {
 	void HierarchyView::Init()
 	{
+		//Only queue the change here, the entity may not be fully set up yet (eg. CreateEntity before AddComponent)
+		m_change_listener = FlexECS::Scene::AddChangeListener(
+			[this](FlexECS::Scene::ChangeType type, FlexECS::EntityID entity, const FlexECS::ComponentID&)
+			{
+				if (type == FlexECS::Scene::ChangeType::ActiveSceneChanged)
+				{
+					m_rebuild_pending = true;
+					m_pending.clear();
+				}
+				else if (!m_rebuild_pending)
+				{
+					m_pending.insert(entity);
+				}
+			});
+		m_rebuild_pending = true;
 	}
+
 	void HierarchyView::Update()
 	{
+		if (m_rebuild_pending)
+		{
+			RebuildTree();
+			return;
+		}
+
+		if (m_pending.empty()) return;
+
+		//Refreshing a node can queue its parent, so swap out the set first
+		std::unordered_set<EntityID> pending;
+		pending.swap(m_pending);
+		for (EntityID entity : pending)
+		{
+			RefreshNode(entity);
+		}
+		m_rows_dirty = true;
+	}
+
+	#pragma region Tree
+
+	void HierarchyView::RebuildTree()
+	{
+		m_nodes.clear();
+		m_roots.clear();
+		m_matches.clear();
+		m_pending.clear();
+		m_next_order = 0;
+
+		auto scene = FlexECS::Scene::GetActiveScene();
+
+		//entity_index is unordered, sort so that the hierarchy does not shuffle between rebuilds
+		std::vector<EntityID> entities;
+		entities.reserve(scene->entity_index.size());
+		for (auto& [id, record] : scene->entity_index)
+		{
+			entities.push_back(id);
+		}
+		std::sort(entities.begin(), entities.end());
+
+		m_nodes.reserve(entities.size());
+		for (EntityID entity : entities)
+		{
+			RefreshNode(entity);
+		}
+
+		m_rebuild_pending = false;
+		m_rows_dirty = true;
+	}
+
+	void HierarchyView::RefreshNode(EntityID entity)
+	{
+		auto scene = FlexECS::Scene::GetActiveScene();
+		if (scene->entity_index.count(entity) == 0)
+		{
+			RemoveNode(entity);
+			return;
+		}
+
+		FlexECS::Entity e = entity;
+		auto it = m_nodes.find(entity);
+		bool is_new = (it == m_nodes.end());
+		if (is_new)
+		{
+			it = m_nodes.emplace(entity, Node{}).first;
+			it->second.order = m_next_order++;
+		}
+
+		//Name
+		{
+			Node& node = it->second;
+			const std::string& name = e.HasComponent<EntityName>() ? FLX_STRING_GET(*e.GetComponent<EntityName>()) : FLX_STRING_GET(FLX_STRING_NULL);
+			if (is_new || node.name != name)
+			{
+				node.name = name;
+				node.name_lower = name;
+				std::transform(node.name_lower.begin(), node.name_lower.end(), node.name_lower.begin(),
+					[](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+				UpdateFilterMatch(entity, node);
+			}
+		}
+
+		//Parent
+		EntityID parent = 0;
+		if (e.HasComponent<Parent>())
+		{
+			parent = e.GetComponent<Parent>()->parent;
+		}
+
+		if (parent != 0)
+		{
+			//Parent not in the scene, show this entity at the root instead of hiding it
+			if (scene->entity_index.count(parent) == 0)
+			{
+				parent = 0;
+			}
+			//Parent exists but we haven't seen it yet (happens during a rebuild or when both are created in the same frame)
+			else if (m_nodes.count(parent) == 0)
+			{
+				RefreshNode(parent);
+			}
+		}
+
+		//Guard against cycles, the tree is walked recursively when flattening
+		for (EntityID ancestor = parent; ancestor != 0; ancestor = m_nodes[ancestor].parent)
+		{
+			if (ancestor == entity)
+			{
+				parent = 0;
+				break;
+			}
+		}
+
+		Node& node = m_nodes[entity];	//re-fetch, RefreshNode(parent) may have rehashed
+		if (is_new)
+		{
+			Attach(entity, parent);
+		}
+		else if (node.parent != parent)
+		{
+			Detach(entity);
+			Attach(entity, parent);
+		}
+	}
+
+	void HierarchyView::RemoveNode(EntityID entity)
+	{
+		auto it = m_nodes.find(entity);
+		if (it == m_nodes.end()) return;
+
+		Detach(entity);
+
+		//Orphaned children go to the root until they are refreshed
+		std::vector<EntityID> children;
+		children.swap(it->second.children);
+		for (EntityID child : children)
+		{
+			m_nodes[child].parent = 0;
+			m_roots.push_back(child);
+			m_pending.insert(child);
+		}
+
+		if (it->second.matches_filter)
+		{
+			m_matches.erase(std::remove(m_matches.begin(), m_matches.end(), entity), m_matches.end());
+		}
+
+		m_nodes.erase(entity);
+	}
+
+	void HierarchyView::Attach(EntityID entity, EntityID parent)
+	{
+		m_nodes[entity].parent = parent;
+		if (parent == 0)
+		{
+			m_roots.push_back(entity);
+		}
+		else
+		{
+			m_nodes[parent].children.push_back(entity);
+		}
+	}
+
+	void HierarchyView::Detach(EntityID entity)
+	{
+		EntityID parent = m_nodes[entity].parent;
+		std::vector<EntityID>& siblings = (parent == 0) ? m_roots : m_nodes[parent].children;
+		siblings.erase(std::remove(siblings.begin(), siblings.end(), entity), siblings.end());
+	}
+
+	void HierarchyView::ValidateNode(EntityID entity)
+	{
+		//Component values can be edited directly (inspector, scripts) without any notification,
+		//so visible and selected entities are compared against the cache every frame.
+		auto scene = FlexECS::Scene::GetActiveScene();
+		if (scene->entity_index.count(entity) == 0)
+		{
+			m_pending.insert(entity);
+			return;
+		}
+
+		auto it = m_nodes.find(entity);
+		if (it == m_nodes.end())
+		{
+			m_pending.insert(entity);
+			return;
+		}
+
+		FlexECS::Entity e = entity;
+		EntityID parent = e.HasComponent<Parent>() ? EntityID(e.GetComponent<Parent>()->parent) : 0;
+		bool name_changed = e.HasComponent<EntityName>() && FLX_STRING_GET(*e.GetComponent<EntityName>()) != it->second.name;
+
+		//A parent that was dropped to the root (missing or cyclic) will always mismatch, so check that it is still invalid
+		bool parent_changed = (parent != it->second.parent) && !(it->second.parent == 0 && scene->entity_index.count(parent) == 0);
+
+		if (name_changed || parent_changed)
+		{
+			m_pending.insert(entity);
+		}
+	}
+
+	#pragma endregion
+
+	#pragma region Search
+
+	void HierarchyView::SetFilter(const std::string& filter)
+	{
+		std::string filter_lower = filter;
+		std::transform(filter_lower.begin(), filter_lower.end(), filter_lower.begin(),
+			[](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+		if (filter_lower == m_filter) return;
+
+		//Anything that contains the new filter also contains the old one, so only the old matches need to be checked
+		bool narrowing = !m_filter.empty() && filter_lower.find(m_filter) != std::string::npos;
+		m_filter = filter_lower;
+
+		if (narrowing)
+		{
+			auto last = std::remove_if(m_matches.begin(), m_matches.end(), [this](EntityID entity)
+				{
+					Node& node = m_nodes[entity];
+					node.matches_filter = node.name_lower.find(m_filter) != std::string::npos;
+					return !node.matches_filter;
+				});
+			m_matches.erase(last, m_matches.end());
+		}
+		else
+		{
+			m_matches.clear();
+			for (auto& [entity, node] : m_nodes)
+			{
+				node.matches_filter = !m_filter.empty() && node.name_lower.find(m_filter) != std::string::npos;
+				if (node.matches_filter) m_matches.push_back(entity);
+			}
+			m_matches_unsorted = true;
+		}
+
+		m_rows_dirty = true;
+	}
+
+	void HierarchyView::UpdateFilterMatch(EntityID entity, Node& node)
+	{
+		bool matches = !m_filter.empty() && node.name_lower.find(m_filter) != std::string::npos;
+		if (matches == node.matches_filter) return;
+
+		node.matches_filter = matches;
+		if (matches)
+		{
+			m_matches.push_back(entity);
+			m_matches_unsorted = true;
+		}
+		else
+		{
+			m_matches.erase(std::remove(m_matches.begin(), m_matches.end(), entity), m_matches.end());
+		}
 	}
 
+	#pragma endregion
+
+	#pragma region Rows
+
+	void HierarchyView::RebuildRows()
+	{
+		m_rows.clear();
+
+		//Search results are shown flat
+		if (!m_filter.empty())
+		{
+			if (m_matches_unsorted)
+			{
+				std::sort(m_matches.begin(), m_matches.end(), [this](EntityID a, EntityID b)
+					{
+						return m_nodes[a].order < m_nodes[b].order;
+					});
+				m_matches_unsorted = false;
+			}
+			for (EntityID entity : m_matches)
+			{
+				m_rows.push_back({ entity, 0 });
+			}
+			m_rows_dirty = false;
+			return;
+		}
+
+		//Depth first, children of closed nodes are skipped entirely
+		std::vector<Row> stack;
+		for (auto it = m_roots.rbegin(); it != m_roots.rend(); ++it)
+		{
+			stack.push_back({ *it, 0 });
+		}
+		while (!stack.empty())
+		{
+			Row row = stack.back();
+			stack.pop_back();
+			m_rows.push_back(row);
+
+			Node& node = m_nodes[row.entity];
+			if (!node.open) continue;
+			for (auto it = node.children.rbegin(); it != node.children.rend(); ++it)
+			{
+				stack.push_back({ *it, row.depth + 1 });
+			}
+		}
+
+		m_rows_dirty = false;
+	}
+
+	void HierarchyView::DrawRow(const Row& row)
+	{
+		auto selection_system = Editor::GetInstance().GetSystem<SelectionSystem>();
+		const auto& selected_entities = selection_system->GetSelectedEntities();
+		bool multiselect = selected_entities.size() > 1;
+
+		FlexECS::Entity entity(row.entity);
+		Node& node = m_nodes[row.entity];
+
+		ImGui::PushID(reinterpret_cast<void*>(static_cast<uintptr_t>(row.entity)));
+
+		float indent = row.depth * ImGui::GetStyle().IndentSpacing;
+		if (indent > 0.0f) ImGui::Indent(indent);
+
+		//Rows are not nested in ImGui (they may be clipped), so the tree is never pushed
+		ImGuiTreeNodeFlags node_flags =
+			ImGuiTreeNodeFlags_FramePadding |
+			ImGuiTreeNodeFlags_SpanAvailWidth |
+			ImGuiTreeNodeFlags_NoTreePushOnOpen;
+
+		bool has_children = !node.children.empty() && m_filter.empty();
+		node_flags |= has_children ? ImGuiTreeNodeFlags_OpenOnArrow : ImGuiTreeNodeFlags_Leaf;
+
+		if (selected_entities.count(row.entity) != 0)
+		{
+			node_flags |= ImGuiTreeNodeFlags_Selected;
+		}
+
+		if (has_children) ImGui::SetNextItemOpen(node.open);
+		bool open = ImGui::TreeNodeEx("##entity", node_flags, "%s", node.name.c_str());
+		if (has_children && open != node.open)
+		{
+			node.open = open;
+			m_rows_dirty = true;
+		}
+
+		if (!multiselect && ImGui::BeginDragDropSource())
+		{
+			EditorGUI::StartPayload(PayloadTags::ENTITY, &entity.Get(), sizeof(FlexECS::EntityID), node.name.c_str());
+			EditorGUI::EndPayload();
+		}
+
+		if (ImGui::IsItemHovered())
+		{
+			m_item_hovered = true;
+		}
+
+		if (ImGui::IsItemHovered() && ImGui::IsMouseReleased(ImGuiMouseButton_Left) && !ImGui::IsMouseDragging(ImGuiMouseButton_Left))
+		{
+			if (ImGui::IsKeyDown(ImGuiKey_LeftCtrl))
+			{
+				selection_system->AddSelectedEntity(entity);
+			}
+			else
+			{
+				selection_system->SelectEntity(entity);
+			}
+		}
+
+		if (ImGui::IsItemClicked(ImGuiMouseButton_Right))
+		{
+			m_context_entity = row.entity;
+			selection_system->SelectEntity(entity);
+		}
+
+		if (indent > 0.0f) ImGui::Unindent(indent);
+		ImGui::PopID();
+	}
+
+	#pragma endregion
+
 	void HierarchyView::EditorUI()
 	{
 		auto scene = FlexECS::Scene::GetActiveScene();
@@ -77,80 +469,55 @@ namespace Editor
 			ImGui::EndPopup();
 		}
 
-		//Display all entities
-		auto selected_entities = Editor::GetInstance().GetSystem<SelectionSystem>()->GetSelectedEntities();
-		bool multiselect = selected_entities.size() > 1;
-		bool item_hovered = false;
-		for (auto& [id, record] : scene->entity_index)
+		//Search
+		ImGui::SetNextItemWidth(-FLT_MIN);
+		if (ImGui::InputTextWithHint("##HierarchySearch", "Search", m_filter_buffer, sizeof(m_filter_buffer)))
 		{
-			EditorGUI::PushID();
-			FlexECS::Entity entity(id);
-
-      std::string name = FLX_STRING_GET(*entity.GetComponent<EntityName>());
-			ImGuiTreeNodeFlags node_flags = entity.HasComponent<Parent>() ? 
-				ImGuiTreeNodeFlags_DefaultOpen |
-				ImGuiTreeNodeFlags_FramePadding |
-				ImGuiTreeNodeFlags_OpenOnArrow |
-				ImGuiTreeNodeFlags_SpanAvailWidth
-				:
-				ImGuiTreeNodeFlags_Leaf |
-				ImGuiTreeNodeFlags_FramePadding |
-				ImGuiTreeNodeFlags_SpanAvailWidth;
-
-			bool is_selected = false;
-			if (selected_entities.find(entity) != selected_entities.end()) is_selected = true;
-
-			if (is_selected)
-			{
-				node_flags |= ImGuiTreeNodeFlags_Selected;
-			}
-
-			if (ImGui::TreeNodeEx(name.c_str(), node_flags, name.c_str()))
-			{
-				if (!multiselect && ImGui::BeginDragDropSource())
-				{
-					EditorGUI::StartPayload(PayloadTags::ENTITY, &entity.Get(), sizeof(FlexECS::EntityID), name.c_str());
-					EditorGUI::EndPayload();
-				}
-				ImGui::TreePop();
-			}
+			SetFilter(m_filter_buffer);
+		}
 
-			if (ImGui::IsItemHovered())
-			{
-				item_hovered = true;
-			}
+		if (m_rows_dirty) RebuildRows();
 
-			if (ImGui::IsItemHovered() && ImGui::IsMouseReleased(ImGuiMouseButton_Left) && !ImGui::IsMouseDragging(ImGuiMouseButton_Left))
+		//Display only the entities that are on screen
+		m_item_hovered = false;
+		EntityID context_entity = m_context_entity;
+		ImGuiListClipper clipper;
+		clipper.Begin(static_cast<int>(m_rows.size()));
+		while (clipper.Step())
+		{
+			for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
 			{
-				if (ImGui::IsKeyDown(ImGuiKey_LeftCtrl))
-				{
-					selection_system->AddSelectedEntity(entity);
-				}
-				else 
-				{
-					selection_system->SelectEntity(entity);
-				}
+				ValidateNode(m_rows[i].entity);
+				DrawRow(m_rows[i]);
 			}
+		}
+		clipper.End();
 
+		for (EntityID entity : selection_system->GetSelectedEntities())
+		{
+			ValidateNode(entity);
+		}
 
-			if (ImGui::IsItemClicked(ImGuiMouseButton_Right))
+		//Entity options, opened from a row but drawn at the window level so it survives the row scrolling out of view
+		if (m_context_entity != context_entity)
+		{
+			ImGui::OpenPopup("EntityOptions");
+		}
+		if (ImGui::BeginPopup("EntityOptions"))
+		{
+			if (ImGui::MenuItem("Duplicate Entity"))
 			{
-				ImGui::OpenPopup("EntityOptions");
-				selection_system->SelectEntity(entity);
+				scene->CloneEntity(m_context_entity);
 			}
-			if (ImGui::BeginPopup("EntityOptions"))
+			if (ImGui::MenuItem("Destroy Entity"))
 			{
-				if (ImGui::MenuItem("Duplicate Entity"))
-				{
-					scene->CloneEntity(entity);
-				}
-				if (ImGui::MenuItem("Destroy Entity"))
-				{
-					selection_system->DeleteEntity(entity);
-				}
-				ImGui::EndPopup();
+				selection_system->DeleteEntity(m_context_entity);
 			}
-			EditorGUI::PopID();
+			ImGui::EndPopup();
+		}
+		else
+		{
+			m_context_entity = 0;
 		}
 
 		//Delete entity with del key
@@ -160,7 +527,7 @@ namespace Editor
 		}
 
 		//Deselect focused entity when clicking on empty space
-		if (ImGui::IsWindowHovered() && ImGui::IsMouseClicked(0) && !item_hovered)
+		if (ImGui::IsWindowHovered() && ImGui::IsMouseClicked(0) && !m_item_hovered)
 		{
 			selection_system->ClearSelection();
 		}
@@ -169,6 +536,6 @@ namespace Editor
 
 	void HierarchyView::Shutdown()
 	{
+		FlexECS::Scene::RemoveChangeListener(m_change_listener);
 	}
 }
-
@@ -20,6 +20,11 @@ namespace Editor
 	/*!***************************************************************************
 	* @brief
 	* Call in Update() function of EditorLayer().
+	*
+	* The panel keeps its own copy of the entity tree (built from the Parent
+	* component) and only touches the ECS for entities that changed, which it
+	* learns about through the scene's change listeners.
+	* Only the rows that are on screen are drawn (ImGuiListClipper).
 	******************************************************************************/
 	class HierarchyView : public EditorPanel
 	{
@@ -28,8 +33,74 @@ namespace Editor
 		void Update();
 		void EditorUI();
 		void Shutdown();
+
+	private:
+		using EntityID = FlexEngine::FlexECS::EntityID;
+
+		struct Node
+		{
+			EntityID parent = 0;								//0 if it is a root
+			std::vector<EntityID> children;
+			std::string name;
+			std::string name_lower;							//for case insensitive search
+			uint64_t order = 0;									//creation order, used to sort search results
+			bool open = true;
+			bool matches_filter = false;
+		};
+
+		struct Row
+		{
+			EntityID entity;
+			int depth;
+		};
+
+		/*!***************************************************************************
+		* @brief Tree maintenance
+		* > RebuildTree() throws everything away and reads the whole scene, only done on scene change
+		* > RefreshNode() re-reads the parent and name of one entity, or removes it if it no longer exists
+		* > ValidateNode() cheaply checks if a cached node is out of date, and queues it for a refresh
+		******************************************************************************/
+		void RebuildTree();
+		void RefreshNode(EntityID entity);
+		void RemoveNode(EntityID entity);
+		void Attach(EntityID entity, EntityID parent);
+		void Detach(EntityID entity);
+		void ValidateNode(EntityID entity);
+
+		/*!***************************************************************************
+		* @brief Search
+		* Matches are narrowed down from the previous results when the filter is extended,
+		* and updated per node when names change, so the whole scene is only scanned when
+		* the filter is shortened or replaced.
+		******************************************************************************/
+		void SetFilter(const std::string& filter);
+		void UpdateFilterMatch(EntityID entity, Node& node);
+
+		void RebuildRows();
+		void DrawRow(const Row& row);
+
+		std::unordered_map<EntityID, Node> m_nodes;
+		std::vector<EntityID> m_roots;
+		uint64_t m_next_order = 0;
+
+		//Filled by the change listener, processed once per frame in Update()
+		std::unordered_set<EntityID> m_pending;
+		bool m_rebuild_pending = true;
+		FlexEngine::FlexECS::Scene::ChangeListenerID m_change_listener = 0;
+
+		//Flattened list of what is currently expanded (or the search results)
+		std::vector<Row> m_rows;
+		bool m_rows_dirty = true;
+
+		char m_filter_buffer[128] = {};
+		std::string m_filter;									//lowercase
+		std::vector<EntityID> m_matches;
+		bool m_matches_unsorted = false;
+
+		//Entity whose right click menu is open, kept outside the rows since the row may be clipped
+		EntityID m_context_entity = 0;
+		bool m_item_hovered = false;
 	};
 
 
 }
-
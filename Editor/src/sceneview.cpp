@@ -182,6 +182,23 @@ namespace Editor
 		return screen_pos;
 	}
 
+	void SceneView::UpdatePickingBounds(FlexECS::EntityID entity, Matrix4x4& transform, float z)
+	{
+		auto corners = ComputeOBBCorners(transform);
+
+		Vector2 max_point = corners[0];
+		Vector2 min_point = corners[0];
+		for (int i = 1; i < 4; i++)
+		{
+			min_point.x = std::min(min_point.x, corners[i].x);
+			min_point.y = std::min(min_point.y, corners[i].y);
+			max_point.x = std::max(max_point.x, corners[i].x);
+			max_point.y = std::max(max_point.y, corners[i].y);
+		}
+
+		m_picking_index.Update(entity, min_point, max_point, z);
+	}
+
 	FlexECS::Entity SceneView::FindClickedEntity()
 	{
 		FlexECS::Entity clicked_entity = FlexECS::Entity::Null;
@@ -198,36 +215,22 @@ namespace Editor
 
 		//Gets all entities under the mouse (including entities overlapping each other)
 		//Sorts them based on position.z
+		//The picking index only holds rendered entities, so we only walk the ones under the mouse
 		auto scene = FlexECS::Scene::GetActiveScene();
-		for (auto entity : scene->CachedQuery<Position, Rotation, Scale, Transform, Sprite>()) //you probably only wanna click on things that are rendered
+		std::vector<FlexECS::EntityID> candidates;
+		m_picking_index.QueryPoint(Vector2(mouse_world_pos.x, mouse_world_pos.y), candidates);
+		for (FlexECS::EntityID id : candidates)
 		{
-			auto& active = entity.GetComponent<Transform>()->is_active;
-			if (!active) continue;
-
-			//auto& pos = entity.GetComponent<Position>()->position;
-			//auto& scale = entity.GetComponent<Scale>()->scale;
-			//float rotation = entity.GetComponent<Rotation>()->rotation.z;
-			auto& transform = entity.GetComponent<Transform>()->transform;
+			//the index is synced once per frame, so the entity may have been destroyed since
+			if (scene->entity_index.count(id) == 0) continue;
 
-			auto corners = ComputeOBBCorners(transform);
+			FlexECS::Entity entity = id;
+			if (!entity.HasComponent<Transform>() || !entity.HasComponent<Position>()) continue;
 
-			Vector2 max_point = corners[0];
-			Vector2 min_point = corners[0];
-			for (int i = 1; i < 4; i++)
-			{
-				min_point.x = std::min(min_point.x, corners[i].x);
-				min_point.y = std::min(min_point.y, corners[i].y);
-				max_point.x = std::max(max_point.x, corners[i].x);
-				max_point.y = std::max(max_point.y, corners[i].y);
-			}
+			auto& active = entity.GetComponent<Transform>()->is_active;
+			if (!active) continue;
 
-			if (mouse_world_pos.x >= min_point.x &&
-					mouse_world_pos.x <= max_point.x &&
-					mouse_world_pos.y >= min_point.y &&
-					mouse_world_pos.y <= max_point.y)
-			{
-				clicked_entities.insert(std::make_pair(entity, entity.GetComponent<Position>()->position.z));
-			}
+			clicked_entities.insert(std::make_pair(id, entity.GetComponent<Position>()->position.z));
 		}
 
 		//Cycles to the next z-index entity, so we can select the entity even when covered by another.
@@ -296,15 +299,21 @@ namespace Editor
 		Vector2 max_point = { std::max(pt1.x, pt2.x), std::max(pt1.y, pt2.y) };
 		Vector2 min_point = { std::min(pt1.x, pt2.x), std::min(pt1.y, pt2.y) };
 
+		//Anything whose center is inside the selection must also overlap it, so only test those
 		auto scene = FlexECS::Scene::GetActiveScene();
-		for (auto entity : scene->CachedQuery<Position, Rotation, Scale, Transform, Sprite>()) //you probably only wanna click on things that are rendered
+		std::vector<FlexECS::EntityID> candidates;
+		m_picking_index.QueryRect(min_point, max_point, candidates);
+		std::sort(candidates.begin(), candidates.end());
+		for (FlexECS::EntityID id : candidates)
 		{
+			if (scene->entity_index.count(id) == 0) continue;
+
+			FlexECS::Entity entity = id;
+			if (!entity.HasComponent<Transform>()) continue;
+
 			auto& active = entity.GetComponent<Transform>()->is_active;
 			if (!active) continue;
 
-			//auto& pos = entity.GetComponent<Position>()->position;
-			//auto& scale = entity.GetComponent<Scale>()->scale;
-			//float rotation = entity.GetComponent<Rotation>()->rotation.z;
 			auto& transform = entity.GetComponent<Transform>()->transform;
 
 			Vector2 entity_center = { transform.m30, transform.m31 };
@@ -42,6 +42,11 @@ namespace Editor
 		void EditorUI();
 		void Shutdown();
 
+		//Spatial index used for click and drag selection.
+		//Kept in sync by the rendering layer's transform pass, which already computes every sprite's transform.
+		FlexEngine::SpatialIndex& GetPickingIndex() { return m_picking_index; }
+		void UpdatePickingBounds(FlexEngine::FlexECS::EntityID entity, FlexEngine::Matrix4x4& transform, float z);
+
 	private:
 		enum GizmoType
 		{
@@ -85,5 +90,7 @@ namespace Editor
 		FlexEngine::FlexECS::Entity m_editor_camera;
 		FlexEngine::Vector3 m_camera_position{ 0,0,0 };
 
+		FlexEngine::SpatialIndex m_picking_index;
+
 	};
 }
@@ -2,7 +2,7 @@
 // WLVERSE [https://wlverse.web.app]
 // settingspanel.cpp
 //
-// Settings Panel for the editor, using FlexPrefs.
+// Settings Panel for the editor, using the engine settings.
 //
 // AUTHORS
 // [100%] Soh Wei Jie (weijie.soh\@digipen.edu)
@@ -22,20 +22,26 @@ namespace Editor {
 
     void SettingsPanel::Init() 
     {
-        // Any one-time initialization for the settings panel can go here.
-        FlexPrefs::Load();
+        // The settings are declared and loaded by the application
+        ReadSettings();
+    }
 
+    void SettingsPanel::ReadSettings()
+    {
         // Load Editor settings
-        m_editorCameraSpeed = FlexPrefs::GetFloat("editor.cameraSpeed", 1.0f);
-        m_editorThemeIndex = FlexPrefs::GetInt("editor.themeIndex", 0);
-        m_editorBatching = FlexPrefs::GetBool("editor.batching", true);
+        m_editorCameraSpeed = EngineSettings::editor_camera_speed.Get();
+        m_editorThemeIndex = EngineSettings::editor_theme_index.Get();
+        m_editorBatching = EngineSettings::editor_batching.Get();
 
         // Load Game settings
-        m_gameFullscreen = FlexPrefs::GetBool("game.fullscreen", false);
-        m_gameVSync = FlexPrefs::GetBool("game.vsync", true);
-        m_gameBatching = FlexPrefs::GetBool("game.batching", true);
-        m_gameResolutionIndex = FlexPrefs::GetInt("game.resolutionIndex", 0);
-        m_gameVolume = FlexPrefs::GetFloat("game.volume", 0.75f);
+        m_gameFullscreen = EngineSettings::game_fullscreen.Get();
+        m_gameVSync = EngineSettings::game_vsync.Get();
+        m_gameFramePacing = EngineSettings::game_frame_pacing.Get();
+        m_gameSerialSystems = EngineSettings::game_serial_systems.Get();
+        m_gameFrameBudgetMs = EngineSettings::game_frame_budget_ms.Get();
+        m_gameBatching = EngineSettings::game_batching.Get();
+        m_gameResolutionIndex = EngineSettings::game_resolution_index.Get();
+        m_gameVolume = EngineSettings::game_volume.Get();
     }
 
     void SettingsPanel::Update() 
@@ -47,6 +53,9 @@ namespace Editor {
         if (!m_open)
             return;
 
+        // The settings can also be changed outside of the panel, e.g. toggling fullscreen
+        ReadSettings();
+
         // Begin a new ImGui window for Settings.
         ImGui::Begin("Settings", &m_open);
 
@@ -55,7 +64,7 @@ namespace Editor {
         {
             if (ImGui::SliderFloat("Camera Speed", &m_editorCameraSpeed, 0.1f, 10.0f)) 
             {
-                FlexPrefs::SetFloat("editor.cameraSpeed", m_editorCameraSpeed);
+                Settings::Set(EngineSettings::editor_camera_speed, m_editorCameraSpeed);
             }
             // Use a separate text label and hidden combo label to place the text on the left.
             ImGui::Text("Editor Theme");
@@ -63,13 +72,13 @@ namespace Editor {
             const char* editorThemes[] = { "Dark", "Light" };
             if (ImGui::Combo("##EditorTheme", &m_editorThemeIndex, editorThemes, IM_ARRAYSIZE(editorThemes))) 
             {
-                FlexPrefs::SetInt("editor.themeIndex", m_editorThemeIndex);
+                Settings::Set(EngineSettings::editor_theme_index, m_editorThemeIndex);
                 // Optionally, apply immediate theme changes here.
                 // e.g., (m_editorThemeIndex == 0 ? SetupDarkTheme() : SetupLightTheme());
             }
             if (ImGui::Checkbox("Editor Batching", &m_editorBatching)) 
             {
-                FlexPrefs::SetBool("editor.batching", m_editorBatching);
+                Settings::Set(EngineSettings::editor_batching, m_editorBatching);
             }
         }
         ImGui::NewLine();
@@ -79,25 +88,40 @@ namespace Editor {
         {
             if (ImGui::Checkbox("Fullscreen", &m_gameFullscreen)) 
             {
-                FlexPrefs::SetBool("game.fullscreen", m_gameFullscreen);
+                Settings::Set(EngineSettings::game_fullscreen, m_gameFullscreen);
             }
             if (ImGui::Checkbox("OpenGL VSync", &m_gameVSync)) 
             {
-                FlexPrefs::SetBool("game.vsync", m_gameVSync);
+                Settings::Set(EngineSettings::game_vsync, m_gameVSync);
+            }
+            if (ImGui::Checkbox("Frame Pacing", &m_gameFramePacing)) 
+            {
+                Settings::Set(EngineSettings::game_frame_pacing, m_gameFramePacing);
+                Application::GetCurrentWindow()->GetFramerateController().SetFramePacing(m_gameFramePacing);
+            }
+            if (ImGui::SliderFloat("Frame Budget (ms)", &m_gameFrameBudgetMs, 0.0f, 50.0f, "%.1f")) 
+            {
+                Settings::Set(EngineSettings::game_frame_budget_ms, m_gameFrameBudgetMs);
+                Application::GetCurrentWindow()->GetFramerateController().SetFrameBudget(m_gameFrameBudgetMs);
             }
             if (ImGui::Checkbox("Game Batching", &m_gameBatching)) 
             {
-                FlexPrefs::SetBool("game.batching", m_gameBatching);
+                Settings::Set(EngineSettings::game_batching, m_gameBatching);
+            }
+            // Runs the layer systems one after another on the main thread, for debugging data races
+            if (ImGui::Checkbox("Serial Systems", &m_gameSerialSystems)) 
+            {
+                Settings::Set(EngineSettings::game_serial_systems, m_gameSerialSystems);
             }
             // Dropdown for selecting resolution.
             const char* resolutions[] = { "1920x1080", "1600x900", "1366x768", "1280x720" };
             if (ImGui::Combo("Resolution", &m_gameResolutionIndex, resolutions, IM_ARRAYSIZE(resolutions))) 
             {
-                FlexPrefs::SetInt("game.resolutionIndex", m_gameResolutionIndex);
+                Settings::Set(EngineSettings::game_resolution_index, m_gameResolutionIndex);
             }
             if (ImGui::SliderFloat("Audio Volume", &m_gameVolume, 0.0f, 1.0f)) 
             {
-                FlexPrefs::SetFloat("game.volume", m_gameVolume);
+                Settings::Set(EngineSettings::game_volume, m_gameVolume);
             }
         }
 
@@ -105,15 +129,15 @@ namespace Editor {
         ImGui::Separator();
         if (ImGui::Button("Save Settings", ImVec2(180, 30)))
         {
-            Application::GetCurrentWindow()->ToggleFullScreen(FlexPrefs::GetBool("game.fullscreen"));
-            FlexPrefs::Save();
+            Application::GetCurrentWindow()->ToggleFullScreen(EngineSettings::game_fullscreen.Get());
+            Settings::Flush();
         }
         ImGui::End();
     }
 
     void SettingsPanel::Shutdown() {
         // Save settings to disk when shutting down.
-        FlexPrefs::Save();
+        Settings::Flush();
     }
 
     void SettingsPanel::SetOpen(bool val)
@@ -2,7 +2,7 @@
 // WLVERSE [https://wlverse.web.app]
 // settingspanel.h
 //
-// Settings Panel for the editor, using FlexPrefs.
+// Settings Panel for the editor, using the engine settings.
 //
 // AUTHORS
 // [100%] Soh Wei Jie (weijie.soh\@digipen.edu)
@@ -35,6 +35,9 @@ namespace Editor {
 		void SetOpen(bool val);
 		bool IsOpen();
 	private:
+		// Copies the engine settings into the values shown by the panel
+		void ReadSettings();
+
 		bool m_open = false;  // Controls visibility of the settings window
 
 		// --- Editor Settings ---
@@ -45,6 +48,9 @@ namespace Editor {
 		// --- Game Settings ---
 		bool  m_gameFullscreen;
 		bool  m_gameVSync;
+		bool  m_gameFramePacing;
+		bool  m_gameSerialSystems;
+		float m_gameFrameBudgetMs; // 0: no budget warning
 		bool  m_gameBatching;
 		int   m_gameResolutionIndex; // e.g., 0: "1920x1080", 1: "1600x900", etc.
 		float m_gameVolume;
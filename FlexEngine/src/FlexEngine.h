@@ -39,6 +39,14 @@
 // then be used to retrieve the asset.
 #include "FlexEngine/assetmanager.h"
 
+// Cooked asset archive (assets.flxpak), created with --cook.
+// The asset manager loads textures and text assets from it when it exists.
+#include "FlexEngine/assetarchive.h"
+
+// Headless runtime without a window, renderer or audio device, started with --headless.
+// Used for soak tests and performance runs, writes per-frame timings to a file.
+#include "FlexEngine/headless.h"
+
 
 /* |-----------------------------| */
 /* |----------- Tools -----------| */
@@ -78,6 +86,9 @@
 // UUID class for generating unique identifiers.
 #include "FlexEngine/Utilities/uuid.h"
 
+// LZ4 block compression, used by the cooked asset archive.
+#include "FlexEngine/Utilities/flexlz4.h"
+
 // FlexID class for generating special unique identifiers.
 // The first 32 bits are the ID, the next 28 bits are the generation, and the last 4 bits are the flags.
 #include "FlexEngine/FlexECS/flexid.h"
@@ -118,6 +129,10 @@
 // Set float, int, string, and bool values.
 #include "FlexEngine/flexprefs.h"
 
+// Typed settings declared once with a default and a range, stored in FlexPrefs.
+// Reading a setting is a load, changes notify listeners and are saved in the background.
+#include "FlexEngine/settings.h"
+
 // Input handling abstracted from GLFW.
 // Use GLFW key codes.
 // Currently does not support gamepads.
@@ -176,8 +191,17 @@
 // The current implementation is exclusively for OpenGL.
 #include "FlexEngine/Renderer/OpenGL/openglshader.h"
 
+// Skips binds and blend changes that would not change anything.
+#include "FlexEngine/Renderer/OpenGL/openglstate.h"
+
+// Counts OpenGL calls without a GPU, for headless runs and tests.
+#include "FlexEngine/Renderer/OpenGL/openglrecorder.h"
+
 #include "FlexEngine/Renderer/OpenGL/openglframebuffermanager.h"
 
+// Post processing effects compiled into fused passes.
+#include "FlexEngine/Renderer/postprocessgraph.h"
+
 /* |-----------------------------| */
 /* |------ Data Structures ------| */
 /* |-----------------------------| */
@@ -186,6 +210,30 @@
 // This uses the Archetype-based Entity-Component-System architecture.
 #include "FlexEngine/FlexECS/datastructures.h"
 
+// Loads scenes on a worker thread so that scene transitions do not stall the frame.
+#include "FlexEngine/FlexECS/sceneloader.h"
+
+// Keeps a loaded copy of every scene that was entered, so entering it again skips the file.
+#include "FlexEngine/FlexECS/scenetemplatecache.h"
+
+// Runs the systems of a layer on a worker pool, ordered by the components they read and write.
+#include "FlexEngine/FlexECS/systemschedule.h"
+
+// Battle rules shared by the battle layer and the battle simulator.
+#include "FlexEngine/Battle/battlestate.h"
+
+// Headless battle simulator for balance runs, also used by the --battle-sim command line.
+#include "FlexEngine/Battle/battlesim.h"
+
+// Tweens that animate component fields over time, and timelines that sequence them.
+// Updated once per frame with TweenSystem::Update.
+#include "FlexEngine/Animation/tween.h"
+
+// Spritesheets compiled into clips with prefix summed frame times and precomputed UVs.
+// AnimatorSystem::Update plays every Animator of the active scene in one batch.
+#include "FlexEngine/Animation/animationclip.h"
+#include "FlexEngine/Animation/animatorsystem.h"
+
 // Two way queue for storing and executing functions.
 #include "FlexEngine/DataStructures/functionqueue.h"
 
@@ -193,6 +241,18 @@
 // heap objects after execution.
 #include "FlexEngine/DataStructures/freequeue.h"
 
+// Linear allocator for per frame data, reset at the start of every frame.
+// FrameVector and FrameString are standard containers that allocate from it.
+// HeapCounter counts heap allocations to check that the frame loop stays off the heap,
+// and tracks live memory by subsystem with FLX_MEMORY_TAG when tracking is on.
+#include "FlexEngine/DataStructures/framearena.h"
+#include "FlexEngine/heapcounter.h"
+
+// Dynamic AABB tree for 2D broadphase queries.
+// SpatialIndex wraps it for entities and supports point, rectangle, ray and z-ordered picking queries.
+#include "FlexEngine/DataStructures/aabbtree.h"
+#include "FlexEngine/Physics/spatialindex.h"
+
 // Data structure for a range of values.
 // Use Get() to generate random values within the range.
 // The number that is generated is inclusive of the min and max values.
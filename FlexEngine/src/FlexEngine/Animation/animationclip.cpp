@@ -0,0 +1,66 @@
+// WLVERSE [https://wlverse.web.app]
+// animationclip.cpp
+//
+// A spritesheet compiled for playback.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#include "pch.h"
+
+#include "animationclip.h"
+
+#include "Renderer/OpenGL/openglspritesheet.h"
+#include "Renderer/OpenGL/opengltexture.h"
+
+namespace FlexEngine
+{
+
+  AnimationClip AnimationClip::Compile(const Asset::Spritesheet& spritesheet, const Asset::Texture& texture)
+  {
+    AnimationClip clip;
+
+    std::size_t frame_count = spritesheet.frame_times.size();
+    clip.frame_ends.reserve(frame_count);
+    clip.uvs.reserve(frame_count);
+
+    bool uniform = true;
+    float end = 0.f;
+    for (std::size_t i = 0; i < frame_count; ++i)
+    {
+      float frame_time = spritesheet.frame_times[i];
+      uniform = uniform && frame_time == spritesheet.frame_times[0];
+
+      end += frame_time;
+      clip.frame_ends.push_back(end);
+      clip.uvs.push_back(spritesheet.GetUV(static_cast<int>(i)));
+    }
+
+    clip.duration = end;
+    clip.uniform_frame_time = (uniform && frame_count > 0) ? spritesheet.frame_times[0] : 0.f;
+
+    // integer division, same as the transform used before it was cached
+    clip.frame_size = Vector2(
+      static_cast<float>(texture.GetWidth() / spritesheet.columns),
+      static_cast<float>(texture.GetHeight() / spritesheet.rows)
+    );
+
+    return clip;
+  }
+
+  int AnimationClip::FrameAt(float time) const
+  {
+    int last = GetFrameCount() - 1;
+    if (last <= 0 || time <= 0.f) return 0;
+
+    if (uniform_frame_time > 0.f) return std::min(static_cast<int>(time / uniform_frame_time), last);
+
+    // the first frame that ends after the time
+    auto it = std::upper_bound(frame_ends.begin(), frame_ends.end(), time);
+    return std::min(static_cast<int>(it - frame_ends.begin()), last);
+  }
+
+}
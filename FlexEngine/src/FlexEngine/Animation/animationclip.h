@@ -0,0 +1,58 @@
+// WLVERSE [https://wlverse.web.app]
+// animationclip.h
+//
+// A spritesheet compiled for playback.
+//
+// The frame times of the spritesheet are prefix summed, so the frame at any
+// time in the clip is a binary search, or a division when every frame has the
+// same time. The UV rect of every frame and the size of one frame in pixels
+// are computed once, instead of every time a sprite is drawn or transformed.
+//
+// Clips are compiled by AnimatorSystem::GetClip, see animatorsystem.h.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#pragma once
+
+#include "flx_api.h"
+
+#include "FlexMath/vector2.h"
+#include "FlexMath/vector4.h"
+
+#include <vector>
+
+namespace FlexEngine
+{
+
+  namespace Asset
+  {
+    class Texture;
+    struct Spritesheet;
+  }
+
+  struct __FLX_API AnimationClip
+  {
+    std::vector<float> frame_ends; // time at which each frame ends, the last one is the duration
+    std::vector<Vector4> uvs;      // u1, v1 (top left), u2, v2 (bottom right) of each frame
+    float duration = 0.f;
+    float uniform_frame_time = 0.f; // the time of every frame when they are all the same, otherwise 0
+    Vector2 frame_size;             // size of one frame in pixels
+
+    static AnimationClip Compile(const Asset::Spritesheet& spritesheet, const Asset::Texture& texture);
+
+    int GetFrameCount() const { return static_cast<int>(frame_ends.size()); }
+
+    // Frame shown at the time, clamped to the first and last frame
+    int FrameAt(float time) const;
+
+    // Time at which the frame starts
+    float FrameStart(int frame) const { return frame > 0 ? frame_ends[frame - 1] : 0.f; }
+
+    float FrameTime(int frame) const { return frame_ends[frame] - FrameStart(frame); }
+  };
+
+}
@@ -0,0 +1,237 @@
+// WLVERSE [https://wlverse.web.app]
+// animatorsystem.cpp
+//
+// Plays the Animator components of the active scene.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#include "pch.h"
+
+#include "animatorsystem.h"
+
+#include "FlexECS/enginecomponents.h"
+#include "assetmanager.h"
+
+#include <cmath> // std::fmod
+
+namespace FlexEngine
+{
+
+  namespace
+  {
+    // Compiled clips by spritesheet handle slot, the generation tells when the slot was reloaded.
+    // The clips are boxed so that the batch can point at them while new ones are compiled.
+    struct CompiledClip
+    {
+      uint32_t generation = 0;
+      std::unique_ptr<AnimationClip> clip;
+    };
+
+    std::vector<CompiledClip> compiled_clips;
+
+    // The animators of one Update, one entry per animator with a spritesheet.
+    // Kept between frames so that the arrays reuse their storage.
+    struct AnimatorBatch
+    {
+      std::vector<FlexECS::Entity> entity;
+      std::vector<const AnimationClip*> clip;
+      std::vector<CachedAssetHandle<Asset::Spritesheet>> handle;
+      std::vector<float> elapsed;  // time since the start of the clip
+      std::vector<float> duration;
+      std::vector<float> speed;    // 1 while playing, 0 when stopped
+      std::vector<uint8_t> looping;
+      std::vector<uint8_t> ended;  // a clip that is not looping ran past its end
+      std::vector<int> frame;
+
+      std::size_t Size() const { return entity.size(); }
+
+      void Clear()
+      {
+        entity.clear();
+        clip.clear();
+        handle.clear();
+        elapsed.clear();
+        duration.clear();
+        speed.clear();
+        looping.clear();
+        ended.clear();
+        frame.clear();
+      }
+
+      void Push(FlexECS::Entity e, const AnimationClip* c, CachedAssetHandle<Asset::Spritesheet> h, float time, bool playing, bool loop, int current_frame)
+      {
+        entity.push_back(e);
+        clip.push_back(c);
+        handle.push_back(h);
+        elapsed.push_back(time);
+        duration.push_back(c->duration);
+        speed.push_back(playing ? 1.f : 0.f);
+        looping.push_back(loop ? 1 : 0);
+        ended.push_back(0);
+        frame.push_back(current_frame);
+      }
+    };
+
+    AnimatorBatch batch;
+
+    #pragma region Passes
+
+    void Gather()
+    {
+      batch.Clear();
+
+      for (auto& entity : FlexECS::Scene::GetActiveScene()->CachedQuery<Animator, Sprite>())
+      {
+        const Animator& animator = *entity.ReadComponent<Animator>();
+
+        CachedAssetHandle<Asset::Spritesheet> handle = animator.spritesheet_asset;
+        const AnimationClip* found = AnimatorSystem::GetClip(handle, animator.spritesheet_handle);
+        if (!found || found->GetFrameCount() == 0) continue;
+        const AnimationClip& clip = *found;
+
+        // the spritesheet can be swapped without resetting the frame
+        int frame = (animator.current_frame >= 0 && animator.current_frame < clip.GetFrameCount()) ? animator.current_frame : 0;
+
+        batch.Push(entity, &clip, handle, clip.FrameStart(frame) + animator.frame_time, animator.should_play, animator.is_looping, frame);
+      }
+    }
+
+    void Advance(float dt)
+    {
+      std::size_t count = batch.Size();
+      float* elapsed = batch.elapsed.data();
+      const float* speed = batch.speed.data();
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        elapsed[i] += dt * speed[i];
+      }
+    }
+
+    void Wrap()
+    {
+      std::size_t count = batch.Size();
+      float* elapsed = batch.elapsed.data();
+      const float* duration = batch.duration.data();
+      const float* speed = batch.speed.data();
+      const uint8_t* looping = batch.looping.data();
+      uint8_t* ended = batch.ended.data();
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        bool past_end = speed[i] > 0.f && elapsed[i] >= duration[i];
+        ended[i] = past_end && !looping[i];
+        if (past_end && looping[i]) elapsed[i] = std::fmod(elapsed[i], duration[i]);
+      }
+    }
+
+    void LookUpFrames()
+    {
+      std::size_t count = batch.Size();
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        if (batch.speed[i] > 0.f) batch.frame[i] = batch.clip[i]->FrameAt(batch.elapsed[i]);
+      }
+    }
+
+    // Only writes to the animators whose state changed
+    void WriteBack()
+    {
+      std::size_t count = batch.Size();
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        FlexECS::Entity entity = batch.entity[i];
+        const AnimationClip& clip = *batch.clip[i];
+        const Animator& current = *entity.ReadComponent<Animator>();
+
+        if (batch.ended[i])
+        {
+          Animator& animator = *entity.GetComponent<Animator>();
+
+          // return to default and continue looping
+          if (animator.return_to_default)
+          {
+            animator.spritesheet_handle = animator.default_spritesheet_handle;
+            animator.is_looping = true;
+            animator.current_frame = 0;
+            animator.frame_time = 0.f;
+
+            const AnimationClip* default_clip = AnimatorSystem::GetClip(animator.spritesheet_asset, animator.spritesheet_handle);
+            if (!default_clip || default_clip->GetFrameCount() == 0) continue;
+
+            animator.total_frames = default_clip->GetFrameCount();
+            animator.current_frame_time = default_clip->FrameTime(0);
+            animator.current_uv = default_clip->uvs[0];
+          }
+          // stop at the last frame
+          else
+          {
+            int last = clip.GetFrameCount() - 1;
+            animator.spritesheet_asset = batch.handle[i];
+            animator.total_frames = clip.GetFrameCount();
+            animator.current_frame = last;
+            animator.frame_time = clip.FrameTime(last);
+            animator.current_frame_time = clip.FrameTime(last);
+            animator.current_uv = clip.uvs[last];
+            animator.should_play = false;
+          }
+          continue;
+        }
+
+        int frame = batch.frame[i];
+        float frame_time = batch.elapsed[i] - clip.FrameStart(frame);
+
+        // a stopped animator keeps its time
+        if (batch.speed[i] == 0.f) frame_time = current.frame_time;
+
+        if (current.current_frame == frame &&
+            current.frame_time == frame_time &&
+            current.total_frames == clip.GetFrameCount() &&
+            current.spritesheet_asset == batch.handle[i] &&
+            current.current_uv == clip.uvs[frame]) continue;
+
+        Animator& animator = *entity.GetComponent<Animator>();
+        animator.spritesheet_asset = batch.handle[i];
+        animator.total_frames = clip.GetFrameCount();
+        animator.current_frame = frame;
+        animator.frame_time = frame_time;
+        animator.current_frame_time = clip.FrameTime(frame);
+        animator.current_uv = clip.uvs[frame];
+      }
+    }
+
+    #pragma endregion
+
+  }
+
+  const AnimationClip* AnimatorSystem::GetClip(CachedAssetHandle<Asset::Spritesheet>& cache, std::size_t key_index)
+  {
+    Asset::Spritesheet* spritesheet = FLX_ASSET_GET_CACHED(cache, key_index);
+    if (!spritesheet) return nullptr;
+
+    // a successful Get always leaves a valid handle in the cache
+    std::size_t slot = cache.handle.index - 1;
+    if (slot >= compiled_clips.size()) compiled_clips.resize(slot + 1);
+
+    CompiledClip& compiled = compiled_clips[slot];
+    if (!compiled.clip || compiled.generation != cache.handle.generation)
+    {
+      auto& texture = AssetManager::Get(spritesheet->texture_asset, spritesheet->texture);
+      compiled.clip = std::make_unique<AnimationClip>(AnimationClip::Compile(*spritesheet, texture));
+      compiled.generation = cache.handle.generation;
+    }
+    return compiled.clip.get();
+  }
+
+  void AnimatorSystem::Update(float dt)
+  {
+    Gather();
+    Advance(dt);
+    Wrap();
+    LookUpFrames();
+    WriteBack();
+  }
+
+}
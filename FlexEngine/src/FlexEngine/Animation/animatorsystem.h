@@ -0,0 +1,53 @@
+// WLVERSE [https://wlverse.web.app]
+// animatorsystem.h
+//
+// Plays the Animator components of the active scene.
+//
+// Update gathers every animator with a spritesheet into one structure of
+// arrays batch, advances and wraps all of their times in plain loops, looks
+// up the frames in the compiled clips, then writes the frame and its UV rect
+// back into the Animator. Renderers read Animator::current_uv straight into
+// the sprite instance data instead of resolving the spritesheet per sprite.
+// An Animator is only written to when its frame or time changed, so stopped
+// animators do not show up in change queries.
+//
+// Restarting an animation is done the same way as before, by setting
+// current_frame and frame_time to 0.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#pragma once
+
+#include "flx_api.h"
+
+#include "Animation/animationclip.h"
+#include "assethandle.h"
+#include "assetkey.h"
+
+namespace FlexEngine
+{
+
+  // All functions must be called from the main thread.
+  class __FLX_API AnimatorSystem
+  {
+  public:
+    // static class
+    AnimatorSystem() = delete;
+    AnimatorSystem(const AnimatorSystem&) = delete;
+    AnimatorSystem& operator=(const AnimatorSystem&) = delete;
+
+    // Returns the compiled clip of the spritesheet, compiling it the first time it is used
+    // and again after the assets were reloaded.
+    // key_index is the Scene::StringIndex of the spritesheet key, it is resolved through the cached
+    // handle like FLX_ASSET_GET_CACHED. Returns nullptr for an empty key and throws the same errors.
+    static const AnimationClip* GetClip(CachedAssetHandle<Asset::Spritesheet>& cache, std::size_t key_index);
+
+    // Advances every animator of the active scene and writes the current frame and its UV.
+    static void Update(float dt);
+  };
+
+}
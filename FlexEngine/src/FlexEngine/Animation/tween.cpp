@@ -0,0 +1,748 @@
+// WLVERSE [https://wlverse.web.app]
+// tween.cpp
+//
+// Tweens that animate component fields over time, and timelines that
+// sequence them.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#include "pch.h"
+
+#include "tween.h"
+
+#include "FlexECS/enginecomponents.h"
+#include "FlexMath/mathconstants.h"
+
+#include <cmath> // std::sin, std::cos
+
+namespace FlexEngine
+{
+
+  namespace
+  {
+    #pragma region Easing
+
+    // The curves are inlined into the pool loops, a select instead of a branch
+    // keeps the piecewise ones vectorizable.
+    template <Ease E>
+    inline float Curve(float t)
+    {
+      if constexpr (E == Ease::Linear) return t;
+      else if constexpr (E == Ease::InQuad) return t * t;
+      else if constexpr (E == Ease::OutQuad) return t * (2.f - t);
+      else if constexpr (E == Ease::InOutQuad) return t < 0.5f ? 2.f * t * t : -1.f + (4.f - 2.f * t) * t;
+      else if constexpr (E == Ease::InCubic) return t * t * t;
+      else if constexpr (E == Ease::OutCubic)
+      {
+        float u = t - 1.f;
+        return u * u * u + 1.f;
+      }
+      else if constexpr (E == Ease::InOutCubic)
+      {
+        float u = 2.f * t - 2.f;
+        return t < 0.5f ? 4.f * t * t * t : 0.5f * u * u * u + 1.f;
+      }
+      else if constexpr (E == Ease::InSine) return 1.f - std::cos(t * PIf * 0.5f);
+      else if constexpr (E == Ease::OutSine) return std::sin(t * PIf * 0.5f);
+      else if constexpr (E == Ease::InOutSine) return 0.5f * (1.f - std::cos(t * PIf));
+      else if constexpr (E == Ease::OutBack)
+      {
+        constexpr float overshoot = 1.70158f;
+        float u = t - 1.f;
+        return 1.f + (overshoot + 1.f) * u * u * u + overshoot * u * u;
+      }
+      else return t;
+    }
+
+    #pragma endregion
+
+    #pragma region Storage
+
+    enum class LaneState : uint8_t
+    {
+      Waiting, // the delay has not passed yet
+      Running
+    };
+
+    // One animated float. Every lane in a pool uses the same curve.
+    struct LanePool
+    {
+      // read and written by the vectorized loops
+      std::vector<float> elapsed; // negative while waiting for the delay
+      std::vector<float> duration;
+      std::vector<float> inv_duration; // zero for a zero duration
+      std::vector<float> from;
+      std::vector<float> to;
+      std::vector<float> value;
+
+      // only used per lane
+      std::vector<FlexECS::EntityID> entity;
+      std::vector<TweenField> field;
+      std::vector<uint32_t> tween;      // slot index
+      std::vector<uint32_t> generation; // the lane is stale once the slot's generation moves on
+      std::vector<LaneState> state;
+      std::vector<uint8_t> capture_from;
+      std::vector<uint32_t> loops_played;
+
+      size_t Size() const { return elapsed.size(); }
+
+      void Push(
+        FlexECS::EntityID lane_entity, TweenField lane_field, uint32_t lane_tween, uint32_t lane_generation,
+        float lane_from, float lane_to, float lane_duration, float delay, bool capture
+      )
+      {
+        elapsed.push_back(-delay);
+        duration.push_back(lane_duration);
+        inv_duration.push_back(lane_duration > 0.f ? 1.f / lane_duration : 0.f);
+        from.push_back(lane_from);
+        to.push_back(lane_to);
+        value.push_back(lane_from);
+
+        entity.push_back(lane_entity);
+        field.push_back(lane_field);
+        tween.push_back(lane_tween);
+        generation.push_back(lane_generation);
+        state.push_back(LaneState::Waiting);
+        capture_from.push_back(capture ? 1 : 0);
+        loops_played.push_back(0);
+      }
+
+      void Move(size_t to_index, size_t from_index)
+      {
+        elapsed[to_index] = elapsed[from_index];
+        duration[to_index] = duration[from_index];
+        inv_duration[to_index] = inv_duration[from_index];
+        from[to_index] = from[from_index];
+        to[to_index] = to[from_index];
+        value[to_index] = value[from_index];
+
+        entity[to_index] = entity[from_index];
+        field[to_index] = field[from_index];
+        tween[to_index] = tween[from_index];
+        generation[to_index] = generation[from_index];
+        state[to_index] = state[from_index];
+        capture_from[to_index] = capture_from[from_index];
+        loops_played[to_index] = loops_played[from_index];
+      }
+
+      void Resize(size_t size)
+      {
+        elapsed.resize(size);
+        duration.resize(size);
+        inv_duration.resize(size);
+        from.resize(size);
+        to.resize(size);
+        value.resize(size);
+
+        entity.resize(size);
+        field.resize(size);
+        tween.resize(size);
+        generation.resize(size);
+        state.resize(size);
+        capture_from.resize(size);
+        loops_played.resize(size);
+      }
+    };
+
+    // What a handle refers to. Timelines have a slot but no lanes.
+    struct Slot
+    {
+      uint32_t generation = 0;
+      bool alive = false;
+      uint32_t remaining = 0; // lanes, or steps for a timeline, that have not finished
+      int loops = 0;
+      bool yoyo = false;
+      TweenHandle group; // the timeline this tween is a step of
+      std::function<void()> on_complete;
+    };
+
+    std::array<LanePool, static_cast<size_t>(Ease::Count)> pools;
+    std::vector<Slot> slots;
+    std::vector<uint32_t> free_slots;
+
+    // Callbacks of tweens that completed, called at the end of Update.
+    // The second list is the one being called, so the queue can grow while it runs.
+    std::vector<std::function<void()>> queued_callbacks;
+    std::vector<std::function<void()>> running_callbacks;
+
+    std::weak_ptr<FlexECS::Scene> tween_scene;
+
+    bool IsLaneCurrent(const LanePool& pool, size_t lane)
+    {
+      return slots[pool.tween[lane]].generation == pool.generation[lane];
+    }
+
+    TweenHandle AllocateSlot(uint32_t remaining, TweenHandle group)
+    {
+      uint32_t index;
+      if (!free_slots.empty())
+      {
+        index = free_slots.back();
+        free_slots.pop_back();
+      }
+      else
+      {
+        index = static_cast<uint32_t>(slots.size());
+        slots.emplace_back();
+      }
+
+      Slot& slot = slots[index];
+      slot.alive = true;
+      slot.remaining = remaining;
+      slot.loops = 0;
+      slot.yoyo = false;
+      slot.group = group;
+      return { index, slot.generation };
+    }
+
+    // Frees the slot, its lanes go stale and are removed by the next Update.
+    // A timeline completes once every step has finished or was killed.
+    void ReleaseSlot(uint32_t index, bool completed)
+    {
+      Slot& slot = slots[index];
+      if (completed && slot.on_complete) queued_callbacks.push_back(std::move(slot.on_complete));
+      slot.on_complete = nullptr;
+      slot.alive = false;
+      slot.generation++;
+      free_slots.push_back(index);
+
+      TweenHandle group = slot.group;
+      slot.group = {};
+      if (TweenSystem::IsActive(group) && --slots[group.index].remaining == 0) ReleaseSlot(group.index, true);
+    }
+
+    // The entities of the tweens belong to the scene they were created in.
+    void SyncScene()
+    {
+      std::shared_ptr<FlexECS::Scene> active_scene = FlexECS::Scene::GetActiveScene();
+      if (tween_scene.lock() == active_scene) return;
+
+      TweenSystem::Clear();
+      tween_scene = active_scene;
+    }
+
+    // The lanes in capture_lanes (a bit per lane) read their starting value when they start,
+    // the others start from the given one.
+    TweenHandle CreateTween(
+      FlexECS::EntityID entity, TweenField field, uint32_t lanes,
+      const float* from, const float* to, uint32_t capture_lanes,
+      float duration, Ease ease, float delay, TweenHandle group
+    )
+    {
+      SyncScene();
+
+      // guard: unknown curve
+      if (static_cast<size_t>(ease) >= pools.size())
+      {
+        Log::Warning("Tween created with an unknown easing curve, using Ease::Linear.");
+        ease = Ease::Linear;
+      }
+
+      TweenHandle handle = AllocateSlot(lanes, group);
+      LanePool& pool = pools[static_cast<size_t>(ease)];
+      for (uint32_t i = 0; i < lanes; ++i)
+      {
+        TweenField lane_field = (field == TweenField::None) ? field : static_cast<TweenField>(static_cast<uint8_t>(field) + i);
+        pool.Push(
+          entity, lane_field, handle.index, handle.generation,
+          from ? from[i] : 0.f, to ? to[i] : 0.f, std::max(duration, 0.f), std::max(delay, 0.f),
+          field != TweenField::None && (capture_lanes & (1u << i)) != 0
+        );
+      }
+      return handle;
+    }
+
+    TweenField GetFirstField(TweenVector field)
+    {
+      switch (field)
+      {
+      case TweenVector::Position: return TweenField::PositionX;
+      case TweenVector::Scale: return TweenField::ScaleX;
+      case TweenVector::Rotation: return TweenField::RotationX;
+      case TweenVector::TextColor: return TweenField::TextColorR;
+      default: return TweenField::None;
+      }
+    }
+
+    #pragma endregion
+
+    #pragma region Component Fields
+
+    // The axis of a vector field, counted from its first field.
+    size_t GetAxis(TweenField field, TweenField first)
+    {
+      return static_cast<size_t>(field) - static_cast<size_t>(first);
+    }
+
+    // Returns false if the entity does not have the component of the field.
+    bool ReadField(FlexECS::Entity entity, TweenField field, float& out)
+    {
+      switch (field)
+      {
+      case TweenField::PositionX: case TweenField::PositionY: case TweenField::PositionZ:
+        if (!entity.HasComponent<Position>()) return false;
+        out = entity.ReadComponent<Position>()->position.data[GetAxis(field, TweenField::PositionX)];
+        return true;
+      case TweenField::ScaleX: case TweenField::ScaleY: case TweenField::ScaleZ:
+        if (!entity.HasComponent<Scale>()) return false;
+        out = entity.ReadComponent<Scale>()->scale.data[GetAxis(field, TweenField::ScaleX)];
+        return true;
+      case TweenField::RotationX: case TweenField::RotationY: case TweenField::RotationZ:
+        if (!entity.HasComponent<Rotation>()) return false;
+        out = entity.ReadComponent<Rotation>()->rotation.data[GetAxis(field, TweenField::RotationX)];
+        return true;
+      case TweenField::Opacity:
+        if (!entity.HasComponent<Sprite>()) return false;
+        out = entity.ReadComponent<Sprite>()->opacity;
+        return true;
+      case TweenField::TextColorR: case TweenField::TextColorG: case TweenField::TextColorB:
+        if (!entity.HasComponent<Text>()) return false;
+        out = entity.ReadComponent<Text>()->color.data[GetAxis(field, TweenField::TextColorR)];
+        return true;
+      default:
+        return false;
+      }
+    }
+
+    // Returns false if the entity does not have the component of the field.
+    // Writes through GetComponent, so the field shows up in ChangedQuery.
+    bool WriteField(FlexECS::Entity entity, TweenField field, float value)
+    {
+      switch (field)
+      {
+      case TweenField::PositionX: case TweenField::PositionY: case TweenField::PositionZ:
+      {
+        Position* position = entity.GetComponent<Position>();
+        if (!position) return false;
+        position->position.data[GetAxis(field, TweenField::PositionX)] = value;
+        return true;
+      }
+      case TweenField::ScaleX: case TweenField::ScaleY: case TweenField::ScaleZ:
+      {
+        Scale* scale = entity.GetComponent<Scale>();
+        if (!scale) return false;
+        scale->scale.data[GetAxis(field, TweenField::ScaleX)] = value;
+        return true;
+      }
+      case TweenField::RotationX: case TweenField::RotationY: case TweenField::RotationZ:
+      {
+        Rotation* rotation = entity.GetComponent<Rotation>();
+        if (!rotation) return false;
+        rotation->rotation.data[GetAxis(field, TweenField::RotationX)] = value;
+        return true;
+      }
+      case TweenField::Opacity:
+      {
+        Sprite* sprite = entity.GetComponent<Sprite>();
+        if (!sprite) return false;
+        sprite->opacity = value;
+        return true;
+      }
+      case TweenField::TextColorR: case TweenField::TextColorG: case TweenField::TextColorB:
+      {
+        Text* text = entity.GetComponent<Text>();
+        if (!text) return false;
+        text->color.data[GetAxis(field, TweenField::TextColorR)] = value;
+        return true;
+      }
+      default:
+        return true;
+      }
+    }
+
+    bool EntityExists(FlexECS::EntityID entity)
+    {
+      return ENTITY_INDEX.count(entity) != 0;
+    }
+
+    #pragma endregion
+
+    #pragma region Update Passes
+
+    // Vectorized, every lane including the waiting and stale ones.
+    void Advance(LanePool& pool, float dt)
+    {
+      float* elapsed = pool.elapsed.data();
+      const size_t size = pool.Size();
+      for (size_t i = 0; i < size; ++i) elapsed[i] += dt;
+    }
+
+    // Lanes whose delay just passed read their starting value.
+    void StartLanes(LanePool& pool)
+    {
+      const size_t size = pool.Size();
+      for (size_t i = 0; i < size; ++i)
+      {
+        if (pool.state[i] != LaneState::Waiting || pool.elapsed[i] < 0.f) continue;
+        if (!IsLaneCurrent(pool, i)) continue;
+
+        pool.state[i] = LaneState::Running;
+        if (!pool.capture_from[i]) continue;
+
+        // guard: the entity or its component is gone, drop the whole tween
+        float start = 0.f;
+        if (!EntityExists(pool.entity[i]) || !ReadField(pool.entity[i], pool.field[i], start))
+        {
+          ReleaseSlot(pool.tween[i], false);
+          continue;
+        }
+        pool.from[i] = start;
+        pool.capture_from[i] = 0;
+      }
+    }
+
+    // Vectorized, every lane including the waiting and stale ones, they are not written back.
+    template <Ease E>
+    void Evaluate(LanePool& pool)
+    {
+      const float* elapsed = pool.elapsed.data();
+      const float* duration = pool.duration.data();
+      const float* inv_duration = pool.inv_duration.data();
+      const float* from = pool.from.data();
+      const float* to = pool.to.data();
+      float* value = pool.value.data();
+
+      const size_t size = pool.Size();
+      for (size_t i = 0; i < size; ++i)
+      {
+        // a lane is finished once elapsed reaches its duration, which is also how a zero duration ends
+        float t = std::min(std::max(elapsed[i] * inv_duration[i], 0.f), 1.f);
+        t = elapsed[i] >= duration[i] ? 1.f : t;
+        value[i] = from[i] + (to[i] - from[i]) * Curve<E>(t);
+      }
+    }
+
+    using EvaluateFunction = void (*)(LanePool&);
+    constexpr EvaluateFunction evaluate_functions[] = {
+      &Evaluate<Ease::Linear>,
+      &Evaluate<Ease::InQuad>,
+      &Evaluate<Ease::OutQuad>,
+      &Evaluate<Ease::InOutQuad>,
+      &Evaluate<Ease::InCubic>,
+      &Evaluate<Ease::OutCubic>,
+      &Evaluate<Ease::InOutCubic>,
+      &Evaluate<Ease::InSine>,
+      &Evaluate<Ease::OutSine>,
+      &Evaluate<Ease::InOutSine>,
+      &Evaluate<Ease::OutBack>
+    };
+    static_assert(std::size(evaluate_functions) == static_cast<size_t>(Ease::Count), "Every easing curve needs an Evaluate.");
+
+    // Writes the running lanes into their components, then loops or retires
+    // the finished ones and removes the stale ones, keeping the lane order.
+    void WriteAndRetire(LanePool& pool)
+    {
+      const size_t size = pool.Size();
+      size_t kept = 0;
+      for (size_t i = 0; i < size; ++i)
+      {
+        // killed, or a sibling lane dropped the tween this update
+        if (!IsLaneCurrent(pool, i)) continue;
+
+        if (pool.state[i] == LaneState::Running)
+        {
+          // guard: the entity or its component is gone, drop the whole tween
+          FlexECS::EntityID entity = pool.entity[i];
+          if (pool.field[i] != TweenField::None && (!EntityExists(entity) || !WriteField(entity, pool.field[i], pool.value[i])))
+          {
+            ReleaseSlot(pool.tween[i], false);
+            continue;
+          }
+
+          if (pool.elapsed[i] >= pool.duration[i])
+          {
+            Slot& slot = slots[pool.tween[i]];
+            if (slot.loops < 0 || pool.loops_played[i] < static_cast<uint32_t>(slot.loops))
+            {
+              // play again, keeping the time that overshot the end
+              pool.loops_played[i]++;
+              pool.elapsed[i] -= pool.duration[i];
+              if (slot.yoyo) std::swap(pool.from[i], pool.to[i]);
+            }
+            else
+            {
+              if (--slot.remaining == 0) ReleaseSlot(pool.tween[i], true);
+              continue;
+            }
+          }
+        }
+
+        if (kept != i) pool.Move(kept, i);
+        kept++;
+      }
+      pool.Resize(kept);
+    }
+
+    #pragma endregion
+  }
+
+  float EvaluateEase(Ease ease, float t)
+  {
+    t = std::min(std::max(t, 0.f), 1.f);
+    switch (ease)
+    {
+    case Ease::InQuad: return Curve<Ease::InQuad>(t);
+    case Ease::OutQuad: return Curve<Ease::OutQuad>(t);
+    case Ease::InOutQuad: return Curve<Ease::InOutQuad>(t);
+    case Ease::InCubic: return Curve<Ease::InCubic>(t);
+    case Ease::OutCubic: return Curve<Ease::OutCubic>(t);
+    case Ease::InOutCubic: return Curve<Ease::InOutCubic>(t);
+    case Ease::InSine: return Curve<Ease::InSine>(t);
+    case Ease::OutSine: return Curve<Ease::OutSine>(t);
+    case Ease::InOutSine: return Curve<Ease::InOutSine>(t);
+    case Ease::OutBack: return Curve<Ease::OutBack>(t);
+    default: return t;
+    }
+  }
+
+  #pragma region TweenSystem
+
+  TweenHandle TweenSystem::To(FlexECS::Entity entity, TweenField field, float to, float duration, Ease ease, float delay)
+  {
+    return CreateTween(entity, field, 1, nullptr, &to, ~0u, duration, ease, delay, {});
+  }
+
+  TweenHandle TweenSystem::To(FlexECS::Entity entity, TweenVector field, const Vector3& to, float duration, Ease ease, float delay)
+  {
+    return CreateTween(entity, GetFirstField(field), 3, nullptr, to.data, ~0u, duration, ease, delay, {});
+  }
+
+  TweenHandle TweenSystem::FromTo(FlexECS::Entity entity, TweenField field, float from, float to, float duration, Ease ease, float delay)
+  {
+    return CreateTween(entity, field, 1, &from, &to, 0, duration, ease, delay, {});
+  }
+
+  TweenHandle TweenSystem::FromTo(FlexECS::Entity entity, TweenVector field, const Vector3& from, const Vector3& to, float duration, Ease ease, float delay)
+  {
+    return CreateTween(entity, GetFirstField(field), 3, from.data, to.data, 0, duration, ease, delay, {});
+  }
+
+  TweenHandle TweenSystem::Delay(float seconds)
+  {
+    return CreateTween(0, TweenField::None, 1, nullptr, nullptr, 0, 0.f, Ease::Linear, seconds, {});
+  }
+
+  void TweenSystem::SetLoops(TweenHandle handle, int loops, bool yoyo)
+  {
+    // guard: completed or killed
+    if (!IsActive(handle)) return;
+
+    slots[handle.index].loops = loops;
+    slots[handle.index].yoyo = yoyo;
+  }
+
+  void TweenSystem::OnComplete(TweenHandle handle, std::function<void()> callback)
+  {
+    // guard: completed or killed
+    if (!IsActive(handle)) return;
+
+    slots[handle.index].on_complete = std::move(callback);
+  }
+
+  void TweenSystem::Kill(TweenHandle handle)
+  {
+    // guard: completed or killed
+    if (!IsActive(handle)) return;
+
+    ReleaseSlot(handle.index, false);
+
+    // the steps of a timeline
+    for (uint32_t i = 0; i < slots.size(); ++i)
+    {
+      if (slots[i].alive && slots[i].group == handle) ReleaseSlot(i, false);
+    }
+  }
+
+  void TweenSystem::KillAll(FlexECS::Entity entity)
+  {
+    FlexECS::EntityID id = entity;
+    for (LanePool& pool : pools)
+    {
+      for (size_t i = 0; i < pool.Size(); ++i)
+      {
+        if (pool.entity[i] == id && pool.field[i] != TweenField::None && IsLaneCurrent(pool, i)) ReleaseSlot(pool.tween[i], false);
+      }
+    }
+  }
+
+  void TweenSystem::Clear()
+  {
+    for (LanePool& pool : pools) pool.Resize(0);
+
+    free_slots.clear();
+    for (uint32_t i = 0; i < slots.size(); ++i)
+    {
+      Slot& slot = slots[i];
+      if (slot.alive) slot.generation++;
+      slot.alive = false;
+      slot.group = {};
+      slot.on_complete = nullptr;
+      free_slots.push_back(i);
+    }
+
+    queued_callbacks.clear();
+  }
+
+  bool TweenSystem::IsActive(TweenHandle handle)
+  {
+    return handle.index < slots.size() && slots[handle.index].alive && slots[handle.index].generation == handle.generation;
+  }
+
+  size_t TweenSystem::GetLaneCount()
+  {
+    size_t count = 0;
+    for (const LanePool& pool : pools)
+    {
+      for (size_t i = 0; i < pool.Size(); ++i)
+      {
+        if (IsLaneCurrent(pool, i)) count++;
+      }
+    }
+    return count;
+  }
+
+  void TweenSystem::Update(float dt)
+  {
+    SyncScene();
+
+    for (size_t ease = 0; ease < pools.size(); ++ease)
+    {
+      LanePool& pool = pools[ease];
+
+      // guard: nothing uses this curve
+      if (pool.Size() == 0) continue;
+
+      Advance(pool, dt);
+      StartLanes(pool);
+      evaluate_functions[ease](pool);
+      WriteAndRetire(pool);
+    }
+
+    // callbacks may create, kill and complete tweens, those wait for the next update
+    running_callbacks.swap(queued_callbacks);
+    for (std::function<void()>& callback : running_callbacks) callback();
+    running_callbacks.clear();
+  }
+
+  #pragma endregion
+
+  #pragma region Timeline
+
+  Timeline& Timeline::Internal_Add(Step step, float start)
+  {
+    step.start = std::max(start, 0.f);
+    m_last_start = step.start;
+    m_duration = std::max(m_duration, step.start + step.duration);
+    m_steps.push_back(std::move(step));
+    return *this;
+  }
+
+  Timeline::Step Timeline::Internal_MakeStep(FlexECS::EntityID entity, TweenField field, uint32_t lanes, const float* to, float duration, Ease ease)
+  {
+    Step step;
+    step.entity = entity;
+    step.field = field;
+    step.lanes = lanes;
+    std::copy(to, to + lanes, step.to);
+    step.duration = std::max(duration, 0.f);
+    step.ease = ease;
+    return step;
+  }
+
+  Timeline& Timeline::Append(FlexECS::Entity entity, TweenField field, float to, float duration, Ease ease)
+  {
+    return Internal_Add(Internal_MakeStep(entity, field, 1, &to, duration, ease), m_duration);
+  }
+
+  Timeline& Timeline::Append(FlexECS::Entity entity, TweenVector field, const Vector3& to, float duration, Ease ease)
+  {
+    return Internal_Add(Internal_MakeStep(entity, GetFirstField(field), 3, to.data, duration, ease), m_duration);
+  }
+
+  Timeline& Timeline::Join(FlexECS::Entity entity, TweenField field, float to, float duration, Ease ease)
+  {
+    return Internal_Add(Internal_MakeStep(entity, field, 1, &to, duration, ease), m_last_start);
+  }
+
+  Timeline& Timeline::Join(FlexECS::Entity entity, TweenVector field, const Vector3& to, float duration, Ease ease)
+  {
+    return Internal_Add(Internal_MakeStep(entity, GetFirstField(field), 3, to.data, duration, ease), m_last_start);
+  }
+
+  Timeline& Timeline::Insert(float time, FlexECS::Entity entity, TweenField field, float to, float duration, Ease ease)
+  {
+    return Internal_Add(Internal_MakeStep(entity, field, 1, &to, duration, ease), time);
+  }
+
+  Timeline& Timeline::Insert(float time, FlexECS::Entity entity, TweenVector field, const Vector3& to, float duration, Ease ease)
+  {
+    return Internal_Add(Internal_MakeStep(entity, GetFirstField(field), 3, to.data, duration, ease), time);
+  }
+
+  Timeline& Timeline::AppendInterval(float seconds)
+  {
+    m_duration += std::max(seconds, 0.f);
+    return *this;
+  }
+
+  Timeline& Timeline::AppendCallback(std::function<void()> callback)
+  {
+    Step step;
+    step.lanes = 1;
+    step.callback = std::move(callback);
+    return Internal_Add(std::move(step), m_duration);
+  }
+
+  TweenHandle Timeline::Play(float delay) const
+  {
+    SyncScene();
+
+    // every step and the end of the timeline have to finish
+    TweenHandle timeline = AllocateSlot(static_cast<uint32_t>(m_steps.size()) + 1, {});
+
+    for (size_t i = 0; i < m_steps.size(); ++i)
+    {
+      const Step& step = m_steps[i];
+
+      // A lane continues from the target of the last earlier step on the same field.
+      // Reading it when the lane starts would depend on which of the two is updated first.
+      float from[3] = { 0.f, 0.f, 0.f };
+      uint32_t capture_lanes = 0;
+      for (uint32_t lane = 0; lane < step.lanes; ++lane)
+      {
+        TweenField field = static_cast<TweenField>(static_cast<uint8_t>(step.field) + lane);
+        float latest_end = -1.f;
+        for (size_t j = 0; j < i; ++j)
+        {
+          const Step& earlier = m_steps[j];
+          float end = earlier.start + earlier.duration;
+          if (earlier.entity != step.entity || earlier.field == TweenField::None || end > step.start || end < latest_end) continue;
+
+          size_t earlier_lane = static_cast<size_t>(field) - static_cast<size_t>(earlier.field);
+          if (static_cast<uint8_t>(field) < static_cast<uint8_t>(earlier.field) || earlier_lane >= earlier.lanes) continue;
+
+          from[lane] = earlier.to[earlier_lane];
+          latest_end = end;
+        }
+        if (latest_end < 0.f) capture_lanes |= 1u << lane;
+      }
+
+      TweenHandle handle = CreateTween(
+        step.entity, step.field, step.lanes, from, step.to, capture_lanes,
+        step.duration, step.ease, delay + step.start, timeline
+      );
+      if (step.callback) slots[handle.index].on_complete = step.callback;
+    }
+
+    // the end, so a trailing interval is waited for
+    CreateTween(0, TweenField::None, 1, nullptr, nullptr, 0, 0.f, Ease::Linear, delay + m_duration, timeline);
+    return timeline;
+  }
+
+  #pragma endregion
+
+}
@@ -0,0 +1,220 @@
+// WLVERSE [https://wlverse.web.app]
+// tween.h
+//
+// Tweens that animate component fields over time, and timelines that
+// sequence them.
+//
+// A tween animates one field (position, scale, rotation, sprite opacity or
+// text color) of one entity from a value to another with an easing curve.
+// Vector fields are split into one lane per axis. Lanes are stored in
+// structure of arrays pools, one pool per easing curve, so Update evaluates
+// every lane of a pool in one loop without branching on the curve, and only
+// the write back into the components is done per lane.
+//
+// Completion callbacks are queued while the tweens are evaluated and called
+// at the end of Update, so a callback can safely start or kill tweens.
+//
+// Tweens belong to the scene that was active when they were created, all of
+// them are dropped without calling their callbacks when the active scene
+// changes. A lane whose entity was destroyed is dropped the same way.
+//
+// Usage:
+//   // slide a button in and fade it, then do something once it is in place
+//   TweenHandle slide = TweenSystem::To(button, TweenVector::Scale, Vector3(1, 1, 1), 0.25f, Ease::OutCubic);
+//   TweenSystem::OnComplete(slide, []() { ... });
+//
+//   // bob an arrow up and down forever
+//   TweenHandle bob = TweenSystem::FromTo(arrow, TweenField::PositionY, y - 5.f, y + 5.f, 0.5f, Ease::InOutSine);
+//   TweenSystem::SetLoops(bob, -1, true);
+//
+//   // sequence steps, each Append starts after the previous step, Join starts with it
+//   Timeline()
+//     .Append(icon, TweenVector::Scale, Vector3(1.2f, 1.2f, 1.2f), 0.2f, Ease::OutQuad)
+//     .Append(icon, TweenField::PositionX, 300.f, 0.8f)
+//     .Join(icon, TweenVector::Scale, Vector3(1, 1, 1), 0.8f)
+//     .AppendCallback([]() { ... })
+//     .Play();
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#pragma once
+
+#include "flx_api.h"
+
+#include "FlexECS/datastructures.h"
+#include "FlexMath/vector3.h"
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace FlexEngine
+{
+
+  // Easing curves, each one maps 0 to 0 and 1 to 1.
+  enum class Ease : uint8_t
+  {
+    Linear,
+    InQuad,
+    OutQuad,
+    InOutQuad,
+    InCubic,
+    OutCubic,
+    InOutCubic,
+    InSine,
+    OutSine,
+    InOutSine,
+    OutBack,
+
+    Count
+  };
+
+  // Evaluates the curve for a single t between 0 and 1.
+  __FLX_API float EvaluateEase(Ease ease, float t);
+
+  // The component fields a tween can animate.
+  // The axes of a vector field are consecutive, starting from the X or R axis.
+  enum class TweenField : uint8_t
+  {
+    None, // animates nothing, used for delays and callbacks
+
+    PositionX, PositionY, PositionZ,
+    ScaleX, ScaleY, ScaleZ,
+    RotationX, RotationY, RotationZ,
+    Opacity, // Sprite::opacity
+    TextColorR, TextColorG, TextColorB
+  };
+
+  // Vector fields, animated as three lanes that share a handle.
+  enum class TweenVector : uint8_t
+  {
+    Position,
+    Scale,
+    Rotation,
+    TextColor
+  };
+
+  // Refers to a tween or a timeline. A handle stays valid until the tween
+  // completes or is killed, after that IsActive returns false.
+  struct __FLX_API TweenHandle
+  {
+    static constexpr uint32_t NONE = ~0u;
+
+    uint32_t index = NONE;
+    uint32_t generation = 0;
+
+    bool operator==(const TweenHandle& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const TweenHandle& other) const { return !(*this == other); }
+  };
+
+  // All functions must be called from the main thread.
+  class __FLX_API TweenSystem
+  {
+  public:
+    // static class
+    TweenSystem() = delete;
+    TweenSystem(const TweenSystem&) = delete;
+    TweenSystem& operator=(const TweenSystem&) = delete;
+
+    #pragma region Creating Tweens
+
+    // Animates the field from its value when the tween starts (after the delay) to the target.
+    static TweenHandle To(FlexECS::Entity entity, TweenField field, float to, float duration, Ease ease = Ease::Linear, float delay = 0.f);
+    static TweenHandle To(FlexECS::Entity entity, TweenVector field, const Vector3& to, float duration, Ease ease = Ease::Linear, float delay = 0.f);
+
+    // Animates the field between two given values.
+    static TweenHandle FromTo(FlexECS::Entity entity, TweenField field, float from, float to, float duration, Ease ease = Ease::Linear, float delay = 0.f);
+    static TweenHandle FromTo(FlexECS::Entity entity, TweenVector field, const Vector3& from, const Vector3& to, float duration, Ease ease = Ease::Linear, float delay = 0.f);
+
+    // A tween that animates nothing, complete it with OnComplete to call something later.
+    static TweenHandle Delay(float seconds);
+
+    #pragma endregion
+
+    #pragma region Controlling Tweens
+
+    // Repeats the tween, loops is the number of times it plays again, -1 repeats it forever.
+    // With yoyo every other loop plays backwards.
+    static void SetLoops(TweenHandle handle, int loops, bool yoyo = false);
+
+    // Called once at the end of the Update the tween completed in, not when it is killed.
+    static void OnComplete(TweenHandle handle, std::function<void()> callback);
+
+    // Stops the tween where it is, without calling its callback.
+    // Killing a timeline kills every step of it, a timeline with a killed step completes without it.
+    static void Kill(TweenHandle handle);
+
+    // Kills every tween that animates the entity.
+    static void KillAll(FlexECS::Entity entity);
+
+    // Kills every tween.
+    static void Clear();
+
+    static bool IsActive(TweenHandle handle);
+
+    // Number of active lanes, a vector tween has three.
+    static size_t GetLaneCount();
+
+    #pragma endregion
+
+    // Advances every tween and writes the results into the components, then calls the queued callbacks.
+    static void Update(float dt);
+  };
+
+  // Builds a sequence of tweens, Play schedules them all at once.
+  // A step continues from the target of the last earlier step on the same field,
+  // otherwise it reads the field when it starts, not when the timeline is played.
+  class __FLX_API Timeline
+  {
+  public:
+    // Starts after every step added so far.
+    Timeline& Append(FlexECS::Entity entity, TweenField field, float to, float duration, Ease ease = Ease::Linear);
+    Timeline& Append(FlexECS::Entity entity, TweenVector field, const Vector3& to, float duration, Ease ease = Ease::Linear);
+
+    // Starts together with the previous step.
+    Timeline& Join(FlexECS::Entity entity, TweenField field, float to, float duration, Ease ease = Ease::Linear);
+    Timeline& Join(FlexECS::Entity entity, TweenVector field, const Vector3& to, float duration, Ease ease = Ease::Linear);
+
+    // Starts at the given time from the start of the timeline.
+    Timeline& Insert(float time, FlexECS::Entity entity, TweenField field, float to, float duration, Ease ease = Ease::Linear);
+    Timeline& Insert(float time, FlexECS::Entity entity, TweenVector field, const Vector3& to, float duration, Ease ease = Ease::Linear);
+
+    // Waits before the next appended step.
+    Timeline& AppendInterval(float seconds);
+
+    // Calls the function once every step added so far has finished.
+    Timeline& AppendCallback(std::function<void()> callback);
+
+    // Length of the timeline in seconds.
+    float GetDuration() const { return m_duration; }
+
+    // Schedules the steps. The handle completes when the last step does,
+    // OnComplete on it is called after the callbacks of the steps.
+    TweenHandle Play(float delay = 0.f) const;
+
+  private:
+    struct Step
+    {
+      FlexECS::EntityID entity = 0;
+      TweenField field = TweenField::None;
+      uint32_t lanes = 0;
+      float to[3] = { 0.f, 0.f, 0.f };
+      float start = 0.f;
+      float duration = 0.f;
+      Ease ease = Ease::Linear;
+      std::function<void()> callback;
+    };
+
+    static Step Internal_MakeStep(FlexECS::EntityID entity, TweenField field, uint32_t lanes, const float* to, float duration, Ease ease);
+    Timeline& Internal_Add(Step step, float start);
+
+    std::vector<Step> m_steps;
+    float m_last_start = 0.f;
+    float m_duration = 0.f;
+  };
+
+}
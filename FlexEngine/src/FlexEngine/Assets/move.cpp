@@ -6,6 +6,38 @@ namespace FlexEngine
 {
   namespace Asset
   {
+    MoveEffect ParseMoveEffect(const std::string& effect)
+    {
+      static const std::unordered_map<std::string, MoveEffect> lookup = {
+        { "Damage", MoveEffect::Damage }, { "Heal", MoveEffect::Heal },
+        { "Speed_Up", MoveEffect::Speed_Up }, { "Speed_Down", MoveEffect::Speed_Down },
+        { "Attack_Up", MoveEffect::Attack_Up }, { "Attack_Down", MoveEffect::Attack_Down },
+        { "Stun", MoveEffect::Stun }, { "Shield", MoveEffect::Shield }, { "Protect", MoveEffect::Protect },
+        { "Strip", MoveEffect::Strip }, { "Cleanse", MoveEffect::Cleanse }
+      };
+      auto it = lookup.find(effect);
+      return (it != lookup.end()) ? it->second : MoveEffect::Unknown;
+    }
+
+    MoveTarget ParseMoveTarget(const std::string& target)
+    {
+      static const std::unordered_map<std::string, MoveTarget> lookup = {
+        { "ALL_ENEMIES", MoveTarget::All_Enemies }, { "ADJACENT_ENEMIES", MoveTarget::Adjacent_Enemies },
+        { "NEXT_ENEMY", MoveTarget::Next_Enemy }, { "SINGLE_ENEMY", MoveTarget::Single_Enemy },
+        { "ALL_ALLIES", MoveTarget::All_Allies }, { "NEXT_ALLY", MoveTarget::Next_Ally }, { "SINGLE_ALLY", MoveTarget::Single_Ally },
+        { "ALL", MoveTarget::All }, { "SELF", MoveTarget::Self }
+      };
+      auto it = lookup.find(target);
+      return (it != lookup.end()) ? it->second : MoveTarget::Unknown;
+    }
+
+    bool TargetsAllies(const std::vector<MoveOp>& ops)
+    {
+      if (ops.empty()) return false;
+      MoveTarget first = ops[0].target;
+      return first == MoveTarget::All_Allies || first == MoveTarget::Next_Ally || first == MoveTarget::Single_Ally || first == MoveTarget::Self;
+    }
+
     Move::Move(File& _metadata)
       : metadata(_metadata)
     {
@@ -60,6 +92,40 @@ namespace FlexEngine
           std::getline(iss >> std::ws, description); // Read the rest of the line, trimming leading spaces
         }
       }
+
+      // compile the parallel lists into ops so that battles never compare strings
+      std::size_t count = effect.size();
+      if (value.size() != count || target.size() != count)
+      {
+        Log::Warning(
+          "Move " + metadata.path.string() + " has " + std::to_string(effect.size()) + " effects, " +
+          std::to_string(value.size()) + " values and " + std::to_string(target.size()) + " targets, extra entries are ignored"
+        );
+        count = std::min({ effect.size(), value.size(), target.size() });
+      }
+
+      ops.reserve(count);
+      for (std::size_t i = 0; i < count; i++)
+      {
+        MoveOp op;
+        op.effect = ParseMoveEffect(effect[i]);
+        op.target = ParseMoveTarget(target[i]);
+        op.value = value[i];
+
+        if (op.effect == MoveEffect::Unknown || op.target == MoveTarget::Unknown)
+        {
+          Log::Warning("Move " + metadata.path.string() + " has an unknown effect or target: " + effect[i] + " " + target[i]);
+          continue;
+        }
+        if (op.value < 0)
+        {
+          Log::Warning("Move " + metadata.path.string() + " has a negative value for " + effect[i]);
+        }
+
+        ops.push_back(op);
+      }
+
+      targets_allies = TargetsAllies(ops);
     }
   } // namespace Asset
 } // namespace FlexEngine
@@ -5,11 +5,44 @@
 #include "Utilities/file.h"
 #include "assetkey.h"
 
+#include <cstdint> // uint8_t
+
 namespace FlexEngine
 {
   namespace Asset
   {
 
+    // Effect names as written in .flxmove files
+    enum class MoveEffect : uint8_t
+    {
+      Damage, Heal, Speed_Up, Speed_Down, Attack_Up, Attack_Down, Stun, Shield, Protect, Strip, Cleanse,
+      Unknown
+    };
+
+    // Target names as written in .flxmove files.
+    // Relative to the character using the move, so ALL_ENEMIES used by an enemy hits the drifters.
+    enum class MoveTarget : uint8_t
+    {
+      All_Enemies, Adjacent_Enemies, Next_Enemy, Single_Enemy, All_Allies, Next_Ally, Single_Ally, All, Self,
+      Unknown
+    };
+
+    // Returns Unknown for names that are not in the enum
+    __FLX_API MoveEffect ParseMoveEffect(const std::string& effect);
+    __FLX_API MoveTarget ParseMoveTarget(const std::string& target);
+
+    // One Effect/Value/Target entry of a move, compiled when the file is loaded
+    struct __FLX_API MoveOp
+    {
+      MoveEffect effect = MoveEffect::Unknown;
+      MoveTarget target = MoveTarget::Unknown;
+      int value = 0;
+    };
+
+    // The first target decides which side the move is aimed at.
+    // Returns true for ALL_ALLIES, NEXT_ALLY, SINGLE_ALLY and SELF.
+    __FLX_API bool TargetsAllies(const std::vector<MoveOp>& ops);
+
     // TODO: use the flxfmt formatter
     // TODO: save any changes to file
     struct __FLX_API Move
@@ -19,10 +52,16 @@ namespace FlexEngine
       std::string name = "None";
       int speed = 0;
 
+      // as written in the file
       std::vector<std::string> effect;
       std::vector<int> value;
       std::vector<std::string> target;
-     
+
+      // The entries above after validation, in file order.
+      // Entries with an unknown effect or target are dropped with a warning.
+      std::vector<MoveOp> ops;
+      bool targets_allies = false;
+
       std::string description = "";
 
       Move(File& _metadata);
@@ -0,0 +1,436 @@
+// WLVERSE [https://wlverse.web.app]
+// battlesim.cpp
+//
+// Headless battle simulator for balance runs.
+//
+// The rules come from battlestate.h, the same functions the battle layer
+// calls from Start_Of_Turn, Move_Select, Move_Resolution and End_Of_Turn.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#include "pch.h"
+
+#include "battlesim.h"
+#include "battlestate.h"
+
+#include "Assets/battle.h"
+#include "Assets/character.h"
+
+#include <algorithm> // std::replace
+#include <chrono>
+#include <cmath> // std::ceil
+#include <fstream>
+#include <iomanip> // std::setprecision
+#include <iostream>
+#include <random>
+#include <thread>
+
+namespace FlexEngine
+{
+  namespace BattleSim
+  {
+
+    #pragma region Battle Data
+
+    // asset keys start with a slash, which would make the path absolute
+    static Path KeyToPath(const Path& assets_root, const std::string& key)
+    {
+      std::string relative = key;
+      if (!relative.empty() && (relative[0] == '/' || relative[0] == '\\')) relative.erase(0, 1);
+      return assets_root.append(relative);
+    }
+
+    static std::string ReplaceUnderscores(std::string str)
+    {
+      std::replace(str.begin(), str.end(), '_', ' ');
+      return str;
+    }
+
+    bool BattleData::Load(const Path& assets_root, const std::string& battle_key, BattleData& out)
+    {
+      out = BattleData();
+      out.name = battle_key;
+
+      Path battle_path = KeyToPath(assets_root, battle_key);
+      if (!battle_path.is_file())
+      {
+        Log::Error("Battle file not found: " + battle_path.string());
+        return false;
+      }
+
+      Asset::Battle battle(File::Open(battle_path));
+      out.is_boss = (battle.battle_num == 2); // same check as Internal_ParseBattle
+
+      auto load_side = [&](const std::vector<AssetKey*>& slots) -> bool
+      {
+        int slot = 0;
+        for (AssetKey* key : slots)
+        {
+          // empty slots still take up a slot number
+          if (*key == "None" || key->empty()) { slot++; continue; }
+
+          Path character_path = KeyToPath(assets_root, *key);
+          if (!character_path.is_file())
+          {
+            Log::Error("Character file not found: " + character_path.string());
+            return false;
+          }
+
+          Asset::Character character_asset(File::Open(character_path));
+
+          CharacterData character;
+          character.name = ReplaceUnderscores(character_asset.character_name);
+          character.character_id = character_asset.character_id;
+          character.health = character_asset.health;
+          character.speed = character_asset.speed;
+          character.slot = slot++;
+
+          for (const AssetKey& move_key : { character_asset.move_one, character_asset.move_two, character_asset.move_three })
+          {
+            if (move_key == "None" || move_key.empty()) continue;
+
+            Path move_path = KeyToPath(assets_root, move_key);
+            if (!move_path.is_file())
+            {
+              Log::Error("Move file not found: " + move_path.string());
+              return false;
+            }
+
+            Asset::Move move_asset(File::Open(move_path));
+
+            MoveData move;
+            move.name = ReplaceUnderscores(move_asset.name);
+            move.speed = move_asset.speed;
+
+            move.ops = move_asset.ops;
+
+            character.moves.push_back(move);
+          }
+
+          out.characters.push_back(character);
+        }
+        return true;
+      };
+
+      if (!load_side(battle.GetDrifterSlots())) return false;
+      if (!load_side(battle.GetEnemySlots())) return false;
+      return true;
+    }
+
+    #pragma endregion
+
+    #pragma region Simulation
+
+    namespace
+    {
+
+      // Spreads consecutive battle indices into unrelated seeds
+      uint64_t SplitMix64(uint64_t x)
+      {
+        x += 0x9E3779B97F4A7C15ull;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+        return x ^ (x >> 31);
+      }
+
+      struct Unit : BattleState::Combatant
+      {
+        const CharacterData* data = nullptr;
+      };
+
+      class Battle
+      {
+      public:
+        Battle(const BattleData& data, uint64_t seed)
+          : m_rng(seed)
+          , m_is_boss(data.is_boss)
+        {
+          m_units.reserve(data.characters.size());
+          for (const CharacterData& character : data.characters)
+          {
+            Unit unit;
+            unit.data = &character;
+            unit.character_id = character.character_id;
+            unit.health = character.health;
+            unit.speed = character.speed;
+            unit.current_slot = character.slot;
+            BattleState::Reset(unit);
+            m_units.push_back(unit);
+          }
+
+          // pointers into m_units, which is not resized after this
+          for (Unit& unit : m_units) m_speed_bar.push_back(&unit);
+          m_targets.reserve(m_units.size());
+        }
+
+        Result Run(int max_turns)
+        {
+          Result result;
+
+          for (result.turns = 1; result.turns <= max_turns; result.turns++)
+          {
+            // Start_Of_Turn
+            Unit* actor = BattleState::AdvanceSpeedBar(m_speed_bar);
+
+            // guard: nobody left to act
+            if (!actor) break;
+
+            // Move_Select
+            if (BattleState::LosesTurn(*actor))
+            {
+              BattleState::TickDurations(*actor);
+              BattleState::EndTurn(*actor, 0);
+            }
+            else
+            {
+              int target_slot = 0;
+              const MoveData* move = SelectMove(*actor, target_slot);
+
+              BattleState::TickDurations(*actor);
+
+              // Move_Resolution
+              if (move)
+              {
+                BattleState::ApplyMove(move->ops, move->TargetsAllies(), *actor, target_slot, m_units, m_targets);
+                BattleState::EndTurn(*actor, move->speed);
+              }
+              else BattleState::EndTurn(*actor, 0);
+            }
+
+            // End_Of_Turn
+            for (Unit& unit : m_units) BattleState::CheckDeath(unit, m_speed_bar);
+
+            BattleState::Outcome outcome = BattleState::CountSurvivors(m_units).GetOutcome(m_is_boss);
+            if (outcome == BattleState::Outcome::Win) { result.outcome = Outcome::Win; break; }
+            if (outcome == BattleState::Outcome::Lose) { result.outcome = Outcome::Lose; break; }
+          }
+
+          if (result.turns > max_turns)
+          {
+            result.turns = max_turns;
+            result.outcome = Outcome::Draw;
+          }
+
+          BattleState::Headcount headcount = BattleState::CountSurvivors(m_units);
+          result.drifters_alive = headcount.drifters;
+          result.enemies_alive = headcount.enemies;
+
+          return result;
+        }
+
+      private:
+        std::vector<Unit> m_units;
+        std::vector<Unit*> m_speed_bar; // dead characters are removed
+        std::vector<Unit*> m_targets;   // reused for every move
+        std::mt19937_64 m_rng;
+
+        bool m_is_boss;
+        BattleState::BossScript m_boss_script;
+
+        int RandomInt(int min, int max)
+        {
+          return std::uniform_int_distribution<int>(min, max)(m_rng);
+        }
+
+        // Move_Select
+        // Returns the move to use, or nullptr if the character has no moves.
+        const MoveData* SelectMove(Unit& actor, int& target_slot)
+        {
+          const std::vector<MoveData>& moves = actor.data->moves;
+          if (moves.empty()) return nullptr;
+
+          auto random_int = [this](int min, int max) { return RandomInt(min, max); };
+
+          // player stand-in: any move, any valid target
+          if (actor.IsDrifter())
+          {
+            const MoveData& move = moves[RandomInt(0, static_cast<int>(moves.size()) - 1)];
+            Unit* target = BattleState::ChooseRandomTarget(m_units, move.TargetsAllies(), random_int);
+            target_slot = target ? target->current_slot : 0;
+            return &move;
+          }
+
+          int move_num = m_is_boss ? m_boss_script.NextMove() : RandomInt(1, 3);
+
+          // characters with fewer than three moves use their last one
+          const MoveData& move = moves[std::min(move_num, static_cast<int>(moves.size())) - 1];
+
+          Unit* target = m_is_boss
+            ? BattleState::ChooseBossTarget(m_units, move_num)
+            : BattleState::ChooseRandomTarget(m_units, !move.TargetsAllies(), random_int);
+          target_slot = target ? target->current_slot : 0;
+
+          return &move;
+        }
+      };
+
+    }
+
+    Result Simulate(const BattleData& battle, uint64_t seed, int max_turns)
+    {
+      return Battle(battle, seed).Run(max_turns);
+    }
+
+    void Summary::Add(const Result& result)
+    {
+      battles++;
+      switch (result.outcome)
+      {
+      case Outcome::Win: wins++; break;
+      case Outcome::Lose: losses++; break;
+      default: draws++; break;
+      }
+      total_turns += result.turns;
+      total_drifters_alive += result.drifters_alive;
+
+      if (turn_counts.size() <= static_cast<std::size_t>(result.turns)) turn_counts.resize(result.turns + 1, 0);
+      turn_counts[result.turns]++;
+    }
+
+    void Summary::Merge(const Summary& other)
+    {
+      battles += other.battles;
+      wins += other.wins;
+      losses += other.losses;
+      draws += other.draws;
+      total_turns += other.total_turns;
+      total_drifters_alive += other.total_drifters_alive;
+
+      if (turn_counts.size() < other.turn_counts.size()) turn_counts.resize(other.turn_counts.size(), 0);
+      for (std::size_t i = 0; i < other.turn_counts.size(); i++) turn_counts[i] += other.turn_counts[i];
+    }
+
+    int Summary::TurnPercentile(double p) const
+    {
+      if (battles == 0) return 0;
+
+      int rank = std::max(1, static_cast<int>(std::ceil(p * battles)));
+      int seen = 0;
+      for (std::size_t turns = 0; turns < turn_counts.size(); turns++)
+      {
+        seen += turn_counts[turns];
+        if (seen >= rank) return static_cast<int>(turns);
+      }
+      return static_cast<int>(turn_counts.size()) - 1;
+    }
+
+    Summary SimulateMany(const BattleData& battle, uint64_t seed, int count, int threads, int max_turns)
+    {
+      if (count <= 0) return Summary();
+
+      if (threads <= 0) threads = static_cast<int>(std::thread::hardware_concurrency());
+      threads = std::max(1, std::min(threads, count));
+
+      // every thread takes every n-th battle, the results are only counts so the merge order does not matter
+      std::vector<Summary> summaries(threads);
+      auto run = [&](int thread_index)
+      {
+        for (int i = thread_index; i < count; i += threads)
+        {
+          summaries[thread_index].Add(Simulate(battle, SplitMix64(seed + static_cast<uint64_t>(i)), max_turns));
+        }
+      };
+
+      std::vector<std::thread> workers;
+      for (int t = 1; t < threads; t++) workers.emplace_back(run, t);
+      run(0);
+      for (std::thread& worker : workers) worker.join();
+
+      Summary total;
+      for (const Summary& summary : summaries) total.Merge(summary);
+      return total;
+    }
+
+    #pragma endregion
+
+    #pragma region Command Line
+
+    int RunCommandLine(int argc, char** argv)
+    {
+      std::vector<std::string> battles;
+      int count = 10000;
+      uint64_t seed = 1;
+      int threads = 0;
+      int max_turns = 1000;
+      std::string out_path;
+
+      for (int i = 1; i < argc; i++)
+      {
+        std::string arg = argv[i];
+        bool has_value = (i + 1 < argc);
+
+        if (arg == "--battle-sim") continue;
+        else if (arg == "--count" && has_value) count = std::stoi(argv[++i]);
+        else if (arg == "--seed" && has_value) seed = std::stoull(argv[++i]);
+        else if (arg == "--threads" && has_value) threads = std::stoi(argv[++i]);
+        else if (arg == "--max-turns" && has_value) max_turns = std::stoi(argv[++i]);
+        else if (arg == "--out" && has_value) out_path = argv[++i];
+        else if (arg.rfind("--", 0) == 0)
+        {
+          std::cerr << "Unknown option: " << arg << "\n";
+          return 1;
+        }
+        else battles.push_back(arg);
+      }
+
+      // guard: nothing to run
+      if (battles.empty())
+      {
+        std::cerr
+          << "Usage: --battle-sim <battle key>... [--count N] [--seed S] [--threads T] [--max-turns M] [--out file.csv]\n"
+          << "Example: --battle-sim /data/robot_battle.flxbattle --count 100000\n";
+        return 1;
+      }
+
+      std::stringstream csv;
+      csv << "battle,battles,win_rate,losses,draws,avg_turns,p50_turns,p90_turns,p99_turns,avg_drifters_alive,battles_per_second\n";
+
+      Path assets_root = Path::current("assets");
+      for (const std::string& key : battles)
+      {
+        BattleData battle;
+        if (!BattleData::Load(assets_root, key, battle))
+        {
+          std::cerr << "Could not load " << key << "\n";
+          return 1;
+        }
+
+        auto start = std::chrono::high_resolution_clock::now();
+        Summary summary = SimulateMany(battle, seed, count, threads, max_turns);
+        double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+        double per_second = (seconds > 0.0) ? summary.battles / seconds : 0.0;
+
+        std::cout
+          << std::fixed << std::setprecision(3)
+          << key << "\n"
+          << "  battles:        " << summary.battles << " (" << static_cast<long long>(per_second) << "/s)\n"
+          << "  win rate:       " << summary.WinRate() * 100.0 << "%"
+          << " (" << summary.wins << " won, " << summary.losses << " lost, " << summary.draws << " hit the turn limit)\n"
+          << "  turns:          avg " << summary.AverageTurns()
+          << ", p50 " << summary.TurnPercentile(0.5) << ", p90 " << summary.TurnPercentile(0.9) << ", p99 " << summary.TurnPercentile(0.99) << "\n"
+          << "  drifters alive: avg " << summary.AverageDriftersAlive() << "\n";
+
+        csv
+          << std::fixed << std::setprecision(4)
+          << key << "," << summary.battles << "," << summary.WinRate() << "," << summary.losses << "," << summary.draws << ","
+          << summary.AverageTurns() << "," << summary.TurnPercentile(0.5) << "," << summary.TurnPercentile(0.9) << ","
+          << summary.TurnPercentile(0.99) << "," << summary.AverageDriftersAlive() << "," << per_second << "\n";
+      }
+
+      if (!out_path.empty())
+      {
+        std::ofstream out(out_path);
+        out << csv.str();
+      }
+
+      return 0;
+    }
+
+    #pragma endregion
+
+  }
+}
@@ -0,0 +1,134 @@
+// WLVERSE [https://wlverse.web.app]
+// battlesim.h
+//
+// Headless battle simulator for balance runs.
+//
+// Runs the battle rules in battlestate.h, which the battle layer
+// (Game/src/Layers/battlelayer.cpp) also uses, without any entities, animations,
+// timers or input. A battle is built from the same .flxbattle, .flxcharacter and
+// .flxmove files and resolved turn by turn.
+//
+// Enemies use the same AI as the game (random move and target, scripted boss).
+// The player's choices are replaced by a random move and a random valid target.
+//
+// Each battle is seeded separately, so a batch gives the same results no matter
+// how many threads run it.
+//
+// Command line:
+//   Game.exe --battle-sim /data/robot_battle.flxbattle [more battles...]
+//            [--count 10000] [--seed 1] [--threads 0] [--max-turns 1000] [--out results.csv]
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#pragma once
+
+#include "flx_api.h"
+
+#include "Assets/move.h"
+#include "Utilities/path.h"
+
+#include <cstdint> // uint64_t
+#include <string>
+#include <vector>
+
+namespace FlexEngine
+{
+  namespace BattleSim
+  {
+
+    #pragma region Battle Data
+
+    struct __FLX_API MoveData
+    {
+      std::string name;
+      int speed = 0;
+      std::vector<Asset::MoveOp> ops;
+
+      bool TargetsAllies() const { return Asset::TargetsAllies(ops); }
+    };
+
+    struct __FLX_API CharacterData
+    {
+      std::string name;
+      int character_id = 0; // 1-2 are drifters, same rule as the battle layer
+      int health = 0;
+      int speed = 0;
+      int slot = 0;         // 0-1 for drifters, 0-4 for enemies
+      std::vector<MoveData> moves;
+
+      bool IsDrifter() const { return character_id <= 2; }
+    };
+
+    struct __FLX_API BattleData
+    {
+      std::string name;
+      bool is_boss = false;
+
+      // drifters first, then enemies, in slot order
+      std::vector<CharacterData> characters;
+
+      // Reads a .flxbattle and the characters and moves it references.
+      // Keys are asset keys like "/data/robot_battle.flxbattle", relative to assets_root.
+      // Returns false if any of the files could not be read.
+      static bool Load(const Path& assets_root, const std::string& battle_key, BattleData& out);
+    };
+
+    #pragma endregion
+
+    #pragma region Simulation
+
+    enum class Outcome : uint8_t
+    {
+      Win, Lose, Draw // draw means the turn limit was hit
+    };
+
+    struct __FLX_API Result
+    {
+      Outcome outcome = Outcome::Draw;
+      int turns = 0;
+      int drifters_alive = 0;
+      int enemies_alive = 0;
+    };
+
+    // Runs one battle to the end. The same seed always gives the same result.
+    __FLX_API Result Simulate(const BattleData& battle, uint64_t seed, int max_turns = 1000);
+
+    struct __FLX_API Summary
+    {
+      int battles = 0;
+      int wins = 0;
+      int losses = 0;
+      int draws = 0;
+      uint64_t total_turns = 0;
+      uint64_t total_drifters_alive = 0;
+
+      // turn_counts[n] is the number of battles that took n turns
+      std::vector<int> turn_counts;
+
+      void Add(const Result& result);
+      void Merge(const Summary& other);
+
+      double WinRate() const { return battles ? static_cast<double>(wins) / battles : 0.0; }
+      double AverageTurns() const { return battles ? static_cast<double>(total_turns) / battles : 0.0; }
+      double AverageDriftersAlive() const { return battles ? static_cast<double>(total_drifters_alive) / battles : 0.0; }
+
+      // p is from 0 to 1
+      int TurnPercentile(double p) const;
+    };
+
+    // Runs count battles with seeds derived from seed, split across threads.
+    // threads = 0 uses every core.
+    __FLX_API Summary SimulateMany(const BattleData& battle, uint64_t seed, int count, int threads = 0, int max_turns = 1000);
+
+    #pragma endregion
+
+    // Entry point for --battle-sim, see the top of this file for the options.
+    // Returns the process exit code.
+    __FLX_API int RunCommandLine(int argc, char** argv);
+
+  }
+}
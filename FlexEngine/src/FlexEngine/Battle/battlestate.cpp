@@ -0,0 +1,218 @@
+// WLVERSE [https://wlverse.web.app]
+// battlestate.cpp
+//
+// Battle rules shared by the battle layer and the headless battle simulator.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#include "pch.h"
+
+#include "battlestate.h"
+
+namespace FlexEngine
+{
+  namespace BattleState
+  {
+
+    #pragma region Characters
+
+    void Reset(Combatant& character)
+    {
+      character.current_health = character.health;
+      character.current_speed = character.speed;
+      character.speed_change = 0;
+      character.is_alive = true;
+    }
+
+    bool LosesTurn(const Combatant& character)
+    {
+      return character.stun_debuff_duration > 0 && character.character_id != 5;
+    }
+
+    void TickDurations(Combatant& character)
+    {
+      for (int* duration : {
+        &character.stun_debuff_duration, &character.attack_buff_duration, &character.attack_debuff_duration,
+        &character.shield_buff_duration, &character.protect_buff_duration
+      })
+      {
+        if (*duration > 0) *duration -= 1;
+      }
+    }
+
+    void EndTurn(Combatant& character, int move_speed)
+    {
+      character.current_speed = move_speed + character.speed_change;
+      character.speed_change = 0;
+    }
+
+    bool CheckDeath(Combatant& character)
+    {
+      if (!character.is_alive || character.current_health > 0) return false;
+
+      character.is_alive = false;
+      character.current_health = 0;
+      character.attack_buff_duration = 0;
+      character.attack_debuff_duration = 0;
+      character.stun_debuff_duration = 0;
+      character.shield_buff_duration = 0;
+      character.protect_buff_duration = 0;
+      return true;
+    }
+
+    #pragma endregion
+
+    #pragma region Moves
+
+    int GetDamage(const Combatant& user, int value, bool god_mode)
+    {
+      int damage = value;
+      if (user.attack_buff_duration > 0) damage += value / 2;
+      if (user.attack_debuff_duration > 0) damage -= value / 2;
+      if (god_mode) damage *= 10;
+      return damage;
+    }
+
+    bool IsTarget(
+      const Asset::MoveOp& op, const Combatant& user, const Combatant& candidate,
+      int target_slot, bool move_targets_allies
+    )
+    {
+      if (op.target == Asset::MoveTarget::Self) return &candidate == &user;
+      if (!candidate.is_alive) return false;
+
+      const bool is_ally = (candidate.IsDrifter() == user.IsDrifter());
+      const int slot = candidate.current_slot;
+
+      switch (op.target)
+      {
+      case Asset::MoveTarget::All_Enemies:
+      case Asset::MoveTarget::Next_Enemy:
+        return !is_ally;
+      case Asset::MoveTarget::Adjacent_Enemies:
+        return !is_ally && slot >= target_slot - 1 && slot <= target_slot + 1;
+      case Asset::MoveTarget::Single_Enemy:
+        return !is_ally && slot == target_slot;
+      case Asset::MoveTarget::All_Allies:
+        return is_ally;
+      case Asset::MoveTarget::Next_Ally:
+        // compares ids, so copies of the same enemy skip each other
+        return is_ally && candidate.character_id != user.character_id;
+      case Asset::MoveTarget::Single_Ally:
+        // fizzles if the move was aimed at the other side
+        return move_targets_allies && is_ally && slot == target_slot;
+      case Asset::MoveTarget::All:
+        return true;
+      default:
+        return false;
+      }
+    }
+
+    bool HitsFirstOnly(Asset::MoveTarget target)
+    {
+      return target == Asset::MoveTarget::Next_Enemy || target == Asset::MoveTarget::Next_Ally || target == Asset::MoveTarget::Self;
+    }
+
+    void ApplyEffect(const Asset::MoveOp& op, const Combatant& user, Combatant& target, bool god_mode)
+    {
+      const int value = op.value;
+
+      switch (op.effect)
+      {
+      case Asset::MoveEffect::Damage:
+        // god mode: drifters hit through shields, enemies deal no damage
+        if (god_mode && !user.IsDrifter()) break;
+        if (!god_mode && target.shield_buff_duration > 0) break;
+        target.current_health -= GetDamage(user, value, god_mode);
+        break;
+      case Asset::MoveEffect::Heal:
+        target.current_health = std::min(target.current_health + value, target.health);
+        break;
+      case Asset::MoveEffect::Speed_Up:
+        target.speed_change -= value;
+        break;
+      case Asset::MoveEffect::Speed_Down:
+        target.speed_change += value;
+        break;
+      case Asset::MoveEffect::Attack_Up:
+        target.attack_buff_duration = std::min(target.attack_buff_duration + value, value);
+        break;
+      case Asset::MoveEffect::Attack_Down:
+        if (target.protect_buff_duration > 0) break;
+        target.attack_debuff_duration = std::min(target.attack_debuff_duration + value, value);
+        break;
+      case Asset::MoveEffect::Stun:
+        if (target.protect_buff_duration > 0) break;
+        target.stun_debuff_duration = std::min(target.stun_debuff_duration + value, value);
+        break;
+      case Asset::MoveEffect::Shield:
+        target.shield_buff_duration = std::min(target.shield_buff_duration + value, value);
+        break;
+      case Asset::MoveEffect::Protect:
+        target.protect_buff_duration = std::min(target.protect_buff_duration + value, value);
+        break;
+      case Asset::MoveEffect::Strip:
+        target.attack_buff_duration = 0;
+        target.shield_buff_duration = 0;
+        target.protect_buff_duration = 0;
+        break;
+      case Asset::MoveEffect::Cleanse:
+        target.attack_debuff_duration = 0;
+        target.stun_debuff_duration = 0;
+        break;
+      default:
+        break;
+      }
+    }
+
+    #pragma endregion
+
+    #pragma region Enemy AI
+
+    int BossScript::NextMove()
+    {
+      if (running)
+      {
+        move++;
+        if (move > 3) move = 1;
+        if (move == 3) running = false;
+        return move;
+      }
+
+      // one basic attack, then the sequence starts again
+      move++;
+      if (move > 3)
+      {
+        move = 0;
+        running = true;
+      }
+      return 1;
+    }
+
+    int GetBossTargetId(int move_num, bool first_choice)
+    {
+      const int grace = 2;
+      const int renko = 1;
+      if (move_num == 2) return first_choice ? grace : renko;
+      return first_choice ? renko : grace;
+    }
+
+    #pragma endregion
+
+    #pragma region Outcome
+
+    Outcome Headcount::GetOutcome(bool is_boss) const
+    {
+      if ((is_boss && renko_dead) || drifters == 0) return Outcome::Lose;
+      if (enemies == 0) return Outcome::Win;
+      return Outcome::Ongoing;
+    }
+
+    #pragma endregion
+
+  }
+}
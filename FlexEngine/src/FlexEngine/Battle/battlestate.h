@@ -0,0 +1,256 @@
+// WLVERSE [https://wlverse.web.app]
+// battlestate.h
+//
+// Battle rules shared by the battle layer and the headless battle simulator.
+//
+// Only game state lives here: health, speed, buff and debuff durations, and the
+// enemy AI. Entities, animations, timers and input stay in the battle layer.
+//  - speed bar: the lowest current speed acts next, everyone's speed is reduced
+//    by the speed of the character in front
+//  - stunned characters (except Jack) lose their turn
+//  - every turn ticks the actor's durations, then its speed is set from the move
+//  - move effects are applied in order with the buff and debuff rules
+//  - deaths are checked at the end of every turn
+//
+// The battle layer and BattleSim derive their characters from Combatant and call
+// the same functions, so balance runs always use the shipped rules.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#pragma once
+
+#include "flx_api.h"
+
+#include "Assets/move.h"
+
+#include <algorithm> // std::stable_sort, std::remove
+#include <cstdint> // uint8_t
+#include <vector>
+
+namespace FlexEngine
+{
+  namespace BattleState
+  {
+
+    #pragma region Characters
+
+    // The rules half of a character.
+    // The field names match the battle layer, which derives its characters from this.
+    struct __FLX_API Combatant
+    {
+      int character_id = 0; // 1-2 are drifters, 3-5 are enemies, 5 is Jack
+      int health = 0;       // max health
+      int speed = 0;        // starting speed
+
+      int attack_debuff_duration = 0;
+      int attack_buff_duration = 0;
+      int stun_debuff_duration = 0;
+      int shield_buff_duration = 0;
+      int protect_buff_duration = 0;
+
+      int current_health = 0;
+      int current_speed = 0;
+      int current_slot = 0; // 0-1 for drifters, 0-4 for enemies
+
+      int speed_change = 0; // added to the speed of the next move, from Speed_Up and Speed_Down
+      bool is_alive = true;
+
+      bool IsDrifter() const { return character_id <= 2; }
+    };
+
+    // Sets the current health and speed to the starting values.
+    __FLX_API void Reset(Combatant& character);
+
+    // Stunned characters lose their turn, Jack ignores stuns.
+    __FLX_API bool LosesTurn(const Combatant& character);
+
+    // Counts down every buff and debuff of the character whose turn it is.
+    __FLX_API void TickDurations(Combatant& character);
+
+    // Places the character on the speed bar after its turn.
+    // move_speed is 0 when the turn was skipped.
+    __FLX_API void EndTurn(Combatant& character, int move_speed);
+
+    // Marks the character as dead if its health ran out and clears its buffs and debuffs.
+    // Returns true if the character died just now.
+    __FLX_API bool CheckDeath(Combatant& character);
+
+    #pragma endregion
+
+    #pragma region Speed Bar
+
+    // Sorts the speed bar and moves everyone forward by the speed of the character in front.
+    // Returns the character whose turn it is.
+    template <typename T>
+    T* AdvanceSpeedBar(std::vector<T*>& speed_bar)
+    {
+      if (speed_bar.empty()) return nullptr;
+
+      std::stable_sort(
+        speed_bar.begin(), speed_bar.end(),
+        [](const T* a, const T* b) { return a->current_speed < b->current_speed; }
+      );
+
+      int first_speed = speed_bar.front()->current_speed;
+      if (first_speed > 0)
+      {
+        for (T* character : speed_bar) character->current_speed -= first_speed;
+      }
+
+      return speed_bar.front();
+    }
+
+    // CheckDeath, and takes the character off the speed bar if it died.
+    template <typename T>
+    bool CheckDeath(T& character, std::vector<T*>& speed_bar)
+    {
+      if (!CheckDeath(static_cast<Combatant&>(character))) return false;
+      speed_bar.erase(std::remove(speed_bar.begin(), speed_bar.end(), &character), speed_bar.end());
+      return true;
+    }
+
+    #pragma endregion
+
+    #pragma region Moves
+
+    // Damage of one Damage op after the user's attack buff and debuff.
+    // God mode is the battle layer's debug cheat.
+    __FLX_API int GetDamage(const Combatant& user, int value, bool god_mode = false);
+
+    // Whether candidate is hit by op.
+    // target_slot is the slot the move was aimed at, move_targets_allies is Asset::Move::targets_allies.
+    __FLX_API bool IsTarget(
+      const Asset::MoveOp& op, const Combatant& user, const Combatant& candidate,
+      int target_slot, bool move_targets_allies
+    );
+
+    // NEXT_ENEMY, NEXT_ALLY and SELF hit the first match only.
+    __FLX_API bool HitsFirstOnly(Asset::MoveTarget target);
+
+    // Applies one effect of op to target, with the shield and protect rules.
+    __FLX_API void ApplyEffect(const Asset::MoveOp& op, const Combatant& user, Combatant& target, bool god_mode = false);
+
+    // Appends the characters hit by op, in slot order.
+    template <typename T>
+    void GatherTargets(
+      const Asset::MoveOp& op, const Combatant& user, int target_slot, bool move_targets_allies,
+      std::vector<T>& characters, std::vector<T*>& targets
+    )
+    {
+      for (T& character : characters)
+      {
+        if (!IsTarget(op, user, character, target_slot, move_targets_allies)) continue;
+        targets.push_back(&character);
+        if (HitsFirstOnly(op.target)) break;
+      }
+    }
+
+    // Applies every op of a move in order.
+    // targets is scratch space, passed in so it can be reused between moves.
+    template <typename T>
+    void ApplyMove(
+      const std::vector<Asset::MoveOp>& ops, bool move_targets_allies, const Combatant& user, int target_slot,
+      std::vector<T>& characters, std::vector<T*>& targets, bool god_mode = false
+    )
+    {
+      for (const Asset::MoveOp& op : ops)
+      {
+        targets.clear();
+        GatherTargets(op, user, target_slot, move_targets_allies, characters, targets);
+        for (T* target : targets) ApplyEffect(op, user, *target, god_mode);
+      }
+    }
+
+    #pragma endregion
+
+    #pragma region Enemy AI
+
+    // The boss uses its moves 1, 2 and 3 in order, then one basic attack (move 1), and repeats.
+    struct __FLX_API BossScript
+    {
+      int move = 0;        // position in the current sequence
+      bool running = true; // true while the scripted moves are being used
+
+      // Returns the move number to use, 1-3.
+      int NextMove();
+    };
+
+    // Move 2 goes for Grace first, the others go for Renko first.
+    __FLX_API int GetBossTargetId(int move_num, bool first_choice);
+
+    // Returns nullptr if neither drifter is alive.
+    template <typename T>
+    T* ChooseBossTarget(std::vector<T>& characters, int move_num)
+    {
+      for (bool first_choice : { true, false })
+      {
+        int character_id = GetBossTargetId(move_num, first_choice);
+        for (T& character : characters)
+        {
+          if (character.is_alive && character.character_id == character_id) return &character;
+        }
+      }
+      return nullptr;
+    }
+
+    // Picks a random living character on the given side.
+    // random_int(min, max) returns a number from min to max inclusive.
+    // Returns nullptr if that side has nobody left.
+    template <typename T, typename RandomInt>
+    T* ChooseRandomTarget(std::vector<T>& characters, bool drifters, RandomInt&& random_int)
+    {
+      int count = 0;
+      for (const T& character : characters)
+      {
+        if (character.is_alive && character.IsDrifter() == drifters) count++;
+      }
+      if (count == 0) return nullptr;
+
+      int pick = random_int(0, count - 1);
+      for (T& character : characters)
+      {
+        if (!character.is_alive || character.IsDrifter() != drifters) continue;
+        if (pick-- == 0) return &character;
+      }
+      return nullptr;
+    }
+
+    #pragma endregion
+
+    #pragma region Outcome
+
+    enum class Outcome : uint8_t
+    {
+      Ongoing, Win, Lose
+    };
+
+    struct __FLX_API Headcount
+    {
+      int drifters = 0;
+      int enemies = 0;
+      bool renko_dead = false;
+
+      // The boss battle is lost as soon as Renko falls.
+      Outcome GetOutcome(bool is_boss) const;
+    };
+
+    template <typename T>
+    Headcount CountSurvivors(const std::vector<T>& characters)
+    {
+      Headcount headcount;
+      for (const T& character : characters)
+      {
+        if (character.is_alive) (character.IsDrifter() ? headcount.drifters : headcount.enemies)++;
+        else if (character.character_id == 1) headcount.renko_dead = true;
+      }
+      return headcount;
+    }
+
+    #pragma endregion
+
+  }
+}
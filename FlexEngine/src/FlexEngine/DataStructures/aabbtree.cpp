@@ -0,0 +1,439 @@
+// WLVERSE [https://wlverse.web.app]
+// aabbtree.cpp
+//
+// Dynamic AABB tree for 2D broadphase queries.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#include "pch.h"
+
+#include "aabbtree.h"
+
+#include <cmath> // std::abs
+
+namespace FlexEngine
+{
+
+  AABBTree::AABBTree(float fat_margin)
+    : m_margin(fat_margin)
+  {
+  }
+
+  #pragma region Node Pool
+
+  int AABBTree::AllocateNode()
+  {
+    // grow the pool if there are no free nodes
+    if (m_free_list == Null)
+    {
+      m_nodes.emplace_back();
+      m_nodes.back().height = -1;
+      m_free_list = static_cast<int>(m_nodes.size()) - 1;
+      m_nodes[m_free_list].parent = Null;
+    }
+
+    int node = m_free_list;
+    m_free_list = m_nodes[node].parent;
+
+    m_nodes[node] = Node();
+    m_nodes[node].height = 0;
+    return node;
+  }
+
+  void AABBTree::FreeNode(int node)
+  {
+    m_nodes[node].parent = m_free_list;
+    m_nodes[node].height = -1;
+    m_free_list = node;
+  }
+
+  #pragma endregion
+
+  #pragma region Proxy Management
+
+  int AABBTree::Insert(const Box& box, uint64_t user_data)
+  {
+    int proxy = AllocateNode();
+
+    // fatten the box
+    Node& node = m_nodes[proxy];
+    node.box = { box.min_x - m_margin, box.min_y - m_margin, box.max_x + m_margin, box.max_y + m_margin };
+    node.user_data = user_data;
+    node.height = 0;
+
+    InsertLeaf(proxy);
+    ++m_proxy_count;
+
+    return proxy;
+  }
+
+  void AABBTree::Remove(int proxy)
+  {
+    FLX_CORE_ASSERT(proxy >= 0 && proxy < static_cast<int>(m_nodes.size()), "AABBTree proxy out of range.");
+    FLX_CORE_ASSERT(m_nodes[proxy].IsLeaf() && m_nodes[proxy].height == 0, "AABBTree proxy is not a leaf.");
+
+    RemoveLeaf(proxy);
+    FreeNode(proxy);
+    --m_proxy_count;
+  }
+
+  bool AABBTree::Move(int proxy, const Box& box)
+  {
+    FLX_CORE_ASSERT(proxy >= 0 && proxy < static_cast<int>(m_nodes.size()), "AABBTree proxy out of range.");
+    FLX_CORE_ASSERT(m_nodes[proxy].IsLeaf() && m_nodes[proxy].height == 0, "AABBTree proxy is not a leaf.");
+
+    const Box& fat_box = m_nodes[proxy].box;
+    if (fat_box.Contains(box))
+    {
+      // The box still fits, but if the fat box is now far too large
+      // (the entity shrank) the queries get loose, so reinsert in that case.
+      Box huge_box = {
+        box.min_x - 4.0f * m_margin, box.min_y - 4.0f * m_margin,
+        box.max_x + 4.0f * m_margin, box.max_y + 4.0f * m_margin
+      };
+      if (huge_box.Contains(fat_box)) return false;
+    }
+
+    RemoveLeaf(proxy);
+    m_nodes[proxy].box = { box.min_x - m_margin, box.min_y - m_margin, box.max_x + m_margin, box.max_y + m_margin };
+    InsertLeaf(proxy);
+
+    return true;
+  }
+
+  void AABBTree::Clear()
+  {
+    // rebuild the free list over the whole pool
+    m_free_list = Null;
+    for (int i = static_cast<int>(m_nodes.size()) - 1; i >= 0; --i)
+    {
+      FreeNode(i);
+    }
+    m_root = Null;
+    m_proxy_count = 0;
+  }
+
+  #pragma endregion
+
+  #pragma region Tree Maintenance
+
+  void AABBTree::InsertLeaf(int leaf)
+  {
+    if (m_root == Null)
+    {
+      m_root = leaf;
+      m_nodes[m_root].parent = Null;
+      return;
+    }
+
+    // Find the best sibling for this leaf using the surface area heuristic.
+    // Perimeter is used in place of area for 2D.
+    Box leaf_box = m_nodes[leaf].box;
+    int index = m_root;
+    while (!m_nodes[index].IsLeaf())
+    {
+      const Node& node = m_nodes[index];
+      int child1 = node.child1;
+      int child2 = node.child2;
+
+      float perimeter = node.box.Perimeter();
+      float combined_perimeter = Box::Union(node.box, leaf_box).Perimeter();
+
+      // cost of creating a new parent for this node and the new leaf
+      float cost = 2.0f * combined_perimeter;
+
+      // minimum cost of pushing the leaf further down the tree
+      float inheritance_cost = 2.0f * (combined_perimeter - perimeter);
+
+      auto descend_cost = [&](int child)
+      {
+        const Node& c = m_nodes[child];
+        float union_perimeter = Box::Union(leaf_box, c.box).Perimeter();
+        if (c.IsLeaf()) return union_perimeter + inheritance_cost;
+        return (union_perimeter - c.box.Perimeter()) + inheritance_cost;
+      };
+
+      float cost1 = descend_cost(child1);
+      float cost2 = descend_cost(child2);
+
+      // descend according to the minimum cost
+      if (cost < cost1 && cost < cost2) break;
+      index = (cost1 < cost2) ? child1 : child2;
+    }
+
+    int sibling = index;
+
+    // create a new parent
+    int old_parent = m_nodes[sibling].parent;
+    int new_parent = AllocateNode();
+    m_nodes[new_parent].parent = old_parent;
+    m_nodes[new_parent].box = Box::Union(leaf_box, m_nodes[sibling].box);
+    m_nodes[new_parent].height = m_nodes[sibling].height + 1;
+    m_nodes[new_parent].child1 = sibling;
+    m_nodes[new_parent].child2 = leaf;
+    m_nodes[sibling].parent = new_parent;
+    m_nodes[leaf].parent = new_parent;
+
+    if (old_parent != Null)
+    {
+      // the sibling was not the root
+      if (m_nodes[old_parent].child1 == sibling) m_nodes[old_parent].child1 = new_parent;
+      else m_nodes[old_parent].child2 = new_parent;
+    }
+    else
+    {
+      // the sibling was the root
+      m_root = new_parent;
+    }
+
+    // walk back up the tree fixing heights and boxes
+    index = m_nodes[leaf].parent;
+    while (index != Null)
+    {
+      index = Balance(index);
+
+      int child1 = m_nodes[index].child1;
+      int child2 = m_nodes[index].child2;
+
+      m_nodes[index].height = 1 + std::max(m_nodes[child1].height, m_nodes[child2].height);
+      m_nodes[index].box = Box::Union(m_nodes[child1].box, m_nodes[child2].box);
+
+      index = m_nodes[index].parent;
+    }
+  }
+
+  void AABBTree::RemoveLeaf(int leaf)
+  {
+    if (leaf == m_root)
+    {
+      m_root = Null;
+      return;
+    }
+
+    int parent = m_nodes[leaf].parent;
+    int grand_parent = m_nodes[parent].parent;
+    int sibling = (m_nodes[parent].child1 == leaf) ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+    if (grand_parent != Null)
+    {
+      // destroy the parent and connect the sibling to the grand parent
+      if (m_nodes[grand_parent].child1 == parent) m_nodes[grand_parent].child1 = sibling;
+      else m_nodes[grand_parent].child2 = sibling;
+      m_nodes[sibling].parent = grand_parent;
+      FreeNode(parent);
+
+      // adjust ancestor bounds
+      int index = grand_parent;
+      while (index != Null)
+      {
+        index = Balance(index);
+
+        int child1 = m_nodes[index].child1;
+        int child2 = m_nodes[index].child2;
+
+        m_nodes[index].box = Box::Union(m_nodes[child1].box, m_nodes[child2].box);
+        m_nodes[index].height = 1 + std::max(m_nodes[child1].height, m_nodes[child2].height);
+
+        index = m_nodes[index].parent;
+      }
+    }
+    else
+    {
+      m_root = sibling;
+      m_nodes[sibling].parent = Null;
+      FreeNode(parent);
+    }
+  }
+
+  int AABBTree::Balance(int a_index)
+  {
+    Node& a = m_nodes[a_index];
+    if (a.IsLeaf() || a.height < 2) return a_index;
+
+    int b_index = a.child1;
+    int c_index = a.child2;
+    Node& b = m_nodes[b_index];
+    Node& c = m_nodes[c_index];
+
+    int balance = c.height - b.height;
+
+    // rotate C up
+    if (balance > 1)
+    {
+      int f_index = c.child1;
+      int g_index = c.child2;
+      Node& f = m_nodes[f_index];
+      Node& g = m_nodes[g_index];
+
+      // swap A and C
+      c.child1 = a_index;
+      c.parent = a.parent;
+      a.parent = c_index;
+
+      // A's old parent should point to C
+      if (c.parent != Null)
+      {
+        if (m_nodes[c.parent].child1 == a_index) m_nodes[c.parent].child1 = c_index;
+        else m_nodes[c.parent].child2 = c_index;
+      }
+      else m_root = c_index;
+
+      // rotate
+      if (f.height > g.height)
+      {
+        c.child2 = f_index;
+        a.child2 = g_index;
+        g.parent = a_index;
+        a.box = Box::Union(b.box, g.box);
+        c.box = Box::Union(a.box, f.box);
+
+        a.height = 1 + std::max(b.height, g.height);
+        c.height = 1 + std::max(a.height, f.height);
+      }
+      else
+      {
+        c.child2 = g_index;
+        a.child2 = f_index;
+        f.parent = a_index;
+        a.box = Box::Union(b.box, f.box);
+        c.box = Box::Union(a.box, g.box);
+
+        a.height = 1 + std::max(b.height, f.height);
+        c.height = 1 + std::max(a.height, g.height);
+      }
+
+      return c_index;
+    }
+
+    // rotate B up
+    if (balance < -1)
+    {
+      int d_index = b.child1;
+      int e_index = b.child2;
+      Node& d = m_nodes[d_index];
+      Node& e = m_nodes[e_index];
+
+      // swap A and B
+      b.child1 = a_index;
+      b.parent = a.parent;
+      a.parent = b_index;
+
+      // A's old parent should point to B
+      if (b.parent != Null)
+      {
+        if (m_nodes[b.parent].child1 == a_index) m_nodes[b.parent].child1 = b_index;
+        else m_nodes[b.parent].child2 = b_index;
+      }
+      else m_root = b_index;
+
+      // rotate
+      if (d.height > e.height)
+      {
+        b.child2 = d_index;
+        a.child1 = e_index;
+        e.parent = a_index;
+        a.box = Box::Union(c.box, e.box);
+        b.box = Box::Union(a.box, d.box);
+
+        a.height = 1 + std::max(c.height, e.height);
+        b.height = 1 + std::max(a.height, d.height);
+      }
+      else
+      {
+        b.child2 = e_index;
+        a.child1 = d_index;
+        d.parent = a_index;
+        a.box = Box::Union(c.box, d.box);
+        b.box = Box::Union(a.box, e.box);
+
+        a.height = 1 + std::max(c.height, d.height);
+        b.height = 1 + std::max(a.height, e.height);
+      }
+
+      return b_index;
+    }
+
+    return a_index;
+  }
+
+  #pragma endregion
+
+  #pragma region Queries
+
+  bool AABBTree::SegmentOverlaps(const Box& box, float x1, float y1, float dx, float dy)
+  {
+    // slab test over the parametric range [0, 1]
+    float t_min = 0.0f;
+    float t_max = 1.0f;
+
+    const float origin[2] = { x1, y1 };
+    const float delta[2] = { dx, dy };
+    const float lo[2] = { box.min_x, box.min_y };
+    const float hi[2] = { box.max_x, box.max_y };
+
+    for (int axis = 0; axis < 2; ++axis)
+    {
+      if (std::abs(delta[axis]) < 1e-8f)
+      {
+        // parallel to the slab
+        if (origin[axis] < lo[axis] || origin[axis] > hi[axis]) return false;
+        continue;
+      }
+
+      float inv = 1.0f / delta[axis];
+      float t1 = (lo[axis] - origin[axis]) * inv;
+      float t2 = (hi[axis] - origin[axis]) * inv;
+      if (t1 > t2) std::swap(t1, t2);
+
+      t_min = std::max(t_min, t1);
+      t_max = std::min(t_max, t2);
+      if (t_min > t_max) return false;
+    }
+
+    return true;
+  }
+
+  #pragma endregion
+
+  #pragma region Validation
+
+  int AABBTree::ValidateNode(int index) const
+  {
+    // returns the number of leaves under this node, or -1 if the subtree is broken
+    const Node& node = m_nodes[index];
+
+    if (node.IsLeaf())
+    {
+      if (node.height != 0) return -1;
+      return 1;
+    }
+
+    int child1 = node.child1;
+    int child2 = node.child2;
+    if (child1 == Null || child2 == Null) return -1;
+    if (m_nodes[child1].parent != index || m_nodes[child2].parent != index) return -1;
+    if (node.height != 1 + std::max(m_nodes[child1].height, m_nodes[child2].height)) return -1;
+    if (!node.box.Contains(m_nodes[child1].box) || !node.box.Contains(m_nodes[child2].box)) return -1;
+
+    int leaves1 = ValidateNode(child1);
+    int leaves2 = ValidateNode(child2);
+    if (leaves1 < 0 || leaves2 < 0) return -1;
+    return leaves1 + leaves2;
+  }
+
+  bool AABBTree::Validate() const
+  {
+    if (m_root == Null) return m_proxy_count == 0;
+    if (m_nodes[m_root].parent != Null) return false;
+
+    int leaves = ValidateNode(m_root);
+    return leaves >= 0 && static_cast<std::size_t>(leaves) == m_proxy_count;
+  }
+
+  #pragma endregion
+
+}
@@ -0,0 +1,273 @@
+// WLVERSE [https://wlverse.web.app]
+// aabbtree.h
+//
+// Dynamic AABB tree for 2D broadphase queries.
+//
+// Leaves store a "fat" box that is slightly larger than the real bounds so that
+// small movements do not require the leaf to be reinserted. Internal nodes are
+// kept balanced with tree rotations, so point, box and ray queries only visit
+// O(log n) nodes for well-distributed scenes.
+//
+// Proxy ids are stable for the lifetime of the leaf and can be used as an index
+// into external arrays.
+//
+// References:
+// https://box2d.org/files/ErinCatto_DynamicBVH_GDC2019.pdf
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#pragma once
+
+#include "flx_api.h"
+
+#include <cstdint> // uint64_t
+#include <vector>
+#include <algorithm> // std::min, std::max
+
+namespace FlexEngine
+{
+
+  class __FLX_API AABBTree
+  {
+  public:
+
+    // Proxy id used for null nodes
+    static constexpr int Null = -1;
+
+    // Axis-aligned box in world space
+    struct __FLX_API Box
+    {
+      float min_x = 0.0f;
+      float min_y = 0.0f;
+      float max_x = 0.0f;
+      float max_y = 0.0f;
+
+      bool Contains(const Box& other) const
+      {
+        return min_x <= other.min_x && min_y <= other.min_y && max_x >= other.max_x && max_y >= other.max_y;
+      }
+
+      bool Contains(float x, float y) const
+      {
+        return x >= min_x && x <= max_x && y >= min_y && y <= max_y;
+      }
+
+      bool Overlaps(const Box& other) const
+      {
+        return !(other.min_x > max_x || other.max_x < min_x || other.min_y > max_y || other.max_y < min_y);
+      }
+
+      float Perimeter() const
+      {
+        return 2.0f * ((max_x - min_x) + (max_y - min_y));
+      }
+
+      static Box Union(const Box& a, const Box& b)
+      {
+        return {
+          std::min(a.min_x, b.min_x), std::min(a.min_y, b.min_y),
+          std::max(a.max_x, b.max_x), std::max(a.max_y, b.max_y)
+        };
+      }
+    };
+
+    // The margin is added on every side of the box when a leaf is inserted.
+    // Larger margins mean fewer reinserts but looser queries.
+    AABBTree(float fat_margin = 10.0f);
+
+    // Inserts a new leaf and returns its proxy id.
+    int Insert(const Box& box, uint64_t user_data);
+
+    // Removes a leaf. The proxy id may be reused by a later Insert.
+    void Remove(int proxy);
+
+    // Updates the bounds of a leaf.
+    // Returns true if the leaf had to be reinserted, false if it still fits its fat box.
+    bool Move(int proxy, const Box& box);
+
+    // Removes every leaf but keeps the node storage.
+    void Clear();
+
+    uint64_t GetUserData(int proxy) const { return m_nodes[proxy].user_data; }
+    const Box& GetFatBox(int proxy) const { return m_nodes[proxy].box; }
+
+    std::size_t GetProxyCount() const { return m_proxy_count; }
+    int GetHeight() const { return (m_root == Null) ? 0 : m_nodes[m_root].height; }
+
+    // Visits every leaf whose fat box contains the point.
+    // The callback is called as bool(int proxy). Return false to stop the query.
+    template <typename Fn>
+    void QueryPoint(float x, float y, Fn&& callback) const;
+
+    // Visits every leaf whose fat box overlaps the box.
+    // The callback is called as bool(int proxy). Return false to stop the query.
+    template <typename Fn>
+    void QueryBox(const Box& box, Fn&& callback) const;
+
+    // Visits every leaf whose fat box is crossed by the segment from (x1, y1) to (x2, y2).
+    // The callback is called as bool(int proxy). Return false to stop the query.
+    template <typename Fn>
+    void QueryRay(float x1, float y1, float x2, float y2, Fn&& callback) const;
+
+    // Checks the structure of the tree.
+    // Used by the unit tests, this is not cheap.
+    bool Validate() const;
+
+    // Segment vs box slab test.
+    // The segment starts at (x1, y1) and ends at (x1 + dx, y1 + dy).
+    static bool SegmentOverlaps(const Box& box, float x1, float y1, float dx, float dy);
+
+  private:
+    struct Node
+    {
+      Box box;
+      uint64_t user_data = 0;
+
+      // parent when in the tree, next free node when in the free list
+      int parent = Null;
+      int child1 = Null;
+      int child2 = Null;
+
+      // leaf = 0, free node = -1
+      int height = -1;
+
+      bool IsLeaf() const { return child1 == Null; }
+    };
+
+    std::vector<Node> m_nodes;
+    int m_root = Null;
+    int m_free_list = Null;
+    std::size_t m_proxy_count = 0;
+    float m_margin;
+
+    int AllocateNode();
+    void FreeNode(int node);
+
+    void InsertLeaf(int leaf);
+    void RemoveLeaf(int leaf);
+
+    // Performs a left or right rotation if node A is imbalanced.
+    // Returns the new root index.
+    int Balance(int a);
+
+    int ValidateNode(int node) const;
+  };
+
+  #pragma region Template Implementations
+
+  // The queries use a small fixed stack which is enough for a balanced tree of
+  // over a billion leaves, and fall back to the heap if that is ever exceeded.
+
+  template <typename Fn>
+  void AABBTree::QueryPoint(float x, float y, Fn&& callback) const
+  {
+    if (m_root == Null) return;
+
+    int fixed_stack[64];
+    std::vector<int> overflow;
+    int top = 0;
+    fixed_stack[top++] = m_root;
+
+    while (top > 0 || !overflow.empty())
+    {
+      int index;
+      if (!overflow.empty()) { index = overflow.back(); overflow.pop_back(); }
+      else index = fixed_stack[--top];
+
+      const Node& node = m_nodes[index];
+      if (!node.box.Contains(x, y)) continue;
+
+      if (node.IsLeaf())
+      {
+        if (!callback(index)) return;
+        continue;
+      }
+
+      for (int child : { node.child1, node.child2 })
+      {
+        if (top < 64) fixed_stack[top++] = child;
+        else overflow.push_back(child);
+      }
+    }
+  }
+
+  template <typename Fn>
+  void AABBTree::QueryBox(const Box& box, Fn&& callback) const
+  {
+    if (m_root == Null) return;
+
+    int fixed_stack[64];
+    std::vector<int> overflow;
+    int top = 0;
+    fixed_stack[top++] = m_root;
+
+    while (top > 0 || !overflow.empty())
+    {
+      int index;
+      if (!overflow.empty()) { index = overflow.back(); overflow.pop_back(); }
+      else index = fixed_stack[--top];
+
+      const Node& node = m_nodes[index];
+      if (!node.box.Overlaps(box)) continue;
+
+      if (node.IsLeaf())
+      {
+        if (!callback(index)) return;
+        continue;
+      }
+
+      for (int child : { node.child1, node.child2 })
+      {
+        if (top < 64) fixed_stack[top++] = child;
+        else overflow.push_back(child);
+      }
+    }
+  }
+
+  template <typename Fn>
+  void AABBTree::QueryRay(float x1, float y1, float x2, float y2, Fn&& callback) const
+  {
+    if (m_root == Null) return;
+
+    const float dx = x2 - x1;
+    const float dy = y2 - y1;
+
+    // bounds of the whole segment for a cheap early out
+    Box segment_box = { std::min(x1, x2), std::min(y1, y2), std::max(x1, x2), std::max(y1, y2) };
+
+    int fixed_stack[64];
+    std::vector<int> overflow;
+    int top = 0;
+    fixed_stack[top++] = m_root;
+
+    while (top > 0 || !overflow.empty())
+    {
+      int index;
+      if (!overflow.empty()) { index = overflow.back(); overflow.pop_back(); }
+      else index = fixed_stack[--top];
+
+      const Node& node = m_nodes[index];
+      if (!node.box.Overlaps(segment_box)) continue;
+      if (!SegmentOverlaps(node.box, x1, y1, dx, dy)) continue;
+
+      if (node.IsLeaf())
+      {
+        if (!callback(index)) return;
+        continue;
+      }
+
+      for (int child : { node.child1, node.child2 })
+      {
+        if (top < 64) fixed_stack[top++] = child;
+        else overflow.push_back(child);
+      }
+    }
+  }
+
+  #pragma endregion
+
+}
@@ -0,0 +1,147 @@
+// WLVERSE [https://wlverse.web.app]
+// framearena.cpp
+//
+// Linear (bump) allocator for data that only lives for a frame.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#include "framearena.h"
+
+#include <algorithm> // std::max
+
+namespace FlexEngine
+{
+
+  #pragma region LinearArena
+
+  namespace
+  {
+    std::size_t AlignUp(std::size_t value, std::size_t alignment)
+    {
+      return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    unsigned char* AllocateBlock(std::size_t size)
+    {
+      return static_cast<unsigned char*>(::operator new(size, std::align_val_t(alignof(std::max_align_t))));
+    }
+
+    void FreeBlock(unsigned char* block)
+    {
+      ::operator delete(block, std::align_val_t(alignof(std::max_align_t)));
+    }
+  }
+
+  LinearArena::LinearArena(std::size_t capacity)
+    : m_capacity(std::max<std::size_t>(capacity, 64))
+  {
+    m_block = AllocateBlock(m_capacity);
+  }
+
+  LinearArena::~LinearArena()
+  {
+    for (unsigned char* block : m_overflow_blocks) FreeBlock(block);
+    FreeBlock(m_block);
+  }
+
+  void* LinearArena::Allocate(std::size_t size, std::size_t alignment)
+  {
+    // the block itself is aligned to max_align_t, so aligning the offset aligns the address
+    std::size_t offset = AlignUp(m_offset, alignment);
+    if (alignment <= alignof(std::max_align_t) && offset + size <= m_capacity)
+    {
+      m_offset = offset + size;
+      return m_block + offset;
+    }
+
+    return Internal_AllocateOverflow(size, alignment);
+  }
+
+  void* LinearArena::Internal_AllocateOverflow(std::size_t size, std::size_t alignment)
+  {
+    // the main block is full for this frame, keep bumping through heap blocks
+    uintptr_t cursor = reinterpret_cast<uintptr_t>(m_overflow_cursor);
+    uintptr_t aligned = (cursor + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+    if (!m_overflow_cursor || aligned + size > reinterpret_cast<uintptr_t>(m_overflow_end))
+    {
+      std::size_t block_size = std::max(m_capacity, size + alignment);
+      unsigned char* block = AllocateBlock(block_size);
+      m_overflow_blocks.push_back(block);
+      m_overflow_count++;
+
+      m_overflow_cursor = block;
+      m_overflow_end = block + block_size;
+      cursor = reinterpret_cast<uintptr_t>(block);
+      aligned = (cursor + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+    }
+
+    m_overflow_used += (aligned - cursor) + size;
+    m_overflow_cursor = reinterpret_cast<unsigned char*>(aligned + size);
+    return reinterpret_cast<void*>(aligned);
+  }
+
+  void LinearArena::Reset()
+  {
+    std::size_t used = GetUsed();
+    m_high_water_mark = std::max(m_high_water_mark, used);
+
+    // grow the main block so that a frame like this one fits without overflowing
+    if (!m_overflow_blocks.empty())
+    {
+      for (unsigned char* block : m_overflow_blocks) FreeBlock(block);
+      m_overflow_blocks.clear();
+      m_overflow_cursor = m_overflow_end = nullptr;
+
+      std::size_t capacity = m_capacity;
+      while (capacity < used) capacity *= 2;
+      FreeBlock(m_block);
+      m_block = AllocateBlock(capacity);
+      m_capacity = capacity;
+    }
+
+    m_offset = 0;
+    m_overflow_used = 0;
+  }
+
+  #pragma endregion
+
+  #pragma region FrameArena
+
+  // static member initialization
+  LinearArena FrameArena::s_arena;
+  LinearArena FrameArena::s_double_buffered[2];
+  int FrameArena::s_current = 0;
+  std::thread::id FrameArena::s_main_thread = std::this_thread::get_id();
+  std::size_t FrameArena::s_used_last_frame = 0;
+  std::size_t FrameArena::s_double_buffered_used_last_frame = 0;
+
+  void FrameArena::NewFrame()
+  {
+    s_used_last_frame = s_arena.GetUsed();
+    s_arena.Reset();
+
+    // the arena that was written two frames ago is the one that gets reused
+    s_double_buffered_used_last_frame = s_double_buffered[s_current].GetUsed();
+    s_current = 1 - s_current;
+    s_double_buffered[s_current].Reset();
+  }
+
+  FrameArena::Stats FrameArena::GetStats()
+  {
+    Stats stats;
+    stats.used_last_frame = s_used_last_frame;
+    stats.high_water_mark = s_arena.GetHighWaterMark();
+    stats.capacity = s_arena.GetCapacity();
+    stats.overflow_count = s_arena.GetOverflowCount();
+    stats.double_buffered_used_last_frame = s_double_buffered_used_last_frame;
+    stats.double_buffered_high_water_mark = std::max(s_double_buffered[0].GetHighWaterMark(), s_double_buffered[1].GetHighWaterMark());
+    return stats;
+  }
+
+  #pragma endregion
+
+}
@@ -1,24 +1,9 @@
-/** WLVerse
- * \file FMODWrapper.cpp
- *
- * \brief
- *   Audio wrapper to be used to play all audio in the game.
- *   This system uses FMOD studio as a basis for playing music
- *
- * \authors
- *   Yew Chong (yewchong.k\@digipen.edu)
- *
- * \link <https://portylstudios.notion.site/WLVerse-GAM150-Plan-d3460d6a24db417ca86f9ed54deaf365?pvs=4>
- *   WLVerse GAM150 Plan
- * \endlink
- *
- * \par All content (c) 2024 DigiPen Institute of Technology Singapore. All rights reserved.
- */
-
 #include "FMODWrapper.h"
 #include <string>
 
 #include "flexprefs.h" // For saving volume settings
+#include "settings.h" // Volume settings
+#include "heapcounter.h" // FLX_MEMORY_TAG
 
 namespace FlexEngine
 {
@@ -29,11 +14,20 @@ FMOD_RESULT FMODWrapper::result;
 FMOD::ChannelGroup* FMODWrapper::bgm_group = nullptr;
 FMOD::ChannelGroup* FMODWrapper::sfx_group = nullptr;
 bool FMODWrapper::is_paused = false;
+FMODWrapper::MemoryStats FMODWrapper::memory_stats;
+
+// The groups follow the volume settings, whoever changes them
+static Settings::ListenerID bgm_volume_listener = 0;
+static Settings::ListenerID sfx_volume_listener = 0;
 
 // Static initialization for core
-std::map<std::string, FMOD::Channel*> FMODWrapper::Core::channels;
+// 64 voices is plenty for this game, FMOD itself is initialized with 512 virtual channels
+VoicePool FMODWrapper::Core::voices(64, FMODWrapper::Core::CHANNELGROUP::COUNT);
+std::unordered_map<std::string, VoicePool::Handle> FMODWrapper::Core::named_voices;
 
-// Callback function which calls stop sound when the sound is done playing
+// Callback function which frees the voice when the sound is done playing
+// The handle is stored directly in the user data, so nothing has to be allocated per sound.
+// Stopped and stolen voices also end up here, their handles are already stale and Release ignores them.
 FMOD_RESULT F_CALLBACK channelCallback(FMOD_CHANNELCONTROL* channelControl, FMOD_CHANNELCONTROL_TYPE controlType [[maybe_unused]], 
                                        FMOD_CHANNELCONTROL_CALLBACK_TYPE callbackType, 
                                        void* commandData1 [[maybe_unused]], void* commandData2 [[maybe_unused]] )
@@ -42,18 +36,11 @@ FMOD_RESULT F_CALLBACK channelCallback(FMOD_CHANNELCONTROL* channelControl, FMOD
   {
     // Get ptr to the channel and read data
     FMOD::Channel* channel = reinterpret_cast<FMOD::Channel*>(channelControl);
-    std::string* id = nullptr;
-    channel->getUserData(reinterpret_cast<void**>(&id));
-
-    if (id)
-    {
-      // Remove the channel from the map
-      FMODWrapper::Core::StopSound(*id);
-
-      // Free userdata memory alloc
-      delete id;
-      channel->setUserData(nullptr);
-    }
+    void* user_data = nullptr;
+    channel->getUserData(&user_data);
+
+    VoicePool::Handle handle = static_cast<VoicePool::Handle>(reinterpret_cast<uintptr_t>(user_data));
+    if (handle != VoicePool::INVALID_HANDLE) FMODWrapper::Core::Internal_ReleaseVoice(handle);
   }
   return FMOD_OK;
 }
@@ -61,19 +48,29 @@ FMOD_RESULT F_CALLBACK channelCallback(FMOD_CHANNELCONTROL* channelControl, FMOD
 /*!
   \brief Constructor for the FMODWrapper. Handles the creation of the FMOD system.
 */
-void FMODWrapper::Load()
+void FMODWrapper::Load(FMOD_OUTPUTTYPE output)
 {
   FMOD_ASSERT(FMOD::Studio::System::create(&fmod_studio_system));
-  FMOD_ASSERT(fmod_studio_system->initialize(512, FMOD_STUDIO_INIT_NORMAL, FMOD_INIT_NORMAL, nullptr));
+
+  // the output has to be set on the core system before initialization
   FMOD_ASSERT(fmod_studio_system->getCoreSystem(&fmod_system));
+  if (output != FMOD_OUTPUTTYPE_AUTODETECT) FMOD_ASSERT(fmod_system->setOutput(output));
+
+  FMOD_ASSERT(fmod_studio_system->initialize(512, FMOD_STUDIO_INIT_NORMAL, FMOD_INIT_NORMAL, nullptr));
+
+  // music never needs more than a crossfade, sfx can pile up in battles
+  Core::SetGroupVoiceLimit(Core::CHANNELGROUP::BGM, 4);
+  Core::SetGroupVoiceLimit(Core::CHANNELGROUP::SFX, 32);
 
   fmod_system->createChannelGroup("BGM", &FMODWrapper::bgm_group);
   fmod_system->createChannelGroup("SFX", &FMODWrapper::sfx_group);
 
   // Set the volume of the channel groups
-  FlexPrefs::Load(); // Load the settings in case they aren't open
-  FMODWrapper::bgm_group->setVolume(FlexPrefs::GetFloat("game.volume", 0.0f));
-  FMODWrapper::sfx_group->setVolume(FlexPrefs::GetFloat("game.sfx.volume", 0.0f));
+  // The application declares the engine settings before loading FMOD
+  FMODWrapper::bgm_group->setVolume(EngineSettings::game_volume.Get());
+  FMODWrapper::sfx_group->setVolume(EngineSettings::game_sfx_volume.Get());
+  bgm_volume_listener = Settings::AddListener(EngineSettings::game_volume, [](float volume) { FMODWrapper::bgm_group->setVolume(volume); });
+  sfx_volume_listener = Settings::AddListener(EngineSettings::game_sfx_volume, [](float volume) { FMODWrapper::sfx_group->setVolume(volume); });
 }
 
 /*!
@@ -84,7 +81,19 @@ void FMODWrapper::Unload()
   // Save any settings in case
   FlexPrefs::Save();
 
+  Settings::RemoveListener(bgm_volume_listener);
+  Settings::RemoveListener(sfx_volume_listener);
+
   Core::ForceStop();
+
+  const VoicePool::Stats& voice_stats = Core::GetVoiceStats();
+  Log::Info(
+    "[FMOD] " + std::to_string(memory_stats.sounds) + " sounds (" + std::to_string(memory_stats.streamed) + " streamed, " +
+    std::to_string(memory_stats.compressed) + " compressed), " + std::to_string(memory_stats.resident_bytes / 1024) + " KB in memory, " +
+    std::to_string(memory_stats.SavedBytes() / 1024) + " KB saved by the load policies. Peak voices " + std::to_string(voice_stats.peak) +
+    ", stolen " + std::to_string(voice_stats.stolen) + ", rejected " + std::to_string(voice_stats.rejected)
+  );
+
   FMOD_ASSERT(fmod_studio_system->release()); // Unloads core as well...
 }
 
@@ -93,117 +102,166 @@ void FMODWrapper::Unload()
 */
 void FMODWrapper::Update()
 {
+  FLX_MEMORY_TAG(Audio);
+
   FMOD_ASSERT(fmod_studio_system->update()); // Invokes fmod core's update as well...
 }
 
-void FMODWrapper::Core::PlaySound(std::string const& identifier, Asset::Sound const& asset, CHANNELGROUP cg)
+const FMODWrapper::MemoryStats& FMODWrapper::GetMemoryStats()
 {
-  if (FMODWrapper::is_paused) return; // Don't play if paused
+  return memory_stats;
+}
+
+void FMODWrapper::Internal_TrackSound(Asset::Sound const& asset, bool is_loaded)
+{
+  // loaded adds, unloaded subtracts
+  auto apply = [is_loaded](auto& value, auto amount) { if (is_loaded) value += amount; else value -= amount; };
+
+  apply(memory_stats.sounds, std::size_t(1));
+  if (asset.policy == Asset::Sound::LoadPolicy::Stream) apply(memory_stats.streamed, std::size_t(1));
+  if (asset.policy == Asset::Sound::LoadPolicy::CompressedInMemory) apply(memory_stats.compressed, std::size_t(1));
+  apply(memory_stats.decoded_bytes, asset.decoded_bytes);
+  apply(memory_stats.resident_bytes, asset.resident_bytes);
+
+  // FMOD allocates the sound data itself
+  int64_t resident_bytes = static_cast<int64_t>(asset.resident_bytes);
+  HeapCounter::AddExternal(MemoryTag::AssetSound, is_loaded ? resident_bytes : -resident_bytes);
+}
 
-  // Play the sound given a sound handle and a channel...
-  if (channels.find(identifier) == channels.end()) // not already used identifier
+FMOD::ChannelGroup* FMODWrapper::Core::GetGroup(CHANNELGROUP channelGroup)
+{
+  if (channelGroup == CHANNELGROUP::BGM) return FMODWrapper::bgm_group;
+  if (channelGroup == CHANNELGROUP::SFX) return FMODWrapper::sfx_group;
+  return nullptr;
+}
+
+VoicePool::Handle FMODWrapper::Core::PlayVoice(Asset::Sound const& asset, CHANNELGROUP cg, bool is_looping, int priority)
+{
+  FLX_MEMORY_TAG(Audio);
+
+  if (FMODWrapper::is_paused) return VoicePool::INVALID_HANDLE; // Don't play if paused
+
+  // guard: sound failed to load
+  if (!asset.sound) return VoicePool::INVALID_HANDLE;
+
+  void* stolen = nullptr;
+  VoicePool::Handle handle = voices.Acquire(cg, priority, stolen);
+  if (stolen) static_cast<FMOD::Channel*>(stolen)->stop();
+  if (handle == VoicePool::INVALID_HANDLE) return handle;
+
+  // Start paused so that the mode and group are set before the first sample is mixed
+  FMOD::Channel* channel = nullptr;
+  FMOD_ASSERT(fmod_system->playSound(asset.sound, GetGroup(cg), true, &channel));
+  if (!channel)
   {
-    FMOD::Channel* channel;
-    FMOD_ASSERT(fmod_system->playSound(asset.sound, nullptr, false, &channel));
-
-    if (channel)
-    {
-      if (cg == CHANNELGROUP::BGM)
-      {
-        channel->setChannelGroup(FMODWrapper::bgm_group);
-      }
-      else if (cg == CHANNELGROUP::SFX)
-      {
-        channel->setChannelGroup(FMODWrapper::sfx_group);
-      }
-    }
-
-    // Set it to automatically remove from list when done
-    std::string* id = new std::string(identifier);
-    channel->setCallback(channelCallback); 
-    channel->setUserData(reinterpret_cast<void*>(id));
-
-    channels[identifier] = channel;
+    voices.Release(handle);
+    return VoicePool::INVALID_HANDLE;
   }
-  else
+
+  if (is_looping) channel->setMode(FMOD_LOOP_NORMAL);
+  channel->setPriority(priority);
+
+  // Set it to automatically free the voice when done
+  channel->setUserData(reinterpret_cast<void*>(static_cast<uintptr_t>(handle)));
+  channel->setCallback(channelCallback);
+  channel->setPaused(false);
+
+  voices.SetChannel(handle, channel);
+  return handle;
+}
+
+void FMODWrapper::Core::StopVoice(VoicePool::Handle voice)
+{
+  FMOD::Channel* channel = static_cast<FMOD::Channel*>(voices.GetChannel(voice));
+
+  // release first, stop fires the end callback which would try again
+  voices.Release(voice);
+  if (channel) channel->stop();
+}
+
+void FMODWrapper::Core::Internal_ReleaseVoice(VoicePool::Handle voice)
+{
+  voices.Release(voice);
+}
+
+bool FMODWrapper::Core::IsVoicePlaying(VoicePool::Handle voice)
+{
+  return voices.IsValid(voice);
+}
+
+void FMODWrapper::Core::SetVoiceLooping(VoicePool::Handle voice, bool is_looping)
+{
+  FMOD::Channel* channel = static_cast<FMOD::Channel*>(voices.GetChannel(voice));
+  if (channel) channel->setMode(is_looping ? FMOD_LOOP_NORMAL : FMOD_LOOP_OFF);
+}
+
+void FMODWrapper::Core::SetGroupVoiceLimit(CHANNELGROUP channelGroup, std::size_t limit)
+{
+  voices.SetGroupLimit(channelGroup, limit);
+}
+
+const VoicePool::Stats& FMODWrapper::Core::GetVoiceStats()
+{
+  return voices.GetStats();
+}
+
+void FMODWrapper::Core::PlaySound(std::string const& identifier, Asset::Sound const& asset, CHANNELGROUP cg)
+{
+  FLX_MEMORY_TAG(Audio);
+
+  if (FMODWrapper::is_paused) return; // Don't play if paused
+
+  auto it = named_voices.find(identifier);
+  if (it != named_voices.end() && voices.IsValid(it->second))
   {
     Log::Warning("Channel already exists for identifier: " + identifier + ", playing newly requested sound...");
-    StopSound(identifier);
-    PlaySound(identifier, asset);
+    StopVoice(it->second);
   }
+
+  named_voices[identifier] = PlayVoice(asset, cg, false);
 }
 
 void FMODWrapper::Core::PlayLoopingSound(std::string const& identifier, Asset::Sound const& asset, CHANNELGROUP cg)
 {
-  // Play the sound given a sound handle and a channel...
-  if (channels.find(identifier) == channels.end()) // not already used identifier
-  {
-    FMOD::Channel* channel;
-    FMOD_ASSERT(fmod_system->playSound(asset.sound, nullptr, false, &channel));
-    channel->setMode(FMOD_LOOP_NORMAL); 
-
-    if (channel)
-    {
-      if (cg == CHANNELGROUP::BGM)
-      {
-        channel->setChannelGroup(FMODWrapper::bgm_group);
-      }
-      else if (cg == CHANNELGROUP::SFX)
-      {
-        channel->setChannelGroup(FMODWrapper::sfx_group);
-      }
-    }
-
-    // Set it to automatically remove from list when done
-    std::string* id = new std::string(identifier);
-    channel->setCallback(channelCallback);
-    channel->setUserData(reinterpret_cast<void*>(id));
-
-    channels[identifier] = channel;
-  }
-  else
+  FLX_MEMORY_TAG(Audio);
+
+  auto it = named_voices.find(identifier);
+  if (it != named_voices.end() && voices.IsValid(it->second))
   {
     Log::Warning("Channel already exists for identifier: " + identifier + ", playing newly requested sound...");
-    StopSound(identifier);
-    PlaySound(identifier, asset);
+    StopVoice(it->second);
   }
+
+  named_voices[identifier] = PlayVoice(asset, cg, true);
 }
 
 void FMODWrapper::Core::StopSound(std::string const& identifier)
 {
-  if (channels.find(identifier) != channels.end())
+  auto it = named_voices.find(identifier);
+  if (it != named_voices.end() && voices.IsValid(it->second))
   {
-    channels[identifier]->stop();
-    channels.erase(identifier);
+    StopVoice(it->second);
+    named_voices.erase(it);
   }
   else Log::Warning("Tried to stop channel that does not exist for identifier: " + identifier);
 }
 
 void FMODWrapper::Core::ForceStop()
 {
-  // A bizarre choice... but I have no choice because this is not callback safe. I've tried not making a copy but it doesn't work.
-  std::vector<FMOD::Channel*> channelsToStop;
-  for (auto& channel : channels)
+  // Release everything before stopping, stop fires the end callback for each channel
+  for (void* channel : voices.ReleaseAll())
   {
-    channelsToStop.push_back(channel.second);
+    static_cast<FMOD::Channel*>(channel)->stop();
   }
 
-  for (auto* channel : channelsToStop)
-  {
-    if (channel)
-    {
-      channel->stop(); 
-    }
-  }
-
-  channels.clear();
+  named_voices.clear();
 }
 
 void FMODWrapper::Core::ForceFadeOut(float fadeDuration)
 {
-  for (auto& [key, channel] : channels)
+  voices.ForEachChannel([fadeDuration](void* voice_channel)
   {
-    if (!channel) continue; // Skip invalid 
+    FMOD::Channel* channel = static_cast<FMOD::Channel*>(voice_channel);
 
     // Enable volume ramp to start fade out
     channel->setVolumeRamp(true);
@@ -224,23 +282,17 @@ void FMODWrapper::Core::ForceFadeOut(float fadeDuration)
 
     // Set the delay to stop the sound after the fade duration
     channel->setDelay(0, dspClock + static_cast<unsigned long long>(fadeDuration * sampleRate), false);
-  }
+  });
 }
 
 void FMODWrapper::Core::StopAll()
 {
-  for (auto& channel : channels)
-  {
-    channel.second->setPaused(true);
-  }
+  voices.ForEachChannel([](void* channel) { static_cast<FMOD::Channel*>(channel)->setPaused(true); });
 }
 
 void FMODWrapper::Core::ResumeAll()
 {
-  for (auto& channel : channels)
-  {
-    channel.second->setPaused(false);
-  }
+  voices.ForEachChannel([](void* channel) { static_cast<FMOD::Channel*>(channel)->setPaused(false); });
 }
 
 void FMODWrapper::Core::WindowFocusCallback([[maybe_unused]] GLFWwindow* window, int focused) // Forced to use this signature, but don't need the window pointer itself.
@@ -259,24 +311,20 @@ void FMODWrapper::Core::WindowFocusCallback([[maybe_unused]] GLFWwindow* window,
 
 void FMODWrapper::Core::ChangeLoopProperty(std::string const& identifier, bool is_looping)
 {
-  // Proper way to stop but this kills the sound
-  channels[identifier]->setMode(is_looping ? FMOD_LOOP_NORMAL : FMOD_LOOP_OFF);
-  
-  // Slightly hacky but should always work
-  //channels[identifier]->setLoopCount(0);
+  auto it = named_voices.find(identifier);
+  if (it != named_voices.end()) SetVoiceLooping(it->second, is_looping);
 }
 
 void FMODWrapper::Core::AdjustGroupVolume(CHANNELGROUP channelGroup, float volPercent)
 {
+  // the settings listeners set the group volume
   if (channelGroup == CHANNELGROUP::BGM)
   {
-    FMODWrapper::bgm_group->setVolume(volPercent);
-    FlexPrefs::SetFloat("game.volume", volPercent);
+    Settings::Set(EngineSettings::game_volume, volPercent);
   }
   else if (channelGroup == CHANNELGROUP::SFX)
   {
-    FMODWrapper::sfx_group->setVolume(volPercent);
-    FlexPrefs::SetFloat("game.sfx.volume", volPercent);
+    Settings::Set(EngineSettings::game_sfx_volume, volPercent);
   }
 }
 
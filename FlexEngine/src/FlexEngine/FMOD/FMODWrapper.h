@@ -8,6 +8,10 @@
  *   It doesn't handle any of the audio playing, and meant to be run in a system in the game layer.
  * 
  *   Note that you can't run two sounds under the same name unless the previous sound is a one shot and finished playing or was stopped.
+ *
+ *   Playing channels live in a VoicePool. PlayVoice returns an integer handle that stays valid until the
+ *   sound ends, is stopped or is stolen by a more important sound. The name based functions are kept for
+ *   existing callers and map names to handles.
  * 
  *   Now here's the sauce...
  *   For a quick start: https://www.fmod.com/docs/2.02/api/white-papers-getting-started.html#fmod-core-api-initialization-do-not-use-this-if-using-fmod-studio-api-initialization
@@ -27,6 +31,7 @@
 #include "FMOD/core/fmod_errors.h"     // FMOD error handling for macro
 #include <cassert>
 #include "FMOD/Sound.h"                // Definition of the asset
+#include "FMOD/VoicePool.h"            // Handles for playing channels
 #include "GLFW/glfw3.h"                // For focus/unfocus callback
 
 // Most of the FMOD functions return an FMOD_RESULT, we want to watch for this with FMOD assert macro to crash fast for debugging
@@ -59,16 +64,51 @@ public:
   // This class extends usage for middle level to call from.
   class __FLX_API Core
   {
-    static std::map<std::string, FMOD::Channel*> channels; // Stores all instances of channels in existence
-
   public:
     // Enum of channel groups that it can be a part of. To create a channel, add to this enum
     enum CHANNELGROUP
     {
       BGM = 0,
       SFX = 1,
+      COUNT
     };
 
+  private:
+    static VoicePool voices;                                               // Every playing channel
+    static std::unordered_map<std::string, VoicePool::Handle> named_voices; // For the name based functions
+
+    static FMOD::ChannelGroup* GetGroup(CHANNELGROUP channelGroup);
+
+  public:
+    /*!
+      \brief Plays a sound in the voice pool. Usage: auto voice = FMODWrapper::Core::PlayVoice(FLX_ASSET_GET(Asset::Sound, AssetKey("/audio/test.mp3")));
+      \param asset The sound to play
+      \param channelGroup The group, which has its own voice limit
+      \param is_looping Loops until stopped
+      \param priority 0 is the most important, 256 the least. Used to pick which voice to steal when the group is full.
+      \return The handle of the voice, or VoicePool::INVALID_HANDLE if the sound could not be played
+    */
+    static VoicePool::Handle PlayVoice(Asset::Sound const& asset, CHANNELGROUP channelGroup = CHANNELGROUP::SFX,
+                                       bool is_looping = false, int priority = VoicePool::DEFAULT_PRIORITY);
+
+    // Stops a voice. Does nothing if it already finished.
+    static void StopVoice(VoicePool::Handle voice);
+
+    // INTERNAL FUNCTION
+    // Frees the voice without stopping the channel, called when the channel ends by itself
+    static void Internal_ReleaseVoice(VoicePool::Handle voice);
+
+    // Returns false once the voice finished, was stopped or was stolen
+    static bool IsVoicePlaying(VoicePool::Handle voice);
+
+    static void SetVoiceLooping(VoicePool::Handle voice, bool is_looping);
+
+    // Sets the maximum number of voices the group can play at once
+    static void SetGroupVoiceLimit(CHANNELGROUP channelGroup, std::size_t limit);
+
+    // Playing, peak, stolen and rejected voice counts
+    static const VoicePool::Stats& GetVoiceStats();
+
     /*!
       \brief Plays the sound. Usage: FMODWrapper::Core::PlaySound("mario", FLX_ASSET_GET(Asset::Sound, AssetKey("/audio/test.mp3")));
       \param identifier The identifier of the sound for controlling
@@ -118,8 +158,33 @@ public:
   inline static bool is_studio_init() { return fmod_studio_system != NULL; }
   inline static bool is_core_init() { return fmod_system != NULL; }
 
+  // Memory used by loaded sounds compared to decoding all of them at load
+  struct MemoryStats
+  {
+    std::size_t sounds = 0;
+    std::size_t streamed = 0;
+    std::size_t compressed = 0;
+    std::uintmax_t decoded_bytes = 0;  // if every sound was fully decoded
+    std::uintmax_t resident_bytes = 0; // with the load policies
+
+    std::uintmax_t SavedBytes() const { return decoded_bytes > resident_bytes ? decoded_bytes - resident_bytes : 0; }
+  };
+
+private:
+  static MemoryStats memory_stats;
+
+public:
+
+  static const MemoryStats& GetMemoryStats();
+
+  // INTERNAL FUNCTION
+  // Called by Asset::Sound when it is created and unloaded
+  static void Internal_TrackSound(Asset::Sound const& asset, bool is_loaded);
+
   // Functions for setup of core FMOD systems
-  static void Load();
+  // Use FMOD_OUTPUTTYPE_NOSOUND_NRT or FMOD_OUTPUTTYPE_WAVWRITER_NRT to run without an audio device,
+  // e.g. for tests. Non-realtime outputs only advance when Update is called.
+  static void Load(FMOD_OUTPUTTYPE output = FMOD_OUTPUTTYPE_AUTODETECT);
   static void Unload();
   static void Update();
 };
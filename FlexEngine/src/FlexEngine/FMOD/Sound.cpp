@@ -3,14 +3,62 @@
 #include "FMODWrapper.h"
 #include "Sound.h"
 
+#include <filesystem>
+
 namespace FlexEngine
 {
   namespace Asset
   {
+    Sound::LoadPolicy Sound::ChooseLoadPolicy(std::string const& key, std::uintmax_t file_size)
+    {
+      // keys can use either slash depending on where they were loaded from
+      std::string normalized = key;
+      std::replace(normalized.begin(), normalized.end(), '\\', '/');
+
+      if (normalized.find("/audio/bgm/") != std::string::npos) return LoadPolicy::Stream;
+      if (file_size >= STREAM_THRESHOLD_BYTES) return LoadPolicy::Stream;
+
+      // wav is already PCM, keeping it compressed saves nothing
+      std::string extension = std::filesystem::path(normalized).extension().string();
+      std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+      if (extension == ".wav") return LoadPolicy::Decompressed;
+
+      return LoadPolicy::CompressedInMemory;
+    }
+
     Sound::Sound(std::string const& key) : sound(nullptr)
     {
       std::string path = "assets" + key;
-      FMOD_ASSERT(FMODWrapper::fmod_system->createSound(path.c_str(), FMOD_DEFAULT, 0, &sound));
+
+      std::error_code ec;
+      std::uintmax_t file_size = std::filesystem::file_size(path, ec);
+      if (ec) file_size = 0;
+
+      policy = ChooseLoadPolicy(key, file_size);
+
+      FMOD_MODE mode = FMOD_DEFAULT;
+      switch (policy)
+      {
+      case LoadPolicy::Decompressed:       mode |= FMOD_CREATESAMPLE; break;
+      case LoadPolicy::CompressedInMemory: mode |= FMOD_CREATECOMPRESSEDSAMPLE; break;
+      case LoadPolicy::Stream:             mode |= FMOD_CREATESTREAM; break;
+      }
+
+      FMOD_ASSERT(FMODWrapper::fmod_system->createSound(path.c_str(), mode, 0, &sound));
+
+      // PCM length is an estimate for compressed streams, good enough for reporting
+      unsigned int pcm_bytes = 0;
+      if (sound) sound->getLength(&pcm_bytes, FMOD_TIMEUNIT_PCMBYTES);
+      decoded_bytes = pcm_bytes;
+
+      switch (policy)
+      {
+      case LoadPolicy::Decompressed:       resident_bytes = decoded_bytes; break;
+      case LoadPolicy::CompressedInMemory: resident_bytes = file_size; break;
+      case LoadPolicy::Stream:             resident_bytes = 0; break; // only the stream buffer
+      }
+
+      FMODWrapper::Internal_TrackSound(*this, true);
     }
 
     // Cannot free sound as FMOD frees it internally
@@ -22,9 +70,10 @@ namespace FlexEngine
     {
       if (sound)
       {
+        FMODWrapper::Internal_TrackSound(*this, false);
         FMOD_ASSERT(sound->release());
         sound = nullptr;
       }
     }
   }
-}
\ No newline at end of file
+}
@@ -5,6 +5,8 @@
 #include "flx_api.h"
 #include "FMOD/studio/fmod_studio.hpp" // FMOD studio
 
+#include <cstdint>
+
 namespace FlexEngine
 {
   namespace Asset
@@ -13,7 +15,31 @@ namespace FlexEngine
     class __FLX_API Sound
     {
     public:
+      // How the file is kept in memory.
+      //  - Decompressed: decoded to PCM at load, cheapest to play. Short SFX.
+      //  - CompressedInMemory: file bytes are kept and decoded while playing. Short compressed SFX.
+      //  - Stream: read from disk while playing. Music and long tracks.
+      //    Only one instance of a streamed sound can play at a time.
+      enum class LoadPolicy : uint8_t
+      {
+        Decompressed,
+        CompressedInMemory,
+        Stream
+      };
+
+      // Files at or above this size are streamed
+      static constexpr std::uintmax_t STREAM_THRESHOLD_BYTES = 1024 * 1024;
+
+      // Picks the policy from the asset key and the file size.
+      // Anything under /audio/bgm/ is music and always streams.
+      static LoadPolicy ChooseLoadPolicy(std::string const& key, std::uintmax_t file_size);
+
       FMOD::Sound* sound = nullptr;
+      LoadPolicy policy = LoadPolicy::Decompressed;
+
+      // Memory footprint estimates, see FMODWrapper::GetMemoryStats
+      std::uintmax_t decoded_bytes = 0;  // size of the fully decoded PCM
+      std::uintmax_t resident_bytes = 0; // what this policy keeps in memory
 
       // Only allow construction of sound if we have a key.
       Sound(std::string const& key);
@@ -21,4 +47,4 @@ namespace FlexEngine
       void Unload();
     };
   }
-}
\ No newline at end of file
+}
@@ -0,0 +1,176 @@
+/** WLVerse
+ * \file VoicePool.cpp
+ *
+ * \brief
+ *   Fixed size pool of voices (playing channels) with integer handles.
+ *
+ * \authors
+ *   Yew Chong (yewchong.k\@digipen.edu)
+ *
+ * \par All content (c) 2024 DigiPen Institute of Technology Singapore. All rights reserved.
+ */
+
+#include "pch.h"
+
+#include "VoicePool.h"
+
+namespace FlexEngine
+{
+VoicePool::VoicePool(std::size_t capacity, int group_count)
+{
+  if (capacity > 0xFFFF) capacity = 0xFFFF;
+  if (group_count < 1) group_count = 1;
+
+  m_voices.resize(capacity);
+  m_free.reserve(capacity);
+
+  // hand out low slots first
+  for (std::size_t i = capacity; i > 0; --i) m_free.push_back(static_cast<uint16_t>(i - 1));
+
+  m_group_limits.assign(group_count, capacity);
+  m_group_counts.assign(group_count, 0);
+}
+
+void VoicePool::SetGroupLimit(int group, std::size_t limit)
+{
+  if (group < 0 || group >= static_cast<int>(m_group_limits.size())) return;
+  m_group_limits[group] = limit;
+}
+
+std::size_t VoicePool::GetGroupLimit(int group) const
+{
+  if (group < 0 || group >= static_cast<int>(m_group_limits.size())) return 0;
+  return m_group_limits[group];
+}
+
+std::size_t VoicePool::GetGroupCount(int group) const
+{
+  if (group < 0 || group >= static_cast<int>(m_group_counts.size())) return 0;
+  return m_group_counts[group];
+}
+
+VoicePool::Handle VoicePool::Acquire(int group, int priority, void*& stolen_channel)
+{
+  stolen_channel = nullptr;
+
+  // guard: unknown group
+  if (group < 0 || group >= static_cast<int>(m_group_limits.size()))
+  {
+    m_stats.rejected++;
+    return INVALID_HANDLE;
+  }
+
+  // steal within the group if it is full, or from anyone if the whole pool is full
+  bool group_full = m_group_counts[group] >= m_group_limits[group];
+  if (group_full || m_free.empty())
+  {
+    std::size_t victim = m_voices.size();
+    for (std::size_t i = 0; i < m_voices.size(); ++i)
+    {
+      const Voice& voice = m_voices[i];
+      if (!voice.in_use) continue;
+      if (group_full && voice.group != group) continue;
+
+      // least important first, then oldest
+      if (victim == m_voices.size() ||
+          voice.priority > m_voices[victim].priority ||
+          (voice.priority == m_voices[victim].priority && voice.order < m_voices[victim].order))
+      {
+        victim = i;
+      }
+    }
+
+    // guard: nothing that can be stolen
+    if (victim == m_voices.size() || m_voices[victim].priority < priority)
+    {
+      m_stats.rejected++;
+      return INVALID_HANDLE;
+    }
+
+    stolen_channel = m_voices[victim].channel;
+    Free(victim);
+    m_stats.stolen++;
+  }
+
+  uint16_t index = m_free.back();
+  m_free.pop_back();
+
+  Voice& voice = m_voices[index];
+  voice.channel = nullptr;
+  voice.order = m_next_order++;
+  voice.group = group;
+  voice.priority = priority;
+  voice.in_use = true;
+
+  m_group_counts[group]++;
+  m_stats.playing++;
+  if (m_stats.playing > m_stats.peak) m_stats.peak = m_stats.playing;
+
+  return MakeHandle(index, voice.generation);
+}
+
+void VoicePool::SetChannel(Handle handle, void* channel)
+{
+  Voice* voice = const_cast<Voice*>(Lookup(handle));
+  if (voice) voice->channel = channel;
+}
+
+void* VoicePool::GetChannel(Handle handle) const
+{
+  const Voice* voice = Lookup(handle);
+  return voice ? voice->channel : nullptr;
+}
+
+bool VoicePool::IsValid(Handle handle) const
+{
+  return Lookup(handle) != nullptr;
+}
+
+void VoicePool::Release(Handle handle)
+{
+  if (!Lookup(handle)) return;
+  Free((handle & 0xFFFF) - 1);
+}
+
+std::vector<void*> VoicePool::ReleaseAll()
+{
+  std::vector<void*> channels;
+  for (std::size_t i = 0; i < m_voices.size(); ++i)
+  {
+    if (!m_voices[i].in_use) continue;
+    if (m_voices[i].channel) channels.push_back(m_voices[i].channel);
+    Free(i);
+  }
+  return channels;
+}
+
+VoicePool::Handle VoicePool::MakeHandle(std::size_t index, uint16_t generation)
+{
+  // index + 1 so that 0 is never a valid handle
+  return (static_cast<Handle>(generation) << 16) | static_cast<Handle>(index + 1);
+}
+
+const VoicePool::Voice* VoicePool::Lookup(Handle handle) const
+{
+  std::size_t index = handle & 0xFFFF;
+  if (index == 0 || index > m_voices.size()) return nullptr;
+
+  const Voice& voice = m_voices[index - 1];
+  if (!voice.in_use || voice.generation != static_cast<uint16_t>(handle >> 16)) return nullptr;
+  return &voice;
+}
+
+void VoicePool::Free(std::size_t index)
+{
+  Voice& voice = m_voices[index];
+  voice.in_use = false;
+  voice.channel = nullptr;
+
+  // skip 0 so that a handle is never 0 after wrapping around
+  if (++voice.generation == 0) voice.generation = 1;
+
+  m_group_counts[voice.group]--;
+  m_stats.playing--;
+  m_free.push_back(static_cast<uint16_t>(index));
+}
+}
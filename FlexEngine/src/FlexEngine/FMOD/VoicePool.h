@@ -0,0 +1,112 @@
+/** WLVerse
+ * \file VoicePool.h
+ *
+ * \brief
+ *   Fixed size pool of voices (playing channels) with integer handles.
+ *
+ *   A handle packs the slot index with a generation counter, so a handle to a voice
+ *   that has finished or was stolen simply stops resolving instead of pointing at
+ *   whatever plays in that slot next.
+ *
+ *   Every group (BGM, SFX...) has a voice limit. When a group is full, the least
+ *   important voice in it is stolen if it is not more important than the new one,
+ *   otherwise the new voice is rejected. Priorities follow FMOD: 0 is the most
+ *   important, 256 the least. Ties steal the oldest voice.
+ *
+ *   The pool does not call FMOD, it only hands back the channel that has to be
+ *   stopped. This keeps it testable without an audio device.
+ *
+ * \authors
+ *   Yew Chong (yewchong.k\@digipen.edu)
+ *
+ * \par All content (c) 2024 DigiPen Institute of Technology Singapore. All rights reserved.
+ */
+
+#pragma once
+
+#include "flx_api.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace FlexEngine
+{
+class __FLX_API VoicePool
+{
+public:
+  using Handle = uint32_t;
+  static constexpr Handle INVALID_HANDLE = 0;
+
+  static constexpr int DEFAULT_PRIORITY = 128;
+
+  struct Stats
+  {
+    std::size_t playing = 0;
+    std::size_t peak = 0;
+    std::size_t stolen = 0;   // voices stopped early to make room
+    std::size_t rejected = 0; // play requests dropped because every voice was more important
+  };
+
+  // capacity is capped at 65535 because the slot index is 16 bits of the handle
+  VoicePool(std::size_t capacity, int group_count);
+
+  // Limits how many voices a group can play at once. Defaults to the capacity.
+  void SetGroupLimit(int group, std::size_t limit);
+  std::size_t GetGroupLimit(int group) const;
+  std::size_t GetGroupCount(int group) const;
+
+  // Reserves a voice for a new sound.
+  // If a voice had to be stolen, stolen_channel is set to its channel and the caller must stop it.
+  // Returns INVALID_HANDLE if the request was rejected.
+  Handle Acquire(int group, int priority, void*& stolen_channel);
+
+  // Attaches the playing channel to an acquired voice
+  void SetChannel(Handle handle, void* channel);
+
+  // Returns nullptr if the handle is stale
+  void* GetChannel(Handle handle) const;
+
+  bool IsValid(Handle handle) const;
+
+  // Frees the voice. Stale handles are ignored, so this is safe to call from
+  // the channel end callback after the voice was already stopped or stolen.
+  void Release(Handle handle);
+
+  // Frees every voice and returns their channels so that the caller can stop them
+  std::vector<void*> ReleaseAll();
+
+  // Calls func(channel) for every voice with a channel
+  template <typename Func>
+  void ForEachChannel(Func func) const
+  {
+    for (const Voice& voice : m_voices)
+    {
+      if (voice.in_use && voice.channel) func(voice.channel);
+    }
+  }
+
+  const Stats& GetStats() const { return m_stats; }
+
+private:
+  struct Voice
+  {
+    void* channel = nullptr;
+    uint64_t order = 0; // when the voice was acquired, used to steal the oldest
+    int group = 0;
+    int priority = DEFAULT_PRIORITY;
+    uint16_t generation = 1;
+    bool in_use = false;
+  };
+
+  std::vector<Voice> m_voices;
+  std::vector<uint16_t> m_free; // free slot indices
+  std::vector<std::size_t> m_group_limits;
+  std::vector<std::size_t> m_group_counts;
+  uint64_t m_next_order = 0;
+  Stats m_stats;
+
+  static Handle MakeHandle(std::size_t index, uint16_t generation);
+  const Voice* Lookup(Handle handle) const;
+  void Free(std::size_t index);
+};
+}
@@ -67,6 +67,8 @@ namespace FlexEngine
 
     __FLX_API ComponentData<void> Internal_CreateComponentData(std::size_t size, void* data)
     {
+      FLX_MEMORY_TAG(ECS);
+
       // Create a new data structure
       void* ptr = ::operator new(sizeof(std::size_t) + size);
       if (!ptr)
@@ -84,7 +86,7 @@ namespace FlexEngine
       return ComponentData<void>(ptr, [](void* ptr) { ::operator delete(ptr); });
     }
 
-    __FLX_API std::pair<std::size_t, void*> Internal_GetComponentData(ComponentData<void> data)
+    __FLX_API std::pair<std::size_t, void*> Internal_GetComponentData(const ComponentData<void>& data)
     {
       std::size_t* size_ptr = reinterpret_cast<std::size_t*>(data.get());
       return {
@@ -95,5 +97,43 @@ namespace FlexEngine
       };
     }
 
+    __FLX_API Column Internal_CopyColumn(const Column& column)
+    {
+      FLX_MEMORY_TAG(ECS);
+
+      Column copy;
+      if (column.empty()) return copy;
+
+      // Each component is copied together with its size prefix, and is padded so that
+      // it has the same alignment as a component from Internal_CreateComponentData.
+      auto stride_of = [](const ComponentData<void>& data)
+      {
+        std::size_t bytes = sizeof(std::size_t) + *reinterpret_cast<const std::size_t*>(data.get());
+        return (bytes + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+      };
+
+      std::size_t total = 0;
+      for (const ComponentData<void>& data : column) total += stride_of(data);
+
+      std::shared_ptr<unsigned char> block(
+        static_cast<unsigned char*>(::operator new(total)),
+        [](unsigned char* ptr) { ::operator delete(ptr); }
+      );
+
+      copy.reserve(column.size());
+      std::size_t offset = 0;
+      for (const ComponentData<void>& data : column)
+      {
+        std::size_t size = *reinterpret_cast<const std::size_t*>(data.get());
+        memcpy(block.get() + offset, data.get(), sizeof(std::size_t) + size);
+
+        // aliasing constructor, shares the block's reference count
+        copy.emplace_back(block, block.get() + offset);
+        offset += stride_of(data);
+      }
+
+      return copy;
+    }
+
   }
 }
\ No newline at end of file
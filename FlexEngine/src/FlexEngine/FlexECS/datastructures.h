@@ -28,10 +28,15 @@
 #include "Reflection/base.h"  // "Wrapper/flexassert.h" <rapidjson/document.h>
                               // <cstddef> <iostream> <string> <sstream> <vector> <map> <unordered_map> <functional>
 #include "Utilities/file.h" // "Wrapper/path.h" <fstream>
+#include "DataStructures/framearena.h" // FrameVector
+#include "heapcounter.h" // FLX_MEMORY_TAG
+#include "FlexECS/systemschedule.h" // SystemSchedule::Internal_IsDeclaredReadOnly
 
 #include <algorithm> // std::sort
 #include <typeindex> // std::type_index
 #include <memory> // std::shared_ptr
+#include <functional> // std::function
+#include <mutex> // std::mutex
 
 namespace FlexEngine
 {
@@ -137,10 +142,26 @@ namespace FlexEngine
     __FLX_API ComponentData<void> Internal_CreateComponentData(std::size_t size, void* data);
 
     // Get the size and data pointer from a ComponentData<void>
-    __FLX_API std::pair<std::size_t, void*> Internal_GetComponentData(ComponentData<void> data);
+    __FLX_API std::pair<std::size_t, void*> Internal_GetComponentData(const ComponentData<void>& data);
 
 
     using Column = std::vector<ComponentData<void>>;
+
+    // Deep copy of a column in a single allocation.
+    // The copies share ownership of that allocation, it is freed with the last of them.
+    __FLX_API Column Internal_CopyColumn(const Column& column);
+
+    // When a component was added to its entity and when it was last accessed for writing.
+    // The ticks come from Scene::change_tick, see Scene::ChangedQuery.
+    struct ComponentTicks
+    {
+      uint32_t added = 0;
+      uint32_t changed = 0;
+    };
+
+    // The ticks of every row of a column, kept in the same order as the column
+    using TickColumn = std::vector<ComponentTicks>;
+
     using Row = std::vector<Column>;
     using ArchetypeTable = Row;
 
@@ -151,6 +172,7 @@ namespace FlexEngine
       ArchetypeID id{};
       ComponentIDList type;
       ArchetypeTable archetype_table; // This is where the components are stored
+      std::vector<TickColumn> ticks;  // Change ticks for every component, parallel to archetype_table
       std::vector<EntityID> entities;
       std::unordered_map<ComponentID, ArchetypeEdge> edges;
     };
@@ -210,6 +232,57 @@ namespace FlexEngine
     // Used to lookup components in archetypes
     using ArchetypeMap = std::unordered_map<ArchetypeID, ArchetypeRecord>;
 
+
+
+
+
+    // Filters for Scene::ChangedQuery
+    // An entity passes if any of the listed components has been written to (Changed)
+    // or added (Added) since the query last ran. Components an entity doesn't have are ignored.
+    template <typename... Ts>
+    struct Changed {};
+
+    template <typename... Ts>
+    struct Added {};
+
+    // Unpacks a filter into the component ids it checks
+    template <typename Filter>
+    struct Internal_ChangeFilter;
+
+    template <typename... Ts>
+    struct Internal_ChangeFilter<Changed<Ts...>>
+    {
+      static constexpr bool added = false;
+      static const ComponentIDList& Components()
+      {
+        static const ComponentIDList components = { Reflection::TypeResolver<Ts>::Get()->name... };
+        return components;
+      }
+    };
+
+    template <typename... Ts>
+    struct Internal_ChangeFilter<Added<Ts...>>
+    {
+      static constexpr bool added = true;
+      static const ComponentIDList& Components()
+      {
+        static const ComponentIDList components = { Reflection::TypeResolver<Ts>::Get()->name... };
+        return components;
+      }
+    };
+
+
+
+
+
+    // What a system has already seen, see Scene::ChangedQuery.
+    // Keep one per system and query. It starts over when the active scene changes.
+    struct __FLX_API ChangeCursor
+    {
+      std::weak_ptr<Scene> scene;
+      uint32_t last_run = 0;
+    };
+
     #pragma endregion
 
 
@@ -247,6 +320,10 @@ namespace FlexEngine
       std::unordered_map<EntityID, EntityRecord> entity_index;
       std::unordered_map<ComponentID, ArchetypeMap> component_index;
 
+      // Stamped on components when they are added or accessed with Entity::GetComponent.
+      // Every ChangedQuery advances it, so anything written after a query is newer than what it returned.
+      uint32_t change_tick = 1;
+
 
       #pragma region String Storage
 
@@ -319,44 +396,94 @@ namespace FlexEngine
       template <typename... Ts>
       std::vector<Entity> Query();
 
+      // The result is allocated from the frame arena, iterate over it but do not keep it past the frame
       template <typename... Ts>
-      std::vector<Entity> CachedQuery();
+      FrameVector<Entity> CachedQuery();
+
+      // CachedQuery without the inactive entities, see Entity::IsActive.
+      // This is a filter, not a partition: every row is visited and its Transform is read straight
+      // from the column, the callers just never see the inactive ones. Toggling an entity never moves it,
+      // is_active is written directly in too many places to keep active rows apart.
+      template <typename... Ts>
+      FrameVector<Entity> ActiveQuery();
+
+      // CachedQuery that only returns the entities that passed the filter since the cursor last ran,
+      // and everything the first time or after a scene change.
+      // Usage: ChangedQuery<Changed<Position, Scale>, Position, Scale, Transform>(m_cursor);
+      // The system should read its filter components with Entity::ReadComponent, otherwise it
+      // marks them as changed and gets every entity back next time.
+      template <typename Filter, typename... Ts>
+      FrameVector<Entity> ChangedQuery(ChangeCursor& cursor);
 
       // Proxy class to return the combined list of entities as if it was one list
-      class ProxyContainer
+      class __FLX_API ProxyContainer
       {
       public:
-        ProxyContainer() : entity_ids() {}
+        ProxyContainer() : archetypes() {}
 
         // Constructor 
-        ProxyContainer(std::vector<std::vector<FlexEngine::FlexECS::Entity>*>& ptrs)
+        ProxyContainer(std::vector<Archetype*>& ptrs)
         {
           for (auto& ptr : ptrs)
           {
-            entity_ids.push_back(ptr);
+            AddPtr(ptr);
           }
         }
 
         // Returns a vector which is the combined list of these vectors
-        std::vector<FlexEngine::FlexECS::Entity> Get()
+        FrameVector<FlexEngine::FlexECS::Entity> Get()
         {
-          std::vector<FlexEngine::FlexECS::Entity> combined;
-          for (auto& container : entity_ids)
+          std::size_t count = 0;
+          for (auto& view : archetypes) count += view.archetype->entities.size();
+
+          FrameVector<FlexEngine::FlexECS::Entity> combined;
+          combined.reserve(count);
+          for (auto& view : archetypes)
           {
-            combined.insert(combined.end(), container->begin(), container->end());
+            auto& entities = *reinterpret_cast<std::vector<FlexEngine::FlexECS::Entity>*>(&view.archetype->entities);
+            combined.insert(combined.end(), entities.begin(), entities.end());
           }
           return combined;
         }
 
-        void AddPtr(std::vector<FlexEngine::FlexECS::Entity>* ptr)
+        // Same as Get, but only the entities that are active in the scene graph.
+        // Still visits every row of every archetype, it only saves the callers the component lookups.
+        FrameVector<FlexEngine::FlexECS::Entity> GetActive();
+
+        // Same as Get, but only the entities with a component in filter that was changed
+        // (or added, with added_only) after the since tick
+        FrameVector<FlexEngine::FlexECS::Entity> GetChanged(const ComponentIDList& filter, bool added_only, uint32_t since);
+
+        void AddPtr(Archetype* ptr)
         {
-          entity_ids.push_back(ptr);
+          archetypes.push_back({ ptr });
         }
 
       private:
-        std::vector<std::vector<FlexEngine::FlexECS::Entity>*> entity_ids; // Container of pointers to std::vector<EntityID>
+        static constexpr std::size_t UNRESOLVED = static_cast<std::size_t>(-1);
+        static constexpr std::size_t NO_COLUMN = static_cast<std::size_t>(-2);
+
+        struct ArchetypeView
+        {
+          Archetype* archetype;
+
+          // Columns used by GetActive, looked up the first time they are needed
+          std::size_t transform_column = UNRESOLVED;
+          std::size_t parent_column = UNRESOLVED;
+        };
+
+        std::vector<ArchetypeView> archetypes; // Archetypes that match the query
       };
 
+      // INTERNAL FUNCTION
+      // Finds or builds the cached list of archetypes for the query
+      template <typename... Ts>
+      ProxyContainer& Internal_GetCachedQuery();
+
+      // INTERNAL FUNCTION
+      // Guards query_cache and the columns resolved by GetActive, systems can query from several threads
+      static std::mutex& Internal_QueryMutex();
+
       std::map<ComponentIDList, ProxyContainer> query_cache; // Cache for the query results, in the form of a proxy object
 
       #pragma endregion
@@ -367,8 +494,17 @@ namespace FlexEngine
       static std::shared_ptr<Scene> CreateScene();
       static std::shared_ptr<Scene> GetActiveScene();
       static void SetActiveScene(const Scene& scene);
+
+      // INTERNAL FUNCTION
+      // Same as GetActiveScene without copying the shared_ptr, for the per-component hot paths.
+      // The pointer is only valid until the active scene changes, do not keep it.
+      static Scene* Internal_GetActiveScenePtr();
       static void SetActiveScene(std::shared_ptr<Scene> scene);
 
+      // Deep copy of the scene, the copy shares no component data or strings with this one.
+      // Much faster than loading the same scene again, see SceneTemplateCache.
+      std::shared_ptr<Scene> Clone() const;
+
       #pragma endregion
 
       #pragma region Entity management functions
@@ -397,29 +533,92 @@ namespace FlexEngine
 
       #pragma endregion
 
+      #pragma region Change notifications
+
+    public:
+      // Structural changes to the active scene.
+      // Listeners are called after the change has been applied, so the entity can be inspected.
+      // Changes to component values are not reported, only adding and removing them.
+      enum class ChangeType
+      {
+        EntityCreated,
+        EntityDestroyed,
+        ComponentAdded,
+        ComponentRemoved,
+        ActiveSceneChanged  // entity is 0, every cached view of the old scene is invalid
+      };
+
+      // component is empty for entity and scene changes
+      using ChangeCallback = std::function<void(ChangeType type, EntityID entity, const ComponentID& component)>;
+      using ChangeListenerID = std::size_t;
+
+      // Listeners are global rather than per scene so that they survive scene switches.
+      static ChangeListenerID AddChangeListener(ChangeCallback callback);
+      static void RemoveChangeListener(ChangeListenerID id);
+
+      // INTERNAL FUNCTION
+      // Called by the ECS whenever the structure of the active scene changes.
+      static void Internal_NotifyChange(ChangeType type, EntityID entity, const ComponentID& component = s_no_component);
+
+    private:
+      static std::vector<std::pair<ChangeListenerID, ChangeCallback>> s_change_listeners;
+      static ChangeListenerID s_next_change_listener_id;
+      static const ComponentID s_no_component;
+
+      #pragma endregion
+
       #pragma region Scene serialization functions
 
     public:
       // This is the interface for the reflection system to serialize and deserialize
       // the ECS data structures. Use this interface to save and load scenes.
 
+      // Saves in the same encoding as the existing file, new files are saved as json.
       void Save(File& file);
-      static std::shared_ptr<Scene> Load(File& file);
+
+      // Saves in the given encoding, replacing the existing file's encoding.
+      // Binary scenes load much faster but can only be read while the component layouts
+      // match, so keep a json copy around for anything that needs to survive refactors.
+      void Save(File& file, FlxFmtEncoding encoding);
+
+      // Called with the fraction of the load that is done, from 0 to 1.
+      using LoadProgressCallback = std::function<void(float)>;
+
+      // Loads either encoding, detected from the file contents.
+      // Does not touch the active scene, so it is safe to call from a worker thread
+      // as long as the file is not shared with the main thread. See SceneLoader.
+      static std::shared_ptr<Scene> Load(File& file, const LoadProgressCallback& on_progress = nullptr);
       static void SaveActiveScene(File& file);
 
+      // INTERNAL FUNCTION
+      // Records a default constructed instance of every reflected component, once.
+      // Loading starts each component from these bytes so the members that are not
+      // serialized keep their default member initializers.
+      // Call on the main thread before loading on a worker, the constructors use FLX_STRING_NEW.
+      static void Internal_PrepareComponentDefaults();
+
     private:
       // Interim structures
       // This structure pre-serializes all components and
       // in the future will handle pointers as well.
+      // Each component is stored as json text or binary bytes depending on the file encoding.
       std::unordered_map<ComponentIDList, _Archetype> _archetype_index;
 
       // INTERNAL FUNCTION
       // Convert to serialized archetype
-      void Internal_ConvertToSerializedArchetype();
+      void Internal_ConvertToSerializedArchetype(FlxFmtEncoding encoding = FlxFmtEncoding::Json);
 
       // INTERNAL FUNCTION
       // Convert from serialized archetype
-      void Internal_ConvertFromSerializedArchetype();
+      // Returns false if a binary component could not be read.
+      // Progress is reported from 0 to 1 as archetypes are converted.
+      bool Internal_ConvertFromSerializedArchetype(FlxFmtEncoding encoding = FlxFmtEncoding::Json, const LoadProgressCallback& on_progress = nullptr);
+
+      // INTERNAL FUNCTION
+      // Binary scenes start with a table of every component id and its schema hash,
+      // so that a layout change in any single component is caught before reading.
+      void Internal_WriteComponentSchemas(Reflection::BinaryWriter& out) const;
+      static bool Internal_CheckComponentSchemas(Reflection::BinaryReader& in);
 
       #pragma endregion
 
@@ -476,9 +675,17 @@ namespace FlexEngine
       bool HasComponent();
 
       // Returns a nullptr if the component is not found
+      // Marks the component as changed for ChangedQuery, use ReadComponent if it is only read.
+      // Only the call is recorded: writes through a pointer kept from an earlier GetComponent,
+      // after the ChangedQuery that would have seen them, are not detected.
+      // Call GetComponent again in the frame the write happens.
       template <typename T>
       T* GetComponent();
 
+      // Same as GetComponent, without marking the component as changed
+      template <typename T>
+      const T* ReadComponent();
+
       // Specialization to get a component safely
       // out is not modified if the component is not found
       // Returns true if the component is found
@@ -498,6 +705,22 @@ namespace FlexEngine
 
       #pragma endregion
 
+      #pragma region Active State
+
+      // The entity's own active state, which is Transform::is_active.
+      // Entities without a Transform are always active.
+      bool IsActiveSelf();
+
+      // Active in the scene graph: the entity and every Parent above it are active.
+      // This is what ActiveQuery filters on, it only reads components and does not mark them as changed.
+      bool IsActive();
+
+      // Same as setting Transform::is_active, children follow through IsActive.
+      // Does nothing for entities without a Transform.
+      void SetActive(bool active);
+
+      #pragma endregion
+
     private:
       // Allow the scene class to access internal functions
       friend class FlexECS::Scene;
@@ -509,6 +732,11 @@ namespace FlexEngine
       // INTERNAL FUNCTION
       // Used to move an entity from one archetype to another
       static void Internal_MoveEntity(EntityID entity, Archetype& from, size_t from_row, Archetype& to);
+
+      // INTERNAL FUNCTION
+      // Shared by GetComponent and ReadComponent
+      template <typename T>
+      T* Internal_GetComponent(bool mark_changed);
     };
 
     #pragma endregion
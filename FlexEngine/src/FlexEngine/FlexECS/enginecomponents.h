@@ -14,13 +14,23 @@
 #include "FlexECS/datastructures.h"
 #include "FlexMath/matrix4x4.h"
 #include "FlexMath/vector3.h"
+#include "FlexMath/vector4.h"
 #include "Reflection/base.h"
+#include "assethandle.h"
 #include "flx_api.h"
 
 namespace FlexEngine
 {
   using EntityName = FlexECS::Scene::StringIndex;
 
+  // Asset types referenced by cached handles below
+  namespace Asset
+  {
+    class Texture;
+    struct Spritesheet;
+  }
+  class VideoDecoder;
+
   /*!***************************************************************************
    * \class Position
    * \brief
@@ -124,6 +134,9 @@ namespace FlexEngine
     bool should_stop = false;
     bool is_looping = false;
     bool change_mode = false; // For tagging to flip
+
+    // VoicePool::Handle of the playing sound, not serialized
+    uint32_t voice = 0;
   };
 
   /*!***************************************************************************
@@ -148,6 +161,9 @@ namespace FlexEngine
     bool center_aligned = false;
     float opacity = 1.0f;
     Matrix4x4 model_matrix = Matrix4x4::Identity;
+
+    // Not serialized, resolved from sprite_handle on use
+    CachedAssetHandle<Asset::Texture> sprite_asset;
   };
 
   class __FLX_API Animator
@@ -166,6 +182,12 @@ namespace FlexEngine
     int current_frame = 0;
     float current_frame_time = 0.f;
     float time = 0.f;
+
+    // Not serialized, resolved from spritesheet_handle on use
+    CachedAssetHandle<Asset::Spritesheet> spritesheet_asset;
+
+    // Not serialized, UV rect of current_frame written by AnimatorSystem::Update
+    Vector4 current_uv = Vector4(0.f, 0.f, 1.f, 1.f);
   };
 
 
@@ -178,6 +200,9 @@ namespace FlexEngine
     bool is_looping = false;
     float time = 0.f;
     float playback_speed = 1.0f;
+
+    // Not serialized, resolved from video_file on use
+    CachedAssetHandle<VideoDecoder> video_asset;
   };
 
 
@@ -271,6 +296,11 @@ namespace FlexEngine
     Vector3 color = Vector3::One;
     std::pair<int, int> alignment = std::make_pair(1, 1); // Default value: centered (all bits set)
     Vector2 textboxDimensions = Vector2(850.0f, 300.0f);
+
+    // --- Non-reflected typewriter reveal, applied when the text is drawn ---
+    // Revealing a line only changes these, the string and its cached layout stay the same.
+    float visible_glyphs = -1.0f; // characters shown from the start, negative shows all of them
+    float glyph_fade = 0.0f;      // characters each glyph takes to fade in, 0 shows each one at once
   };
 
   /**************
@@ -321,6 +351,12 @@ namespace FlexEngine
     FlexECS::Scene::StringIndex script_name = FLX_STRING_NEW("");
     bool is_awake = false;
     bool is_start = false;
+
+    // Cached by ScriptRegistry::Resolve, not serialized.
+    // The slot is looked up again when the name changes or the scripting DLL is reloaded.
+    int script_slot = -1;
+    uint32_t script_slot_generation = 0;
+    FlexECS::Scene::StringIndex script_slot_name = 0;
   };
 
   /**************
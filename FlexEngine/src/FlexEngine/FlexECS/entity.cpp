@@ -13,6 +13,7 @@
 // Copyright (c) 2025 DigiPen, All rights reserved.
 
 #include "datastructures.h"
+#include "enginecomponents.h"
 
 namespace FlexEngine
 {
@@ -60,10 +61,10 @@ namespace FlexEngine
     bool Entity::operator<(const Entity& other) const
     {
       // compare their names (in std::string component)
-      // makes a copy because GetComponent is not const, gets the name component, and compares the strings
+      // makes a copy because ReadComponent is not const, gets the name component, and compares the strings
       Entity lhs = *this;
       Entity rhs = other;
-      return *(lhs.GetComponent<std::string>()) < *(rhs.GetComponent<std::string>());
+      return *(lhs.ReadComponent<std::string>()) < *(rhs.ReadComponent<std::string>());
     }
 
     Entity::operator EntityID() const
@@ -73,6 +74,48 @@ namespace FlexEngine
 
     #pragma endregion
 
+    #pragma region Active State
+
+    bool Entity::IsActiveSelf()
+    {
+      // guard: entities without a transform can't be disabled
+      if (!HasComponent<Transform>()) return true;
+
+      return ReadComponent<Transform>()->is_active;
+    }
+
+    bool Entity::IsActive()
+    {
+      // deep enough for any real hierarchy, also stops a parent cycle from hanging the query
+      constexpr int max_depth = 64;
+
+      Entity current = *this;
+      for (int depth = 0; depth < max_depth; depth++)
+      {
+        if (!current.IsActiveSelf()) return false;
+
+        // guard: roots are active if they are
+        if (!current.HasComponent<Parent>()) return true;
+
+        // guard: the parent was never set or has been destroyed
+        Entity parent = current.ReadComponent<Parent>()->parent;
+        if (parent == Entity::Null || ENTITY_INDEX.count(parent) == 0) return true;
+
+        current = parent;
+      }
+
+      return true;
+    }
+
+    void Entity::SetActive(bool active)
+    {
+      if (!HasComponent<Transform>()) return;
+
+      GetComponent<Transform>()->is_active = active;
+    }
+
+    #pragma endregion
+
     #pragma region Internal Functions
 
     // Assume the component is not in the archetype and
@@ -85,6 +128,7 @@ namespace FlexEngine
       archetype.id = ARCHETYPE_INDEX.size() - 1;
       archetype.type = type;
       archetype.archetype_table.reserve(type.size());
+      archetype.ticks.reserve(type.size());
       // edges are lazily instantiated
 
       // create a new archetype record for each component
@@ -93,6 +137,7 @@ namespace FlexEngine
         //Log::Flow("Create new column (" + std::to_string(i) + ")");
         COMPONENT_INDEX[archetype.type[i]][archetype.id] = { i };
         archetype.archetype_table.push_back(Column()); // create a column for each component
+        archetype.ticks.push_back(TickColumn());
       }
 
       // update caches with this archetype if needed
@@ -112,7 +157,7 @@ namespace FlexEngine
 
         if (!skip)
         {
-          a.second.AddPtr(reinterpret_cast<std::vector<FlexEngine::FlexECS::Entity>*>(&archetype.entities));
+          a.second.AddPtr(&archetype);
         }
       }
 
@@ -156,6 +201,7 @@ namespace FlexEngine
         // Copy the source component data to the destination archetype
         size_t destination_column_index = COMPONENT_INDEX[from.type[i]][to.id].column;
         to.archetype_table[destination_column_index].push_back(source_data);
+        to.ticks[destination_column_index].push_back(from.ticks[i][from_row]);
       }
 
       // Add the entity to the entities vector
@@ -178,6 +224,7 @@ namespace FlexEngine
         for (size_t i = 0; i < from.archetype_table.size(); i++)
         {
           from.archetype_table[i].pop_back();
+          from.ticks[i].pop_back();
         }
       }
       else
@@ -190,6 +237,8 @@ namespace FlexEngine
         {
           std::swap(from.archetype_table[i][from_row], from.archetype_table[i][last_row_index]);
           from.archetype_table[i].pop_back();
+          from.ticks[i][from_row] = from.ticks[i][last_row_index];
+          from.ticks[i].pop_back();
         }
 
         // Update entity_index for the swapped entity if necessary
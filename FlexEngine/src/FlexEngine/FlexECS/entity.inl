@@ -14,36 +14,59 @@ bool FlexEngine::FlexECS::Entity::HasComponent()
 {
   // cache the entity id
   EntityID entity = entity_id;
+  Scene& scene = *Scene::Internal_GetActiveScenePtr();
 
   // get the component id
-  ComponentID component = Reflection::TypeResolver<T>::Get()->name;
+  const ComponentID& component = Reflection::TypeResolver<T>::Get()->name;
 
   // guard: check if the component is in the index
   // provides an early exit because if it's not in the index, it's not in any archetype
-  // this also prevents component_index[component] from creating a new entry
-  if (COMPONENT_INDEX.count(component) == 0) return false;
+  // only find is used so that systems can look up components from several threads
+  auto component_it = scene.component_index.find(component);
+  if (component_it == scene.component_index.end()) return false;
 
   // figure out the archetype for the entity
-  EntityRecord& entity_record = ENTITY_INDEX[entity];
+  EntityRecord& entity_record = scene.entity_index.find(entity)->second;
   Archetype& archetype = *entity_record.archetype;
 
   // check if the component is in the archetype
-  ArchetypeMap& archetype_map = COMPONENT_INDEX[component];
+  ArchetypeMap& archetype_map = component_it->second;
   return (archetype_map.count(archetype.id) != 0);
 }
 
 
+template <typename T>
+T* FlexEngine::FlexECS::Entity::GetComponent()
+{
+  // a write the schedule does not know about races with the systems it runs alongside
+  FLX_ASSERT(
+    !SystemSchedule::Internal_IsDeclaredReadOnly(std::type_index(typeid(T))),
+    "GetComponent on a component the running system declared with Reads, use ReadComponent: " + Reflection::TypeResolver<T>::Get()->name
+  );
+  return Internal_GetComponent<T>(true);
+}
+
+template <typename T>
+const T* FlexEngine::FlexECS::Entity::ReadComponent()
+{
+  return Internal_GetComponent<T>(false);
+}
+
+
 // Get the archetype and row from the entity_index, then get the column from the component_index.
 // Use the column and row to get the component data from the archetype_table.
 // This performs two lookups in the entity_index and two lookups in the component_index.
+// The scene is fetched once as a raw pointer, this runs for every component access
+// and copying the active scene's shared_ptr each time costs an atomic increment and decrement.
 template <typename T>
-T* FlexEngine::FlexECS::Entity::GetComponent()
+T* FlexEngine::FlexECS::Entity::Internal_GetComponent(bool mark_changed)
 {
   // cache the entity id
   EntityID entity = entity_id;
+  Scene& scene = *Scene::Internal_GetActiveScenePtr();
 
   // get the component id
-  ComponentID component = Reflection::TypeResolver<T>::Get()->name;
+  const ComponentID& component = Reflection::TypeResolver<T>::Get()->name;
 
   // guard: HasComponent
   // This has some repeated lookups, so it can be further optimized by copying the HasComponent code here
@@ -52,20 +75,22 @@ T* FlexEngine::FlexECS::Entity::GetComponent()
 
   // guard: check if the component is in the index
   // provides an early exit because if it's not in the index, it's not in any archetype
-  // this also prevents component_index[component] from creating a new entry
-  if (COMPONENT_INDEX.count(component) == 0)
+  // only find is used so that systems can look up components from several threads
+  auto component_it = scene.component_index.find(component);
+  if (component_it == scene.component_index.end())
   {
     Log::Error("GetComponent did not find the component at the specified index. The component may not exist. " + component);
     return nullptr;
   }
 
   // figure out the archetype for the entity
-  EntityRecord& entity_record = ENTITY_INDEX[entity];
+  EntityRecord& entity_record = scene.entity_index.find(entity)->second;
   Archetype& archetype = *entity_record.archetype;
 
   // check if the component is in the archetype
-  ArchetypeMap& archetype_map = COMPONENT_INDEX[component];
-  if (archetype_map.count(archetype.id) == 0)
+  ArchetypeMap& archetype_map = component_it->second;
+  auto archetype_it = archetype_map.find(archetype.id);
+  if (archetype_it == archetype_map.end())
   {
     Log::Error("GetComponent did not find the component in the archetype. The component may not exist in the archetype. " + component);
     return nullptr;
@@ -74,8 +99,9 @@ T* FlexEngine::FlexECS::Entity::GetComponent()
   #pragma endregion
 
   // get the component data
-  ArchetypeRecord& archetype_record = archetype_map[archetype.id];
-  ComponentData<void> component_data = archetype.archetype_table[archetype_record.column][entity_record.row];
+  ArchetypeRecord& archetype_record = archetype_it->second;
+  if (mark_changed) archetype.ticks[archetype_record.column][entity_record.row].changed = scene.change_tick;
+  const ComponentData<void>& component_data = archetype.archetype_table[archetype_record.column][entity_record.row];
   void* data = Internal_GetComponentData(component_data).second;
   T* out_component = reinterpret_cast<T*>(data);
   return out_component;
@@ -103,16 +129,19 @@ bool FlexEngine::FlexECS::Entity::TryGetComponent(T* out)
 template <typename T>
 void FlexEngine::FlexECS::Entity::AddComponent(const T& data)
 {
+  FLX_MEMORY_TAG(ECS);
+
   // cache the entity id
   EntityID entity = entity_id;
 
   // get component id
-  ComponentID component = Reflection::TypeResolver<T>::Get()->name;
+  const ComponentID& component = Reflection::TypeResolver<T>::Get()->name;
 
   // type erasure
   T data_copy = data;
   void* data_copy_ptr = reinterpret_cast<void*>(&data_copy);
   ComponentData<void> data_ptr = Internal_CreateComponentData(sizeof(T), data_copy_ptr);
+  uint32_t tick = Scene::GetActiveScene()->change_tick;
 
   // figure out the current archetype for the entity
   EntityRecord& entity_record = ENTITY_INDEX[entity];
@@ -138,6 +167,7 @@ void FlexEngine::FlexECS::Entity::AddComponent(const T& data)
     // store the component data in the archetype
     ArchetypeRecord& archetype_record = COMPONENT_INDEX[component][next_archetype.id];
     next_archetype.archetype_table[archetype_record.column].push_back(data_ptr);
+    next_archetype.ticks[archetype_record.column].push_back({ tick, tick });
   }
   // find or create the archetype
   else
@@ -160,6 +190,7 @@ void FlexEngine::FlexECS::Entity::AddComponent(const T& data)
       // store the component data in the archetype
       ArchetypeRecord& archetype_record = COMPONENT_INDEX[component][next_archetype.id];
       next_archetype.archetype_table[archetype_record.column].push_back(data_ptr);
+      next_archetype.ticks[archetype_record.column].push_back({ tick, tick });
 
       // update archetype graph
       archetype.edges[component].add = &next_archetype;    // adding the component to the current archetype will lead to the next archetype
@@ -178,6 +209,7 @@ void FlexEngine::FlexECS::Entity::AddComponent(const T& data)
       // store the component data in the archetype
       ArchetypeRecord& archetype_record = COMPONENT_INDEX[component][new_archetype.id];
       new_archetype.archetype_table[archetype_record.column].push_back(data_ptr);
+      new_archetype.ticks[archetype_record.column].push_back({ tick, tick });
 
       // update archetype graph
       archetype.edges[component].add = &new_archetype;
@@ -185,17 +217,21 @@ void FlexEngine::FlexECS::Entity::AddComponent(const T& data)
     }
 
   }
+
+  Scene::Internal_NotifyChange(Scene::ChangeType::ComponentAdded, entity, component);
 }
 
 // Do the opposite of AddComponent
 template <typename T>
 void FlexEngine::FlexECS::Entity::RemoveComponent()
 {
+  FLX_MEMORY_TAG(ECS);
+
   // cache the entity id
   EntityID entity = entity_id;
 
   // get component id
-  ComponentID component = Reflection::TypeResolver<T>::Get()->name;
+  const ComponentID& component = Reflection::TypeResolver<T>::Get()->name;
 
   // figure out the current archetype for the entity
   EntityRecord& entity_record = ENTITY_INDEX[entity];
@@ -252,4 +288,6 @@ void FlexEngine::FlexECS::Entity::RemoveComponent()
     }
 
   }
+
+  Scene::Internal_NotifyChange(Scene::ChangeType::ComponentRemoved, entity, component);
 }
\ No newline at end of file
@@ -20,6 +20,9 @@ namespace FlexEngine
     // static member initialization
     std::shared_ptr<Scene> Scene::s_active_scene = nullptr;
     Scene Scene::Null = Scene();
+    std::vector<std::pair<Scene::ChangeListenerID, Scene::ChangeCallback>> Scene::s_change_listeners;
+    Scene::ChangeListenerID Scene::s_next_change_listener_id = 1;
+    const ComponentID Scene::s_no_component = "";
 
 
     #pragma region String Storage
@@ -42,6 +45,8 @@ namespace FlexEngine
 
     Scene::StringIndex Scene::Internal_StringStorage_New(const std::string& str)
     {
+      FLX_MEMORY_TAG(Strings);
+
       StringIndex index = 1;
 
       // check if there are any free indices
@@ -130,6 +135,13 @@ namespace FlexEngine
       return s_active_scene;
     }
 
+    Scene* Scene::Internal_GetActiveScenePtr()
+    {
+      // guard: GetActiveScene creates the scene and warns
+      if (s_active_scene == nullptr) return GetActiveScene().get();
+      return s_active_scene.get();
+    }
+
     void Scene::SetActiveScene(const Scene& scene)
     {
       SetActiveScene(std::make_shared<Scene>(scene));
@@ -151,6 +163,85 @@ namespace FlexEngine
       }
 
       s_active_scene = scene;
+
+      Internal_NotifyChange(ChangeType::ActiveSceneChanged, 0);
+    }
+
+    std::shared_ptr<Scene> Scene::Clone() const
+    {
+      FLX_MEMORY_TAG(ECS);
+
+      std::shared_ptr<Scene> clone = std::make_shared<Scene>();
+      clone->_flx_id_next = _flx_id_next;
+      clone->_flx_id_unused = _flx_id_unused;
+      clone->entity_index = entity_index;
+      clone->component_index = component_index;
+      clone->string_storage = string_storage;
+      clone->string_storage_free_list = string_storage_free_list;
+      clone->change_tick = change_tick;
+
+      // component data is owned through shared pointers, copying the archetype would share it
+      clone->archetype_index.reserve(archetype_index.size());
+      for (const auto& [type, archetype] : archetype_index)
+      {
+        Archetype& copy = clone->archetype_index[type];
+        copy.id = archetype.id;
+        copy.type = archetype.type;
+        copy.entities = archetype.entities;
+        copy.ticks = archetype.ticks;
+        copy.archetype_table.reserve(archetype.archetype_table.size());
+        for (const Column& column : archetype.archetype_table)
+        {
+          copy.archetype_table.push_back(Internal_CopyColumn(column));
+        }
+      }
+
+      // edges point into this scene's archetype index, point them at the clone's
+      for (const auto& [type, archetype] : archetype_index)
+      {
+        Archetype& copy = clone->archetype_index[type];
+        for (const auto& [component, edge] : archetype.edges)
+        {
+          ArchetypeEdge& copy_edge = copy.edges[component];
+          if (edge.add) copy_edge.add = &clone->archetype_index[edge.add->type];
+          if (edge.remove) copy_edge.remove = &clone->archetype_index[edge.remove->type];
+        }
+      }
+
+      // the query cache holds pointers into the archetypes, it is rebuilt on demand
+      clone->Internal_RelinkEntityArchetypePointers();
+      return clone;
+    }
+
+    #pragma endregion
+
+
+    #pragma region Change Notifications
+
+    Scene::ChangeListenerID Scene::AddChangeListener(ChangeCallback callback)
+    {
+      ChangeListenerID id = s_next_change_listener_id++;
+      s_change_listeners.push_back({ id, callback });
+      return id;
+    }
+
+    void Scene::RemoveChangeListener(ChangeListenerID id)
+    {
+      s_change_listeners.erase(
+        std::remove_if(
+          s_change_listeners.begin(), s_change_listeners.end(),
+          [id](const auto& listener) { return listener.first == id; }
+        ),
+        s_change_listeners.end()
+      );
+    }
+
+    void Scene::Internal_NotifyChange(ChangeType type, EntityID entity, const ComponentID& component)
+    {
+      // fast path: nobody is listening, which is the case in the game
+      if (s_change_listeners.empty()) return;
+
+      for (auto& [id, callback] : s_change_listeners) callback(type, entity, component);
     }
 
     #pragma endregion
@@ -162,12 +253,13 @@ namespace FlexEngine
     Entity Scene::CreateEntity(const std::string& name)
     {
       FLX_FLOW_FUNCTION();
+      FLX_MEMORY_TAG(ECS);
 
       using T = EntityName;
 
       // manually register a name component
       // this is to register the entity in the entity index and archetype
-      ComponentID component = Reflection::TypeResolver<T>::Get()->name;
+      const ComponentID& component = Reflection::TypeResolver<T>::Get()->name;
 
       // type erasure
       T data_copy = FLX_STRING_NEW(name);
@@ -201,6 +293,9 @@ namespace FlexEngine
       //ArchetypeRecord& archetype_record = archetype_map[archetype.id];
       //archetype.archetype_table[archetype_record.column].push_back(data_ptr);
       archetype.archetype_table[0].push_back(data_ptr); // there is only one component in this archetype
+      archetype.ticks[0].push_back({ Scene::GetActiveScene()->change_tick, Scene::GetActiveScene()->change_tick });
+
+      Internal_NotifyChange(ChangeType::EntityCreated, entity_id);
 
       return entity_id;
     }
@@ -232,6 +327,7 @@ namespace FlexEngine
         for (std::size_t i = 0; i < archetype.archetype_table.size(); i++)
         {
           archetype.archetype_table[i].pop_back();
+          archetype.ticks[i].pop_back();
         }
       }
       else
@@ -244,6 +340,8 @@ namespace FlexEngine
         {
           std::swap(archetype.archetype_table[i][row], archetype.archetype_table[i][last_row_index]);
           archetype.archetype_table[i].pop_back();
+          archetype.ticks[i][row] = archetype.ticks[i][last_row_index];
+          archetype.ticks[i].pop_back();
         }
 
         // Update entity_index for the swapped entity if necessary
@@ -265,6 +363,8 @@ namespace FlexEngine
 
       // Destroy the entity id
       ID::Destroy(entity, Scene::GetActiveScene()->_flx_id_unused);
+
+      Internal_NotifyChange(ChangeType::EntityDestroyed, entity);
     }
 
     Entity Scene::GetEntityByName(const std::string& name)
@@ -282,7 +382,7 @@ namespace FlexEngine
         Entity entity = entity_id;
         if (entity.HasComponent<EntityName>())
         {
-          std::string& entity_name = FLX_STRING_GET(*entity.GetComponent<EntityName>());
+          const std::string& entity_name = FLX_STRING_GET(*entity.ReadComponent<EntityName>());
           if (entity_name == name)
           {
             return entity;
@@ -310,6 +410,10 @@ namespace FlexEngine
       ENTITY_INDEX[updated_entity] = entity_record;
       ENTITY_INDEX.erase(entity);
 
+      // the id is the key everywhere else, so to listeners this is a different entity
+      Internal_NotifyChange(ChangeType::EntityDestroyed, entity);
+      Internal_NotifyChange(ChangeType::EntityCreated, updated_entity);
+
       entity = updated_entity;
     }
 
@@ -320,6 +424,8 @@ namespace FlexEngine
     */
     EntityID Scene::CloneEntity(EntityID entity_to_copy)
     {
+      FLX_MEMORY_TAG(ECS);
+
       // Get the archetype of the entity to copy
       EntityRecord& entity_record = ENTITY_INDEX[entity_to_copy];
       Archetype& archetype = *entity_record.archetype;
@@ -335,14 +441,19 @@ namespace FlexEngine
       ENTITY_INDEX[new_entity] = new_entity_record;
 
       // Now, after the setup is complete, we copy the entire row over
+      // The copy is a new entity, so all of its components count as added
+      uint32_t tick = Scene::GetActiveScene()->change_tick;
       for (std::size_t i{}; i < archetype.archetype_table.size(); i++)
       {
         // Perform deep copy, after all, the data inside is actually just a pointer, so we need to reserve memory to store the new one.
         std::pair<size_t, void*> old_data = Internal_GetComponentData(archetype.archetype_table[i][entity_record.row]);
         ComponentData<void> new_data_instance = Internal_CreateComponentData(old_data.first, old_data.second);
         archetype.archetype_table[i].push_back(new_data_instance);
+        archetype.ticks[i].push_back({ tick, tick });
       }
 
+      Internal_NotifyChange(ChangeType::EntityCreated, new_entity);
+
       return new_entity;
     }
 
@@ -396,60 +507,156 @@ namespace FlexEngine
     // how this is implemented is by simply looping through every single component and saving them in a vector
     // where reflection can then serialize them
     void Scene::Save(File& file)
+    {
+      // keep the encoding the file was saved with
+      Save(file, FlexFormatter::DetectEncoding(file.Read()));
+    }
+
+    void Scene::Save(File& file, FlxFmtEncoding encoding)
     {
       // convert the scene to a serialized archetype
       // This is done to prevent the reflection system from serializing the ComponentData<void> pointers.
-      Internal_ConvertToSerializedArchetype();
+      Internal_ConvertToSerializedArchetype(encoding);
 
       Reflection::TypeDescriptor* type_desc = Reflection::TypeResolver<FlexECS::Scene>::Get();
 
-      std::stringstream ss;
-      type_desc->Serialize(this, ss);
+      std::string data;
+      if (encoding == FlxFmtEncoding::Binary)
+      {
+        Reflection::BinaryWriter out;
+        Internal_WriteComponentSchemas(out);
+        type_desc->SerializeBinary(this, out);
+        data = std::move(out.GetBuffer());
+      }
+      else
+      {
+        std::stringstream ss;
+        type_desc->Serialize(this, ss);
+        data = ss.str();
+      }
 
       // check if we need to create a new flx file or overwrite the existing one
       FlxFmtFile flxfmtfile = FlexFormatter::Parse(file, FlxFmtFileType::Scene);
       if (flxfmtfile == FlxFmtFile::Null)
       {
         // make a new flx file
-        flxfmtfile = FlexFormatter::Create(ss.str(), true);
+        flxfmtfile = FlexFormatter::Create(data, true);
       }
 
       else
       {
         // update the data
-        flxfmtfile.data = ss.str();
+        flxfmtfile.data = std::move(data);
       }
 
+      flxfmtfile.metadata.encoding = encoding;
+      flxfmtfile.metadata.schema_hash = (encoding == FlxFmtEncoding::Binary) ? type_desc->GetSchemaHash() : 0;
+
       file.Write(flxfmtfile.Save());
     }
 
     // static function
-    std::shared_ptr<Scene> Scene::Load(File& file)
+    void Scene::Internal_PrepareComponentDefaults()
     {
+      static std::once_flag once;
+      std::call_once(once, []()
+      {
+        // construct against a throwaway scene so the strings made by
+        // the default member initializers don't end up in the real one
+        std::shared_ptr<Scene> previous_scene = s_active_scene;
+        s_active_scene = std::make_shared<Scene>();
+
+        for (auto& [name, type_desc] : TYPE_DESCRIPTOR_LOOKUP)
+        {
+          auto* struct_desc = dynamic_cast<Reflection::TypeDescriptor_Struct*>(type_desc);
+
+          // non-trivial types keep constructing in place, their bytes can't be shared
+          if (!struct_desc || !struct_desc->construct || !struct_desc->trivially_destructible) continue;
+
+          struct_desc->default_bytes.resize(struct_desc->size);
+          struct_desc->construct(struct_desc->default_bytes.data());
+        }
+
+        s_active_scene = previous_scene;
+      });
+    }
+
+    // static function
+    std::shared_ptr<Scene> Scene::Load(File& file, const LoadProgressCallback& on_progress)
+    {
+      FLX_MEMORY_TAG(ECS);
+
+      Internal_PrepareComponentDefaults();
+
       Reflection::TypeDescriptor* type_desc = Reflection::TypeResolver<FlexECS::Scene>::Get();
 
+      // rough split of the load time, the component data is the bulk of it
+      auto report = [&on_progress](float progress) { if (on_progress) on_progress(progress); };
+
       // get scene data
       FlxFmtFile flxfmtfile = FlexFormatter::Parse(file, FlxFmtFileType::Scene);
       if (flxfmtfile == FlxFmtFile::Null) return std::make_shared<Scene>(Scene::Null);
+      report(0.2f);
 
-      // deserialize
-      Document document;
-      document.Parse(flxfmtfile.data.c_str());
-      if (document.HasParseError())
+      std::shared_ptr<Scene> deserialized_scene = std::make_shared<Scene>();
+
+      if (flxfmtfile.metadata.encoding == FlxFmtEncoding::Binary)
       {
-        Log::Error("The scene file could not be parsed. RapidJson Parse Error: " + std::string(GetParseErrorString(document.GetParseError())));
-        return std::make_shared<Scene>(Scene::Null);
+        // guard: the scene layout changed since the file was written
+        if (flxfmtfile.metadata.schema_hash != type_desc->GetSchemaHash())
+        {
+          Log::Error("The binary scene file was saved with a different scene layout. Re-save it from a json copy: " + file.path.string());
+          return std::make_shared<Scene>(Scene::Null);
+        }
+
+        Reflection::BinaryReader in(flxfmtfile.data);
+        if (!Internal_CheckComponentSchemas(in))
+        {
+          Log::Error("The binary scene file was saved with different component layouts. Re-save it from a json copy: " + file.path.string());
+          return std::make_shared<Scene>(Scene::Null);
+        }
+
+        type_desc->DeserializeBinary(deserialized_scene.get(), in);
+        if (in.Failed())
+        {
+          Log::Error("The binary scene file is truncated or corrupted: " + file.path.string());
+          return std::make_shared<Scene>(Scene::Null);
+        }
+      }
+      else
+      {
+        // deserialize
+        Document document;
+        document.Parse(flxfmtfile.data.c_str());
+        if (document.HasParseError())
+        {
+          Log::Error("The scene file could not be parsed. RapidJson Parse Error: " + std::string(GetParseErrorString(document.GetParseError())));
+          return std::make_shared<Scene>(Scene::Null);
+        }
+
+        type_desc->Deserialize(deserialized_scene.get(), document);
       }
 
-      std::shared_ptr<Scene> deserialized_scene = std::make_shared<Scene>();
-      type_desc->Deserialize(deserialized_scene.get(), document);
+      report(0.3f);
 
       // convert the serialized archetype to the scene's archetype
-      deserialized_scene->Internal_ConvertFromSerializedArchetype();
+      bool converted = deserialized_scene->Internal_ConvertFromSerializedArchetype(
+        flxfmtfile.metadata.encoding,
+        [&report](float progress) { report(0.3f + 0.65f * progress); }
+      );
+      if (!converted)
+      {
+        Log::Error("The scene file has corrupted component data: " + file.path.string());
+        return std::make_shared<Scene>(Scene::Null);
+      }
 
       // relink entity archetype pointers
       deserialized_scene->Internal_RelinkEntityArchetypePointers();
 
+      // the serialized copy is rebuilt by Save, keeping it would double the memory of the scene
+      deserialized_scene->_archetype_index.clear();
+      report(1.0f);
+
       return deserialized_scene;
     }
 
@@ -458,7 +665,7 @@ namespace FlexEngine
       Scene::GetActiveScene()->Save(file);
     }
 
-    void Scene::Internal_ConvertToSerializedArchetype()
+    void Scene::Internal_ConvertToSerializedArchetype(FlxFmtEncoding encoding)
     {
       _archetype_index.clear();
 
@@ -480,21 +687,28 @@ namespace FlexEngine
           // Add a new row to the archetype_table
           _archetype.archetype_table.push_back(std::vector<std::string>());
 
+          // Get the type descriptor
+          Reflection::TypeDescriptor* type_desc = TYPE_DESCRIPTOR_LOOKUP[_archetype.type[i]];
+
           // For each entity in the archetype
           for (std::size_t j = 0; j < archetype.archetype_table[i].size(); j++)
           {
-            std::stringstream ss;
-
-            // Get the type descriptor
-            Reflection::TypeDescriptor* type_desc = TYPE_DESCRIPTOR_LOOKUP[_archetype.type[i]];
-
             // Get the component data
             void* data = Internal_GetComponentData(archetype.archetype_table[i][j]).second;
 
             // Serialize the component data
-            type_desc->Serialize(data, ss);
-
-            _archetype.archetype_table[i].push_back(ss.str());
+            if (encoding == FlxFmtEncoding::Binary)
+            {
+              Reflection::BinaryWriter out(type_desc->size);
+              type_desc->SerializeBinary(data, out);
+              _archetype.archetype_table[i].push_back(std::move(out.GetBuffer()));
+            }
+            else
+            {
+              std::stringstream ss;
+              type_desc->Serialize(data, ss);
+              _archetype.archetype_table[i].push_back(ss.str());
+            }
           }
         }
 
@@ -504,8 +718,19 @@ namespace FlexEngine
     
     }
 
-    void Scene::Internal_ConvertFromSerializedArchetype()
+    bool Scene::Internal_ConvertFromSerializedArchetype(FlxFmtEncoding encoding, const LoadProgressCallback& on_progress)
     {
+      // count the components up front so that progress follows the actual work
+      std::size_t total_components = 0;
+      std::size_t converted_components = 0;
+      if (on_progress)
+      {
+        for (auto& [_type, _archetype] : _archetype_index)
+        {
+          for (auto& row : _archetype.archetype_table) total_components += row.size();
+        }
+      }
+
       archetype_index.clear();
       for (auto& [_type, _archetype] : _archetype_index)
       {
@@ -520,18 +745,32 @@ namespace FlexEngine
         {
           archetype.archetype_table.push_back(std::vector<ComponentData<void>>());
 
+          // Get the type descriptor
+          Reflection::TypeDescriptor* type_desc = TYPE_DESCRIPTOR_LOOKUP[_archetype.type[i]];
+
           for (std::size_t j = 0; j < _archetype.archetype_table[i].size(); j++)
           {
-            // Convert the string into json
-            Document document;
-            document.Parse(_archetype.archetype_table[i][j].c_str());
-            
-            // Get the type descriptor
-            Reflection::TypeDescriptor* type_desc = TYPE_DESCRIPTOR_LOOKUP[_archetype.type[i]];
-
-            // Deserialize the component data
+            // Start from a default component, deserializing only fills the reflected members
             void* data = ::operator new(type_desc->size);
-            type_desc->Deserialize(data, document);
+            type_desc->ConstructDefault(data);
+
+            if (encoding == FlxFmtEncoding::Binary)
+            {
+              Reflection::BinaryReader in(_archetype.archetype_table[i][j]);
+              type_desc->DeserializeBinary(data, in);
+              if (in.Failed())
+              {
+                ::operator delete(data);
+                return false;
+              }
+            }
+            else
+            {
+              // Convert the string into json
+              Document document;
+              document.Parse(_archetype.archetype_table[i][j].c_str());
+              type_desc->Deserialize(data, document);
+            }
 
             // Create a new ComponentData<void>
             ComponentData<void> data_ptr = Internal_CreateComponentData(type_desc->size, data);
@@ -540,9 +779,176 @@ namespace FlexEngine
 
             archetype.archetype_table[i].push_back(data_ptr);
           }
+
+          // everything loaded counts as added now
+          archetype.ticks.push_back(TickColumn(archetype.archetype_table[i].size(), { change_tick, change_tick }));
+
+          converted_components += _archetype.archetype_table[i].size();
         }
         archetype_index[archetype.type] = archetype;
+
+        if (on_progress && total_components > 0) on_progress(static_cast<float>(converted_components) / total_components);
+      }
+      return true;
+    }
+
+    void Scene::Internal_WriteComponentSchemas(Reflection::BinaryWriter& out) const
+    {
+      std::set<ComponentID> components;
+      for (auto& [type, _archetype] : _archetype_index)
+      {
+        components.insert(type.begin(), type.end());
+      }
+
+      out.WriteVarUInt(components.size());
+      for (const ComponentID& component : components)
+      {
+        out.WriteString(component);
+        out.WriteU64(TYPE_DESCRIPTOR_LOOKUP[component]->GetSchemaHash());
+      }
+    }
+
+    bool Scene::Internal_CheckComponentSchemas(Reflection::BinaryReader& in)
+    {
+      std::size_t count = in.ReadCount();
+      for (std::size_t i = 0; i < count; i++)
+      {
+        ComponentID component = in.ReadString();
+        uint64_t schema_hash = in.ReadU64();
+        if (in.Failed()) return false;
+
+        auto it = TYPE_DESCRIPTOR_LOOKUP.find(component);
+        if (it == TYPE_DESCRIPTOR_LOOKUP.end())
+        {
+          Log::Error("Unknown component in binary scene: " + component);
+          return false;
+        }
+        if (it->second->GetSchemaHash() != schema_hash)
+        {
+          Log::Error("Component layout changed since the binary scene was saved: " + component);
+          return false;
+        }
       }
+      return !in.Failed();
+    }
+
+    #pragma endregion
+
+
+    #pragma region Query Functions
+
+    std::mutex& Scene::Internal_QueryMutex()
+    {
+      static std::mutex query_mutex;
+      return query_mutex;
+    }
+
+    FrameVector<Entity> Scene::ProxyContainer::GetActive()
+    {
+      static const ComponentID transform_id = Reflection::TypeResolver<Transform>::Get()->name;
+      static const ComponentID parent_id = Reflection::TypeResolver<Parent>::Get()->name;
+
+      // the column of a component in an archetype never changes, so it is only looked up once per archetype
+      auto resolve = [](const ComponentID& component, ArchetypeID archetype_id) -> std::size_t
+      {
+        auto component_it = COMPONENT_INDEX.find(component);
+        if (component_it == COMPONENT_INDEX.end()) return NO_COLUMN;
+
+        auto record_it = component_it->second.find(archetype_id);
+        if (record_it == component_it->second.end()) return NO_COLUMN;
+
+        return record_it->second.column;
+      };
+
+      // siblings share a parent, so each parent's chain is only walked once per query
+      thread_local std::unordered_map<EntityID, bool> parent_active;
+      parent_active.clear();
+      auto is_parent_active = [](Entity parent) -> bool
+      {
+        auto it = parent_active.find(parent);
+        if (it != parent_active.end()) return it->second;
+
+        // guard: the parent has been destroyed
+        bool result = ENTITY_INDEX.count(parent) == 0 || parent.IsActive();
+        parent_active.emplace(parent, result);
+        return result;
+      };
+
+      std::size_t count = 0;
+      for (auto& view : archetypes) count += view.archetype->entities.size();
+
+      FrameVector<Entity> active;
+      active.reserve(count);
+      for (auto& view : archetypes)
+      {
+        Archetype& archetype = *view.archetype;
+
+        if (view.transform_column == UNRESOLVED) view.transform_column = resolve(transform_id, archetype.id);
+        if (view.parent_column == UNRESOLVED) view.parent_column = resolve(parent_id, archetype.id);
+
+        for (std::size_t row = 0; row < archetype.entities.size(); row++)
+        {
+          // guard: the entity itself is inactive
+          if (view.transform_column != NO_COLUMN)
+          {
+            const Column& transforms = archetype.archetype_table[view.transform_column];
+            if (!reinterpret_cast<Transform*>(Internal_GetComponentData(transforms[row]).second)->is_active) continue;
+          }
+
+          // guard: one of its parents is inactive
+          if (view.parent_column != NO_COLUMN)
+          {
+            const Column& parents = archetype.archetype_table[view.parent_column];
+            Entity parent = reinterpret_cast<Parent*>(Internal_GetComponentData(parents[row]).second)->parent;
+            if (parent != Entity::Null && !is_parent_active(parent)) continue;
+          }
+
+          active.push_back(archetype.entities[row]);
+        }
+      }
+
+      return active;
+    }
+
+    FrameVector<Entity> Scene::ProxyContainer::GetChanged(const ComponentIDList& filter, bool added_only, uint32_t since)
+    {
+      FrameVector<std::size_t> columns;
+      columns.reserve(filter.size());
+
+      FrameVector<Entity> changed;
+      for (auto& view : archetypes)
+      {
+        Archetype& archetype = *view.archetype;
+
+        // the filter components this archetype has, the rest are ignored
+        columns.clear();
+        for (const ComponentID& component : filter)
+        {
+          auto component_it = COMPONENT_INDEX.find(component);
+          if (component_it == COMPONENT_INDEX.end()) continue;
+
+          auto record_it = component_it->second.find(archetype.id);
+          if (record_it != component_it->second.end()) columns.push_back(record_it->second.column);
+        }
+        if (columns.empty()) continue;
+
+        for (std::size_t row = 0; row < archetype.entities.size(); row++)
+        {
+          for (std::size_t column : columns)
+          {
+            const ComponentTicks& ticks = archetype.ticks[column][row];
+
+            // the difference keeps working when the tick wraps around
+            if (static_cast<int32_t>((added_only ? ticks.added : ticks.changed) - since) > 0)
+            {
+              changed.push_back(archetype.entities[row]);
+              break;
+            }
+          }
+        }
+      }
+
+      return changed;
     }
 
     #pragma endregion
@@ -554,20 +960,17 @@ namespace FlexEngine
     // for each entity in the entity index, set the archetype pointer to the archetype in the archetype index
     void Scene::Internal_RelinkEntityArchetypePointers()
     {
+      std::unordered_map<ArchetypeID, Archetype*> archetypes;
+      archetypes.reserve(archetype_index.size());
+      for (auto& [type, archetype] : archetype_index) archetypes[archetype.id] = &archetype;
+
       for (auto& [uuid, entity_record] : entity_index)
       {
-        auto it = std::find_if(
-          archetype_index.begin(), archetype_index.end(),
-          [&entity_record](auto& archetype_record)
-          {
-            return archetype_record.second.id == entity_record.archetype_id;
-          }
-        );
-
-        if (it != archetype_index.end())
+        auto it = archetypes.find(entity_record.archetype_id);
+        if (it != archetypes.end())
         {
           // relink
-          entity_record.archetype = &it->second;
+          entity_record.archetype = it->second;
         }
         else
         {
@@ -54,38 +54,35 @@ std::vector<FlexEngine::FlexECS::Entity> FlexEngine::FlexECS::Scene::Query()
 }
 
 /*
-  \brief Performs a query that returns a pre-cached list of entities that have the requested components.
-
-         If the query has not been performed before, it will perform the query and cache the result.
-
-  \note Now you might say, why cache the query result? Well, if the query result isn't going to change, why keep querying?
-        This only really happens if you add or remove components from the entities, resulting in a completely new archetype.
-        This archetype, well maybe then it might not have the requested components, so the query result would be different, but that's rare, and a one time thing.
-
-        So, if you are going to perform the same query multiple times, it is better to cache the result and return the cached result instead of
-        performing the query multiple times.
+  \brief Finds the archetypes that have the requested components, searching them only the first time the query is made.
 
-        We could always create a archetype map that fully covers every connection, but computing that would literally run 10^15 times just for like 20+ components
-        Clearly that isn't viable...
-        So following the principles of pick 2 of the 3 to save - speed, memory and maintainability we choose to take speed and maintainability
+         Archetypes created afterwards are added to every matching cached query by Entity::Internal_CreateArchetype.
 
   \param Ts... The packed component list of the components you want to query for
-  \return A copy of the list of entities that have the requested components
+  \return The cached list of matching archetypes
 */
 template <typename... Ts>
-std::vector<FlexEngine::FlexECS::Entity> FlexEngine::FlexECS::Scene::CachedQuery()
+FlexEngine::FlexECS::Scene::ProxyContainer& FlexEngine::FlexECS::Scene::Internal_GetCachedQuery()
 {
   // Check if the query exists
-  std::vector<std::string> component_id_list = { Reflection::TypeResolver<Ts>::Get()->name... };
-  std::sort(component_id_list.begin(), component_id_list.end());
+  // The component names never change, so the sorted key is built once per query type
+  static const std::vector<std::string> component_id_list = []()
+  {
+    std::vector<std::string> list = { Reflection::TypeResolver<Ts>::Get()->name... };
+    std::sort(list.begin(), list.end());
+    return list;
+  }();
+
+  std::lock_guard<std::mutex> lock(Internal_QueryMutex());
 
-  if (query_cache.find(component_id_list) != query_cache.end())
+  auto cached = query_cache.find(component_id_list);
+  if (cached != query_cache.end())
   {
-    return query_cache[component_id_list].Get();
+    return cached->second;
   }
 
   // If no such query exists, perform archetype searching like Query, but store the archetype pointer instead
-  std::vector<std::vector<FlexEngine::FlexECS::Entity>*> ptr_to_entities;
+  std::vector<Archetype*> matching_archetypes;
   for (auto& [archetype, archetype_storage] : ARCHETYPE_INDEX)
   {
     // find the type in the archetype
@@ -100,12 +97,85 @@ std::vector<FlexEngine::FlexECS::Entity> FlexEngine::FlexECS::Scene::CachedQuery
     // check if the archetype has the requested components
     if (has_requested_components)
     {
-      // 2. Capture pointer to archetype's entity vector
-      std::vector<FlexEngine::FlexECS::Entity>* ptr = reinterpret_cast<std::vector<FlexEngine::FlexECS::Entity>*>(&archetype_storage.entities);
-      ptr_to_entities.push_back(ptr);
+      // 2. Capture pointer to the archetype, its entity vector is read on every query
+      matching_archetypes.push_back(&archetype_storage);
     }
   }
-  query_cache.emplace(component_id_list, ptr_to_entities);
+  return query_cache.emplace(component_id_list, matching_archetypes).first->second;
+}
+
+/*
+  \brief Performs a query that returns a pre-cached list of entities that have the requested components.
 
-  return query_cache[component_id_list].Get();
-}
\ No newline at end of file
+         If the query has not been performed before, it will perform the query and cache the result.
+
+  \note Now you might say, why cache the query result? Well, if the query result isn't going to change, why keep querying?
+        This only really happens if you add or remove components from the entities, resulting in a completely new archetype.
+        This archetype, well maybe then it might not have the requested components, so the query result would be different, but that's rare, and a one time thing.
+
+        So, if you are going to perform the same query multiple times, it is better to cache the result and return the cached result instead of
+        performing the query multiple times.
+
+        We could always create a archetype map that fully covers every connection, but computing that would literally run 10^15 times just for like 20+ components
+        Clearly that isn't viable...
+        So following the principles of pick 2 of the 3 to save - speed, memory and maintainability we choose to take speed and maintainability
+
+  \param Ts... The packed component list of the components you want to query for
+  \return A copy of the list of entities that have the requested components, allocated from the frame arena
+*/
+template <typename... Ts>
+FlexEngine::FrameVector<FlexEngine::FlexECS::Entity> FlexEngine::FlexECS::Scene::CachedQuery()
+{
+  return Internal_GetCachedQuery<Ts...>().Get();
+}
+
+/*
+  \brief Performs a cached query like CachedQuery, but leaves out entities that are not active in the scene graph.
+
+         Use this instead of checking Transform::is_active in the loop. The check is done on the archetype's
+         Transform column while the list is built, which is much cheaper than a GetComponent per entity,
+         and also skips entities whose Parent (or any parent above that) is inactive.
+
+  \param Ts... The packed component list of the components you want to query for
+  \return A copy of the list of active entities that have the requested components, allocated from the frame arena
+*/
+template <typename... Ts>
+FlexEngine::FrameVector<FlexEngine::FlexECS::Entity> FlexEngine::FlexECS::Scene::ActiveQuery()
+{
+  ProxyContainer& container = Internal_GetCachedQuery<Ts...>();
+
+  std::lock_guard<std::mutex> lock(Internal_QueryMutex());
+  return container.GetActive();
+}
+
+/*
+  \brief Performs a cached query like CachedQuery, but only returns the entities that passed the filter since the cursor last ran.
+
+         Each call advances the scene's change tick and remembers it in the cursor, so a write that happens after the query
+         is always newer than what the cursor has seen, even within the same frame.
+         A cursor that has not run on the active scene yet gets every entity, which also covers scene switches.
+
+  \note Writes through GetComponent count as changes whether or not the value actually changed.
+        A system that writes to its own filter components will see those entities again the next time it runs.
+
+  \param Filter Changed<...> or Added<...> with the components to check
+  \param Ts... The packed component list of the components you want to query for
+  \param cursor What this system has already seen, updated by the query
+  \return A copy of the list of entities that passed the filter, allocated from the frame arena
+*/
+template <typename Filter, typename... Ts>
+FlexEngine::FrameVector<FlexEngine::FlexECS::Entity> FlexEngine::FlexECS::Scene::ChangedQuery(ChangeCursor& cursor)
+{
+  ProxyContainer& container = Internal_GetCachedQuery<Ts...>();
+
+  std::shared_ptr<Scene> active_scene = GetActiveScene();
+  bool seen_scene = (cursor.scene.lock() == active_scene);
+
+  FrameVector<Entity> entities = seen_scene
+    ? container.GetChanged(Internal_ChangeFilter<Filter>::Components(), Internal_ChangeFilter<Filter>::added, cursor.last_run)
+    : container.Get();
+
+  cursor.scene = active_scene;
+  cursor.last_run = change_tick++;
+  return entities;
+}
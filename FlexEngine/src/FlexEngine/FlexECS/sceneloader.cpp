@@ -0,0 +1,137 @@
+// WLVERSE [https://wlverse.web.app]
+// sceneloader.cpp
+//
+// Background scene loading.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#include "pch.h"
+
+#include "sceneloader.h"
+#include "scenetemplatecache.h"
+
+#include <chrono>
+
+namespace FlexEngine
+{
+  namespace FlexECS
+  {
+    // static member initialization
+    std::unordered_map<Path, std::unique_ptr<SceneLoader::Request>> SceneLoader::s_requests;
+
+    void SceneLoader::LoadAsync(const Path& path)
+    {
+      // guard: already requested, or entered before and cloned from the template in Take
+      if (s_requests.count(path) != 0 || SceneTemplateCache::Contains(path)) return;
+
+      // the component defaults have to be built here, the constructors are not thread safe
+      Scene::Internal_PrepareComponentDefaults();
+
+      auto request = std::make_unique<Request>();
+      Request* r = request.get();
+
+      r->worker = std::thread([r, path]()
+      {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        // The worker has its own File instead of going through File::Open,
+        // the file registry is not safe to use off the main thread.
+        File file;
+        file.path = path;
+        r->scene = Scene::Load(file, [r](float progress) { r->progress.store(progress); });
+
+        r->load_ms = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+        r->progress.store(1.0f);
+        r->done.store(true);
+      });
+
+      s_requests[path] = std::move(request);
+    }
+
+    bool SceneLoader::IsLoading(const Path& path)
+    {
+      auto it = s_requests.find(path);
+      return it != s_requests.end() && !it->second->done.load();
+    }
+
+    bool SceneLoader::IsReady(const Path& path)
+    {
+      auto it = s_requests.find(path);
+      if (it == s_requests.end()) return SceneTemplateCache::Contains(path);
+      return it->second->done.load();
+    }
+
+    float SceneLoader::GetProgress(const Path& path)
+    {
+      auto it = s_requests.find(path);
+      if (it == s_requests.end()) return SceneTemplateCache::Contains(path) ? 1.0f : 0.0f;
+      return it->second->progress.load();
+    }
+
+    std::shared_ptr<Scene> SceneLoader::Take(const Path& path)
+    {
+      auto start = std::chrono::high_resolution_clock::now();
+      auto elapsed_ms = [&start]()
+      {
+        return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+      };
+
+      auto it = s_requests.find(path);
+
+      // not preloaded, either entered before or the same cost as calling Scene::Load directly
+      if (it == s_requests.end())
+      {
+        bool was_cached = SceneTemplateCache::Contains(path);
+        std::shared_ptr<Scene> scene = SceneTemplateCache::Instantiate(path);
+        Log::Info(
+          "[SceneLoader] " + path.string() + (was_cached ? " copied from the template cache" : " loaded synchronously") +
+          ", blocked the main thread for " + std::to_string(elapsed_ms()) + "ms"
+        );
+        return scene;
+      }
+
+      std::unique_ptr<Request> request = std::move(it->second);
+      s_requests.erase(it);
+
+      bool was_done = request->done.load();
+      request->worker.join();
+
+      std::shared_ptr<Scene> scene = SceneTemplateCache::Store(path, request->scene);
+
+      Log::Info(
+        "[SceneLoader] " + path.string() + " loaded in the background in " + std::to_string(request->load_ms) + "ms, " +
+        (was_done ? "ready" : "still loading") + " when taken, blocked the main thread for " + std::to_string(elapsed_ms()) + "ms"
+      );
+
+      return scene;
+    }
+
+    bool SceneLoader::ActivateIfReady(const Path& path)
+    {
+      if (!IsReady(path)) return false;
+      Scene::SetActiveScene(Take(path));
+      return true;
+    }
+
+    void SceneLoader::Cancel(const Path& path)
+    {
+      auto it = s_requests.find(path);
+      if (it == s_requests.end()) return;
+
+      // there is no way to interrupt Scene::Load, so wait for it and throw the result away
+      it->second->worker.join();
+      s_requests.erase(it);
+    }
+
+    void SceneLoader::Shutdown()
+    {
+      for (auto& [path, request] : s_requests) request->worker.join();
+      s_requests.clear();
+    }
+
+  }
+}
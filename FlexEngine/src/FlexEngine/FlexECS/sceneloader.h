@@ -0,0 +1,107 @@
+// WLVERSE [https://wlverse.web.app]
+// sceneloader.h
+//
+// Background scene loading.
+//
+// Scene::Load reads, parses and deserializes the whole file on the calling
+// thread, which is a long stall for the larger scenes. The SceneLoader runs
+// Scene::Load on a worker thread into a staging scene that nothing else can
+// see, and hands the finished scene back on the main thread where it can be
+// swapped in with Scene::SetActiveScene.
+//
+// Usage:
+//   // when the next scene is known, e.g. at the start of a transition
+//   SceneLoader::LoadAsync(Path::current("assets/saves/town_v7.flxscene"));
+//
+//   // loading screen
+//   float progress = SceneLoader::GetProgress(path);
+//   if (SceneLoader::ActivateIfReady(path)) { ... }
+//
+//   // or where the scene is needed, waits for the worker or loads synchronously if
+//   // the scene was never requested
+//   FlexECS::Scene::SetActiveScene(SceneLoader::Take(path));
+//
+// Each Take logs how long the main thread was blocked, so the frame spike of a
+// scene transition can be compared between preloaded and synchronous loads.
+//
+// Every scene that is taken is kept in the SceneTemplateCache. Entering it
+// again copies the cached scene instead of loading the file, and LoadAsync
+// does nothing for it.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#pragma once
+
+#include "flx_api.h"
+
+#include "datastructures.h"
+#include "Utilities/path.h"
+
+#include <atomic>
+#include <memory> // std::shared_ptr
+#include <thread>
+#include <unordered_map>
+
+namespace FlexEngine
+{
+  namespace FlexECS
+  {
+
+    // All functions must be called from the main thread.
+    class __FLX_API SceneLoader
+    {
+    public:
+      // Starts loading the scene on a worker thread.
+      // Does nothing if the scene is already loading or loaded and not taken yet.
+      static void LoadAsync(const Path& path);
+
+      // Returns true while the worker is still running.
+      static bool IsLoading(const Path& path);
+
+      // Returns true once the scene can be taken without blocking.
+      static bool IsReady(const Path& path);
+
+      // Progress of the load from 0 to 1.
+      // Returns 0 if the scene was never requested.
+      static float GetProgress(const Path& path);
+
+      // Returns the loaded scene and keeps a copy as its template, so the next
+      // Take of the same path copies the template instead of reading the file.
+      // Blocks until the worker is done, or loads synchronously if LoadAsync was
+      // never called and the scene is not cached.
+      // Failed loads return a copy of Scene::Null like Scene::Load.
+      static std::shared_ptr<Scene> Take(const Path& path);
+
+      // Takes the scene and sets it as the active scene if it is done loading.
+      // Returns false without blocking otherwise.
+      static bool ActivateIfReady(const Path& path);
+
+      // Drops a preloaded scene that is no longer needed.
+      // Waits for the worker if it is still running.
+      static void Cancel(const Path& path);
+
+      // Waits for every worker and drops all preloaded scenes.
+      // Called when the application shuts down.
+      static void Shutdown();
+
+    private:
+      struct Request
+      {
+        std::thread worker;
+        std::atomic<float> progress{ 0.0f };
+        std::atomic<bool> done{ false };
+
+        // only read by the main thread after done is set
+        std::shared_ptr<Scene> scene;
+        double load_ms = 0.0;
+      };
+
+      static std::unordered_map<Path, std::unique_ptr<Request>> s_requests;
+    };
+
+  }
+}
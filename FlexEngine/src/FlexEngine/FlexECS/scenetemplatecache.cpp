@@ -0,0 +1,105 @@
+// WLVERSE [https://wlverse.web.app]
+// scenetemplatecache.cpp
+//
+// Keeps a loaded copy of every scene that has been entered.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#include "pch.h"
+
+#include "scenetemplatecache.h"
+
+#include <algorithm> // std::remove_if
+
+namespace FlexEngine
+{
+  namespace FlexECS
+  {
+    // static member initialization
+    std::unordered_map<Path, SceneTemplateCache::Template> SceneTemplateCache::s_templates;
+    std::vector<std::pair<std::weak_ptr<Scene>, Path>> SceneTemplateCache::s_instances;
+
+    namespace
+    {
+      // a missing file compares equal to another missing file, the template is kept
+      std::filesystem::file_time_type GetWriteTime(const Path& path)
+      {
+        std::error_code ec;
+        std::filesystem::file_time_type write_time = std::filesystem::last_write_time(path.get(), ec);
+        return ec ? std::filesystem::file_time_type{} : write_time;
+      }
+    }
+
+    bool SceneTemplateCache::Contains(const Path& path)
+    {
+      auto it = s_templates.find(path);
+      return it != s_templates.end() && it->second.write_time == GetWriteTime(path);
+    }
+
+    std::shared_ptr<Scene> SceneTemplateCache::Store(const Path& path, std::shared_ptr<Scene> scene)
+    {
+      // guard: Scene::Load returns an empty scene when it fails
+      if (scene == nullptr || scene->entity_index.empty()) return scene;
+
+      Template& scene_template = s_templates[path];
+      scene_template.scene = scene;
+      scene_template.write_time = GetWriteTime(path);
+
+      return Internal_Instantiate(path, scene_template);
+    }
+
+    std::shared_ptr<Scene> SceneTemplateCache::Instantiate(const Path& path)
+    {
+      if (!Contains(path)) return Store(path, Scene::Load(File::Open(path)));
+      return Internal_Instantiate(path, s_templates[path]);
+    }
+
+    bool SceneTemplateCache::ResetScene()
+    {
+      std::shared_ptr<Scene> active_scene = Scene::GetActiveScene();
+
+      auto it = std::find_if(
+        s_instances.begin(), s_instances.end(),
+        [&active_scene](const auto& instance) { return instance.first.lock() == active_scene; }
+      );
+      if (it == s_instances.end()) return false;
+
+      // copy the path, Instantiate prunes the list
+      Path path = it->second;
+      Scene::SetActiveScene(Instantiate(path));
+      return true;
+    }
+
+    void SceneTemplateCache::Evict(const Path& path)
+    {
+      s_templates.erase(path);
+    }
+
+    void SceneTemplateCache::Clear()
+    {
+      s_templates.clear();
+      s_instances.clear();
+    }
+
+    std::shared_ptr<Scene> SceneTemplateCache::Internal_Instantiate(const Path& path, const Template& scene_template)
+    {
+      std::shared_ptr<Scene> instance = scene_template.scene->Clone();
+
+      s_instances.erase(
+        std::remove_if(
+          s_instances.begin(), s_instances.end(),
+          [](const auto& instance) { return instance.first.expired(); }
+        ),
+        s_instances.end()
+      );
+      s_instances.push_back({ instance, path });
+
+      return instance;
+    }
+
+  }
+}
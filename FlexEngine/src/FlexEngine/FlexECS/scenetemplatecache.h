@@ -0,0 +1,94 @@
+// WLVERSE [https://wlverse.web.app]
+// scenetemplatecache.h
+//
+// Keeps a loaded copy of every scene that has been entered, so that entering
+// it again is a Scene::Clone instead of reading and parsing the file.
+//
+// The template itself is never made active. Instantiate returns a deep copy,
+// where each component column is copied into a single allocation and the
+// string storage is copied as is, so gameplay can change the instance freely.
+// A template is loaded again if the file was written after it was cached,
+// saving a scene in the editor is picked up the next time it is entered.
+//
+// SceneLoader::Take goes through the cache, so every scene transition that
+// uses the SceneLoader only reads its file once per run.
+//
+// Usage:
+//   // enter a scene, loads synchronously the first time
+//   FlexECS::Scene::SetActiveScene(SceneTemplateCache::Instantiate(path));
+//
+//   // restart the active scene, e.g. retrying a battle
+//   SceneTemplateCache::ResetScene();
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#pragma once
+
+#include "flx_api.h"
+
+#include "datastructures.h"
+#include "Utilities/path.h"
+
+#include <filesystem> // std::filesystem::file_time_type
+#include <memory>     // std::shared_ptr, std::weak_ptr
+#include <unordered_map>
+#include <utility>    // std::pair
+#include <vector>
+
+namespace FlexEngine
+{
+  namespace FlexECS
+  {
+
+    // All functions must be called from the main thread.
+    class __FLX_API SceneTemplateCache
+    {
+    public:
+      // static class
+      SceneTemplateCache() = delete;
+      SceneTemplateCache(const SceneTemplateCache&) = delete;
+      SceneTemplateCache& operator=(const SceneTemplateCache&) = delete;
+
+      // Returns true if a template for the path is cached and up to date with the file.
+      static bool Contains(const Path& path);
+
+      // Caches a scene that was just loaded from the path as its template.
+      // The cache takes the scene, use the returned copy instead.
+      // Failed or empty loads are not cached and are returned as is.
+      static std::shared_ptr<Scene> Store(const Path& path, std::shared_ptr<Scene> scene);
+
+      // Returns a copy of the template, loading it synchronously if it is not cached.
+      static std::shared_ptr<Scene> Instantiate(const Path& path);
+
+      // Sets the active scene to a fresh copy of the template it was instantiated from.
+      // Returns false if the active scene did not come from the cache.
+      static bool ResetScene();
+
+      // Drops the template, the next Instantiate reads the file again.
+      static void Evict(const Path& path);
+
+      // Drops every template.
+      // Called when the application shuts down.
+      static void Clear();
+
+    private:
+      struct Template
+      {
+        std::shared_ptr<const Scene> scene;
+        std::filesystem::file_time_type write_time;
+      };
+
+      static std::unordered_map<Path, Template> s_templates;
+
+      // the path of every live instance, so that ResetScene can find the template of the active scene
+      static std::vector<std::pair<std::weak_ptr<Scene>, Path>> s_instances;
+
+      static std::shared_ptr<Scene> Internal_Instantiate(const Path& path, const Template& scene_template);
+    };
+
+  }
+}
@@ -0,0 +1,458 @@
+// WLVERSE [https://wlverse.web.app]
+// systemschedule.cpp
+//
+// Runs the systems of a layer on the worker pool.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#include "pch.h"
+
+#include "systemschedule.h"
+
+#include "flexprofiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace FlexEngine
+{
+
+  namespace
+  {
+    using Clock = std::chrono::high_resolution_clock;
+
+    // Leave a core for the rest of the machine, the schedules are small
+    constexpr std::size_t MAX_WORKERS = 7;
+
+    bool serial = false;
+
+    // 0 on the main thread, the index of the worker + 1 on the workers
+    thread_local std::size_t t_thread = 0;
+
+    // Set while a schedule runs, a system that runs another schedule runs it serially
+    bool running = false;
+
+    // The read-only types of the system running on this thread, for Internal_IsDeclaredReadOnly
+    thread_local const std::vector<std::type_index>* t_read_only = nullptr;
+
+    std::size_t GetWorkerCount()
+    {
+      std::size_t hardware = std::thread::hardware_concurrency();
+      return std::min<std::size_t>(hardware > 1 ? hardware - 1 : 1, MAX_WORKERS);
+    }
+
+    // The state of one parallel Run, lives on the stack of the main thread.
+    // Everything in it is guarded by the pool mutex.
+    struct RunState
+    {
+      std::vector<std::size_t> waiting_for; // unfinished dependencies of every system
+      std::deque<std::size_t> ready;        // any thread
+      std::deque<std::size_t> main_ready;   // main thread only
+      std::size_t finished = 0;
+      std::vector<Profiler::ScheduleSpan> spans;
+      std::exception_ptr error;
+    };
+
+    class WorkerPool
+    {
+    public:
+      ~WorkerPool() { Stop(); }
+
+      void Start()
+      {
+        if (!m_workers.empty()) return;
+
+        std::size_t count = GetWorkerCount();
+
+        m_stop = false;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          m_workers.emplace_back([this, i]() { WorkerLoop(i + 1); });
+        }
+      }
+
+      void Stop()
+      {
+        {
+          std::lock_guard<std::mutex> lock(m_mutex);
+          m_stop = true;
+        }
+        m_work.notify_all();
+        for (std::thread& worker : m_workers) worker.join();
+        m_workers.clear();
+      }
+
+      // Runs the systems, the main thread works on them too
+      template <typename RunSystem, typename Finish>
+      void Run(RunState& state, std::size_t count, RunSystem run_system, Finish finish)
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_state = &state;
+        m_run_system = run_system;
+        m_finish = finish;
+        m_work.notify_all();
+
+        while (state.finished < count)
+        {
+          std::size_t index;
+          if (!state.main_ready.empty())
+          {
+            index = state.main_ready.front();
+            state.main_ready.pop_front();
+          }
+          else if (!state.ready.empty())
+          {
+            index = state.ready.front();
+            state.ready.pop_front();
+          }
+          else
+          {
+            m_main.wait(lock);
+            continue;
+          }
+
+          Execute(lock, index);
+        }
+
+        m_state = nullptr;
+      }
+
+    private:
+      void WorkerLoop(std::size_t thread)
+      {
+        t_thread = thread;
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true)
+        {
+          m_work.wait(lock, [this]() { return m_stop || (m_state && !m_state->ready.empty()); });
+          if (m_stop) break;
+
+          std::size_t index = m_state->ready.front();
+          m_state->ready.pop_front();
+          Execute(lock, index);
+        }
+      }
+
+      // Runs the system without the lock, then queues the systems that were waiting for it
+      void Execute(std::unique_lock<std::mutex>& lock, std::size_t index)
+      {
+        RunState& state = *m_state;
+
+        lock.unlock();
+        std::exception_ptr error;
+        try
+        {
+          m_run_system(index);
+        }
+        catch (...)
+        {
+          error = std::current_exception();
+        }
+        lock.lock();
+
+        if (error && !state.error) state.error = error;
+
+        std::size_t queued = state.ready.size();
+        m_finish(index);
+        ++state.finished;
+
+        // the main thread waits for main thread systems and for the last system to finish
+        if (state.ready.size() > queued) m_work.notify_all();
+        m_main.notify_one();
+      }
+
+      std::vector<std::thread> m_workers;
+      std::mutex m_mutex;
+      std::condition_variable m_work; // workers wait here
+      std::condition_variable m_main; // the main thread waits here
+      bool m_stop = false;
+
+      RunState* m_state = nullptr;
+      std::function<void(std::size_t)> m_run_system;
+      std::function<void(std::size_t)> m_finish;
+    };
+
+    WorkerPool& GetPool()
+    {
+      static WorkerPool pool;
+      return pool;
+    }
+  }
+
+  #pragma region SystemBuilder
+
+  SystemSchedule::SystemBuilder& SystemSchedule::SystemBuilder::MainThread()
+  {
+    m_schedule.m_systems[m_index].main_thread = true;
+    return *this;
+  }
+
+  SystemSchedule::SystemBuilder& SystemSchedule::SystemBuilder::Exclusive()
+  {
+    m_schedule.m_systems[m_index].exclusive = true;
+    m_schedule.m_built = false;
+    return *this;
+  }
+
+  void SystemSchedule::SystemBuilder::Internal_AddAccess(std::type_index type, bool write)
+  {
+    System& system = m_schedule.m_systems[m_index];
+    (write ? system.writes : system.reads).push_back(type);
+    m_schedule.m_built = false;
+  }
+
+  #pragma endregion
+
+  SystemSchedule::SystemSchedule(const std::string& name)
+    : m_name(name)
+  {
+  }
+
+  SystemSchedule::SystemBuilder SystemSchedule::Add(const std::string& name, SystemFunction function)
+  {
+    System& system = m_systems.emplace_back();
+    system.name = name;
+    system.function = std::move(function);
+    m_built = false;
+    return SystemBuilder(*this, m_systems.size() - 1);
+  }
+
+  const std::vector<std::size_t>& SystemSchedule::GetDependencies(std::size_t index)
+  {
+    Internal_Build();
+    return m_systems[index].dependencies;
+  }
+
+  #pragma region Graph
+
+  bool SystemSchedule::Internal_Conflicts(const System& a, const System& b)
+  {
+    if (a.exclusive || b.exclusive) return true;
+
+    auto contains = [](const std::vector<std::type_index>& list, std::type_index type)
+    {
+      return std::find(list.begin(), list.end(), type) != list.end();
+    };
+
+    for (std::type_index type : a.writes)
+    {
+      if (contains(b.writes, type) || contains(b.reads, type)) return true;
+    }
+    for (std::type_index type : a.reads)
+    {
+      if (contains(b.writes, type)) return true;
+    }
+    return false;
+  }
+
+  void SystemSchedule::Internal_Call(System& system)
+  {
+    // a system can run another schedule, so the outer system is restored afterwards
+    const std::vector<std::type_index>* outer_read_only = t_read_only;
+    t_read_only = &system.read_only;
+    try
+    {
+      system.function();
+    }
+    catch (...)
+    {
+      t_read_only = outer_read_only;
+      throw;
+    }
+    t_read_only = outer_read_only;
+  }
+
+  // Every system depends on the conflicting systems added before it,
+  // which keeps the order of every pair that could see each other's writes.
+  void SystemSchedule::Internal_Build()
+  {
+    if (m_built) return;
+
+    for (System& system : m_systems)
+    {
+      system.dependencies.clear();
+      system.dependents.clear();
+
+      // usually empty or a couple of types, GetComponent searches it on every call
+      system.read_only.clear();
+      for (std::type_index type : system.reads)
+      {
+        if (std::find(system.writes.begin(), system.writes.end(), type) == system.writes.end())
+          system.read_only.push_back(type);
+      }
+    }
+
+    for (std::size_t j = 0; j < m_systems.size(); ++j)
+    {
+      for (std::size_t i = 0; i < j; ++i)
+      {
+        if (!Internal_Conflicts(m_systems[i], m_systems[j])) continue;
+        m_systems[j].dependencies.push_back(i);
+        m_systems[i].dependents.push_back(j);
+      }
+    }
+
+    m_built = true;
+  }
+
+  #pragma endregion
+
+  #pragma region Run
+
+  void SystemSchedule::Run()
+  {
+    if (m_systems.empty()) return;
+    Internal_Build();
+
+    // guard: nested schedules, workers and the serial fallback all run in order on this thread
+    if (serial || running || t_thread != 0 || m_systems.size() == 1)
+    {
+      Internal_RunSerial();
+      return;
+    }
+
+    running = true;
+    try
+    {
+      Internal_RunParallel();
+    }
+    catch (...)
+    {
+      running = false;
+      throw;
+    }
+    running = false;
+  }
+
+  void SystemSchedule::Internal_RunSerial()
+  {
+    std::vector<Profiler::ScheduleSpan> spans;
+    spans.reserve(m_systems.size());
+
+    // same as the parallel run, the other systems still run after one throws
+    std::exception_ptr error;
+
+    auto start = Clock::now();
+    for (System& system : m_systems)
+    {
+      auto system_start = Clock::now();
+      try
+      {
+        Internal_Call(system);
+      }
+      catch (...)
+      {
+        if (!error) error = std::current_exception();
+      }
+      auto system_end = Clock::now();
+
+      spans.push_back({
+        system.name, 0,
+        std::chrono::duration_cast<std::chrono::microseconds>(system_start - start).count(),
+        std::chrono::duration_cast<std::chrono::microseconds>(system_end - start).count()
+      });
+    }
+
+    // the profiler belongs to the main thread
+    if (t_thread == 0) Profiler::SubmitSchedule(m_name, std::move(spans));
+
+    if (error) std::rethrow_exception(error);
+  }
+
+  void SystemSchedule::Internal_RunParallel()
+  {
+    WorkerPool& pool = GetPool();
+    pool.Start();
+
+    RunState state;
+    state.waiting_for.resize(m_systems.size());
+    state.spans.resize(m_systems.size());
+
+    auto queue = [this, &state](std::size_t index)
+    {
+      (m_systems[index].main_thread ? state.main_ready : state.ready).push_back(index);
+    };
+
+    for (std::size_t i = 0; i < m_systems.size(); ++i)
+    {
+      state.waiting_for[i] = m_systems[i].dependencies.size();
+      if (state.waiting_for[i] == 0) queue(i);
+    }
+
+    auto start = Clock::now();
+
+    // runs without the pool lock, every system writes only its own span
+    auto run_system = [this, &state, start](std::size_t index)
+    {
+      auto system_start = Clock::now();
+      Internal_Call(m_systems[index]);
+      auto system_end = Clock::now();
+
+      state.spans[index] = {
+        m_systems[index].name, t_thread,
+        std::chrono::duration_cast<std::chrono::microseconds>(system_start - start).count(),
+        std::chrono::duration_cast<std::chrono::microseconds>(system_end - start).count()
+      };
+    };
+
+    // runs with the pool lock
+    auto finish = [this, &state, &queue](std::size_t index)
+    {
+      for (std::size_t dependent : m_systems[index].dependents)
+      {
+        if (--state.waiting_for[dependent] == 0) queue(dependent);
+      }
+    };
+
+    pool.Run(state, m_systems.size(), run_system, finish);
+
+    Profiler::SubmitSchedule(m_name, std::move(state.spans));
+
+    if (state.error) std::rethrow_exception(state.error);
+  }
+
+  #pragma endregion
+
+  #pragma region Settings
+
+  void SystemSchedule::SetSerial(bool value)
+  {
+    serial = value;
+  }
+
+  bool SystemSchedule::IsSerial()
+  {
+    return serial;
+  }
+
+  std::size_t SystemSchedule::GetThreadCount()
+  {
+    return serial ? 1 : GetWorkerCount() + 1;
+  }
+
+  void SystemSchedule::Shutdown()
+  {
+    GetPool().Stop();
+  }
+
+  bool SystemSchedule::Internal_IsDeclaredReadOnly(std::type_index type)
+  {
+    // guard: not called from a system, or the system declared nothing read-only
+    if (!t_read_only || t_read_only->empty()) return false;
+
+    return std::find(t_read_only->begin(), t_read_only->end(), type) != t_read_only->end();
+  }
+
+  #pragma endregion
+
+}
@@ -0,0 +1,154 @@
+// WLVERSE [https://wlverse.web.app]
+// systemschedule.h
+//
+// Runs the systems of a layer on the worker pool.
+//
+// Every system is added with the data it reads and writes. Two systems
+// conflict if one of them writes something the other reads or writes, and a
+// system always runs after the conflicting systems that were added before it.
+// Systems that do not conflict run at the same time on the worker pool, so the
+// results are the same as running every system in the order they were added.
+//
+// The data is named by type. Components are the usual case, but anything
+// shared can be declared the same way, e.g. Writes<SpatialIndex>() or
+// Writes<Asset::Spritesheet>() for a system that resolves spritesheet handles.
+//
+// A system must not write what it declared with Reads. For components that
+// means reading them with Entity::ReadComponent, GetComponent marks them as
+// changed. Debug builds assert on GetComponent of a component the running
+// system declared read-only.
+//
+// Systems that use the renderer, audio or anything else that belongs to the
+// main thread are marked MainThread. Systems that use ChangedQuery, create or
+// destroy entities or add and remove components change the scene itself and
+// are marked Exclusive, they run on their own.
+//
+// The schedule of the last Run is sent to the profiler window.
+// SetSerial(true) runs every system on the main thread in order, for debugging.
+//
+// Usage:
+//   SystemSchedule schedule("Physics");
+//   schedule.Add("Move", &Move).Reads<Rigidbody>().Writes<Position>();
+//   schedule.Add("Reset Collisions", &ResetCollisions).Writes<BoundingBox2D>();
+//   schedule.Add("Bounds", &UpdateBounds).Reads<Position, Scale>().Writes<BoundingBox2D>();
+//   schedule.Run(); // Move and Reset Collisions run at the same time, then Bounds
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#pragma once
+
+#include "flx_api.h"
+
+#include <cstddef> // std::size_t
+#include <functional>
+#include <string>
+#include <typeindex>
+#include <vector>
+
+namespace FlexEngine
+{
+
+  // All functions must be called from the main thread.
+  class __FLX_API SystemSchedule
+  {
+  public:
+    using SystemFunction = std::function<void()>;
+
+    // Declares what a system reads and writes, returned by Add.
+    class __FLX_API SystemBuilder
+    {
+    public:
+      template <typename... Ts>
+      SystemBuilder& Reads()
+      {
+        (Internal_AddAccess(std::type_index(typeid(Ts)), false), ...);
+        return *this;
+      }
+
+      template <typename... Ts>
+      SystemBuilder& Writes()
+      {
+        (Internal_AddAccess(std::type_index(typeid(Ts)), true), ...);
+        return *this;
+      }
+
+      // The system only runs on the main thread.
+      SystemBuilder& MainThread();
+
+      // The system conflicts with every other system.
+      SystemBuilder& Exclusive();
+
+    private:
+      friend class SystemSchedule;
+
+      SystemBuilder(SystemSchedule& schedule, std::size_t index) : m_schedule(schedule), m_index(index) {}
+
+      void Internal_AddAccess(std::type_index type, bool write);
+
+      SystemSchedule& m_schedule;
+      std::size_t m_index;
+    };
+
+    explicit SystemSchedule(const std::string& name);
+
+    // Adds a system that runs after the conflicting systems added before it.
+    SystemBuilder Add(const std::string& name, SystemFunction function);
+
+    // Runs every system once and returns when all of them are done.
+    // An exception thrown by a system is rethrown here after the other systems finished.
+    void Run();
+
+    // The systems that must finish before the system at the index can start.
+    // Only direct conflicts are listed, for tests and tools.
+    const std::vector<std::size_t>& GetDependencies(std::size_t index);
+
+    std::size_t GetSystemCount() const { return m_systems.size(); }
+    const std::string& GetName() const { return m_name; }
+
+    // Runs the systems of every schedule on the main thread in the order they were added.
+    static void SetSerial(bool serial);
+    static bool IsSerial();
+
+    // Number of threads that run systems, including the main thread.
+    static std::size_t GetThreadCount();
+
+    // Stops the worker pool. Called when the application shuts down.
+    static void Shutdown();
+
+    // INTERNAL FUNCTION
+    // True if the system running on this thread declared the type with Reads and not with Writes.
+    // Used by Entity::GetComponent, which fails on such a type in every build.
+    static bool Internal_IsDeclaredReadOnly(std::type_index type);
+
+  private:
+    struct System
+    {
+      std::string name;
+      SystemFunction function;
+      std::vector<std::type_index> reads;
+      std::vector<std::type_index> writes;
+      bool main_thread = false;
+      bool exclusive = false;
+
+      // built by Internal_Build
+      std::vector<std::size_t> dependencies;
+      std::vector<std::size_t> dependents;
+      std::vector<std::type_index> read_only; // reads that are not also writes
+    };
+
+    static bool Internal_Conflicts(const System& a, const System& b);
+    static void Internal_Call(System& system);
+    void Internal_Build();
+    void Internal_RunSerial();
+    void Internal_RunParallel();
+
+    std::string m_name;
+    std::vector<System> m_systems;
+    bool m_built = false;
+  };
+
+}
@@ -16,6 +16,7 @@
 #include "FlexECS/datastructures.h"
 
 #include <string>
+#include <vector>
 
 #pragma region Macros
 
@@ -59,6 +60,18 @@ namespace FlexEngine
     virtual void Awake() {};
     virtual void Start() {};
     virtual void Update() {};
+
+    // Called once per frame with every active entity that uses this script.
+    // Override to process all entities in one pass, the default calls Update for each entity.
+    // Remember to set the context if the overridden function calls anything that uses self.
+    virtual void UpdateBatch(const std::vector<FlexECS::Entity>& entities)
+    {
+      for (const FlexECS::Entity& entity : entities)
+      {
+        Internal_SetContext(entity);
+        Update();
+      }
+    }
     //virtual void FixedUpdate() {};
     virtual void Stop() {};
 
@@ -10,6 +10,9 @@
 // Copyright (c) 2025 DigiPen, All rights reserved.
 
 #include "FlexScripting/scriptregistry.h"
+#include "FlexECS/enginecomponents.h"
+#include "flexprofiler.h"
+#include "heapcounter.h" // FLX_MEMORY_TAG
 
 namespace FlexEngine
 {
@@ -19,14 +22,41 @@ namespace FlexEngine
   std::vector<std::pair<std::string, std::string>> ScriptRegistry::scripts_run_names{};
   #endif
 
+  namespace
+  {
+    struct ScriptSlot
+    {
+      IScript* script = nullptr;
+      std::string profiler_name; // built once so that timing does not allocate every frame
+      std::vector<FlexECS::Entity> batch; // reused every frame
+    };
+
+    std::vector<ScriptSlot> slots;
+    std::unordered_map<std::string, int> slot_lookup;
+
+    // starts at 1 so that a default constructed component never matches
+    uint32_t generation = 1;
+  }
+
   void ScriptRegistry::RegisterScript(IScript* script)
   {
-    GetScripts().insert({ script->GetName(), script});
+    std::string name = script->GetName();
+    GetScripts().insert({ name, script });
+
+    // guard: registering the same name again keeps the first script, like the map
+    if (slot_lookup.count(name) != 0) return;
+
+    slot_lookup[name] = static_cast<int>(slots.size());
+    slots.push_back({ script, "Script: " + name, {} });
+    generation++;
   }
 
   void ScriptRegistry::ClearScripts()
   {
     GetScripts().clear();
+    slots.clear();
+    slot_lookup.clear();
+    generation++;
   }
 
   ScriptMap& ScriptRegistry::GetScripts()
@@ -49,4 +79,155 @@ namespace FlexEngine
     return scripts[name];
   }
 
-}
\ No newline at end of file
+  #pragma region Slots
+
+  int ScriptRegistry::GetScriptSlot(const std::string& name)
+  {
+    auto it = slot_lookup.find(name);
+    return (it != slot_lookup.end()) ? it->second : -1;
+  }
+
+  IScript* ScriptRegistry::GetScriptBySlot(int slot)
+  {
+    if (slot < 0 || slot >= static_cast<int>(slots.size())) return nullptr;
+    return slots[slot].script;
+  }
+
+  std::size_t ScriptRegistry::GetSlotCount()
+  {
+    return slots.size();
+  }
+
+  uint32_t ScriptRegistry::GetGeneration()
+  {
+    return generation;
+  }
+
+  IScript* ScriptRegistry::Resolve(Script& script_component)
+  {
+    // guard
+    if (!is_running) return nullptr;
+
+    // cache hit, no string work
+    // the slot is range checked so that a stale or corrupted cache falls back to the name lookup
+    bool is_cached = script_component.script_slot_generation == generation && script_component.script_slot_name == script_component.script_name;
+    if (is_cached && script_component.script_slot >= 0 && script_component.script_slot < static_cast<int>(slots.size()))
+      return slots[script_component.script_slot].script;
+
+    const std::string& name = FLX_STRING_GET(script_component.script_name);
+    script_component.script_slot = GetScriptSlot(name);
+    script_component.script_slot_generation = generation;
+    script_component.script_slot_name = script_component.script_name;
+
+    // only warn once per name change or reload, not every frame
+    if (script_component.script_slot < 0 && !is_cached) Log::Warning("Script: " + name + " does not exist.");
+    return GetScriptBySlot(script_component.script_slot);
+  }
+
+  #pragma endregion
+
+  #pragma region Dispatch
+
+  void ScriptRegistry::UpdateScripts()
+  {
+    // guard
+    if (!is_running) return;
+
+    // allocations made inside the scripts module are not counted, see heapcounter.h
+    FLX_MEMORY_TAG(Scripting);
+
+    for (ScriptSlot& slot : slots) slot.batch.clear();
+
+    // process all scripts, multiple of the same script can exist
+    // order is not guaranteed and should never be
+    // call awake and start per entity, then collect the entities to update by script
+    for (FlexECS::Entity& entity : FlexECS::Scene::GetActiveScene()->CachedQuery<Transform, Script>())
+    {
+      const Transform& transform = *entity.ReadComponent<Transform>();
+      if (!transform.is_active) continue; // skip non active entities
+
+      auto& script_component = *entity.GetComponent<Script>();
+      IScript* script = Resolve(script_component);
+
+      // guard: missing scripts are warned about in Resolve
+      // a script is only returned for a slot that is in range, so script_slot can index slots below
+      if (!script) continue;
+
+      // awake is called once when the script is created
+      if (!script_component.is_awake)
+      {
+        // always remember to set the context before calling functions
+        script->Internal_SetContext(entity);
+        script->Awake();
+        script_component.is_awake = true;
+      }
+
+      // start is called once when the object is enabled for the first time
+      if (!script_component.is_start && script_component.is_awake)
+      {
+        // always remember to set the context before calling functions
+        script->Internal_SetContext(entity);
+        script->Start();
+        script_component.is_start = true;
+      }
+
+      // update is called every frame for awake and start objects
+      if (script_component.is_start && script_component.is_awake)
+      {
+        slots[script_component.script_slot].batch.push_back(entity);
+
+        // for debugging
+        Internal_Debug_LogScript(FLX_STRING_GET(*entity.ReadComponent<EntityName>()), script->GetName());
+      }
+    }
+
+    // one call per script type
+    for (ScriptSlot& slot : slots)
+    {
+      if (slot.batch.empty()) continue;
+
+      Profiler::StartCounter(slot.profiler_name);
+      slot.script->UpdateBatch(slot.batch);
+      Profiler::EndCounter(slot.profiler_name);
+    }
+
+    // process callback for scripts
+    for (FlexECS::Entity& entity : FlexECS::Scene::GetActiveScene()->CachedQuery<Transform, Script, BoundingBox2D>())
+    {
+      const auto& bb = *entity.ReadComponent<BoundingBox2D>();
+
+      if (bb.is_mouse_over || bb.is_mouse_over_cached)
+      {
+        IScript* script = Resolve(*entity.GetComponent<Script>());
+        FLX_NULLPTR_ASSERT(script, "An expected script is missing from the script registry: " + FLX_STRING_GET(entity.ReadComponent<Script>()->script_name));
+
+        script->Internal_SetContext(entity);
+
+        if (bb.is_mouse_over && !bb.is_mouse_over_cached)
+          script->OnMouseEnter();
+        else if (bb.is_mouse_over)
+          script->OnMouseStay();
+        else if (!bb.is_mouse_over && bb.is_mouse_over_cached)
+          script->OnMouseExit();
+      }
+    }
+  }
+
+  void ScriptRegistry::StopScripts()
+  {
+    for (FlexECS::Entity& entity : FlexECS::Scene::GetActiveScene()->CachedQuery<Script>())
+    {
+      IScript* script = Resolve(*entity.GetComponent<Script>());
+
+      // guard: missing scripts are warned about in Resolve
+      if (!script) continue;
+
+      // always remember to set the context before calling functions
+      script->Internal_SetContext(entity);
+      script->Stop();
+    }
+  }
+
+  #pragma endregion
+
+}
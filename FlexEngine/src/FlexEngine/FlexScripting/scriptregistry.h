@@ -24,6 +24,9 @@ namespace FlexEngine
   // A map of script names to script pointers
   using ScriptMap = std::unordered_map<std::string, IScript*>;
 
+  // forward declaration, the component is in enginecomponents.h
+  class Script;
+
   // A global registry to store all scripts
   class __FLX_API ScriptRegistry
   {
@@ -52,6 +55,43 @@ namespace FlexEngine
     // Get a script by its name
     static IScript* GetScript(const std::string& name);
 
+    #pragma region Slots
+
+    // Every registered script gets a slot, an index that stays the same until
+    // the scripts are cleared. Script components cache their slot so that the
+    // per-frame update does not look up the script name.
+
+    // Returns the slot of a script, or -1 if it does not exist
+    static int GetScriptSlot(const std::string& name);
+
+    // Returns nullptr if the slot is out of range
+    static IScript* GetScriptBySlot(int slot);
+
+    static std::size_t GetSlotCount();
+
+    // Changes every time a script is registered or the scripts are cleared.
+    // Cached slots from an older generation are looked up again.
+    static uint32_t GetGeneration();
+
+    // Returns the script for a component, using the cached slot if it is still valid.
+    // Returns nullptr if the script does not exist or the registry is not running.
+    static IScript* Resolve(Script& script_component);
+
+    #pragma endregion
+
+    #pragma region Dispatch
+
+    // Runs Awake, Start, UpdateBatch and the mouse callbacks for every script in the active scene.
+    // Active entities are grouped by script so that each script gets one UpdateBatch call.
+    // Each script is timed in the profiler as "Script: <name>".
+    static void UpdateScripts();
+
+    // Calls Stop on every script in the active scene.
+    // Called before the scripting DLL is unloaded.
+    static void StopScripts();
+
+    #pragma endregion
+
     #pragma region Debugging functions
 
     #ifdef _DEBUG
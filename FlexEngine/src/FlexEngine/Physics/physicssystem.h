@@ -13,6 +13,7 @@
 
 #pragma once
 #include "FlexEngine.h"
+#include "spatialindex.h"
 using namespace FlexEngine;
 
 namespace FlexEngine
@@ -32,19 +33,43 @@ namespace FlexEngine
 	Note:
 	Positions are still according to FlexEngine's top left (0,0)
 	so our max min will be topleft botright
+
+	Every BoundingBox2D is also kept in a spatial index while the bounds
+	are recomputed, mouse over detection only tests the entities near the mouse.
+	Only the entities whose Position, Scale or Sprite changed, or that just got
+	their components, are recomputed. Removals come from the scene's change listener.
+	Editing BoundingBox2D::size alone does not refresh the bounds.
+
+	The phases run as a SystemSchedule, see UpdatePhysicsSystem.
 	*/
   class __FLX_API PhysicsSystem
   {
   public:
 		static void UpdatePhysicsSystem();
 
+		// Spatial index of all BoundingBox2D bounds, updated every physics step for the entities that changed.
+		static SpatialIndex& GetSpatialIndex();
+
   private:
 		static void RecomputeBounds(FlexECS::Entity entity);
+		static void OnSceneChange(FlexECS::Scene::ChangeType type, FlexECS::EntityID entity, const FlexECS::ComponentID& component);
 		static void UpdatePositions();
+		static void ResetCollisions();
 		static void UpdateBounds();
 		static void FindCollisions();
 		static void ResolveCollisions();
 
 		static std::vector<std::pair<FlexECS::Entity, FlexECS::Entity>> collisions;
+
+		static SpatialIndex spatial_index;
+		static std::weak_ptr<FlexECS::Scene> indexed_scene;
+
+		// What UpdateBounds has seen, and the entities that got a component it needs since then.
+		static FlexECS::ChangeCursor bounds_cursor;
+		static std::vector<FlexECS::EntityID> pending_bounds;
+
+		// Entities whose mouse over flags may still change.
+		// These are the ones hovered in the last two frames and newly indexed ones.
+		static std::vector<FlexECS::EntityID> mouse_over_tracked;
   };
 }
\ No newline at end of file
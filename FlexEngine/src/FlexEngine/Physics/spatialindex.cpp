@@ -0,0 +1,181 @@
+// WLVERSE [https://wlverse.web.app]
+// spatialindex.cpp
+//
+// Shared 2D spatial index for entities.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#include "pch.h"
+
+#include "spatialindex.h"
+
+namespace FlexEngine
+{
+
+  SpatialIndex::SpatialIndex(float fat_margin)
+    : m_tree(fat_margin)
+  {
+  }
+
+  #pragma region Synchronization
+
+  void SpatialIndex::BeginSync()
+  {
+    ++m_sync_frame;
+    m_synced_count = 0;
+  }
+
+  bool SpatialIndex::Update(EntityID entity, const Vector2& min, const Vector2& max, float z)
+  {
+    AABBTree::Box box = { min.x, min.y, max.x, max.y };
+
+    auto it = m_proxies.find(entity);
+    bool inserted = (it == m_proxies.end());
+    int proxy;
+    if (inserted)
+    {
+      proxy = m_tree.Insert(box, entity);
+      m_proxies[entity] = proxy;
+      if (static_cast<std::size_t>(proxy) >= m_entries.size()) m_entries.resize(proxy + 1);
+    }
+    else
+    {
+      proxy = it->second;
+      m_tree.Move(proxy, box);
+    }
+
+    Entry& entry = m_entries[proxy];
+
+    // guard: the same entity updated twice in one frame
+    if (inserted || entry.sync_frame != m_sync_frame) ++m_synced_count;
+
+    entry.entity = entity;
+    entry.box = box;
+    entry.z = z;
+    entry.sync_frame = m_sync_frame;
+
+    return inserted;
+  }
+
+  void SpatialIndex::EndSync()
+  {
+    // fast path: everything in the index was touched this frame
+    if (m_synced_count == m_proxies.size()) return;
+
+    for (auto it = m_proxies.begin(); it != m_proxies.end();)
+    {
+      if (m_entries[it->second].sync_frame != m_sync_frame)
+      {
+        m_tree.Remove(it->second);
+        it = m_proxies.erase(it);
+      }
+      else ++it;
+    }
+  }
+
+  void SpatialIndex::Remove(EntityID entity)
+  {
+    auto it = m_proxies.find(entity);
+    if (it == m_proxies.end()) return;
+
+    // keep the sync count consistent if removed mid-frame
+    if (m_entries[it->second].sync_frame == m_sync_frame && m_synced_count > 0) --m_synced_count;
+
+    m_tree.Remove(it->second);
+    m_proxies.erase(it);
+  }
+
+  void SpatialIndex::Clear()
+  {
+    m_tree.Clear();
+    m_proxies.clear();
+    m_entries.clear();
+    m_synced_count = 0;
+  }
+
+  #pragma endregion
+
+  #pragma region Queries
+
+  template <typename Container>
+  void SpatialIndex::Internal_QueryPoint(const Vector2& point, Container& out) const
+  {
+    m_tree.QueryPoint(point.x, point.y, [&](int proxy)
+    {
+      // the tree only knows the fat box
+      const Entry& entry = m_entries[proxy];
+      if (entry.box.Contains(point.x, point.y)) out.push_back(entry.entity);
+      return true;
+    });
+  }
+
+  void SpatialIndex::QueryPoint(const Vector2& point, std::vector<EntityID>& out) const
+  {
+    Internal_QueryPoint(point, out);
+  }
+
+  void SpatialIndex::QueryPoint(const Vector2& point, FrameVector<EntityID>& out) const
+  {
+    Internal_QueryPoint(point, out);
+  }
+
+  void SpatialIndex::QueryRect(const Vector2& min, const Vector2& max, std::vector<EntityID>& out) const
+  {
+    AABBTree::Box rect = { min.x, min.y, max.x, max.y };
+    m_tree.QueryBox(rect, [&](int proxy)
+    {
+      const Entry& entry = m_entries[proxy];
+      if (entry.box.Overlaps(rect)) out.push_back(entry.entity);
+      return true;
+    });
+  }
+
+  void SpatialIndex::QueryRay(const Vector2& from, const Vector2& to, std::vector<EntityID>& out) const
+  {
+    m_tree.QueryRay(from.x, from.y, to.x, to.y, [&](int proxy)
+    {
+      const Entry& entry = m_entries[proxy];
+      if (AABBTree::SegmentOverlaps(entry.box, from.x, from.y, to.x - from.x, to.y - from.y)) out.push_back(entry.entity);
+      return true;
+    });
+  }
+
+  void SpatialIndex::Pick(const Vector2& point, std::vector<EntityID>& out) const
+  {
+    FrameVector<std::pair<float, EntityID>> hits;
+    m_tree.QueryPoint(point.x, point.y, [&](int proxy)
+    {
+      const Entry& entry = m_entries[proxy];
+      if (entry.box.Contains(point.x, point.y)) hits.push_back({ entry.z, entry.entity });
+      return true;
+    });
+
+    // front to back, same ordering as the editor's click cycling
+    std::sort(hits.begin(), hits.end(), [](const auto& a, const auto& b)
+    {
+      if (a.first == b.first) return a.second < b.second;
+      return a.first > b.first;
+    });
+
+    for (auto& [z, entity] : hits) out.push_back(entity);
+  }
+
+  #pragma endregion
+
+  bool SpatialIndex::GetBounds(EntityID entity, Vector2* out_min, Vector2* out_max, float* out_z) const
+  {
+    auto it = m_proxies.find(entity);
+    if (it == m_proxies.end()) return false;
+
+    const Entry& entry = m_entries[it->second];
+    if (out_min) *out_min = Vector2(entry.box.min_x, entry.box.min_y);
+    if (out_max) *out_max = Vector2(entry.box.max_x, entry.box.max_y);
+    if (out_z) *out_z = entry.z;
+    return true;
+  }
+
+}
@@ -0,0 +1,119 @@
+// WLVERSE [https://wlverse.web.app]
+// spatialindex.h
+//
+// Shared 2D spatial index for entities.
+//
+// Wraps an AABBTree and keeps the exact bounds and z of every entity so that
+// hover, click and marquee selection only look at the entities near the query
+// instead of walking the whole scene.
+//
+// The index is kept up to date by whichever system already computes the bounds
+// (physics bounds, the editor transform pass). Each frame is wrapped in
+// BeginSync/EndSync and every live entity is passed to Update. Entities that
+// stay inside their fat box cost a single containment check, and entities that
+// were not updated during the frame are dropped in EndSync.
+// Physics skips the sync frame instead: it only passes the entities whose
+// bounds changed to Update and calls Remove for destroyed ones.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#pragma once
+
+#include "flx_api.h"
+
+#include "DataStructures/aabbtree.h"
+#include "DataStructures/framearena.h"
+#include "FlexMath/vector2.h"
+
+#include <cstdint> // uint64_t
+#include <vector>
+#include <unordered_map>
+
+namespace FlexEngine
+{
+
+  class __FLX_API SpatialIndex
+  {
+  public:
+    // Same as FlexECS::EntityID
+    using EntityID = uint64_t;
+
+    SpatialIndex(float fat_margin = 10.0f);
+
+    #pragma region Synchronization
+
+    // Starts a new sync frame.
+    void BeginSync();
+
+    // Inserts the entity or updates its bounds.
+    // min and max are in world space, z is used for picking order.
+    // Returns true if the entity was not in the index before.
+    bool Update(EntityID entity, const Vector2& min, const Vector2& max, float z = 0.0f);
+
+    // Removes every entity that was not updated since BeginSync.
+    // This is how destroyed entities and scene switches are cleaned up.
+    void EndSync();
+
+    void Remove(EntityID entity);
+    void Clear();
+
+    #pragma endregion
+
+    #pragma region Queries
+
+    // All queries are inclusive of the bounds and append to out.
+
+    // Entities whose bounds contain the point.
+    void QueryPoint(const Vector2& point, std::vector<EntityID>& out) const;
+    void QueryPoint(const Vector2& point, FrameVector<EntityID>& out) const;
+
+    // Entities whose bounds overlap the rectangle.
+    void QueryRect(const Vector2& min, const Vector2& max, std::vector<EntityID>& out) const;
+
+    // Entities whose bounds are crossed by the segment.
+    void QueryRay(const Vector2& from, const Vector2& to, std::vector<EntityID>& out) const;
+
+    // Entities whose bounds contain the point, sorted front to back.
+    // Higher z is in front, ties are broken by the lower entity id.
+    void Pick(const Vector2& point, std::vector<EntityID>& out) const;
+
+    #pragma endregion
+
+    bool Contains(EntityID entity) const { return m_proxies.count(entity) != 0; }
+    std::size_t Size() const { return m_proxies.size(); }
+
+    // Exact bounds as last passed to Update.
+    // Returns false if the entity is not in the index.
+    bool GetBounds(EntityID entity, Vector2* out_min, Vector2* out_max, float* out_z = nullptr) const;
+
+    const AABBTree& GetTree() const { return m_tree; }
+
+  private:
+    struct Entry
+    {
+      EntityID entity = 0;
+      AABBTree::Box box;
+      float z = 0.0f;
+      uint64_t sync_frame = 0;
+    };
+
+    AABBTree m_tree;
+
+    // indexed by the tree proxy id
+    std::vector<Entry> m_entries;
+
+    // entity to tree proxy id
+    std::unordered_map<EntityID, int> m_proxies;
+
+    uint64_t m_sync_frame = 0;
+    std::size_t m_synced_count = 0;
+
+    template <typename Container>
+    void Internal_QueryPoint(const Vector2& point, Container& out) const;
+  };
+
+}
@@ -46,6 +46,7 @@
 
 #include "flexassert.h"
 #include "Utilities/flexbase64.h"
+#include "Reflection/binarystream.h" // <cstdint> <cstring> <string>
 
 #include <rapidjson/document.h>
 using namespace rapidjson;
@@ -58,6 +59,10 @@ using namespace rapidjson;
 #include <map>
 #include <unordered_map>
 #include <functional>
+#include <mutex>       // std::once_flag
+#include <type_traits> // std::is_trivially_copyable
+#include <cstring>     // std::memcpy
+#include <new>         // placement new
 
 #pragma region Macros
 
@@ -80,6 +85,9 @@ using namespace rapidjson;
     using T = TYPE; \
     type_desc->name = #TYPE; \
     type_desc->size = sizeof(T); \
+    type_desc->trivially_copyable = std::is_trivially_copyable<T>::value; \
+    type_desc->trivially_destructible = std::is_trivially_destructible<T>::value; \
+    type_desc->construct = FlexEngine::Reflection::Internal_GetConstructor<T>(); \
     type_desc->members = {
 
 // Registers a member variable for reflection
@@ -116,6 +124,17 @@ namespace FlexEngine
 
     struct DefaultResolver;
     struct TypeDescriptor_Struct;
+    struct TypeDescriptor;
+
+    // One step of a compiled binary layout.
+    // Either a run of bytes that are written as they are in memory,
+    // or a value that goes through the SerializeBinary of its type.
+    struct BinaryStep
+    {
+      size_t offset;
+      size_t size;
+      const TypeDescriptor* type; // nullptr for a run of raw bytes
+    };
 
     // Base class for all type descriptors.
     // A type descriptor is a class that describes a type,
@@ -180,9 +199,64 @@ namespace FlexEngine
       // This recursively deserializes the object from the json format
       // The deserializer uses the rapidjson library.
       virtual void Deserialize(void* obj, const json& value) const = 0;
+
+      // Serializes an object into the compact binary format.
+      // Unlike the json format, no type names are written, only the values in member order.
+      // Use GetSchemaHash() to detect if the layout has changed since the data was written.
+      virtual void SerializeBinary(const void* obj, BinaryWriter& out) const = 0;
+
+      // Deserializes an object from the compact binary format.
+      // Check in.Failed() afterwards, a truncated or corrupted stream does not throw.
+      virtual void DeserializeBinary(void* obj, BinaryReader& in) const = 0;
+
+      // Fills raw memory of size bytes with a default object before it is deserialized into.
+      // Deserializing only writes the reflected members, the rest keep these values.
+      // Does nothing for types without a default, their reflected members cover the whole object.
+      virtual void ConstructDefault(void* obj) const { (void)obj; }
+
+      // Hash of everything that affects the binary layout (type names, member names and order).
+      // Two types with the same schema hash can read each other's binary data.
+      virtual uint64_t GetSchemaHash() const
+      {
+        uint64_t hash = SchemaHashSeed;
+        HashCombine(hash, ToString());
+        return hash;
+      }
+
+      // True if the binary format of the type is exactly its bytes in memory,
+      // so that it can be copied in bulk. The engine only targets little-endian platforms.
+      virtual bool IsRawBinary() const { return false; }
+
+      // Appends the steps that write this type at the offset into a struct, see TypeDescriptor_Struct.
+      virtual void AppendBinaryLayout(std::vector<BinaryStep>& steps, size_t offset) const
+      {
+        if (IsRawBinary()) AppendRawRun(steps, offset, size);
+        else steps.push_back({ offset, size, this });
+      }
+
+      // Adds the bytes to the raw run before it if they follow it directly.
+      static void AppendRawRun(std::vector<BinaryStep>& steps, size_t offset, size_t size)
+      {
+        if (!steps.empty() && steps.back().type == nullptr && steps.back().offset + steps.back().size == offset)
+        {
+          steps.back().size += size;
+        }
+        else
+        {
+          steps.push_back({ offset, size, nullptr });
+        }
+      }
     };
 
 
+    // Used by FLX_REFL_REGISTER_START to fill TypeDescriptor_Struct::construct.
+    template <typename T>
+    void (*Internal_GetConstructor())(void*)
+    {
+      if constexpr (std::is_default_constructible_v<T>) return [](void* obj) { new (obj) T(); };
+      else return nullptr;
+    }
+
     // Declare the function template that handles primitive types
     // such as int, std::string, etc. in primitives.cpp
     template <typename T>
@@ -301,6 +375,19 @@ namespace FlexEngine
 
       std::vector<Member> members;
 
+      // Set by FLX_REFL_REGISTER_START
+      bool trivially_copyable = false;
+      bool trivially_destructible = false;
+
+      // Set by FLX_REFL_REGISTER_START, nullptr if the type is not default constructible.
+      // Placement-constructs a default object in raw memory.
+      void (*construct)(void* obj) = nullptr;
+
+      // The bytes of a default object, filled by Scene::Internal_PrepareComponentDefaults.
+      // Default member initializers can call FLX_STRING_NEW, which belongs to the main thread,
+      // so loads on other threads copy these bytes instead of running the constructor.
+      std::vector<unsigned char> default_bytes;
+
       TypeDescriptor_Struct(void (*init)(TypeDescriptor_Struct*))
         : TypeDescriptor{ "", 0}
       {
@@ -354,6 +441,106 @@ namespace FlexEngine
         }
       }
 
+      // Runs of raw members are written with one copy, see GetBinaryLayout().
+      virtual void SerializeBinary(const void* obj, BinaryWriter& out) const override
+      {
+        for (const BinaryStep& step : GetBinaryLayout())
+        {
+          if (step.type) step.type->SerializeBinary((const char*)obj + step.offset, out);
+          else out.WriteBytes((const char*)obj + step.offset, step.size);
+        }
+      }
+
+      virtual void DeserializeBinary(void* obj, BinaryReader& in) const override
+      {
+        for (const BinaryStep& step : GetBinaryLayout())
+        {
+          if (step.type)
+          {
+            step.type->DeserializeBinary((char*)obj + step.offset, in);
+          }
+          else
+          {
+            const char* data = in.ReadBytes(step.size);
+            if (!data) return;
+            std::memcpy((char*)obj + step.offset, data, step.size);
+          }
+        }
+      }
+
+      // The member by member version of SerializeBinary, writes the same data.
+      void Internal_SerializeBinaryMembers(const void* obj, BinaryWriter& out) const
+      {
+        for (const Member& member : members)
+        {
+          member.type->SerializeBinary((const char*)obj + member.offset, out);
+        }
+      }
+
+      // The member by member version of DeserializeBinary.
+      void Internal_DeserializeBinaryMembers(void* obj, BinaryReader& in) const
+      {
+        for (const Member& member : members)
+        {
+          member.type->DeserializeBinary((char*)obj + member.offset, in);
+        }
+      }
+
+      // The members flattened into steps in member order, nested structs included.
+      // Raw members that follow each other in memory are merged into a single run,
+      // so a Vector3 is one 12 byte copy and a struct of only raw members is one copy.
+      // Compiled on first use, after every descriptor has been initialized.
+      const std::vector<BinaryStep>& GetBinaryLayout() const
+      {
+        std::call_once(binary_layout_once, [this]()
+        {
+          for (const Member& member : members) member.type->AppendBinaryLayout(binary_layout, member.offset);
+        });
+        return binary_layout;
+      }
+
+      virtual void ConstructDefault(void* obj) const override
+      {
+        if (!default_bytes.empty()) std::memcpy(obj, default_bytes.data(), size);
+        else if (construct) construct(obj);
+      }
+
+      // A struct is raw when its layout is one run covering the whole struct, without padding.
+      virtual bool IsRawBinary() const override
+      {
+        const std::vector<BinaryStep>& layout = GetBinaryLayout();
+        return trivially_copyable &&
+               layout.size() == 1 && layout[0].type == nullptr &&
+               layout[0].offset == 0 && layout[0].size == size;
+      }
+
+      // Nested structs are flattened into the layout of the outer struct.
+      virtual void AppendBinaryLayout(std::vector<BinaryStep>& steps, size_t offset) const override
+      {
+        for (const BinaryStep& step : GetBinaryLayout())
+        {
+          if (step.type) steps.push_back({ offset + step.offset, step.size, step.type });
+          else AppendRawRun(steps, offset + step.offset, step.size);
+        }
+      }
+
+      virtual uint64_t GetSchemaHash() const override
+      {
+        uint64_t hash = SchemaHashSeed;
+        HashCombine(hash, name);
+        HashCombine(hash, static_cast<uint64_t>(members.size()));
+        for (const Member& member : members)
+        {
+          HashCombine(hash, std::string(member.name));
+          HashCombine(hash, member.type->GetSchemaHash());
+        }
+        return hash;
+      }
+
+    private:
+      mutable std::once_flag binary_layout_once;
+      mutable std::vector<BinaryStep> binary_layout;
+
     };
 
 
@@ -366,6 +553,7 @@ namespace FlexEngine
       size_t (*get_size)(const void*);
       const void* (*get_item)(const void*, size_t);
       void* (*set_item)(void*, size_t);
+      void (*resize)(void*, size_t);
 
       template <typename ItemType>
       TypeDescriptor_StdVector(ItemType*)
@@ -385,6 +573,10 @@ namespace FlexEngine
           if (index >= vec.size()) vec.resize(index + 1);
           return &vec[index];
         };
+        resize = [](void* vec_ptr, size_t size) {
+          auto& vec = *(std::vector<ItemType>*) vec_ptr;
+          vec.resize(size);
+        };
       }
 
       virtual std::string ToString() const override
@@ -443,6 +635,48 @@ namespace FlexEngine
         }
       }
 
+      // Length-prefixed
+      // Raw items are copied in one go, they are stored back to back in the same format.
+      virtual void SerializeBinary(const void* obj, BinaryWriter& out) const override
+      {
+        size_t num_items = get_size(obj);
+        out.WriteVarUInt(num_items);
+        if (num_items > 0 && item_type->IsRawBinary())
+        {
+          out.WriteBytes(get_item(obj, 0), num_items * item_type->size);
+          return;
+        }
+        for (size_t index = 0; index < num_items; index++)
+        {
+          item_type->SerializeBinary(get_item(obj, index), out);
+        }
+      }
+
+      virtual void DeserializeBinary(void* obj, BinaryReader& in) const override
+      {
+        size_t num_items = in.ReadCount();
+        if (num_items > 0 && item_type->IsRawBinary())
+        {
+          const char* data = in.ReadBytes(num_items * item_type->size);
+          resize(obj, data ? num_items : 0);
+          if (data) std::memcpy(set_item(obj, 0), data, num_items * item_type->size);
+          return;
+        }
+        resize(obj, num_items);
+        for (size_t index = 0; index < num_items && !in.Failed(); index++)
+        {
+          item_type->DeserializeBinary(set_item(obj, index), in);
+        }
+      }
+
+      virtual uint64_t GetSchemaHash() const override
+      {
+        uint64_t hash = SchemaHashSeed;
+        HashCombine(hash, std::string("std::vector<>"));
+        HashCombine(hash, item_type->GetSchemaHash());
+        return hash;
+      }
+
     };
 
     // Partially specialize TypeResolver for std::vectors.
@@ -534,6 +768,43 @@ namespace FlexEngine
           map[key] = val;
         }
       }
+
+      // Length-prefixed list of key, value
+      virtual void SerializeBinary(const void* obj, BinaryWriter& out) const override
+      {
+        const auto& map = *(const std::unordered_map<KeyType, ValueType>*)obj;
+        out.WriteVarUInt(map.size());
+        for (const auto& pair : map)
+        {
+          key_type->SerializeBinary(&pair.first, out);
+          value_type->SerializeBinary(&pair.second, out);
+        }
+      }
+
+      virtual void DeserializeBinary(void* obj, BinaryReader& in) const override
+      {
+        std::unordered_map<KeyType, ValueType>& map = *(std::unordered_map<KeyType, ValueType>*)obj;
+
+        size_t num_items = in.ReadCount();
+        map.reserve(map.size() + num_items);
+        for (size_t i = 0; i < num_items && !in.Failed(); i++)
+        {
+          KeyType key{};
+          ValueType val{};
+          key_type->DeserializeBinary(&key, in);
+          value_type->DeserializeBinary(&val, in);
+          map[key] = std::move(val);
+        }
+      }
+
+      virtual uint64_t GetSchemaHash() const override
+      {
+        uint64_t hash = SchemaHashSeed;
+        HashCombine(hash, std::string("std::unordered_map<>"));
+        HashCombine(hash, key_type->GetSchemaHash());
+        HashCombine(hash, value_type->GetSchemaHash());
+        return hash;
+      }
     };
 
     // Partially specialize TypeResolver for std::unordered_maps.
@@ -617,6 +888,36 @@ namespace FlexEngine
         }
       }
 
+      // 1 byte for null/not null, followed by the object
+      virtual void SerializeBinary(const void* obj, BinaryWriter& out) const override
+      {
+        const auto& shared_ptr = *reinterpret_cast<const std::shared_ptr<T>*>(obj);
+        out.WriteU8(shared_ptr ? 1 : 0);
+        if (shared_ptr) item_type->SerializeBinary(shared_ptr.get(), out);
+      }
+
+      virtual void DeserializeBinary(void* obj, BinaryReader& in) const override
+      {
+        if (in.ReadU8() == 0)
+        {
+          *reinterpret_cast<std::shared_ptr<T>*>(obj) = nullptr;
+        }
+        else
+        {
+          std::shared_ptr<T> shared_ptr = std::make_shared<T>();
+          item_type->DeserializeBinary(shared_ptr.get(), in);
+          *reinterpret_cast<std::shared_ptr<T>*>(obj) = shared_ptr;
+        }
+      }
+
+      virtual uint64_t GetSchemaHash() const override
+      {
+        uint64_t hash = SchemaHashSeed;
+        HashCombine(hash, std::string("std::shared_ptr<>"));
+        HashCombine(hash, item_type->GetSchemaHash());
+        return hash;
+      }
+
     };
 
     // Specialization for std::shared_ptr<void>.
@@ -731,6 +1032,46 @@ namespace FlexEngine
         }
       }
 
+      // 1 byte for null/not null, followed by the length-prefixed raw bytes.
+      // No base64, the bytes are copied as they are.
+      virtual void SerializeBinary(const void* obj, BinaryWriter& out) const override
+      {
+        const auto& shared_ptr = *reinterpret_cast<const std::shared_ptr<void>*>(obj);
+        out.WriteU8(shared_ptr ? 1 : 0);
+        if (!shared_ptr) return;
+
+        // Same layout as Serialize, see Internal_GetComponentData
+        const BYTE* byte_ptr = static_cast<const BYTE*>(shared_ptr.get());
+        std::size_t data_size = *reinterpret_cast<const std::size_t*>(byte_ptr);
+        out.WriteVarUInt(data_size);
+        out.WriteBytes(byte_ptr + sizeof(std::size_t), data_size);
+      }
+
+      virtual void DeserializeBinary(void* obj, BinaryReader& in) const override
+      {
+        if (in.ReadU8() == 0)
+        {
+          *reinterpret_cast<std::shared_ptr<void>*>(obj) = nullptr;
+          return;
+        }
+
+        std::size_t data_size = static_cast<std::size_t>(in.ReadVarUInt());
+        const char* data = in.ReadBytes(data_size);
+        if (data == nullptr) return;
+
+        char* ptr = new char[sizeof(std::size_t) + data_size];
+        memcpy(ptr, &data_size, sizeof(std::size_t));
+        memcpy(ptr + sizeof(std::size_t), data, data_size);
+
+        *reinterpret_cast<std::shared_ptr<void>*>(obj) = std::shared_ptr<void>(
+          ptr,
+          [](void* ptr)
+          {
+            delete[] reinterpret_cast<char*>(ptr);
+          }
+        );
+      }
+
     };
 
     /// Partially specialize TypeResolver for std::shared_ptrs.
@@ -802,6 +1143,28 @@ namespace FlexEngine
         second_type->Deserialize(&((std::pair<FirstType, SecondType>*)obj)->second, arr[1]);
       }
 
+      virtual void SerializeBinary(const void* obj, BinaryWriter& out) const override
+      {
+        const auto& pair = *(const std::pair<FirstType, SecondType>*)obj;
+        first_type->SerializeBinary(&pair.first, out);
+        second_type->SerializeBinary(&pair.second, out);
+      }
+
+      virtual void DeserializeBinary(void* obj, BinaryReader& in) const override
+      {
+        first_type->DeserializeBinary(&((std::pair<FirstType, SecondType>*)obj)->first, in);
+        second_type->DeserializeBinary(&((std::pair<FirstType, SecondType>*)obj)->second, in);
+      }
+
+      virtual uint64_t GetSchemaHash() const override
+      {
+        uint64_t hash = SchemaHashSeed;
+        HashCombine(hash, std::string("std::pair<>"));
+        HashCombine(hash, first_type->GetSchemaHash());
+        HashCombine(hash, second_type->GetSchemaHash());
+        return hash;
+      }
+
     };
 
     // Partially specialize TypeResolver for std::pairs.
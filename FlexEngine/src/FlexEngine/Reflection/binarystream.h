@@ -0,0 +1,248 @@
+// WLVERSE [https://wlverse.web.app]
+// binarystream.h
+//
+// Byte streams for the binary reflection backend.
+//
+// Encoding:
+//  - unsigned integers are LEB128 varints (7 bits per byte, high bit = more)
+//  - signed integers are zigzag encoded and then written as varints
+//  - float and double are written as raw little-endian bytes
+//  - strings and byte blobs are a varint length followed by the bytes
+//
+// The reader never throws. Reading past the end marks the stream as failed and
+// returns zeroes, so callers only need to check Failed() once at the end.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring> // std::memcpy
+#include <string>
+
+namespace FlexEngine
+{
+
+  namespace Reflection
+  {
+
+    // Appends encoded values to a std::string buffer.
+    // std::string is used so that the result can be written with File::Write directly.
+    class BinaryWriter
+    {
+    public:
+      BinaryWriter() = default;
+      explicit BinaryWriter(std::size_t reserve) { m_buffer.reserve(reserve); }
+
+      void WriteVarUInt(uint64_t value)
+      {
+        while (value >= 0x80)
+        {
+          m_buffer.push_back(static_cast<char>((value & 0x7F) | 0x80));
+          value >>= 7;
+        }
+        m_buffer.push_back(static_cast<char>(value));
+      }
+
+      void WriteVarInt(int64_t value)
+      {
+        // zigzag: 0, -1, 1, -2, 2... -> 0, 1, 2, 3, 4...
+        WriteVarUInt((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+      }
+
+      void WriteU8(uint8_t value) { m_buffer.push_back(static_cast<char>(value)); }
+
+      void WriteU64(uint64_t value)
+      {
+        for (int i = 0; i < 8; ++i) m_buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+      }
+
+      void WriteFloat(float value)
+      {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        for (int i = 0; i < 4; ++i) m_buffer.push_back(static_cast<char>((bits >> (8 * i)) & 0xFF));
+      }
+
+      void WriteDouble(double value)
+      {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        WriteU64(bits);
+      }
+
+      void WriteBytes(const void* data, std::size_t size)
+      {
+        m_buffer.append(static_cast<const char*>(data), size);
+      }
+
+      // Length-prefixed
+      void WriteString(const std::string& value)
+      {
+        WriteVarUInt(value.size());
+        m_buffer.append(value);
+      }
+
+      const std::string& GetBuffer() const { return m_buffer; }
+      std::string& GetBuffer() { return m_buffer; }
+      std::size_t Size() const { return m_buffer.size(); }
+
+    private:
+      std::string m_buffer;
+    };
+
+
+    // Reads encoded values from a byte range.
+    // The range must outlive the reader.
+    class BinaryReader
+    {
+    public:
+      BinaryReader(const char* data, std::size_t size)
+        : m_cursor(reinterpret_cast<const uint8_t*>(data))
+        , m_end(reinterpret_cast<const uint8_t*>(data) + size)
+      {
+      }
+
+      explicit BinaryReader(const std::string& data)
+        : BinaryReader(data.data(), data.size())
+      {
+      }
+
+      uint64_t ReadVarUInt()
+      {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+          if (m_cursor == m_end) return Fail();
+          uint8_t byte = *m_cursor++;
+          value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+          if ((byte & 0x80) == 0) return value;
+        }
+
+        // more than 10 bytes is not a valid varint
+        return Fail();
+      }
+
+      int64_t ReadVarInt()
+      {
+        uint64_t value = ReadVarUInt();
+        return static_cast<int64_t>((value >> 1) ^ (~(value & 1) + 1));
+      }
+
+      uint8_t ReadU8()
+      {
+        if (m_cursor == m_end) return static_cast<uint8_t>(Fail());
+        return *m_cursor++;
+      }
+
+      uint64_t ReadU64()
+      {
+        if (Remaining() < 8) return Fail();
+        uint64_t value = 0;
+        for (int i = 0; i < 8; ++i) value |= static_cast<uint64_t>(m_cursor[i]) << (8 * i);
+        m_cursor += 8;
+        return value;
+      }
+
+      float ReadFloat()
+      {
+        if (Remaining() < 4) { Fail(); return 0.0f; }
+        uint32_t bits = 0;
+        for (int i = 0; i < 4; ++i) bits |= static_cast<uint32_t>(m_cursor[i]) << (8 * i);
+        m_cursor += 4;
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+      }
+
+      double ReadDouble()
+      {
+        uint64_t bits = ReadU64();
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+      }
+
+      // Returns a pointer to the next size bytes and skips over them.
+      // Returns nullptr if there are not enough bytes left.
+      const char* ReadBytes(std::size_t size)
+      {
+        if (Remaining() < size) { Fail(); return nullptr; }
+        const char* data = reinterpret_cast<const char*>(m_cursor);
+        m_cursor += size;
+        return data;
+      }
+
+      std::string ReadString()
+      {
+        uint64_t size = ReadVarUInt();
+        const char* data = ReadBytes(static_cast<std::size_t>(size));
+        if (data == nullptr) return std::string();
+        return std::string(data, static_cast<std::size_t>(size));
+      }
+
+      // Reads a count for a container.
+      // Every element takes at least one byte, so a count larger than what is left is corrupt.
+      // This stops a bad count from allocating gigabytes before the read fails.
+      std::size_t ReadCount()
+      {
+        uint64_t count = ReadVarUInt();
+        if (count > Remaining()) { Fail(); return 0; }
+        return static_cast<std::size_t>(count);
+      }
+
+      std::size_t Remaining() const { return static_cast<std::size_t>(m_end - m_cursor); }
+      bool Failed() const { return m_failed; }
+
+    private:
+      const uint8_t* m_cursor;
+      const uint8_t* m_end;
+      bool m_failed = false;
+
+      uint64_t Fail()
+      {
+        m_failed = true;
+        m_cursor = m_end;
+        return 0;
+      }
+    };
+
+
+    // FNV-1a, used to build schema hashes.
+    // Stable across runs and builds, unlike std::hash.
+    inline void HashCombine(uint64_t& hash, const void* data, std::size_t size)
+    {
+      const uint8_t* bytes = static_cast<const uint8_t*>(data);
+      for (std::size_t i = 0; i < size; ++i)
+      {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+      }
+    }
+
+    inline void HashCombine(uint64_t& hash, const std::string& value)
+    {
+      HashCombine(hash, value.data(), value.size());
+      // separator so that "ab" + "c" != "a" + "bc"
+      uint8_t separator = 0xFF;
+      HashCombine(hash, &separator, 1);
+    }
+
+    inline void HashCombine(uint64_t& hash, uint64_t value)
+    {
+      // hash the little-endian bytes so the result is the same on every platform
+      uint8_t bytes[8];
+      for (int i = 0; i < 8; ++i) bytes[i] = static_cast<uint8_t>((value >> (8 * i)) & 0xFF);
+      HashCombine(hash, bytes, 8);
+    }
+
+    // FNV-1a offset basis
+    constexpr uint64_t SchemaHashSeed = 14695981039346656037ull;
+
+  }
+
+}
@@ -12,6 +12,11 @@
 // - float
 // - std::string
 //
+// Binary encoding: integers are varints (signed ones zigzag encoded), floating
+// point types are raw little-endian bytes, bool is one byte and std::string is
+// length-prefixed. See binarystream.h.
+// Because floating point types are raw, structs of them are copied in bulk.
+//
 // AUTHORS
 // [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
 //   - Main Author
@@ -20,6 +25,30 @@
 
 #include "Reflection/base.h"
 
+#pragma region Binary Encoding
+
+namespace
+{
+  using FlexEngine::Reflection::BinaryWriter;
+  using FlexEngine::Reflection::BinaryReader;
+
+  void WriteBinary(BinaryWriter& out, int value)      { out.WriteVarInt(value); }
+  void WriteBinary(BinaryWriter& out, unsigned value) { out.WriteVarUInt(value); }
+  void WriteBinary(BinaryWriter& out, int64_t value)  { out.WriteVarInt(value); }
+  void WriteBinary(BinaryWriter& out, uint64_t value) { out.WriteVarUInt(value); }
+  void WriteBinary(BinaryWriter& out, double value)   { out.WriteDouble(value); }
+  void WriteBinary(BinaryWriter& out, float value)    { out.WriteFloat(value); }
+
+  void ReadBinary(BinaryReader& in, int& value)       { value = static_cast<int>(in.ReadVarInt()); }
+  void ReadBinary(BinaryReader& in, unsigned& value)  { value = static_cast<unsigned>(in.ReadVarUInt()); }
+  void ReadBinary(BinaryReader& in, int64_t& value)   { value = in.ReadVarInt(); }
+  void ReadBinary(BinaryReader& in, uint64_t& value)  { value = in.ReadVarUInt(); }
+  void ReadBinary(BinaryReader& in, double& value)    { value = in.ReadDouble(); }
+  void ReadBinary(BinaryReader& in, float& value)     { value = in.ReadFloat(); }
+}
+
+#pragma endregion
+
 #pragma region Macros
 
 // TypeDescriptor for primitive types
@@ -43,6 +72,19 @@
       *(TYPE*)obj = data; \
       /**reinterpret_cast<TYPE*>(obj) = data;*/ \
     } \
+    virtual void SerializeBinary(const void* obj, BinaryWriter& out) const override \
+    { \
+      WriteBinary(out, *(const TYPE*)obj); \
+    } \
+    virtual void DeserializeBinary(void* obj, BinaryReader& in) const override \
+    { \
+      ReadBinary(in, *(TYPE*)obj); \
+    } \
+    /* floating point types are written as their bytes, integers are varints */ \
+    virtual bool IsRawBinary() const override \
+    { \
+      return std::is_floating_point<TYPE>::value; \
+    } \
   }; \
   template <> \
   __FLX_API TypeDescriptor* GetPrimitiveDescriptor<TYPE>() \
@@ -108,6 +150,14 @@ namespace FlexEngine
       {
         bool data = value["data"].Get<bool>(); *(bool*)obj = data;
       }
+      virtual void SerializeBinary(const void* obj, BinaryWriter& out) const override
+      {
+        out.WriteU8((*(const bool*)obj) ? 1 : 0);
+      }
+      virtual void DeserializeBinary(void* obj, BinaryReader& in) const override
+      {
+        *(bool*)obj = (in.ReadU8() != 0);
+      }
     };
     template <>
     __FLX_API TypeDescriptor* GetPrimitiveDescriptor<bool>()
@@ -218,6 +268,14 @@ namespace FlexEngine
 
         *(std::string*)obj = unescaped_data.str();
       }
+      virtual void SerializeBinary(const void* obj, BinaryWriter& out) const override
+      {
+        out.WriteString(*(const std::string*)obj);
+      }
+      virtual void DeserializeBinary(void* obj, BinaryReader& in) const override
+      {
+        *(std::string*)obj = in.ReadString();
+      }
     };
     template <>
     __FLX_API TypeDescriptor* GetPrimitiveDescriptor<std::string>()
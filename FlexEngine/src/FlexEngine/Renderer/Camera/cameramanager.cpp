@@ -36,7 +36,7 @@ namespace FlexEngine
         has_main_camera = true;
 
         FlexECS::Entity cam_entity = cam_targets;
-        Log::Info("Setting main camera with entity name: " + FLX_STRING_GET(*cam_entity.GetComponent<EntityName>()));
+        Log::Info("Setting main camera with entity name: " + FLX_STRING_GET(*cam_entity.ReadComponent<EntityName>()));
         return true;
       }
       return false;
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "Renderer/OpenGL/openglbuffer.h"
+#include "Renderer/OpenGL/openglstate.h"
 
 #include <glad/glad.h>
 
@@ -28,12 +29,12 @@ namespace FlexEngine
 
   OpenGLVertexArray::~OpenGLVertexArray()
   {
-    glDeleteVertexArrays(1, &m_binding_point);
+    OpenGLState::DeleteVertexArrays(1, &m_binding_point);
   }
 
   void OpenGLVertexArray::Bind() const
   {
-    glBindVertexArray(m_binding_point);
+    OpenGLState::BindVertexArray(m_binding_point);
 
     // Hardcoded vertex layout
     //Vertex::SetLayout();
@@ -41,7 +42,7 @@ namespace FlexEngine
 
   void OpenGLVertexArray::Unbind() const
   {
-    glBindVertexArray(0);
+    OpenGLState::BindVertexArray(0);
   }
 
   #pragma endregion
@@ -15,6 +15,8 @@
 #include <glad/glad.h>
 #include "Utilities/file.h"
 #include "openglfont.h"
+#include "openglrenderer.h" // OpenGLRenderer::IsNullBackend
+#include "openglstate.h"
 #include <vector>
 #include <algorithm>
 #include <cstring>
@@ -88,13 +90,13 @@ namespace FlexEngine
                 FontSizeData& data = pair.second;
                 for (auto& glyphPair : data.glyphs)
                 {
-                    glDeleteTextures(1, &glyphPair.second.textureID);
+                    if (glyphPair.second.textureID) OpenGLState::DeleteTextures(1, &glyphPair.second.textureID);
                 }
                 data.glyphs.clear();
 
                 if (data.atlasTexture)
                 {
-                    glDeleteTextures(1, &data.atlasTexture);
+                    OpenGLState::DeleteTextures(1, &data.atlasTexture);
                     data.atlasTexture = 0;
                 }
             }
@@ -132,22 +134,25 @@ namespace FlexEngine
                 FontSizeData& oldData = it->second;
                 for (auto& glyphPair : oldData.glyphs)
                 {
-                    glDeleteTextures(1, &glyphPair.second.textureID);
+                    if (glyphPair.second.textureID) OpenGLState::DeleteTextures(1, &glyphPair.second.textureID);
                 }
                 if (oldData.atlasTexture)
                 {
-                    glDeleteTextures(1, &oldData.atlasTexture);
+                    OpenGLState::DeleteTextures(1, &oldData.atlasTexture);
                 }
                 m_sizeData.erase(it);
             }
 
             FontSizeData data;
 
+            // On the null backend the glyph metrics are still computed, but no textures are created.
+            const bool upload = !OpenGLRenderer::IsNullBackend();
+
             // Set the desired pixel size.
             FT_Set_Pixel_Sizes(s_face, 0, size);
 
             // Ensure proper unpack alignment.
-            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+            if (upload) glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
             std::map<char, TempGlyph> tempGlyphs;
             const int atlasWidth = 512;
@@ -167,16 +172,18 @@ namespace FlexEngine
                 FT_GlyphSlot g = s_face->glyph;
 
                 // Create individual texture for the glyph.
-                GLuint texture;
-                glGenTextures(1, &texture);
-                glBindTexture(GL_TEXTURE_2D, texture);
-                glTexImage2D(GL_TEXTURE_2D, 0, GL_RED,
-                             g->bitmap.width, g->bitmap.rows,
-                             0, GL_RED, GL_UNSIGNED_BYTE, g->bitmap.buffer);
-                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+                GLuint texture = 0;
+                if (upload) {
+                    glGenTextures(1, &texture);
+                    OpenGLState::BindTexture(texture);
+                    glTexImage2D(GL_TEXTURE_2D, 0, GL_RED,
+                                 g->bitmap.width, g->bitmap.rows,
+                                 0, GL_RED, GL_UNSIGNED_BYTE, g->bitmap.buffer);
+                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+                }
 
                 // Store glyph information.
                 Glyph glyph;
@@ -251,8 +258,12 @@ namespace FlexEngine
             }
 
             // Generate the atlas texture.
+            if (!upload) {
+                m_sizeData[size] = data;
+                return;
+            }
             glGenTextures(1, &data.atlasTexture);
-            glBindTexture(GL_TEXTURE_2D, data.atlasTexture);
+            OpenGLState::BindTexture(data.atlasTexture);
             glTexImage2D(GL_TEXTURE_2D, 0, GL_RED,
                          atlasWidth, atlasHeight,
                          0, GL_RED, GL_UNSIGNED_BYTE, atlasBuffer.data());
@@ -260,7 +271,7 @@ namespace FlexEngine
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-            glBindTexture(GL_TEXTURE_2D, 0);
+            OpenGLState::BindTexture(0);
 
             m_sizeData[size] = data;
         }
@@ -12,6 +12,8 @@
 
 #pragma once
 #include "openglframebuffer.h"
+#include "openglrenderer.h" // OpenGLRenderer::IsNullBackend
+#include "openglstate.h"
 #include "flexlogger.h"
 
 namespace FlexEngine 
@@ -23,9 +25,12 @@ namespace FlexEngine
 
   OpenGLFrameBuffer::~OpenGLFrameBuffer()
   {
+    // guard: nothing was created on the null backend
+    if (framebuffer == 0) return;
+
     // Cleanup
     glDeleteFramebuffers(1, &framebuffer);
-    glDeleteTextures(1, &colorAttachment);
+    OpenGLState::DeleteTextures(1, &colorAttachment);
     glDeleteRenderbuffers(1, &depthStencilAttachment);
 
     Log::Info("Framebuffer deleted with ID: " + std::to_string(framebuffer));
@@ -36,13 +41,16 @@ namespace FlexEngine
     width = newWidth;
     height = newHeight;
 
+    // guard: only the size is tracked on the null backend
+    if (OpenGLRenderer::IsNullBackend()) return;
+
     // Create and bind framebuffer
     glGenFramebuffers(1, &framebuffer);
     glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
 
     // Create texture for color attachment
     glGenTextures(1, &colorAttachment);
-    glBindTexture(GL_TEXTURE_2D, colorAttachment);
+    OpenGLState::BindTexture(colorAttachment);
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -69,17 +77,27 @@ namespace FlexEngine
 
   void OpenGLFrameBuffer::Bind() const 
   {
+    if (OpenGLRenderer::IsNullBackend()) return;
     glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
     GET_OPENGL_ERROR()
   }
 
+  void OpenGLFrameBuffer::Unbind()
+  {
+    if (OpenGLRenderer::IsNullBackend()) return;
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    GET_OPENGL_ERROR()
+  }
+
   void OpenGLFrameBuffer::Resize(int newWidth, int newHeight) 
   {
     width = newWidth;
     height = newHeight;
 
+    if (OpenGLRenderer::IsNullBackend()) return;
+
     // Resize texture
-    glBindTexture(GL_TEXTURE_2D, colorAttachment);
+    OpenGLState::BindTexture(colorAttachment);
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
 
     // Resize renderbuffer
@@ -94,6 +112,8 @@ namespace FlexEngine
 
   void OpenGLFrameBuffer::Clear() const
   {
+    if (OpenGLRenderer::IsNullBackend()) return;
+
     Bind();
     glClearColor(0.1f, 0.2f, 0.3f, 1.0f); 
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
@@ -31,7 +31,7 @@ namespace FlexEngine
     void Bind() const;
 
     // Universal unbind to default framebuffer, with an additional check for failures during swap buffers.
-    static void Unbind() { glBindFramebuffer(GL_FRAMEBUFFER, 0); GET_OPENGL_ERROR() }
+    static void Unbind();
 
     // Resize the current framebuffer
     void Resize(int newWidth, int newHeight);
@@ -44,9 +44,9 @@ namespace FlexEngine
     int GetHeight() const { return height; }
 
   private:
-    GLuint framebuffer;
-    GLuint colorAttachment;
-    GLuint depthStencilAttachment;
-    int width, height;
+    GLuint framebuffer = 0;
+    GLuint colorAttachment = 0;
+    GLuint depthStencilAttachment = 0; // all 0 on the null backend
+    int width = 0, height = 0;
   };
 } // namespace FlexEngine
\ No newline at end of file
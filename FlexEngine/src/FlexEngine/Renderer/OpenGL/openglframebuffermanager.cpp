@@ -20,6 +20,7 @@ namespace FlexEngine
 {
     // Define static member variable.
     std::unordered_map<std::string, OpenGLFrameBuffer*> OpenGLFrameBufferManager::m_FrameBuffers;
+    std::vector<OpenGLFrameBuffer*> OpenGLFrameBufferManager::m_Handles;
 
     /*!************************************************************************
      * \brief Destructor that cleans up all dynamically allocated framebuffers.
@@ -32,6 +33,7 @@ namespace FlexEngine
             delete pair.second; // Delete each allocated framebuffer.
         }
         m_FrameBuffers.clear();
+        m_Handles.clear();
     }
 
     /*!************************************************************************
@@ -46,6 +48,7 @@ namespace FlexEngine
         OpenGLFrameBuffer* defaultFramebuffer = new OpenGLFrameBuffer();
         defaultFramebuffer->Init(1920, 1080); // Default size.
         m_FrameBuffers["default"] = defaultFramebuffer;
+        m_Handles.push_back(defaultFramebuffer);
         m_CurrentFrameBuffer = defaultFramebuffer;
     }
 
@@ -54,10 +57,43 @@ namespace FlexEngine
      * \param name The unique name identifier for the framebuffer.
      * \param screenDimensions The dimensions (width and height) for the framebuffer.
      *************************************************************************/
-    void OpenGLFrameBufferManager::AddFrameBuffer(const std::string& name, Vector2 screenDimensions)
+    OpenGLFrameBufferManager::Handle OpenGLFrameBufferManager::AddFrameBuffer(const std::string& name, Vector2 screenDimensions)
     {
         OpenGLFrameBuffer* newFB = new OpenGLFrameBuffer(static_cast<int>(screenDimensions.x), static_cast<int>(screenDimensions.y));
+
+        // Replace an existing framebuffer in place so that its handle stays valid.
+        Handle handle = GetHandle(name);
+        if (handle != InvalidHandle)
+        {
+            if (m_CurrentFrameBuffer == m_Handles[handle]) m_CurrentFrameBuffer = nullptr;
+            delete m_Handles[handle];
+            m_Handles[handle] = newFB;
+        }
+        else
+        {
+            handle = static_cast<Handle>(m_Handles.size());
+            m_Handles.push_back(newFB);
+        }
+
         m_FrameBuffers[name] = newFB;
+        return handle;
+    }
+
+    /*!************************************************************************
+     * \brief Retrieves the handle of a framebuffer by its name.
+     * \param name The unique name identifier for the framebuffer.
+     * \return The handle if found; otherwise, returns InvalidHandle.
+     *************************************************************************/
+    OpenGLFrameBufferManager::Handle OpenGLFrameBufferManager::GetHandle(const std::string& name) const
+    {
+        auto it = m_FrameBuffers.find(name);
+        if (it == m_FrameBuffers.end()) return InvalidHandle;
+
+        for (std::size_t i = 0; i < m_Handles.size(); ++i)
+        {
+            if (m_Handles[i] == it->second) return static_cast<Handle>(i);
+        }
+        return InvalidHandle;
     }
 
     /*!************************************************************************
@@ -75,13 +111,32 @@ namespace FlexEngine
         return nullptr; // Return null if the framebuffer doesn't exist.
     }
 
+    /*!************************************************************************
+     * \brief Retrieves a framebuffer by the handle AddFrameBuffer returned.
+     * \param handle The handle of the framebuffer.
+     * \return Pointer to the framebuffer if valid; otherwise, returns nullptr.
+     *************************************************************************/
+    OpenGLFrameBuffer* OpenGLFrameBufferManager::GetFrameBuffer(Handle handle)
+    {
+        return handle < m_Handles.size() ? m_Handles[handle] : nullptr;
+    }
+
     /*!************************************************************************
      * \brief Sets the current framebuffer by its name.
      * \param name The unique name identifier for the framebuffer to set as current.
      *************************************************************************/
     void OpenGLFrameBufferManager::SetCurrentFrameBuffer(const std::string& name)
     {
-        OpenGLFrameBuffer* framebuffer = GetFrameBuffer(name);
+        SetCurrentFrameBuffer(GetHandle(name));
+    }
+
+    /*!************************************************************************
+     * \brief Sets the current framebuffer by the handle AddFrameBuffer returned.
+     * \param handle The handle of the framebuffer to set as current.
+     *************************************************************************/
+    void OpenGLFrameBufferManager::SetCurrentFrameBuffer(Handle handle)
+    {
+        OpenGLFrameBuffer* framebuffer = GetFrameBuffer(handle);
         if (framebuffer)
         {
             m_CurrentFrameBuffer = framebuffer;
@@ -6,6 +6,10 @@
 // including initialization, addition, retrieval, setting the current framebuffer,
 // and resizing operations.
 //
+// Framebuffers can be looked up by name or by the handle AddFrameBuffer returns.
+// Code that switches framebuffers every pass should keep the handle, it is an
+// index instead of a string hash and compare.
+//
 // AUTHORS
 // [100%] Soh Wei Jie (weijie.soh\@digipen.edu)
 //   - Main Author
@@ -15,8 +19,10 @@
 
 #pragma once
 #include <glad/glad.h>
+#include <cstdint>
 #include <unordered_map>
 #include <string>
+#include <vector>
 #include "flx_api.h"
 #include "Renderer/OpenGL/opengldebugger.h"
 #include "Renderer/OpenGL/openglframebuffer.h"
@@ -28,9 +34,13 @@ namespace FlexEngine
     {
         // Stores references (or pointers) to existing framebuffers.
         static std::unordered_map<std::string, OpenGLFrameBuffer*> m_FrameBuffers;
+        static std::vector<OpenGLFrameBuffer*> m_Handles; // Indexed by Handle, same framebuffers as m_FrameBuffers.
         OpenGLFrameBuffer* m_CurrentFrameBuffer = nullptr; // Pointer to the currently active framebuffer.
 
     public:
+        using Handle = uint32_t;
+        static constexpr Handle InvalidHandle = ~0u;
+
         OpenGLFrameBufferManager() = default;
 
         /*!************************************************************************
@@ -47,8 +57,16 @@ namespace FlexEngine
          * \brief Adds a framebuffer to the manager with a specific name.
          * \param name The unique name identifier for the framebuffer.
          * \param screenDimensions The dimensions (width and height) for the framebuffer.
+         * \return Handle of the framebuffer. Adding an existing name replaces
+         *         the framebuffer but keeps its handle.
+         *************************************************************************/
+        Handle AddFrameBuffer(const std::string& name, Vector2 screenDimensions);
+
+        /*!************************************************************************
+         * \brief Retrieves the handle of a framebuffer by its name.
+         * \return InvalidHandle if the framebuffer doesn't exist.
          *************************************************************************/
-        void AddFrameBuffer(const std::string& name, Vector2 screenDimensions);
+        Handle GetHandle(const std::string& name) const;
 
         /*!************************************************************************
          * \brief Retrieves a framebuffer by its name.
@@ -56,12 +74,14 @@ namespace FlexEngine
          * \return Pointer to the framebuffer if found; otherwise, returns nullptr.
          *************************************************************************/
         OpenGLFrameBuffer* GetFrameBuffer(const std::string& name);
+        OpenGLFrameBuffer* GetFrameBuffer(Handle handle);
 
         /*!************************************************************************
          * \brief Sets the current framebuffer by its name.
          * \param name The unique name identifier for the framebuffer to set as current.
          *************************************************************************/
         void SetCurrentFrameBuffer(const std::string& name);
+        void SetCurrentFrameBuffer(Handle handle);
 
         /*!************************************************************************
          * \brief Retrieves the current active framebuffer.
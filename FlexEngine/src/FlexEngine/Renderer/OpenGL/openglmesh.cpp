@@ -10,6 +10,7 @@
 // Copyright (c) 2025 DigiPen, All rights reserved.
 
 #include "openglmesh.h"
+#include "openglrenderer.h" // OpenGLRenderer::IsNullBackend
 
 namespace FlexEngine
 {
@@ -77,6 +78,9 @@ namespace FlexEngine
     // 7. Unbind VAO to prevent further modification
     void Mesh::Internal_CreateBuffers()
     {
+      // guard: meshes keep their cpu data only on the null backend
+      if (OpenGLRenderer::IsNullBackend()) return;
+
       VAO.reset(VertexArray::Create());
       VAO->Bind();
 
@@ -0,0 +1,277 @@
+// WLVERSE [https://wlverse.web.app]
+// openglrecorder.cpp
+//
+// Fake OpenGL driver that counts calls instead of drawing.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#include "pch.h"
+
+#include "openglrecorder.h"
+#include "openglstate.h"
+
+#include <glad/glad.h>
+
+#include <cstring> // std::strcmp, std::strncmp
+
+namespace FlexEngine
+{
+
+  namespace
+  {
+    bool installed = false;
+
+    OpenGLRecorder::Counts current;
+    OpenGLRecorder::Counts last_frame;
+    OpenGLRecorder::Counts totals;
+    uint64_t frame_count = 0;
+
+    GLuint next_id = 1;
+    GLint next_location = 0;
+
+    void Add(OpenGLRecorder::Counts& to, const OpenGLRecorder::Counts& counts)
+    {
+      to.total += counts.total;
+      to.use_program += counts.use_program;
+      to.bind_texture += counts.bind_texture;
+      to.active_texture += counts.active_texture;
+      to.bind_vertex_array += counts.bind_vertex_array;
+      to.blend += counts.blend;
+      to.get_uniform_location += counts.get_uniform_location;
+      to.uniform += counts.uniform;
+      to.draw += counts.draw;
+    }
+
+    #pragma region Stubs
+
+    const GLubyte* APIENTRY Stub_GetString(GLenum name)
+    {
+      current.total++;
+      // glad reads the version to decide which functions to load
+      return reinterpret_cast<const GLubyte*>(name == GL_VERSION ? "4.6 OpenGLRecorder" : "OpenGLRecorder");
+    }
+
+    const GLubyte* APIENTRY Stub_GetStringi(GLenum, GLuint)
+    {
+      current.total++;
+      return reinterpret_cast<const GLubyte*>("GL_FLX_opengl_recorder");
+    }
+
+    void APIENTRY Stub_GetIntegerv(GLenum pname, GLint* data)
+    {
+      current.total++;
+      // glad fails to load without at least one extension
+      *data = (pname == GL_NUM_EXTENSIONS) ? 1 : 0;
+    }
+
+    void APIENTRY Stub_Gen(GLsizei n, GLuint* ids)
+    {
+      current.total++;
+      for (GLsizei i = 0; i < n; i++) ids[i] = next_id++;
+    }
+
+    GLuint APIENTRY Stub_CreateShader(GLenum)
+    {
+      current.total++;
+      return next_id++;
+    }
+
+    GLuint APIENTRY Stub_CreateProgram()
+    {
+      current.total++;
+      return next_id++;
+    }
+
+    void APIENTRY Stub_GetShaderiv(GLuint, GLenum pname, GLint* params)
+    {
+      current.total++;
+      *params = (pname == GL_COMPILE_STATUS) ? GL_TRUE : 0;
+    }
+
+    void APIENTRY Stub_GetProgramiv(GLuint, GLenum pname, GLint* params)
+    {
+      current.total++;
+      *params = (pname == GL_LINK_STATUS || pname == GL_VALIDATE_STATUS) ? GL_TRUE : 0;
+    }
+
+    GLenum APIENTRY Stub_CheckFramebufferStatus(GLenum)
+    {
+      current.total++;
+      return GL_FRAMEBUFFER_COMPLETE;
+    }
+
+    GLint APIENTRY Stub_GetUniformLocation(GLuint, const GLchar*)
+    {
+      current.total++;
+      current.get_uniform_location++;
+      return next_location++;
+    }
+
+    void APIENTRY Stub_UseProgram(GLuint)
+    {
+      current.total++;
+      current.use_program++;
+    }
+
+    void APIENTRY Stub_BindTexture(GLenum, GLuint)
+    {
+      current.total++;
+      current.bind_texture++;
+    }
+
+    void APIENTRY Stub_ActiveTexture(GLenum)
+    {
+      current.total++;
+      current.active_texture++;
+    }
+
+    void APIENTRY Stub_BindVertexArray(GLuint)
+    {
+      current.total++;
+      current.bind_vertex_array++;
+    }
+
+    void APIENTRY Stub_EnableDisable(GLenum cap)
+    {
+      current.total++;
+      if (cap == GL_BLEND) current.blend++;
+    }
+
+    void APIENTRY Stub_BlendFunc(GLenum, GLenum)
+    {
+      current.total++;
+      current.blend++;
+    }
+
+    void APIENTRY Stub_Draw()
+    {
+      current.total++;
+      current.draw++;
+    }
+
+    void APIENTRY Stub_Uniform()
+    {
+      current.total++;
+      current.uniform++;
+    }
+
+    std::uintptr_t APIENTRY Stub_Other()
+    {
+      current.total++;
+      return 0;
+    }
+
+    #pragma endregion
+
+    struct Stub
+    {
+      const char* name;
+      void* function;
+    };
+
+    #define FLX_RECORDER_STUB(NAME, FUNCTION) { NAME, reinterpret_cast<void*>(&FUNCTION) }
+
+    const Stub stubs[] = {
+      FLX_RECORDER_STUB("glGetString", Stub_GetString),
+      FLX_RECORDER_STUB("glGetStringi", Stub_GetStringi),
+      FLX_RECORDER_STUB("glGetIntegerv", Stub_GetIntegerv),
+      FLX_RECORDER_STUB("glGenBuffers", Stub_Gen),
+      FLX_RECORDER_STUB("glGenVertexArrays", Stub_Gen),
+      FLX_RECORDER_STUB("glGenTextures", Stub_Gen),
+      FLX_RECORDER_STUB("glGenFramebuffers", Stub_Gen),
+      FLX_RECORDER_STUB("glGenRenderbuffers", Stub_Gen),
+      FLX_RECORDER_STUB("glCreateShader", Stub_CreateShader),
+      FLX_RECORDER_STUB("glCreateProgram", Stub_CreateProgram),
+      FLX_RECORDER_STUB("glGetShaderiv", Stub_GetShaderiv),
+      FLX_RECORDER_STUB("glGetProgramiv", Stub_GetProgramiv),
+      FLX_RECORDER_STUB("glCheckFramebufferStatus", Stub_CheckFramebufferStatus),
+      FLX_RECORDER_STUB("glGetUniformLocation", Stub_GetUniformLocation),
+      FLX_RECORDER_STUB("glUseProgram", Stub_UseProgram),
+      FLX_RECORDER_STUB("glBindTexture", Stub_BindTexture),
+      FLX_RECORDER_STUB("glActiveTexture", Stub_ActiveTexture),
+      FLX_RECORDER_STUB("glBindVertexArray", Stub_BindVertexArray),
+      FLX_RECORDER_STUB("glEnable", Stub_EnableDisable),
+      FLX_RECORDER_STUB("glDisable", Stub_EnableDisable),
+      FLX_RECORDER_STUB("glBlendFunc", Stub_BlendFunc),
+      FLX_RECORDER_STUB("glDrawArrays", Stub_Draw),
+      FLX_RECORDER_STUB("glDrawElements", Stub_Draw),
+      FLX_RECORDER_STUB("glDrawArraysInstanced", Stub_Draw),
+      FLX_RECORDER_STUB("glDrawElementsInstanced", Stub_Draw),
+    };
+
+    #undef FLX_RECORDER_STUB
+
+    void* Load(const char* name)
+    {
+      for (const Stub& stub : stubs)
+      {
+        if (std::strcmp(stub.name, name) == 0) return stub.function;
+      }
+
+      if (std::strncmp(name, "glUniform", 9) == 0) return reinterpret_cast<void*>(&Stub_Uniform);
+      return reinterpret_cast<void*>(&Stub_Other);
+    }
+  }
+
+  bool OpenGLRecorder::Install()
+  {
+    FLX_FLOW_FUNCTION();
+
+    #if defined(_WIN32) && !defined(_WIN64)
+    Log::Error("The OpenGL recorder needs a 64-bit build, its stubs ignore their stdcall arguments.");
+    return false;
+    #else
+    if (!gladLoadGLLoader(&Load))
+    {
+      Log::Error("The OpenGL recorder could not be loaded by glad.");
+      return false;
+    }
+
+    installed = true;
+    current = last_frame = totals = {};
+    frame_count = 0;
+
+    // whatever the cache remembers belongs to the previous driver
+    OpenGLState::Invalidate();
+    return true;
+    #endif
+  }
+
+  bool OpenGLRecorder::IsInstalled()
+  {
+    return installed;
+  }
+
+  void OpenGLRecorder::NewFrame()
+  {
+    Add(totals, current);
+    last_frame = current;
+    current = {};
+    frame_count++;
+  }
+
+  const OpenGLRecorder::Counts& OpenGLRecorder::GetCounts()
+  {
+    return current;
+  }
+
+  const OpenGLRecorder::Counts& OpenGLRecorder::GetCountsLastFrame()
+  {
+    return last_frame;
+  }
+
+  const OpenGLRecorder::Counts& OpenGLRecorder::GetTotalCounts()
+  {
+    return totals;
+  }
+
+  uint64_t OpenGLRecorder::GetFrameCount()
+  {
+    return frame_count;
+  }
+
+}
@@ -0,0 +1,69 @@
+// WLVERSE [https://wlverse.web.app]
+// openglrecorder.h
+//
+// Fake OpenGL driver that counts calls instead of drawing.
+//
+// Install loads every glad function pointer with a stub, so the renderer runs
+// its normal (non-null) path without a GPU or context. The calls that matter
+// for state changes (programs, textures, vertex arrays, blending, uniform
+// lookups and draws) are counted by name, everything else is only counted in
+// the total. Used by headless --record-gl runs and the unit tests to check
+// that the state cache and uniform table actually remove calls.
+//
+// Object ids are handed out from a counter, status queries succeed and every
+// other query returns 0.
+//
+// The stubs ignore their arguments, which is only safe when the caller cleans
+// up the stack, so the recorder refuses to install on 32-bit Windows (stdcall).
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#pragma once
+
+#include "flx_api.h"
+
+#include <cstdint> // uint64_t
+
+namespace FlexEngine
+{
+
+  class __FLX_API OpenGLRecorder
+  {
+  public:
+    // static class
+    OpenGLRecorder() = delete;
+    OpenGLRecorder(const OpenGLRecorder&) = delete;
+    OpenGLRecorder& operator=(const OpenGLRecorder&) = delete;
+
+    struct __FLX_API Counts
+    {
+      uint64_t total = 0; // every call, including the ones below
+      uint64_t use_program = 0;
+      uint64_t bind_texture = 0;
+      uint64_t active_texture = 0;
+      uint64_t bind_vertex_array = 0;
+      uint64_t blend = 0; // glEnable/glDisable(GL_BLEND) and glBlendFunc
+      uint64_t get_uniform_location = 0;
+      uint64_t uniform = 0; // glUniform*
+      uint64_t draw = 0;
+    };
+
+    // Replaces the glad function pointers with the recording stubs and resets the counts.
+    // Returns false and logs the reason if the platform is not supported.
+    static bool Install();
+    static bool IsInstalled();
+
+    // Ends the current frame, its counts become the last frame's and are added to the totals.
+    static void NewFrame();
+
+    static const Counts& GetCounts(); // current frame so far
+    static const Counts& GetCountsLastFrame();
+    static const Counts& GetTotalCounts(); // every finished frame
+    static uint64_t GetFrameCount();
+  };
+
+}
@@ -12,7 +12,7 @@
 // - Renderer2DProps: Contains transformation, shader, asset, and color data
 //   for rendering 2D textures.
 // - Renderer2DText: Encapsulates text rendering parameters including shader,
-//   font type, alignment, and transformation settings.
+//   font type, alignment, transformation settings and the typewriter reveal.
 // - Renderer2DSpriteBatch: Holds batch data for rendering multiple sprite
 //   instances with transformations and per-instance opacity.
 //
@@ -28,13 +28,18 @@
 /////////////////////////////////////////////////////////////////////////////
 
 #include "openglrenderer.h"
+#include "openglstate.h"
 
 #include "assetmanager.h" // FLX_ASSET_GET
 #include "DataStructures/freequeue.h"
-#include "FlexEngine/flexprefs.h"
+#include "FlexEngine/settings.h"
 #include "FlexEngine/FlexMath/quaternion.h"
 
 #include "window.h"
+
+#include <algorithm>
+#include <unordered_map>
+
 namespace FlexEngine
 {
 
@@ -44,6 +49,108 @@ namespace FlexEngine
   uint32_t OpenGLRenderer::m_maxInstances = 3000; //Should be more than enough
   bool OpenGLRenderer::m_depth_test = false;
   bool OpenGLRenderer::m_blending = false;
+  bool OpenGLRenderer::m_null_backend = false;
+
+  void OpenGLRenderer::SetNullBackend(bool enabled)
+  {
+    m_null_backend = enabled;
+  }
+
+  bool OpenGLRenderer::IsNullBackend()
+  {
+    return m_null_backend;
+  }
+
+  #pragma region Text Layout
+
+  namespace
+  {
+    // A glyph placed by the text layout, glyph is the index of its character in the text
+    struct PlacedGlyph
+    {
+      char c;
+      int glyph;
+      Vector2 position;
+    };
+
+    // A line of the instanced text layout, first_glyph is the index of its first character in the text
+    struct LaidOutLine
+    {
+      std::string text;
+      float width;
+      int first_glyph;
+    };
+
+    // Everything besides the text that a layout depends on
+    struct TextLayoutParams
+    {
+      const Asset::Font* font;
+      float letterspacing;
+      float linespacing;
+      Vector2 textbox;
+      std::pair<Renderer2DText::AlignmentX, Renderer2DText::AlignmentY> alignment;
+
+      bool operator==(const TextLayoutParams& other) const
+      {
+        return font == other.font && letterspacing == other.letterspacing && linespacing == other.linespacing &&
+               textbox.x == other.textbox.x && textbox.y == other.textbox.y && alignment == other.alignment;
+      }
+    };
+
+    // Layouts are cached by their text, so text that is revealed glyph by glyph
+    // is laid out once instead of every frame.
+    template <typename Layout>
+    class TextLayoutCache
+    {
+    public:
+      // Returns the layout of the text, build fills it in the first time
+      template <typename Build>
+      const Layout& Get(const Renderer2DText& text, const Asset::Font& font, Build build)
+      {
+        TextLayoutParams params{ &font, text.m_letterspacing, text.m_linespacing, text.m_textboxDimensions, text.m_alignment };
+
+        auto it = m_layouts.find(text.m_words);
+        if (it != m_layouts.end())
+        {
+          for (auto& [entry_params, layout] : it->second)
+          {
+            if (entry_params == params) return layout;
+          }
+        }
+
+        // text that changes every frame, e.g. counters, would grow the cache forever
+        if (m_count >= MAX_LAYOUTS)
+        {
+          m_layouts.clear();
+          m_count = 0;
+          it = m_layouts.end();
+        }
+
+        if (it == m_layouts.end()) it = m_layouts.emplace(text.m_words, std::vector<std::pair<TextLayoutParams, Layout>>()).first;
+        auto& entry = it->second.emplace_back(params, Layout());
+        ++m_count;
+
+        build(entry.second);
+        return entry.second;
+      }
+
+    private:
+      static constexpr std::size_t MAX_LAYOUTS = 256;
+
+      std::unordered_map<std::string, std::vector<std::pair<TextLayoutParams, Layout>>> m_layouts;
+      std::size_t m_count = 0;
+    };
+  }
+
+  // freetypetext_GPU.vert does the same per instance
+  float Renderer2DText::GetGlyphAlpha(int glyph) const
+  {
+    if (m_visible_glyphs < 0.0f) return 1.0f;
+    if (m_glyph_fade <= 0.0f) return m_visible_glyphs >= glyph + 1 ? 1.0f : 0.0f;
+    return std::clamp((m_visible_glyphs - glyph) / m_glyph_fade, 0.0f, 1.0f);
+  }
+
+  #pragma endregion
 
   uint32_t OpenGLRenderer::GetDrawCalls()
   {
@@ -63,12 +170,14 @@ namespace FlexEngine
   void OpenGLRenderer::EnableDepthTest()
   {
     m_depth_test = true;
+    if (m_null_backend) return;
     glEnable(GL_DEPTH_TEST);
   }
 
   void OpenGLRenderer::DisableDepthTest()
   {
     m_depth_test = false;
+    if (m_null_backend) return;
     glDisable(GL_DEPTH_TEST);
   }
 
@@ -80,30 +189,36 @@ namespace FlexEngine
   void OpenGLRenderer::EnableBlending()
   {
     m_blending = true;
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    if (m_null_backend) return;
+    OpenGLState::SetBlending(true);
+    OpenGLState::SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
   }
 
   void OpenGLRenderer::DisableBlending()
   {
     m_blending = false;
-    glDisable(GL_BLEND);
+    if (m_null_backend) return;
+    OpenGLState::SetBlending(false);
   }
 
   void OpenGLRenderer::ClearFrameBuffer()
   {
+    if (m_null_backend) return;
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
   }
 
   void OpenGLRenderer::ClearColor(const Vector4& color)
   {
-    glClearColor(color.x, color.y, color.z, color.w);
     m_draw_calls_last_frame = m_draw_calls;
     m_draw_calls = 0;
+
+    if (m_null_backend) return;
+    glClearColor(color.x, color.y, color.z, color.w);
   }
 
   void OpenGLRenderer::Draw(GLsizei size)
   {
+    if (m_null_backend) return;
     glDrawElements(GL_TRIANGLES, size, GL_UNSIGNED_INT, nullptr);
     m_draw_calls++;
   }
@@ -118,6 +233,8 @@ namespace FlexEngine
 
   void OpenGLRenderer::DrawTexture2D(const GLuint& texture, const Matrix4x4& transform, const Vector2& screenDimensions)
   {
+      if (m_null_backend) return;
+
       #pragma region VAO setup
       // unit square
       static const float vertices[] = {
@@ -137,7 +254,7 @@ namespace FlexEngine
           glGenVertexArrays(1, &vao);
           glGenBuffers(1, &vbo);
 
-          glBindVertexArray(vao);
+          OpenGLState::BindVertexArray(vao);
           glBindBuffer(GL_ARRAY_BUFFER, vbo);
           glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
@@ -145,14 +262,14 @@ namespace FlexEngine
           glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
           glEnableVertexAttribArray(1);
           glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
-          glBindVertexArray(0);
+          OpenGLState::BindVertexArray(0);
 
           // free in freequeue
           FreeQueue::Push(
             [=]()
           {
               glDeleteBuffers(1, &vbo);
-              glDeleteVertexArrays(1, &vao);
+              OpenGLState::DeleteVertexArrays(1, &vao);
           }
           );
       }
@@ -161,14 +278,13 @@ namespace FlexEngine
       if (vao == 0) return; // hey, might need to check if scale is 0 because thats what the old code does idk
 
       // bind all
-      glBindVertexArray(vao);
+      OpenGLState::BindVertexArray(vao);
       #pragma endregion
 
       auto& asset_shader = AssetManager::Get<Asset::Shader>(R"(/shaders/texture.flxshader)");
       asset_shader.Use();
 
-      glActiveTexture(GL_TEXTURE0);
-      glBindTexture(GL_TEXTURE_2D, texture);
+      OpenGLState::BindTexture(texture, 0);
 
       asset_shader.SetUniform_bool("u_use_texture", true);
       asset_shader.SetUniform_int("u_texture", 0);
@@ -193,12 +309,14 @@ namespace FlexEngine
           Log::Fatal("OpenGL Error: " + std::to_string(error));
       }
 
-      glBindVertexArray(0);
+      OpenGLState::BindVertexArray(0);
   }
 
  
   void OpenGLRenderer::DrawTexture2D(const Renderer2DProps& props, const Camera& cameraData)
   {
+    if (m_null_backend) return;
+
     // unit square
     static const float vertices[] = {
       // Position           // TexCoords
@@ -217,7 +335,7 @@ namespace FlexEngine
       glGenVertexArrays(1, &vao);
       glGenBuffers(1, &vbo);
 
-      glBindVertexArray(vao);
+      OpenGLState::BindVertexArray(vao);
       glBindBuffer(GL_ARRAY_BUFFER, vbo);
       glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
@@ -227,14 +345,14 @@ namespace FlexEngine
       //glEnableVertexAttribArray(1);
       //glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
 
-      glBindVertexArray(0);
+      OpenGLState::BindVertexArray(0);
 
       // free in freequeue
       FreeQueue::Push(
         [=]()
         {
           glDeleteBuffers(1, &vbo);
-          glDeleteVertexArrays(1, &vao);
+          OpenGLState::DeleteVertexArrays(1, &vao);
         }
       );
     }
@@ -276,14 +394,14 @@ namespace FlexEngine
 
     glGenBuffers(1, &vbo_uv);
 
-    glBindVertexArray(vao);
+    OpenGLState::BindVertexArray(vao);
     glBindBuffer(GL_ARRAY_BUFFER, vbo_uv);
     glBufferData(GL_ARRAY_BUFFER, sizeof(tex_coords), tex_coords, GL_STATIC_DRAW);
 
     glEnableVertexAttribArray(1);
     glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
 
-    glBindVertexArray(0);
+    OpenGLState::BindVertexArray(0);
 
     // free in freequeue
     FreeQueue::Push(
@@ -296,7 +414,7 @@ namespace FlexEngine
 
 
     // bind all
-    glBindVertexArray(vao);
+    OpenGLState::BindVertexArray(vao);
 
     auto& asset_shader = AssetManager::Get<Asset::Shader>(props.shader);
     asset_shader.Use();
@@ -319,7 +437,7 @@ namespace FlexEngine
       {
         asset_shader.SetUniform_bool("u_use_texture", true);
         auto& asset_spritesheet = FLX_ASSET_GET(Asset::Spritesheet, props.asset);
-        auto& asset_texture = FLX_ASSET_GET(Asset::Texture, asset_spritesheet.texture);
+        auto& asset_texture = AssetManager::Get(asset_spritesheet.texture_asset, asset_spritesheet.texture);
         asset_texture.Bind(asset_shader, "u_texture", 0);
       }
     }
@@ -366,7 +484,7 @@ namespace FlexEngine
       Log::Fatal("OpenGL Error: " + std::to_string(error));
     }
 
-    glBindVertexArray(0);
+    OpenGLState::BindVertexArray(0);
 
     // free
     FreeQueue::RemoveAndExecute("Free UV buffer");
@@ -381,6 +499,8 @@ namespace FlexEngine
  *****************************************************************************/
   void OpenGLRenderer::DrawBatchTexture2D(const Renderer2DProps& props, const Renderer2DSpriteBatch& data, const Camera& cameraData)
   {
+      if (m_null_backend) return;
+
       // unit square
       static const float vertices[] = {
           // Position           // TexCoords
@@ -400,7 +520,7 @@ namespace FlexEngine
           glGenVertexArrays(1, &vao);
           glGenBuffers(1, &vbo);
 
-          glBindVertexArray(vao);
+          OpenGLState::BindVertexArray(vao);
           glBindBuffer(GL_ARRAY_BUFFER, vbo);
           glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
@@ -409,14 +529,14 @@ namespace FlexEngine
           glEnableVertexAttribArray(1);
           glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
 
-          glBindVertexArray(0);
+          OpenGLState::BindVertexArray(0);
 
           // free in freequeue
           FreeQueue::Push(
             [=]()
           {
               glDeleteBuffers(1, &vbo);
-              glDeleteVertexArrays(1, &vao);
+              OpenGLState::DeleteVertexArrays(1, &vao);
           }
           );
       }
@@ -484,7 +604,7 @@ namespace FlexEngine
       GLsizei dataSize = (GLsizei)data.m_transformationData.size();
 
       // Bind all
-      glBindVertexArray(vao);
+      OpenGLState::BindVertexArray(vao);
 
       // Apply Shader
       auto& asset_shader = AssetManager::Get<Asset::Shader>(data.m_shader);
@@ -505,7 +625,7 @@ namespace FlexEngine
           {
               asset_shader.SetUniform_bool("u_use_texture", true);
               auto& asset_spritesheet = FLX_ASSET_GET(Asset::Spritesheet, props.asset);
-              auto& asset_texture = FLX_ASSET_GET(Asset::Texture, asset_spritesheet.texture);
+              auto& asset_texture = AssetManager::Get(asset_spritesheet.texture_asset, asset_spritesheet.texture);
               asset_texture.Bind(asset_shader, "u_texture", 0);
           }
       }
@@ -539,7 +659,7 @@ namespace FlexEngine
           Log::Fatal("OpenGL Error: " + std::to_string(error));
       }
 
-      glBindVertexArray(0);
+      OpenGLState::BindVertexArray(0);
   }
 
   void OpenGLRenderer::DrawSimpleTexture2D(
@@ -550,6 +670,8 @@ namespace FlexEngine
     Renderer2DProps::Alignment alignment
   )
   {
+      if (m_null_backend) return;
+
       // unit square
       static const float vertices[] = {
           // Position           // TexCoords
@@ -568,7 +690,7 @@ namespace FlexEngine
           glGenVertexArrays(1, &vao);
           glGenBuffers(1, &vbo);
 
-          glBindVertexArray(vao);
+          OpenGLState::BindVertexArray(vao);
           glBindBuffer(GL_ARRAY_BUFFER, vbo);
           glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
@@ -577,14 +699,14 @@ namespace FlexEngine
           glEnableVertexAttribArray(1);
           glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
 
-          glBindVertexArray(0);
+          OpenGLState::BindVertexArray(0);
 
           // free in freequeue
           FreeQueue::Push(
             [=]()
           {
               glDeleteBuffers(1, &vbo);
-              glDeleteVertexArrays(1, &vao);
+              OpenGLState::DeleteVertexArrays(1, &vao);
           }
           );
       }
@@ -593,7 +715,7 @@ namespace FlexEngine
       if (vao == 0 || scale == Vector2::Zero) return;
 
       // bind all
-      glBindVertexArray(vao);
+      OpenGLState::BindVertexArray(vao);
 
       // jank optimization to run once
       static Asset::Shader texture_shader;
@@ -637,7 +759,7 @@ namespace FlexEngine
       glDrawArrays(GL_TRIANGLES, 0, 6);
       m_draw_calls++;
 
-      glBindVertexArray(0);
+      OpenGLState::BindVertexArray(0);
   }
   #pragma endregion
 
@@ -645,8 +767,10 @@ namespace FlexEngine
 
   void OpenGLRenderer::DrawTexture2D(Camera const& cam, const Renderer2DText& text)
   {
+      if (m_null_backend) return;
+
       // Enable both to activate string render
-      if (!FlexPrefs::GetBool("game.batching") || !FlexPrefs::GetBool("editor.batching"))
+      if (!EngineSettings::game_batching.Get() || !EngineSettings::editor_batching.Get())
       {
           if (!CameraManager::has_main_camera) return;
 
@@ -657,7 +781,7 @@ namespace FlexEngine
               // Configure VAO/VBO for text quads
               glGenVertexArrays(1, &vao);
               glGenBuffers(1, &vbo);
-              glBindVertexArray(vao);
+              OpenGLState::BindVertexArray(vao);
               glBindBuffer(GL_ARRAY_BUFFER, vbo);
               glBufferData(GL_ARRAY_BUFFER, sizeof(float) * 6 * 4, NULL, GL_DYNAMIC_DRAW); // 6 vertices per quad
 
@@ -665,12 +789,12 @@ namespace FlexEngine
               glEnableVertexAttribArray(0);
               glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(float), 0);
               glBindBuffer(GL_ARRAY_BUFFER, 0);
-              glBindVertexArray(0);
+              OpenGLState::BindVertexArray(0);
 
               FreeQueue::Push(
                 [=]()
               {
-                  glDeleteVertexArrays(1, &vao);
+                  OpenGLState::DeleteVertexArrays(1, &vao);
                   glDeleteBuffers(1, &vbo);
               }
               );
@@ -692,14 +816,13 @@ namespace FlexEngine
           asset_shader.SetUniform_mat4("u_model", text.m_transform);
           asset_shader.SetUniform_mat4("projection", cam.GetProjViewMatrix());
 
-          glActiveTexture(GL_TEXTURE0);
-          glBindVertexArray(vao);
+          OpenGLState::BindVertexArray(vao);
           auto& asset_font = FLX_ASSET_GET(Asset::Font, text.m_fonttype);
 
           // Lambda to render a single glyph
           auto renderGlyph = [&](const Asset::Glyph& glyph, const Vector3& position)
           {
-              glBindTexture(GL_TEXTURE_2D, glyph.textureID);
+              OpenGLState::BindTexture(glyph.textureID);
 
               float xpos = position.x + glyph.bearing.x;
               float ypos = position.y - (glyph.bearing.y - glyph.size.y);
@@ -788,110 +911,149 @@ namespace FlexEngine
           };
 
           // Lambda to categorize and process words
-          auto splitIntoWords = [&](const std::string& input) -> std::vector<std::string>
+          // Each word is stored with the index of its first character in the text
+          auto splitIntoWords = [&](const std::string& input) -> std::vector<std::pair<std::string, int>>
           {
-              std::vector<std::string> words;
+              std::vector<std::pair<std::string, int>> words;
               std::string currentWord;
-              for (char c : input)
+              int wordStart = 0;
+              for (int i = 0; i < static_cast<int>(input.size()); ++i)
               {
+                  char c = input[i];
                   if (c == ' ' || c == '\n')
                   {
                       if (!currentWord.empty())
                       {
-                          words.push_back(currentWord);
+                          words.push_back({ currentWord, wordStart });
                           currentWord.clear();
                       }
                       if (c == '\n')
-                          words.push_back("\n"); // Explicit newline
+                          words.push_back({ "\n", i }); // Explicit newline
                   }
                   else
+                  {
+                      if (currentWord.empty()) wordStart = i;
                       currentWord += c;
+                  }
               }
               if (!currentWord.empty())
-                  words.push_back(currentWord);
+                  words.push_back({ currentWord, wordStart });
 
               return words;
           };
 
           // Refactored logic -> Primitive Text Scrolling
-          auto words = splitIntoWords(text.m_words);
-          Vector2 pen_pos = getAlignmentOffset(text.m_alignment, text.m_words); // Initial alignment offset
-          float lineWidth = 0.0f, totalHeight = 0.0f, maxLineHeight = 0.0f;
-          const Asset::Glyph& space = asset_font.GetGlyph(' ');
-          std::string currentLine;
-
-          auto renderLine = [&](const std::string& line)
+          // Places every glyph of the text, the result is cached while the text stays the same
+          auto layoutGlyphs = [&](std::vector<PlacedGlyph>& placed)
           {
-              pen_pos.x = getAlignmentOffset(text.m_alignment, line).x;
-              for (char c : line)
+              auto words = splitIntoWords(text.m_words);
+              Vector2 pen_pos = getAlignmentOffset(text.m_alignment, text.m_words); // Initial alignment offset
+              float lineWidth = 0.0f, totalHeight = 0.0f, maxLineHeight = 0.0f;
+              const Asset::Glyph& space = asset_font.GetGlyph(' ');
+              std::string currentLine;
+              std::vector<int> currentGlyphs; // index in the text of every character of the current line
+
+              auto placeLine = [&](const std::string& line)
               {
-                  const Asset::Glyph& glyph = asset_font.GetGlyph(c);
-                  renderGlyph(glyph, pen_pos);
-                  pen_pos.x += glyph.advance + text.m_letterspacing;
-              }
-          };
+                  pen_pos.x = getAlignmentOffset(text.m_alignment, line).x;
+                  for (std::size_t i = 0; i < line.size(); ++i)
+                  {
+                      const Asset::Glyph& glyph = asset_font.GetGlyph(line[i]);
+                      placed.push_back({ line[i], currentGlyphs[i], pen_pos });
+                      pen_pos.x += glyph.advance + text.m_letterspacing;
+                  }
+              };
 
-          for (const auto& word : words)
-          {
-              if (word == "\n") // Handle explicit line break
+              for (const auto& [word, wordStart] : words)
               {
-                  renderLine(currentLine);
+                  if (word == "\n") // Handle explicit line break
+                  {
+                      placeLine(currentLine);
 
-                  // Move to the next line
-                  pen_pos.y += maxLineHeight + text.m_linespacing;
-                  lineWidth = 0.0f;
-                  maxLineHeight = 0.0f;
-                  currentLine.clear();
-                  continue;
-              }
+                      // Move to the next line
+                      pen_pos.y += maxLineHeight + text.m_linespacing;
+                      lineWidth = 0.0f;
+                      maxLineHeight = 0.0f;
+                      currentLine.clear();
+                      currentGlyphs.clear();
+                      continue;
+                  }
 
-              float wordWidth = 0.0f;
-              float wordHeight = 0.0f;
-              for (char c : word)
-              {
-                  const Asset::Glyph& glyph = asset_font.GetGlyph(c);
-                  wordWidth += glyph.advance + text.m_letterspacing;
-                  wordHeight = std::max(wordHeight, glyph.size.y);
-              }
+                  float wordWidth = 0.0f;
+                  float wordHeight = 0.0f;
+                  for (char c : word)
+                  {
+                      const Asset::Glyph& glyph = asset_font.GetGlyph(c);
+                      wordWidth += glyph.advance + text.m_letterspacing;
+                      wordHeight = std::max(wordHeight, glyph.size.y);
+                  }
 
-              // Check if the word fits in the current line
-              if (lineWidth + wordWidth > text.m_textboxDimensions.x)
-              {
-                  renderLine(currentLine);
+                  // Check if the word fits in the current line
+                  if (lineWidth + wordWidth > text.m_textboxDimensions.x)
+                  {
+                      placeLine(currentLine);
 
-                  // Move to the next line
-                  pen_pos.y += maxLineHeight + text.m_linespacing;
-                  totalHeight += maxLineHeight + text.m_linespacing;
-                  lineWidth = 0.0f;
-                  maxLineHeight = 0.0f;
+                      // Move to the next line
+                      pen_pos.y += maxLineHeight + text.m_linespacing;
+                      totalHeight += maxLineHeight + text.m_linespacing;
+                      lineWidth = 0.0f;
+                      maxLineHeight = 0.0f;
 
-                  // Stop rendering if vertical overflow occurs
-                  if (totalHeight + wordHeight > text.m_textboxDimensions.y)
+                      // Stop rendering if vertical overflow occurs
+                      if (totalHeight + wordHeight > text.m_textboxDimensions.y)
+                      {
+                          currentLine.clear();
+                          currentGlyphs.clear();
+                          break;
+                      }
+
+                      // Start a new line
+                      currentLine = word;
+                      currentGlyphs.clear();
+                      for (int i = 0; i < static_cast<int>(word.size()); ++i) currentGlyphs.push_back(wordStart + i);
+                      lineWidth = wordWidth;
+                      maxLineHeight = wordHeight;
+                  }
+                  else // Add the word & space to the current line 
                   {
-                      currentLine.clear();
-                      break;
+                      if (!currentLine.empty())
+                      {
+                          currentLine += " ";
+                          currentGlyphs.push_back(wordStart - 1);
+                      }
+                      currentLine += word;
+                      for (int i = 0; i < static_cast<int>(word.size()); ++i) currentGlyphs.push_back(wordStart + i);
+                      lineWidth += wordWidth + space.advance + text.m_letterspacing;
+                      maxLineHeight = std::max(maxLineHeight, wordHeight);
                   }
-
-                  // Start a new line
-                  currentLine = word;
-                  lineWidth = wordWidth;
-                  maxLineHeight = wordHeight;
               }
-              else // Add the word & space to the current line 
+
+              // Place the last line
+              if (!currentLine.empty()) placeLine(currentLine);
+          };
+
+          static TextLayoutCache<std::vector<PlacedGlyph>> layouts;
+          const std::vector<PlacedGlyph>& glyphs = layouts.Get(text, asset_font, layoutGlyphs);
+
+          // Typewriter reveal, the glyphs are placed in the order of the text
+          float alpha = 1.0f;
+          asset_shader.SetUniform_float("u_alpha", alpha);
+          for (const PlacedGlyph& placed : glyphs)
+          {
+              float glyph_alpha = text.GetGlyphAlpha(placed.glyph);
+              if (glyph_alpha <= 0.0f) break;
+
+              if (glyph_alpha != alpha)
               {
-                  if (!currentLine.empty()) currentLine += " ";
-                  currentLine += word;
-                  lineWidth += wordWidth + space.advance + text.m_letterspacing;
-                  maxLineHeight = std::max(maxLineHeight, wordHeight);
+                  alpha = glyph_alpha;
+                  asset_shader.SetUniform_float("u_alpha", alpha);
               }
+              renderGlyph(asset_font.GetGlyph(placed.c), placed.position);
           }
 
-          // Render the last line
-          if (!currentLine.empty()) renderLine(currentLine);
-
           // Cleanup
-          glBindVertexArray(0);
-          glBindTexture(GL_TEXTURE_2D, 0);
+          OpenGLState::BindVertexArray(0);
+          OpenGLState::BindTexture(0);
       }
       else
       {
@@ -927,19 +1089,19 @@ namespace FlexEngine
 
               glGenVertexArrays(1, &vao);
               glGenBuffers(1, &vbo);
-              glBindVertexArray(vao);
+              OpenGLState::BindVertexArray(vao);
               glBindBuffer(GL_ARRAY_BUFFER, vbo);
               glBufferData(GL_ARRAY_BUFFER, sizeof(quadVertices), quadVertices, GL_STATIC_DRAW);
               glEnableVertexAttribArray(0);
               glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
               glBindBuffer(GL_ARRAY_BUFFER, 0);
-              glBindVertexArray(0);
+              OpenGLState::BindVertexArray(0);
               initialized = true;
 
               // Push a free callback to delete vao/vbo on shutdown.
               FreeQueue::Push([=]()
               {
-                  glDeleteVertexArrays(1, &vao);
+                  OpenGLState::DeleteVertexArrays(1, &vao);
                   glDeleteBuffers(1, &vbo);
               });
           }
@@ -953,8 +1115,7 @@ namespace FlexEngine
 
           // --- Bind the atlas texture (which holds all glyphs) ---
           auto& asset_font = FLX_ASSET_GET(Asset::Font, text.m_fonttype);
-          glActiveTexture(GL_TEXTURE0);
-          glBindTexture(GL_TEXTURE_2D, asset_font.GetAtlasTexture());
+          OpenGLState::BindTexture(asset_font.GetAtlasTexture(), 0);
           asset_shader.SetUniform_int("u_texture", 0);
 
           // --- Pass layout parameters ---
@@ -989,12 +1150,13 @@ namespace FlexEngine
           asset_shader.SetUniformGlyphMetrics("u_glyphs", const_cast<const Asset::GlyphMetric*>(glyphMetrics), 128);
 
           // --- CPU-side text splitting ---
-          // Use a lambda (without any custom struct) to split the text into lines.
-          // Each element in the resulting vector is a pair: (line text, line width).
-          auto splitLines = [&]() -> std::vector<std::pair<std::string, float>> {
-              std::vector<std::pair<std::string, float>> lines;
+          // Use a lambda to split the text into lines.
+          // Each line keeps its text, its width and the index of its first character in the text.
+          auto splitLines = [&]() -> std::vector<LaidOutLine> {
+              std::vector<LaidOutLine> lines;
               std::string currentLine;
               float currentWidth = 0.0f;
+              int lineStart = 0;
               int lastSpaceIndex = -1;
               float widthAtLastSpace = 0.0f;
               for (size_t i = 0; i < text.m_words.size(); i++)
@@ -1003,7 +1165,8 @@ namespace FlexEngine
                   if (c == '\n')
                   {
                       // Push the current line as-is.
-                      lines.push_back({ currentLine, currentWidth });
+                      lines.push_back({ currentLine, currentWidth, lineStart });
+                      lineStart = static_cast<int>(i) + 1;
                       currentLine = "";
                       currentWidth = 0.0f;
                       lastSpaceIndex = -1;
@@ -1028,7 +1191,7 @@ namespace FlexEngine
                               // Break the line at the last space.
                               std::string lineToPush = currentLine.substr(0, safeIndex);
                               float lineWidth = widthAtLastSpace;
-                              lines.push_back({ lineToPush, lineWidth });
+                              lines.push_back({ lineToPush, lineWidth, lineStart });
 
                               // Start the new line with the word after the space.
                               std::string remaining = "";
@@ -1044,6 +1207,7 @@ namespace FlexEngine
                               }
 
                               // Then add the current character.
+                              lineStart = static_cast<int>(i - remaining.size());
                               currentLine.push_back(c);
                               currentWidth += advance;
 
@@ -1054,7 +1218,8 @@ namespace FlexEngine
                           else
                           {
                               // No space was found; break immediately.
-                              lines.push_back({ currentLine, currentWidth });
+                              lines.push_back({ currentLine, currentWidth, lineStart });
+                              lineStart = static_cast<int>(i);
                               currentLine = "";
                               currentWidth = 0.0f;
                               currentLine.push_back(c);
@@ -1073,11 +1238,16 @@ namespace FlexEngine
                   }
               }
               if (!currentLine.empty())
-                  lines.push_back({ currentLine, currentWidth });
+                  lines.push_back({ currentLine, currentWidth, lineStart });
               return lines;
           };
 
-          auto lines = splitLines();
+          static TextLayoutCache<std::vector<LaidOutLine>> layouts;
+          const std::vector<LaidOutLine>& lines = layouts.Get(text, asset_font, [&](std::vector<LaidOutLine>& out) { out = splitLines(); });
+
+          // Typewriter reveal, the vertex shader fades the glyphs in
+          asset_shader.SetUniform_float("u_visibleGlyphs", text.m_visible_glyphs);
+          asset_shader.SetUniform_float("u_glyphFade", text.m_glyph_fade);
 
           // --- Compute vertical layout ---
           // Use the glyph for 'A' as the baseline line height.
@@ -1091,13 +1261,17 @@ namespace FlexEngine
           float verticalOffset = (alignY == 0.5f) ? totalTextHeight * 0.5f : (alignY == 1.0f ? totalTextHeight : 0.0f);
 
           // --- Render each line separately ---
-          glBindVertexArray(vao);
+          OpenGLState::BindVertexArray(vao);
           float currentBaseline = verticalOffset;
           const int maxTextLength = 256; // maximum supported per line
           for (size_t i = 0; i < lines.size(); i++)
           {
-              const std::string& lineText = lines[i].first;
-              float lineWidth = lines[i].second;
+              // the lines after the first hidden glyph are hidden as well
+              if (text.GetGlyphAlpha(lines[i].first_glyph) <= 0.0f) break;
+
+              const std::string& lineText = lines[i].text;
+              float lineWidth = lines[i].width;
+              asset_shader.SetUniform_int("u_firstGlyph", lines[i].first_glyph);
               // Compute horizontal alignment offset:
               float lineOffsetX = (alignX == 0.5f) ? -lineWidth * 0.5f : (alignX == 1.0f ? -lineWidth : 0.0f);
               // Set per-line offset uniform ("u_lineOffset" should be declared as vec2 in your shader).
@@ -1120,13 +1294,15 @@ namespace FlexEngine
               // Move the baseline down for the next line.
               currentBaseline -= (lineHeight + text.m_linespacing);
           }
-          glBindVertexArray(0);
-          glBindTexture(GL_TEXTURE_2D, 0);
+          OpenGLState::BindVertexArray(0);
+          OpenGLState::BindTexture(0);
       }
   }
 
   void OpenGLRenderer::DrawTexture2D(const Renderer2DText& text, const Camera& cameraData)
   {
+      if (m_null_backend) return;
+
       if (!CameraManager::has_main_camera) return;
 
       static GLuint vao = 0, vbo = 0;
@@ -1136,7 +1312,7 @@ namespace FlexEngine
           // Configure VAO/VBO for text quads
           glGenVertexArrays(1, &vao);
           glGenBuffers(1, &vbo);
-          glBindVertexArray(vao);
+          OpenGLState::BindVertexArray(vao);
           glBindBuffer(GL_ARRAY_BUFFER, vbo);
           glBufferData(GL_ARRAY_BUFFER, sizeof(float) * 6 * 4, NULL, GL_DYNAMIC_DRAW); // 6 vertices per quad
 
@@ -1144,12 +1320,12 @@ namespace FlexEngine
           glEnableVertexAttribArray(0);
           glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(float), 0);
           glBindBuffer(GL_ARRAY_BUFFER, 0);
-          glBindVertexArray(0);
+          OpenGLState::BindVertexArray(0);
 
           FreeQueue::Push(
             [=]()
           {
-              glDeleteVertexArrays(1, &vao);
+              OpenGLState::DeleteVertexArrays(1, &vao);
               glDeleteBuffers(1, &vbo);
           }
           );
@@ -1168,17 +1344,17 @@ namespace FlexEngine
       asset_shader.Use();
 
       asset_shader.SetUniform_vec3("u_color", text.m_color);
+      asset_shader.SetUniform_float("u_alpha", 1.0f);
       asset_shader.SetUniform_mat4("u_model", text.m_transform);
       asset_shader.SetUniform_mat4("projection", cameraData.GetProjViewMatrix());
 
-      glActiveTexture(GL_TEXTURE0);
-      glBindVertexArray(vao);
+      OpenGLState::BindVertexArray(vao);
       auto& asset_font = FLX_ASSET_GET(Asset::Font, text.m_fonttype);
 
       // Lambda to render a single glyph
       auto renderGlyph = [&](const Asset::Glyph& glyph, const Vector3& position)
       {
-          glBindTexture(GL_TEXTURE_2D, glyph.textureID);
+          OpenGLState::BindTexture(glyph.textureID);
 
           float xpos = position.x + glyph.bearing.x;
           float ypos = position.y - (glyph.bearing.y - glyph.size.y);
@@ -1373,8 +1549,8 @@ namespace FlexEngine
       #endif
 
       // Cleanup
-      glBindVertexArray(0);
-      glBindTexture(GL_TEXTURE_2D, 0);
+      OpenGLState::BindVertexArray(0);
+      OpenGLState::BindTexture(0);
   }
   #pragma endregion
 
@@ -1388,6 +1564,8 @@ namespace FlexEngine
   *****************************************************************************/
   void OpenGLRenderer::ApplyBrightnessPass(const GLuint& texture, float threshold)
   {
+      if (m_null_backend) return;
+
       #pragma region VAO setup
       // Full-screen quad covering clip space.
       static const float vertices[] = {
@@ -1407,7 +1585,7 @@ namespace FlexEngine
           glGenVertexArrays(1, &vao);
           glGenBuffers(1, &vbo);
 
-          glBindVertexArray(vao);
+          OpenGLState::BindVertexArray(vao);
           glBindBuffer(GL_ARRAY_BUFFER, vbo);
           glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
@@ -1415,20 +1593,20 @@ namespace FlexEngine
           glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
           glEnableVertexAttribArray(1);
           glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
-          glBindVertexArray(0);
+          OpenGLState::BindVertexArray(0);
 
           // free in freequeue
           FreeQueue::Push(
             [=]()
           {
               glDeleteBuffers(1, &vbo);
-              glDeleteVertexArrays(1, &vao);
+              OpenGLState::DeleteVertexArrays(1, &vao);
           }
           );
       }
 
       // Bind our VAO for drawing.
-      glBindVertexArray(vao);
+      OpenGLState::BindVertexArray(vao);
       #pragma endregion
 
       // Use the brightness pass shader.
@@ -1437,8 +1615,7 @@ namespace FlexEngine
       asset_shader.SetUniform_float("u_Threshold", threshold);
 
       // Bind the input texture to texture unit 0.
-      glActiveTexture(GL_TEXTURE0);
-      glBindTexture(GL_TEXTURE_2D, texture);
+      OpenGLState::BindTexture(texture, 0);
       asset_shader.SetUniform_int("u_texture", 0);
 
       // Draw the full-screen quad.
@@ -1452,7 +1629,7 @@ namespace FlexEngine
           Log::Fatal("OpenGL Error: " + std::to_string(error));
       }
 
-      glBindVertexArray(0);
+      OpenGLState::BindVertexArray(0);
   }
 
   ///*!***************************************************************************
@@ -1465,6 +1642,8 @@ namespace FlexEngine
   //*****************************************************************************/
   void OpenGLRenderer::ApplyGaussianBlur(const GLuint& texture, float blurDistance, int blurIntensity, bool isHorizontal)
   {
+      if (m_null_backend) return;
+
       #pragma region VAO setup
       // Full-screen quad covering clip space.
       static const float vertices[] = {
@@ -1484,7 +1663,7 @@ namespace FlexEngine
           glGenVertexArrays(1, &vao);
           glGenBuffers(1, &vbo);
 
-          glBindVertexArray(vao);
+          OpenGLState::BindVertexArray(vao);
           glBindBuffer(GL_ARRAY_BUFFER, vbo);
           glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
@@ -1492,27 +1671,26 @@ namespace FlexEngine
           glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
           glEnableVertexAttribArray(1);
           glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
-          glBindVertexArray(0);
+          OpenGLState::BindVertexArray(0);
 
           // free in freequeue
           FreeQueue::Push(
             [=]()
           {
               glDeleteBuffers(1, &vbo);
-              glDeleteVertexArrays(1, &vao);
+              OpenGLState::DeleteVertexArrays(1, &vao);
           }
           );
       }
 
       // Bind our VAO for drawing.
-      glBindVertexArray(vao);
+      OpenGLState::BindVertexArray(vao);
       #pragma endregion
 
       auto& asset_shader = FLX_ASSET_GET(Asset::Shader, "/shaders/Gaussian_Blur.flxshader");
      
       asset_shader.SetUniform_int("horizontal", isHorizontal);
-      glActiveTexture(GL_TEXTURE0);
-      glBindTexture(GL_TEXTURE_2D, texture);
+      OpenGLState::BindTexture(texture, 0);
       asset_shader.SetUniform_int("u_texture", 0);
       asset_shader.SetUniform_float("blurDistance", blurDistance);
       asset_shader.SetUniform_int("intensity", blurIntensity);
@@ -1529,6 +1707,8 @@ namespace FlexEngine
   //*****************************************************************************/
   void OpenGLRenderer::ApplyBloomFinalComposition(const GLuint& texture, const GLuint& blurtextureHorizontal, const GLuint& blurtextureVertical, float opacity, float spread)
   {
+      if (m_null_backend) return;
+
       #pragma region VAO setup
       // Full-screen quad covering clip space.
       static const float vertices[] = {
@@ -1548,7 +1728,7 @@ namespace FlexEngine
           glGenVertexArrays(1, &vao);
           glGenBuffers(1, &vbo);
 
-          glBindVertexArray(vao);
+          OpenGLState::BindVertexArray(vao);
           glBindBuffer(GL_ARRAY_BUFFER, vbo);
           glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
@@ -1556,31 +1736,28 @@ namespace FlexEngine
           glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
           glEnableVertexAttribArray(1);
           glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
-          glBindVertexArray(0);
+          OpenGLState::BindVertexArray(0);
 
           // free in freequeue
           FreeQueue::Push(
             [=]()
           {
               glDeleteBuffers(1, &vbo);
-              glDeleteVertexArrays(1, &vao);
+              OpenGLState::DeleteVertexArrays(1, &vao);
           }
           );
       }
 
       // Bind our VAO for drawing.
-      glBindVertexArray(vao);
+      OpenGLState::BindVertexArray(vao);
       #pragma endregion
 
       auto& asset_shader = FLX_ASSET_GET(Asset::Shader, "/shaders/Bloom_final_composite.flxshader");
-      glActiveTexture(GL_TEXTURE0);
-      glBindTexture(GL_TEXTURE_2D, texture); // Original scene texture
+      OpenGLState::BindTexture(texture, 0); // Original scene texture
       asset_shader.SetUniform_int("screenTex", 0);
-      glActiveTexture(GL_TEXTURE1);
-      glBindTexture(GL_TEXTURE_2D, blurtextureVertical); // Blur Vertical
+      OpenGLState::BindTexture(blurtextureVertical, 1); // Blur Vertical
       asset_shader.SetUniform_int("bloomVTex", 1);
-      glActiveTexture(GL_TEXTURE2);
-      glBindTexture(GL_TEXTURE_2D, blurtextureHorizontal); // Blur Horizontal
+      OpenGLState::BindTexture(blurtextureHorizontal, 2); // Blur Horizontal
       asset_shader.SetUniform_int("bloomHTex", 2);
       asset_shader.SetUniform_float("opacity", opacity);
       asset_shader.SetUniform_float("bloomRadius", spread);
@@ -1591,6 +1768,8 @@ namespace FlexEngine
 
   void OpenGLRenderer::ApplyBlurFinalComposition(const GLuint& blurtextureHorizontal, const GLuint& blurtextureVertical)
   {
+      if (m_null_backend) return;
+
       #pragma region VAO setup
       // Full-screen quad covering clip space.
       static const float vertices[] = {
@@ -1610,7 +1789,7 @@ namespace FlexEngine
           glGenVertexArrays(1, &vao);
           glGenBuffers(1, &vbo);
 
-          glBindVertexArray(vao);
+          OpenGLState::BindVertexArray(vao);
           glBindBuffer(GL_ARRAY_BUFFER, vbo);
           glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
@@ -1618,28 +1797,26 @@ namespace FlexEngine
           glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
           glEnableVertexAttribArray(1);
           glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
-          glBindVertexArray(0);
+          OpenGLState::BindVertexArray(0);
 
           // free in freequeue
           FreeQueue::Push(
             [=]()
           {
               glDeleteBuffers(1, &vbo);
-              glDeleteVertexArrays(1, &vao);
+              OpenGLState::DeleteVertexArrays(1, &vao);
           }
           );
       }
 
       // Bind our VAO for drawing.
-      glBindVertexArray(vao);
+      OpenGLState::BindVertexArray(vao);
       #pragma endregion
 
       auto& asset_shader = FLX_ASSET_GET(Asset::Shader, "/shaders/Blur_final_composite.flxshader");
-      glActiveTexture(GL_TEXTURE0);
-      glBindTexture(GL_TEXTURE_2D, blurtextureHorizontal); // Original scene texture
+      OpenGLState::BindTexture(blurtextureHorizontal, 0); // Original scene texture
       asset_shader.SetUniform_int("blurHTex", 0);
-      glActiveTexture(GL_TEXTURE1);
-      glBindTexture(GL_TEXTURE_2D, blurtextureVertical); // Blur Vertical
+      OpenGLState::BindTexture(blurtextureVertical, 1); // Blur Vertical
       asset_shader.SetUniform_int("blurVTex", 1);
 
       glDrawArrays(GL_TRIANGLES, 0, 6);
@@ -1649,6 +1826,8 @@ namespace FlexEngine
 
   void OpenGLRenderer::ApplyChromaticAberration(const GLuint& inputTex, float chromaIntensity, const Vector2& redOffset, const Vector2& greenOffset, const Vector2& blueOffset, const Vector2& EdgeRadius, const Vector2& EdgeSoftness)
   {
+      if (m_null_backend) return;
+
       #pragma region VAO Setup
       // Full-screen quad covering clip space.
       static const float vertices[] = {
@@ -1667,7 +1846,7 @@ namespace FlexEngine
           glGenVertexArrays(1, &vao);
           glGenBuffers(1, &vbo);
 
-          glBindVertexArray(vao);
+          OpenGLState::BindVertexArray(vao);
           glBindBuffer(GL_ARRAY_BUFFER, vbo);
           glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
@@ -1675,24 +1854,23 @@ namespace FlexEngine
           glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
           glEnableVertexAttribArray(1);
           glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
-          glBindVertexArray(0);
+          OpenGLState::BindVertexArray(0);
 
           // Push cleanup into your free queue.
           FreeQueue::Push([=]()
           {
               glDeleteBuffers(1, &vbo);
-              glDeleteVertexArrays(1, &vao);
+              OpenGLState::DeleteVertexArrays(1, &vao);
           });
       }
-      glBindVertexArray(vao);
+      OpenGLState::BindVertexArray(vao);
       #pragma endregion
 
       // Retrieve the chromatic aberration shader asset.
       auto& asset_shader = FLX_ASSET_GET(Asset::Shader, "/shaders/Chromatic_aberration.flxshader");
 
       // Bind the input texture to texture unit 0.
-      glActiveTexture(GL_TEXTURE0);
-      glBindTexture(GL_TEXTURE_2D, inputTex);
+      OpenGLState::BindTexture(inputTex, 0);
       asset_shader.SetUniform_int("u_InputTex", 0);
 
       // Set the chromatic aberration parameters.
@@ -1711,6 +1889,8 @@ namespace FlexEngine
 
   void OpenGLRenderer::ApplyColorGrading(const GLuint& inputTex, float brightness, float contrast, float saturation)
   {
+      if (m_null_backend) return;
+
       #pragma region VAO Setup
       // Full-screen quad covering clip space.
       static const float vertices[] = {
@@ -1729,7 +1909,7 @@ namespace FlexEngine
           glGenVertexArrays(1, &vao);
           glGenBuffers(1, &vbo);
 
-          glBindVertexArray(vao);
+          OpenGLState::BindVertexArray(vao);
           glBindBuffer(GL_ARRAY_BUFFER, vbo);
           glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
@@ -1737,23 +1917,22 @@ namespace FlexEngine
           glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
           glEnableVertexAttribArray(1);
           glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
-          glBindVertexArray(0);
+          OpenGLState::BindVertexArray(0);
 
           // Push cleanup into your free queue.
           FreeQueue::Push([=]() {
               glDeleteBuffers(1, &vbo);
-              glDeleteVertexArrays(1, &vao);
+              OpenGLState::DeleteVertexArrays(1, &vao);
           });
       }
-      glBindVertexArray(vao);
+      OpenGLState::BindVertexArray(vao);
       #pragma endregion
 
       // Retrieve the color grading shader asset.
       auto& asset_shader = FLX_ASSET_GET(Asset::Shader, "/shaders/Color_grading.flxshader");
 
       // Bind the input texture to texture unit 0.
-      glActiveTexture(GL_TEXTURE0);
-      glBindTexture(GL_TEXTURE_2D, inputTex);
+      OpenGLState::BindTexture(inputTex, 0);
       asset_shader.SetUniform_int("u_InputTex", 0);
 
       // Set the color grading parameters.
@@ -1768,6 +1947,8 @@ namespace FlexEngine
 
   void OpenGLRenderer::ApplyVignette(const GLuint& inputTex, float vignetteIntensity, const Vector2& vignetteRadius, const Vector2& vignetteSoftness)
   {
+      if (m_null_backend) return;
+
       #pragma region VAO Setup
       // Full-screen quad covering clip space.
       static const float vertices[] = {
@@ -1786,7 +1967,7 @@ namespace FlexEngine
           glGenVertexArrays(1, &vao);
           glGenBuffers(1, &vbo);
 
-          glBindVertexArray(vao);
+          OpenGLState::BindVertexArray(vao);
           glBindBuffer(GL_ARRAY_BUFFER, vbo);
           glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
@@ -1794,23 +1975,22 @@ namespace FlexEngine
           glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
           glEnableVertexAttribArray(1); // TexCoord attribute
           glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
-          glBindVertexArray(0);
+          OpenGLState::BindVertexArray(0);
 
           // Push cleanup code to your free queue.
           FreeQueue::Push([=]() {
               glDeleteBuffers(1, &vbo);
-              glDeleteVertexArrays(1, &vao);
+              OpenGLState::DeleteVertexArrays(1, &vao);
           });
       }
-      glBindVertexArray(vao);
+      OpenGLState::BindVertexArray(vao);
       #pragma endregion
 
       // Retrieve the vignette shader asset.
       auto& asset_shader = FLX_ASSET_GET(Asset::Shader, "/shaders/Vignette.flxshader");
 
       // Bind the input texture (e.g., the current screen texture) to texture unit 0.
-      glActiveTexture(GL_TEXTURE0);
-      glBindTexture(GL_TEXTURE_2D, inputTex); 
+      OpenGLState::BindTexture(inputTex, 0); 
       asset_shader.SetUniform_int("u_InputTex", 0);
 
       // Set the vignette parameters.
@@ -1825,6 +2005,8 @@ namespace FlexEngine
 
   void OpenGLRenderer::ApplyFilmGrain(const GLuint& inputTex,float filmGrainIntensity,float filmGrainSize,bool filmGrainAnimate)
   {
+      if (m_null_backend) return;
+
       #pragma region VAO Setup
       // Full-screen quad covering clip space.
       static const float vertices[] = {
@@ -1843,7 +2025,7 @@ namespace FlexEngine
           glGenVertexArrays(1, &vao);
           glGenBuffers(1, &vbo);
 
-          glBindVertexArray(vao);
+          OpenGLState::BindVertexArray(vao);
           glBindBuffer(GL_ARRAY_BUFFER, vbo);
           glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
@@ -1851,24 +2033,23 @@ namespace FlexEngine
           glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
           glEnableVertexAttribArray(1);
           glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
-          glBindVertexArray(0);
+          OpenGLState::BindVertexArray(0);
 
           // Push cleanup into your free queue.
           FreeQueue::Push([=]()
           {
               glDeleteBuffers(1, &vbo);
-              glDeleteVertexArrays(1, &vao);
+              OpenGLState::DeleteVertexArrays(1, &vao);
           });
       }
-      glBindVertexArray(vao);
+      OpenGLState::BindVertexArray(vao);
       #pragma endregion
 
       // Retrieve the film grain shader asset.
       auto& asset_shader = FLX_ASSET_GET(Asset::Shader, "/shaders/FilmGrain.flxshader");
 
       // Bind the input texture to texture unit 0.
-      glActiveTexture(GL_TEXTURE0);
-      glBindTexture(GL_TEXTURE_2D, inputTex);
+      OpenGLState::BindTexture(inputTex, 0);
       asset_shader.SetUniform_int("u_InputTex", 0);
 
       // Set film grain parameters.
@@ -1891,6 +2072,8 @@ namespace FlexEngine
 
   void OpenGLRenderer::ApplyPixelate(const GLuint& inputTex, float pixelWidth, float pixelHeight)
   {
+      if (m_null_backend) return;
+
       #pragma region VAO Setup
       // Full-screen quad covering clip space.
       static const float vertices[] = {
@@ -1909,7 +2092,7 @@ namespace FlexEngine
           glGenVertexArrays(1, &vao);
           glGenBuffers(1, &vbo);
 
-          glBindVertexArray(vao);
+          OpenGLState::BindVertexArray(vao);
           glBindBuffer(GL_ARRAY_BUFFER, vbo);
           glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
@@ -1917,24 +2100,23 @@ namespace FlexEngine
           glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
           glEnableVertexAttribArray(1); // TexCoords
           glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
-          glBindVertexArray(0);
+          OpenGLState::BindVertexArray(0);
 
           // Schedule cleanup of the buffers.
           FreeQueue::Push([=]()
           {
               glDeleteBuffers(1, &vbo);
-              glDeleteVertexArrays(1, &vao);
+              OpenGLState::DeleteVertexArrays(1, &vao);
           });
       }
-      glBindVertexArray(vao);
+      OpenGLState::BindVertexArray(vao);
       #pragma endregion
 
       // Retrieve the pixelate shader asset.
       auto& asset_shader = FLX_ASSET_GET(Asset::Shader, "/shaders/Pixelate.flxshader");
 
       // Bind the input texture to texture unit 0.
-      glActiveTexture(GL_TEXTURE0);
-      glBindTexture(GL_TEXTURE_2D, inputTex);
+      OpenGLState::BindTexture(inputTex, 0);
       asset_shader.SetUniform_int("u_InputTex", 0);
 
       // Set the pixelation parameters.
@@ -1948,6 +2130,8 @@ namespace FlexEngine
 
   void OpenGLRenderer::ApplyWarpEffect(const GLuint& inputTex, float warpStrength, float warpRadius)
   {
+      if (m_null_backend) return;
+
       #pragma region VAO Setup
       // Full-screen quad covering clip space.
       static const float vertices[] = {
@@ -1966,7 +2150,7 @@ namespace FlexEngine
           glGenVertexArrays(1, &vao);
           glGenBuffers(1, &vbo);
 
-          glBindVertexArray(vao);
+          OpenGLState::BindVertexArray(vao);
           glBindBuffer(GL_ARRAY_BUFFER, vbo);
           glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
@@ -1974,24 +2158,23 @@ namespace FlexEngine
           glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
           glEnableVertexAttribArray(1); // TexCoords
           glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
-          glBindVertexArray(0);
+          OpenGLState::BindVertexArray(0);
 
           // Schedule cleanup of the buffers.
           FreeQueue::Push([=]()
           {
               glDeleteBuffers(1, &vbo);
-              glDeleteVertexArrays(1, &vao);
+              OpenGLState::DeleteVertexArrays(1, &vao);
           });
       }
-      glBindVertexArray(vao);
+      OpenGLState::BindVertexArray(vao);
       #pragma endregion
 
       // Retrieve the overlay shader asset.
       auto& asset_shader = FLX_ASSET_GET(Asset::Shader, "/shaders/Warp.flxshader");
 
       // Bind the input texture to texture unit 0.
-      glActiveTexture(GL_TEXTURE0);
-      glBindTexture(GL_TEXTURE_2D, inputTex);
+      OpenGLState::BindTexture(inputTex, 0);
       asset_shader.SetUniform_int("screenTexture", 0);
       asset_shader.SetUniform_float("warpStrength", warpStrength);
       asset_shader.SetUniform_float("maxRadius", warpRadius);
@@ -2003,6 +2186,8 @@ namespace FlexEngine
 
   void OpenGLRenderer::ApplyOverlay(const GLuint& backgroundTex, const GLuint& inputTex)
   {
+      if (m_null_backend) return;
+
       #pragma region VAO Setup
       // Full-screen quad covering clip space.
       static const float vertices[] = {
@@ -2021,7 +2206,7 @@ namespace FlexEngine
           glGenVertexArrays(1, &vao);
           glGenBuffers(1, &vbo);
 
-          glBindVertexArray(vao);
+          OpenGLState::BindVertexArray(vao);
           glBindBuffer(GL_ARRAY_BUFFER, vbo);
           glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
@@ -2029,27 +2214,25 @@ namespace FlexEngine
           glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
           glEnableVertexAttribArray(1); // TexCoords
           glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
-          glBindVertexArray(0);
+          OpenGLState::BindVertexArray(0);
 
           // Schedule cleanup of the buffers.
           FreeQueue::Push([=]()
           {
               glDeleteBuffers(1, &vbo);
-              glDeleteVertexArrays(1, &vao);
+              OpenGLState::DeleteVertexArrays(1, &vao);
           });
       }
-      glBindVertexArray(vao);
+      OpenGLState::BindVertexArray(vao);
       #pragma endregion
 
       // Retrieve the overlay shader asset.
       auto& asset_shader = FLX_ASSET_GET(Asset::Shader, "/shaders/Overlay.flxshader");
 
       // Bind the input texture to texture unit 0.
-      glActiveTexture(GL_TEXTURE0);
-      glBindTexture(GL_TEXTURE_2D, backgroundTex);
+      OpenGLState::BindTexture(backgroundTex, 0);
       asset_shader.SetUniform_int("backgroundTex", 0);
-      glActiveTexture(GL_TEXTURE1);
-      glBindTexture(GL_TEXTURE_2D, inputTex);
+      OpenGLState::BindTexture(inputTex, 1);
       asset_shader.SetUniform_int("objTex", 1);
 
       // Draw the full-screen quad.
@@ -2057,6 +2240,56 @@ namespace FlexEngine
       m_draw_calls++;
   }
 
+  void OpenGLRenderer::ApplyPostProcessShader(Asset::Shader& shader, const GLuint& inputTex)
+  {
+      if (m_null_backend) return;
+
+      #pragma region VAO Setup
+      // Full-screen quad covering clip space.
+      static const float vertices[] = {
+          // Positions           // TexCoords
+          -1.0f, -1.0f, 0.0f,     0.0f, 0.0f, // Bottom-left
+           1.0f, -1.0f, 0.0f,     1.0f, 0.0f, // Bottom-right
+           1.0f,  1.0f, 0.0f,     1.0f, 1.0f, // Top-right
+           1.0f,  1.0f, 0.0f,     1.0f, 1.0f, // Top-right
+          -1.0f,  1.0f, 0.0f,     0.0f, 1.0f, // Top-left
+          -1.0f, -1.0f, 0.0f,     0.0f, 0.0f  // Bottom-left
+      };
+
+      static GLuint vao = 0, vbo = 0;
+      if (vao == 0)
+      {
+          glGenVertexArrays(1, &vao);
+          glGenBuffers(1, &vbo);
+
+          OpenGLState::BindVertexArray(vao);
+          glBindBuffer(GL_ARRAY_BUFFER, vbo);
+          glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+
+          glEnableVertexAttribArray(0);
+          glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
+          glEnableVertexAttribArray(1);
+          glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
+          OpenGLState::BindVertexArray(0);
+
+          FreeQueue::Push([=]()
+          {
+              glDeleteBuffers(1, &vbo);
+              OpenGLState::DeleteVertexArrays(1, &vao);
+          });
+      }
+      OpenGLState::BindVertexArray(vao);
+      #pragma endregion
+
+      // The caller has set the shader's own uniforms.
+      OpenGLState::BindTexture(inputTex, 0);
+      shader.SetUniform_int("u_InputTex", 0);
+
+      // Draw the full-screen quad.
+      glDrawArrays(GL_TRIANGLES, 0, 6);
+      m_draw_calls++;
+  }
+
   
   #pragma endregion
 }
\ No newline at end of file
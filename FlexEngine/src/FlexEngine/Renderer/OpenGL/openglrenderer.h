@@ -12,7 +12,7 @@
 // - Renderer2DProps: Contains transformation, shader, asset, and color data
 //   for rendering 2D textures.
 // - Renderer2DText: Encapsulates text rendering parameters including shader,
-//   font type, alignment, and transformation settings.
+//   font type, alignment, transformation settings and the typewriter reveal.
 // - Renderer2DSpriteBatch: Holds batch data for rendering multiple sprite
 //   instances with transformations and per-instance opacity.
 //
@@ -32,6 +32,7 @@
 #include "flx_api.h"
 
 #include "FlexMath/vector4.h"
+#include "DataStructures/framearena.h"
 #include "opengltexture.h"
 
 #include <glad/glad.h>
@@ -104,6 +105,12 @@ namespace FlexEngine
         float m_linespacing = 2.0f;      ///< Spacing between lines.
         float m_letterspacing = 2.0f;    ///< Spacing between letters.
         Vector2 m_textboxDimensions = { 500.0f ,500.0f };  ///< Dimensions of the text box.
+        float m_visible_glyphs = -1.0f;  ///< Characters shown from the start of the text, negative shows all of them.
+        float m_glyph_fade = 0.0f;       ///< Characters each glyph takes to fade in, 0 shows each one at once.
+
+        /// @brief Opacity of the character at the index of m_words for the typewriter reveal.
+        /// Glyph i starts to fade in once m_visible_glyphs passes i and is fully shown m_glyph_fade glyphs later.
+        float GetGlyphAlpha(int glyph) const;
     };
 
     /**
@@ -116,12 +123,13 @@ namespace FlexEngine
     {
         std::string m_shader = R"(/shaders/batchtexture.flxshader)";  ///< Shader path for sprite batch rendering.
 
-        std::vector<int> m_zindex; ///< Z-index values for layering sprites.
-        std::vector<Matrix4x4> m_transformationData; ///< Transformation matrices for each sprite.
+        // Batches are rebuilt every frame, so the instance data lives in the frame arena.
+        FrameVector<int> m_zindex; ///< Z-index values for layering sprites.
+        FrameVector<Matrix4x4> m_transformationData; ///< Transformation matrices for each sprite.
         // For animation:
-        std::vector<Vector4> m_UVmap; ///< UV mapping coordinates.
+        FrameVector<Vector4> m_UVmap; ///< UV mapping coordinates.
         // For opacity control:
-        std::vector<float> m_opacity; ///< Opacity values for each sprite instance.
+        FrameVector<float> m_opacity; ///< Opacity values for each sprite instance.
     };
 
     /**
@@ -151,6 +159,12 @@ namespace FlexEngine
         float blurDistance = 12.5f; // Blur Distance
         int   blurPasses = 5;    // Number of blur passes
 
+        // Blur inside the bloom chain, the same as the Gaussian blur settings
+        // unless the local post processing gives an entity its own blur
+        int   bloomBlurIntensity = 12;
+        float bloomBlurDistance = 12.5f;
+        int   bloomBlurPasses = 5;
+
         // Chromatic Aberration settings
         float chromaIntensity = 1.0f;  // Overall effect intensity
         Vector2 chromaRedOffset = Vector2(10.0f, 0.0f);
@@ -203,8 +217,18 @@ namespace FlexEngine
         static uint32_t m_maxInstances;               ///< Maximum allowed instances for batching.
         static bool m_depth_test;                     ///< Flag indicating if depth testing is enabled.
         static bool m_blending;                       ///< Flag indicating if blending is enabled.
+        static bool m_null_backend;                   ///< Flag indicating if OpenGL calls are skipped (headless).
     public:
 
+        /// @brief Switches to the null backend for headless runs without an OpenGL context.
+        /// Every draw, clear and state call returns without touching OpenGL, and textures,
+        /// shaders, fonts, videos and framebuffers are not created on the GPU.
+        /// Must be set before any asset or window is loaded.
+        static void SetNullBackend(bool enabled);
+
+        /// @brief Checks if the null backend is active.
+        static bool IsNullBackend();
+
         /// @brief Retrieves the total number of draw calls.
         static uint32_t GetDrawCalls();
 
@@ -323,6 +347,14 @@ namespace FlexEngine
         static void ApplyPixelate(const GLuint& inputTex = {}, float pixelWidth = 0.0f, float pixelHeight = 0.0f);
         static void ApplyWarpEffect(const GLuint& inputTex = {}, float warpStrength = 1.2f, float warpRadius = 1.0f);
         static void ApplyOverlay(const GLuint& backgroundTex = {}, const GLuint& inputTex = {});
+
+        /*!***************************************************************************
+        * \brief
+        * Draws a full-screen quad with any post processing shader that reads
+        * its input from u_InputTex, e.g. the fused passes of PostProcessGraph.
+        * The shader's other uniforms must be set before calling this.
+        *****************************************************************************/
+        static void ApplyPostProcessShader(Asset::Shader& shader, const GLuint& inputTex = {});
         #pragma endregion
 
     };
@@ -13,14 +13,34 @@
 #include "pch.h"
 
 #include "openglshader.h"
+#include "openglrenderer.h" // OpenGLRenderer::IsNullBackend
+#include "openglstate.h"
 
 #include <glad/glad.h>
 
+#include <algorithm> // std::lower_bound
+#include <cstring>   // std::strcmp
+
 namespace FlexEngine
 {
   namespace Asset
   {
 
+    namespace
+    {
+      // FNV-1a
+      uint64_t HashUniformName(const char* name)
+      {
+        uint64_t hash = 14695981039346656037ull;
+        for (; *name; ++name)
+        {
+          hash ^= static_cast<unsigned char>(*name);
+          hash *= 1099511628211ull;
+        }
+        return hash;
+      }
+    }
+
     Shader::Shader()
     {
     }
@@ -46,11 +66,32 @@ namespace FlexEngine
       }
     }
 
+    void Shader::LoadFromSource(const std::string& name, const std::string& vertex_source, const std::string& fragment_source)
+    {
+      FLX_FLOW_FUNCTION();
+
+      Destroy();
+
+      // guard: the source is not compiled on the null backend
+      if (OpenGLRenderer::IsNullBackend()) return;
+
+      m_vertex_shader = Internal_Compile(GL_VERTEX_SHADER, vertex_source, "Vertex shader did not compile. Shader: " + name);
+      m_fragment_shader = Internal_Compile(GL_FRAGMENT_SHADER, fragment_source, "Fragment shader did not compile. Shader: " + name);
+      Internal_Link();
+    }
+
     void Shader::Destroy()
     {
       if (m_vertex_shader != 0) glDeleteShader(m_vertex_shader);
       if (m_fragment_shader != 0) glDeleteShader(m_fragment_shader);
-      if (m_shader_program != 0) glDeleteProgram(m_shader_program);
+      if (m_shader_program != 0) OpenGLState::DeleteProgram(m_shader_program);
+
+      m_vertex_shader = 0;
+      m_fragment_shader = 0;
+      m_shader_program = 0;
+
+      m_uniforms.clear();
+      m_glyph_metric_uniforms.clear();
 
       m_path_to_metadata = Path();
       m_path_to_vertex_shader = Path();
@@ -59,83 +100,113 @@ namespace FlexEngine
 
     void Shader::Use() const
     {
+      if (OpenGLRenderer::IsNullBackend()) return;
+
       _FLX_SHADER_VALIDITY_CHECK;
 
-      glUseProgram(m_shader_program);
+      OpenGLState::UseProgram(m_shader_program);
     }
 
     #pragma region Set Uniforms
 
-    void Shader::SetUniform_bool(const char* name, bool value)
+    void Shader::SetUniform(Uniform<bool> uniform, bool value)
     {
+      if (OpenGLRenderer::IsNullBackend()) return;
       Use(); // make sure the shader is being used
-      glUniform1i(glGetUniformLocation(m_shader_program, name), (int)value);
+      glUniform1i(uniform.location, (int)value);
     }
 
-    void Shader::SetUniform_int(const char* name, int value)
+    void Shader::SetUniform(Uniform<int> uniform, int value)
     {
+      if (OpenGLRenderer::IsNullBackend()) return;
       Use();
-      glUniform1i(glGetUniformLocation(m_shader_program, name), value);
+      glUniform1i(uniform.location, value);
     }
 
-    void Shader::SetUniform_float(const char* name, float value)
+    void Shader::SetUniform(Uniform<float> uniform, float value)
     {
+      if (OpenGLRenderer::IsNullBackend()) return;
       Use();
-      glUniform1f(glGetUniformLocation(m_shader_program, name), value);
+      glUniform1f(uniform.location, value);
     }
 
-    void Shader::SetUniform_vec2(const char* name, const Vector2& vector)
+    void Shader::SetUniform(Uniform<Vector2> uniform, const Vector2& vector)
     {
+      if (OpenGLRenderer::IsNullBackend()) return;
       Use();
-      glUniform2f(glGetUniformLocation(m_shader_program, name), vector.x, vector.y);
+      glUniform2f(uniform.location, vector.x, vector.y);
     }
 
-    void Shader::SetUniform_vec3(const char* name, const Vector3& vector)
+    void Shader::SetUniform(Uniform<Vector3> uniform, const Vector3& vector)
     {
+      if (OpenGLRenderer::IsNullBackend()) return;
       Use();
-      glUniform3f(glGetUniformLocation(m_shader_program, name), vector.x, vector.y, vector.z);
+      glUniform3f(uniform.location, vector.x, vector.y, vector.z);
     }
 
-    void Shader::SetUniform_mat4(const char* name, const Matrix4x4& matrix)
+    void Shader::SetUniform(Uniform<Matrix4x4> uniform, const Matrix4x4& matrix)
     {
+      if (OpenGLRenderer::IsNullBackend()) return;
       Use();
-      glUniformMatrix4fv(glGetUniformLocation(m_shader_program, name), 1, GL_FALSE, matrix.data);
+      glUniformMatrix4fv(uniform.location, 1, GL_FALSE, matrix.data);
+    }
+
+    void Shader::SetUniform_bool(const char* name, bool value)
+    {
+      if (OpenGLRenderer::IsNullBackend()) return;
+      SetUniform(GetUniform<bool>(name), value);
+    }
+
+    void Shader::SetUniform_int(const char* name, int value)
+    {
+      if (OpenGLRenderer::IsNullBackend()) return;
+      SetUniform(GetUniform<int>(name), value);
+    }
+
+    void Shader::SetUniform_float(const char* name, float value)
+    {
+      if (OpenGLRenderer::IsNullBackend()) return;
+      SetUniform(GetUniform<float>(name), value);
+    }
+
+    void Shader::SetUniform_vec2(const char* name, const Vector2& vector)
+    {
+      if (OpenGLRenderer::IsNullBackend()) return;
+      SetUniform(GetUniform<Vector2>(name), vector);
+    }
+
+    void Shader::SetUniform_vec3(const char* name, const Vector3& vector)
+    {
+      if (OpenGLRenderer::IsNullBackend()) return;
+      SetUniform(GetUniform<Vector3>(name), vector);
+    }
+
+    void Shader::SetUniform_mat4(const char* name, const Matrix4x4& matrix)
+    {
+      if (OpenGLRenderer::IsNullBackend()) return;
+      SetUniform(GetUniform<Matrix4x4>(name), matrix);
     }
 
     void Shader::SetUniform_int_array(const char* name, const int* array, int count)
     {
+        if (OpenGLRenderer::IsNullBackend()) return;
         Use();
-        GLint location = glGetUniformLocation(m_shader_program, name);
-        glUniform1iv(location, count, array);
+        glUniform1iv(Internal_GetUniformLocation(name), count, array);
     }
 
     void Shader::SetUniformGlyphMetrics(const char* name, const Asset::GlyphMetric* metrics, int count)
     {
+        if (OpenGLRenderer::IsNullBackend()) return;
         Use();
+
+        const std::vector<GlyphMetricUniforms>& uniforms = Internal_GetGlyphMetricUniforms(name, count);
         for (int i = 0; i < count; ++i)
         {
-            // Build the base name for the i-th element: e.g. "u_glyphs[0]"
-            std::string baseName = std::string(name) + "[" + std::to_string(i) + "]";
-
-            // Upload 'advance'
-            GLint locAdvance = glGetUniformLocation(m_shader_program, (baseName + ".advance").c_str());
-            glUniform1f(locAdvance, metrics[i].advance);
-
-            // Upload 'size' (vec2)
-            GLint locSize = glGetUniformLocation(m_shader_program, (baseName + ".size").c_str());
-            glUniform2fv(locSize, 1, metrics[i].size);
-
-            // Upload 'bearing' (vec2)
-            GLint locBearing = glGetUniformLocation(m_shader_program, (baseName + ".bearing").c_str());
-            glUniform2fv(locBearing, 1, metrics[i].bearing);
-
-            // Upload 'uvOffset' (vec2)
-            GLint locUVOffset = glGetUniformLocation(m_shader_program, (baseName + ".uvOffset").c_str());
-            glUniform2fv(locUVOffset, 1, metrics[i].uvOffset);
-
-            // Upload 'uvSize' (vec2)
-            GLint locUVSize = glGetUniformLocation(m_shader_program, (baseName + ".uvSize").c_str());
-            glUniform2fv(locUVSize, 1, metrics[i].uvSize);
+            glUniform1f(uniforms[i].advance, metrics[i].advance);
+            glUniform2fv(uniforms[i].size, 1, metrics[i].size);
+            glUniform2fv(uniforms[i].bearing, 1, metrics[i].bearing);
+            glUniform2fv(uniforms[i].uv_offset, 1, metrics[i].uvOffset);
+            glUniform2fv(uniforms[i].uv_size, 1, metrics[i].uvSize);
         }
     }
     #pragma endregion
@@ -238,6 +309,9 @@ namespace FlexEngine
     {
       FLX_FLOW_FUNCTION();
 
+      // guard: the source is parsed but not compiled on the null backend
+      if (OpenGLRenderer::IsNullBackend()) return;
+
       // warning if vertex shader already exists
       // handled by overriding the old shader
       if (m_vertex_shader != 0)
@@ -251,24 +325,10 @@ namespace FlexEngine
       std::string vertex_shader_source = vertex_shader_file.Read();
 
       // create vertex shader
-      m_vertex_shader = glCreateShader(GL_VERTEX_SHADER);
-      const char* vertex_shader_source_cstr = vertex_shader_source.c_str();
-      glShaderSource(m_vertex_shader, 1, &vertex_shader_source_cstr, NULL);
-      glCompileShader(m_vertex_shader);
-
-      // check for vertex shader compile errors
-      int success;
-      char infoLog[512];
-      glGetShaderiv(m_vertex_shader, GL_COMPILE_STATUS, &success);
-      if (!success)
-      {
-        glGetShaderInfoLog(m_vertex_shader, 512, NULL, infoLog);
-        Log::Error(
-          "Vertex shader did not compile. "
-          "Shader: " + m_path_to_metadata.string() + " Vertex shader: " + path_to_vertex_shader.string() + '\n' +
-          infoLog + '\n'
-        );
-      }
+      m_vertex_shader = Internal_Compile(
+        GL_VERTEX_SHADER, vertex_shader_source,
+        "Vertex shader did not compile. Shader: " + m_path_to_metadata.string() + " Vertex shader: " + path_to_vertex_shader.string()
+      );
 
       Log::Debug("Created vertex shader with id: " + std::to_string(m_vertex_shader));
     }
@@ -277,6 +337,9 @@ namespace FlexEngine
     {
       FLX_FLOW_FUNCTION();
 
+      // guard: the source is parsed but not compiled on the null backend
+      if (OpenGLRenderer::IsNullBackend()) return;
+
       // warning if fragment shader already exists
       // handled by overriding the old shader
       if (m_fragment_shader != 0)
@@ -290,32 +353,41 @@ namespace FlexEngine
       std::string fragment_shader_source = fragment_shader_file.Read();
 
       // create fragment shader
-      m_fragment_shader = glCreateShader(GL_FRAGMENT_SHADER);
-      const char* fragment_shader_source_cstr = fragment_shader_source.c_str();
-      glShaderSource(m_fragment_shader, 1, &fragment_shader_source_cstr, NULL);
-      glCompileShader(m_fragment_shader);
+      m_fragment_shader = Internal_Compile(
+        GL_FRAGMENT_SHADER, fragment_shader_source,
+        "Fragment shader did not compile. Shader: " + m_path_to_metadata.string() + " Fragment shader: " + path_to_fragment_shader.string()
+      );
+
+      Log::Debug("Created fragment shader with id: " + std::to_string(m_fragment_shader));
+    }
 
-      // check for fragment shader compile errors
+    unsigned int Shader::Internal_Compile(unsigned int type, const std::string& source, const std::string& error_message)
+    {
+      unsigned int shader = glCreateShader(type);
+      const char* source_cstr = source.c_str();
+      glShaderSource(shader, 1, &source_cstr, NULL);
+      glCompileShader(shader);
+
+      // check for compile errors
       int success;
       char infoLog[512];
-      glGetShaderiv(m_fragment_shader, GL_COMPILE_STATUS, &success);
+      glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
       if (!success)
       {
-        glGetShaderInfoLog(m_fragment_shader, 512, NULL, infoLog);
-        Log::Error(
-          "Fragment shader did not compile. "
-          "Shader: " + m_path_to_metadata.string() + " Fragment shader: " + path_to_fragment_shader.string() + '\n' +
-          infoLog + '\n'
-        );
+        glGetShaderInfoLog(shader, 512, NULL, infoLog);
+        Log::Error(error_message + '\n' + infoLog + '\n');
       }
 
-      Log::Debug("Created fragment shader with id: " + std::to_string(m_fragment_shader));
+      return shader;
     }
 
     void Shader::Internal_Link()
     {
       FLX_FLOW_FUNCTION();
 
+      // guard: the source is parsed but not compiled on the null backend
+      if (OpenGLRenderer::IsNullBackend()) return;
+
       // guard: check if shaders are compiled
       if (m_vertex_shader == 0 || m_fragment_shader == 0)
       {
@@ -352,6 +424,96 @@ namespace FlexEngine
       // delete shaders
       glDeleteShader(m_vertex_shader);
       glDeleteShader(m_fragment_shader);
+
+      Internal_ReflectUniforms();
+    }
+
+    void Shader::Internal_ReflectUniforms()
+    {
+      m_uniforms.clear();
+      m_glyph_metric_uniforms.clear();
+
+      GLint count = 0;
+      GLint max_length = 0;
+      glGetProgramiv(m_shader_program, GL_ACTIVE_UNIFORMS, &count);
+      glGetProgramiv(m_shader_program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_length);
+
+      std::string name(static_cast<std::size_t>(std::max(max_length, 1)), '\0');
+      for (GLint i = 0; i < count; i++)
+      {
+        GLsizei length = 0;
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(m_shader_program, static_cast<GLuint>(i), max_length, &length, &size, &type, name.data());
+
+        std::string uniform_name = name.substr(0, static_cast<std::size_t>(length));
+        GLint location = glGetUniformLocation(m_shader_program, uniform_name.c_str());
+        m_uniforms.push_back({ HashUniformName(uniform_name.c_str()), uniform_name, location });
+
+        // arrays are reported as "name[0]", but are usually set through "name"
+        if (uniform_name.size() > 3 && uniform_name.compare(uniform_name.size() - 3, 3, "[0]") == 0)
+        {
+          std::string array_name = uniform_name.substr(0, uniform_name.size() - 3);
+          m_uniforms.push_back({ HashUniformName(array_name.c_str()), array_name, location });
+        }
+      }
+
+      std::sort(
+        m_uniforms.begin(), m_uniforms.end(),
+        [](const UniformRecord& a, const UniformRecord& b) { return a.hash < b.hash; }
+      );
+    }
+
+    int Shader::Internal_GetUniformLocation(const char* name) const
+    {
+      // guard: nothing to ask
+      if (OpenGLRenderer::IsNullBackend() || m_shader_program == 0) return -1;
+
+      uint64_t hash = HashUniformName(name);
+      auto it = std::lower_bound(
+        m_uniforms.begin(), m_uniforms.end(), hash,
+        [](const UniformRecord& record, uint64_t value) { return record.hash < value; }
+      );
+      for (auto match = it; match != m_uniforms.end() && match->hash == hash; ++match)
+      {
+        if (std::strcmp(match->name.c_str(), name) == 0) return match->location;
+      }
+
+      // not reflected, ask once and remember the answer, even if it is -1
+      GLint location = glGetUniformLocation(m_shader_program, name);
+      m_uniforms.insert(it, { hash, name, location });
+      return location;
+    }
+
+    const std::vector<Shader::GlyphMetricUniforms>& Shader::Internal_GetGlyphMetricUniforms(const char* name, int count)
+    {
+      auto it = std::find_if(
+        m_glyph_metric_uniforms.begin(), m_glyph_metric_uniforms.end(),
+        [name](const auto& entry) { return entry.first == name; }
+      );
+      if (it == m_glyph_metric_uniforms.end())
+      {
+        m_glyph_metric_uniforms.push_back({ name, {} });
+        it = m_glyph_metric_uniforms.end() - 1;
+      }
+
+      // the member names are only built the first time each element is set
+      std::vector<GlyphMetricUniforms>& uniforms = it->second;
+      for (int i = static_cast<int>(uniforms.size()); i < count; ++i)
+      {
+        // e.g. "u_glyphs[0]"
+        std::string base_name = std::string(name) + "[" + std::to_string(i) + "]";
+
+        GlyphMetricUniforms element;
+        element.advance = Internal_GetUniformLocation((base_name + ".advance").c_str());
+        element.size = Internal_GetUniformLocation((base_name + ".size").c_str());
+        element.bearing = Internal_GetUniformLocation((base_name + ".bearing").c_str());
+        element.uv_offset = Internal_GetUniformLocation((base_name + ".uvOffset").c_str());
+        element.uv_size = Internal_GetUniformLocation((base_name + ".uvSize").c_str());
+        uniforms.push_back(element);
+      }
+
+      return uniforms;
     }
 
     #pragma endregion
@@ -4,6 +4,13 @@
 // Wraps the opengl shader. 
 // Handles compiling and linking of the shader program. 
 //
+// The locations of the active uniforms are read once the program is linked
+// and kept in a table sorted by the hash of their names, so setting a uniform
+// never asks OpenGL for its location. Names that are not in the table (the
+// array name of a uniform array, or a uniform the driver optimized out) are
+// looked up once and added. GetUniform returns a typed handle for code that
+// sets the same uniform often enough to skip the table as well.
+//
 // AUTHORS
 // [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
 //   - Main Author
@@ -17,6 +24,12 @@
 #include "Utilities/file.h"
 #include "FlexMath/matrix4x4.h"
 #include "openglfont.h"
+
+#include <cstdint> // uint64_t
+#include <string>
+#include <utility> // std::pair
+#include <vector>
+
 namespace FlexEngine
 {
   namespace Asset
@@ -72,6 +85,10 @@ namespace FlexEngine
       // Load the shader from the metadata file
       void Load(Path metadata);
 
+      // Compile the shader from source instead of files, for generated shaders.
+      // The name is only used in error messages.
+      void LoadFromSource(const std::string& name, const std::string& vertex_source, const std::string& fragment_source);
+
       // Links the vertex and fragment shaders into a shader program
       void Destroy();
 
@@ -80,6 +97,27 @@ namespace FlexEngine
 
       #pragma region Set Uniforms
 
+      // Location of a uniform, typed so that it can only be set with a value of its type.
+      // Valid for as long as the shader is not reloaded.
+      template <typename T>
+      struct Uniform
+      {
+        int location = -1;
+
+        bool IsValid() const { return location >= 0; }
+      };
+
+      // Usage: auto u_alpha = shader.GetUniform<float>("u_alpha"); ... shader.SetUniform(u_alpha, 0.5f);
+      template <typename T>
+      Uniform<T> GetUniform(const char* name) const { return { Internal_GetUniformLocation(name) }; }
+
+      void SetUniform(Uniform<bool> uniform, bool value);
+      void SetUniform(Uniform<int> uniform, int value);
+      void SetUniform(Uniform<float> uniform, float value);
+      void SetUniform(Uniform<Vector2> uniform, const Vector2& vector);
+      void SetUniform(Uniform<Vector3> uniform, const Vector3& vector);
+      void SetUniform(Uniform<Matrix4x4> uniform, const Matrix4x4& matrix);
+
       void SetUniform_bool(const char* name, bool value);
       void SetUniform_int(const char* name, int value);
       void SetUniform_float(const char* name, float value);
@@ -108,6 +146,42 @@ namespace FlexEngine
       //void Internal_CreateGeometryShader(const Path& path_to_geometry_shader);
       void Internal_Link();
 
+      // INTERNAL FUNCTION
+      // Compiles one stage, logs error_message and the info log if it fails.
+      unsigned int Internal_Compile(unsigned int type, const std::string& source, const std::string& error_message);
+
+      // INTERNAL FUNCTION
+      // Fills the uniform table from the active uniforms of the linked program.
+      void Internal_ReflectUniforms();
+
+      // INTERNAL FUNCTION
+      // Returns -1 if the shader has no such uniform.
+      int Internal_GetUniformLocation(const char* name) const;
+
+      struct UniformRecord
+      {
+        uint64_t hash;
+        std::string name;
+        int location;
+      };
+
+      // Sorted by hash. Mutable because a missing name is added on its first lookup.
+      mutable std::vector<UniformRecord> m_uniforms;
+
+      // Locations of the members of each element of a GlyphMetric array uniform,
+      // built the first time the array is set.
+      struct GlyphMetricUniforms
+      {
+        int advance = -1;
+        int size = -1;
+        int bearing = -1;
+        int uv_offset = -1;
+        int uv_size = -1;
+      };
+      std::vector<std::pair<std::string, std::vector<GlyphMetricUniforms>>> m_glyph_metric_uniforms;
+
+      const std::vector<GlyphMetricUniforms>& Internal_GetGlyphMetricUniforms(const char* name, int count);
+
       #pragma endregion
 
       #pragma region Enums
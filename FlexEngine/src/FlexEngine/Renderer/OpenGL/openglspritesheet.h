@@ -16,6 +16,7 @@
 #include "flx_api.h"
 
 #include "Renderer/OpenGL/opengltexture.h"
+#include "assethandle.h"
 #include "assetkey.h"
 
 namespace FlexEngine
@@ -32,6 +33,7 @@ namespace FlexEngine
     {
       File& metadata;
       AssetKey texture = "";
+      AssetHandle<Texture> texture_asset; // resolved from texture on use, texture is only written when the spritesheet is loaded
       int columns = 1;
       int rows = 1;
       std::vector<float> frame_times = { 1.f };
@@ -0,0 +1,137 @@
+// WLVERSE [https://wlverse.web.app]
+// openglstate.cpp
+//
+// Cache of the OpenGL bindings that change between draws.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#include "pch.h"
+
+#include "openglstate.h"
+
+#include <array>
+
+namespace FlexEngine
+{
+
+  namespace
+  {
+    // no object has this id, so the first bind after an invalidate always reaches OpenGL
+    constexpr GLuint UNKNOWN = ~0u;
+    constexpr GLenum UNKNOWN_ENUM = ~0u;
+
+    using TextureUnits = std::array<GLuint, OpenGLState::MAX_TEXTURE_UNITS>;
+
+    constexpr TextureUnits UnknownTextures()
+    {
+      TextureUnits units{};
+      for (std::size_t i = 0; i < units.size(); i++) units[i] = UNKNOWN;
+      return units;
+    }
+
+    GLuint program = UNKNOWN;
+    GLuint vertex_array = UNKNOWN;
+    GLuint active_unit = UNKNOWN;
+    TextureUnits textures = UnknownTextures();
+
+    int blending = -1; // -1 unknown, 0 disabled, 1 enabled
+    GLenum blend_source = UNKNOWN_ENUM;
+    GLenum blend_destination = UNKNOWN_ENUM;
+  }
+
+  void OpenGLState::UseProgram(GLuint _program)
+  {
+    if (program == _program) return;
+    program = _program;
+    glUseProgram(_program);
+  }
+
+  void OpenGLState::BindTexture(GLuint texture, GLuint unit)
+  {
+    // guard: untracked units always reach OpenGL
+    if (unit >= MAX_TEXTURE_UNITS)
+    {
+      active_unit = unit;
+      glActiveTexture(GL_TEXTURE0 + unit);
+      glBindTexture(GL_TEXTURE_2D, texture);
+      return;
+    }
+
+    if (textures[unit] == texture) return;
+
+    if (active_unit != unit)
+    {
+      active_unit = unit;
+      glActiveTexture(GL_TEXTURE0 + unit);
+    }
+
+    textures[unit] = texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+  }
+
+  void OpenGLState::BindVertexArray(GLuint _vertex_array)
+  {
+    if (vertex_array == _vertex_array) return;
+    vertex_array = _vertex_array;
+    glBindVertexArray(_vertex_array);
+  }
+
+  void OpenGLState::SetBlending(bool enabled)
+  {
+    if (blending == static_cast<int>(enabled)) return;
+    blending = enabled;
+    if (enabled) glEnable(GL_BLEND);
+    else glDisable(GL_BLEND);
+  }
+
+  void OpenGLState::SetBlendFunc(GLenum source_factor, GLenum destination_factor)
+  {
+    if (blend_source == source_factor && blend_destination == destination_factor) return;
+    blend_source = source_factor;
+    blend_destination = destination_factor;
+    glBlendFunc(source_factor, destination_factor);
+  }
+
+  void OpenGLState::DeleteProgram(GLuint _program)
+  {
+    if (program == _program) program = UNKNOWN;
+    glDeleteProgram(_program);
+  }
+
+  void OpenGLState::DeleteTextures(GLsizei count, const GLuint* _textures)
+  {
+    for (GLsizei i = 0; i < count; i++)
+    {
+      for (GLuint& texture : textures)
+      {
+        if (texture == _textures[i]) texture = UNKNOWN;
+      }
+    }
+    glDeleteTextures(count, _textures);
+  }
+
+  void OpenGLState::DeleteVertexArrays(GLsizei count, const GLuint* vertex_arrays)
+  {
+    for (GLsizei i = 0; i < count; i++)
+    {
+      if (vertex_array == vertex_arrays[i]) vertex_array = UNKNOWN;
+    }
+    glDeleteVertexArrays(count, vertex_arrays);
+  }
+
+  void OpenGLState::Invalidate()
+  {
+    program = UNKNOWN;
+    vertex_array = UNKNOWN;
+    active_unit = UNKNOWN;
+    textures = UnknownTextures();
+    blending = -1;
+    blend_source = UNKNOWN_ENUM;
+    blend_destination = UNKNOWN_ENUM;
+  }
+
+}
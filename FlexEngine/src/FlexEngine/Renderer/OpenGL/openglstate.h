@@ -0,0 +1,70 @@
+// WLVERSE [https://wlverse.web.app]
+// openglstate.h
+//
+// Cache of the OpenGL bindings that change between draws.
+//
+// Every draw used to bind its shader, textures and vertex array and set the
+// blend mode, even when the previous draw left the same ones bound. These
+// functions remember what is bound and only call OpenGL when it changes.
+//
+// The cache only works if every bind goes through it. Objects must be deleted
+// through it too, a deleted id is unbound by OpenGL and can be reused by the
+// next object that is created. Code that changes the bindings behind its back
+// (e.g. a third party renderer that does not restore them) must call
+// Invalidate afterwards. The window invalidates the cache at the start of
+// every frame.
+//
+// Only GL_TEXTURE_2D is tracked, it is the only texture target the engine uses.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#pragma once
+
+#include "flx_api.h"
+
+#include <glad/glad.h>
+
+namespace FlexEngine
+{
+
+  class __FLX_API OpenGLState
+  {
+  public:
+    // static class
+    OpenGLState() = delete;
+    OpenGLState(const OpenGLState&) = delete;
+    OpenGLState& operator=(const OpenGLState&) = delete;
+
+    static constexpr GLuint MAX_TEXTURE_UNITS = 32;
+
+    // glUseProgram
+    static void UseProgram(GLuint program);
+
+    // glActiveTexture and glBindTexture(GL_TEXTURE_2D, texture)
+    // The active texture unit is left at unit.
+    static void BindTexture(GLuint texture, GLuint unit = 0);
+
+    // glBindVertexArray
+    static void BindVertexArray(GLuint vertex_array);
+
+    // glEnable(GL_BLEND) and glDisable(GL_BLEND)
+    static void SetBlending(bool enabled);
+
+    // glBlendFunc
+    static void SetBlendFunc(GLenum source_factor, GLenum destination_factor);
+
+    // glDeleteProgram, glDeleteTextures and glDeleteVertexArrays
+    // Forgets the deleted objects so that a reused id is bound again.
+    static void DeleteProgram(GLuint program);
+    static void DeleteTextures(GLsizei count, const GLuint* textures);
+    static void DeleteVertexArrays(GLsizei count, const GLuint* vertex_arrays);
+
+    // Forgets everything, the next call of each function reaches OpenGL.
+    static void Invalidate();
+  };
+
+}
@@ -15,6 +15,8 @@
 #include "pch.h"
 
 #include "opengltexture.h"
+#include "openglrenderer.h" // OpenGLRenderer::IsNullBackend
+#include "openglstate.h"
 
 #include <glad/glad.h>
 
@@ -28,9 +30,12 @@ namespace FlexEngine
 
   static void Internal_LoadTextureForOpenGL(unsigned int* out_texture, unsigned char* texture_data, int width, int height)
   {
+    // guard: the pixels stay on the cpu on the null backend
+    if (OpenGLRenderer::IsNullBackend()) return;
+
     // Create a OpenGL texture identifier
     glGenTextures(1, out_texture);
-    glBindTexture(GL_TEXTURE_2D, *out_texture);
+    OpenGLState::BindTexture(*out_texture);
 
     // Setup filtering parameters for display
     //glGenerateMipmap(GL_TEXTURE_2D);
@@ -250,10 +255,31 @@ namespace FlexEngine
 
       bool success = Internal_LoadTextureFromFile(path_to_texture.string().c_str(), &m_texture_data, &m_texture, &m_width, &m_height);
       // if no texture is loaded, bind the default texture
-      if (!success || !m_texture || !m_width || !m_height)
+      if (!success || (!m_texture && !OpenGLRenderer::IsNullBackend()) || !m_width || !m_height)
+      {
+        Load();
+      }
+    }
+
+    void Texture::Load(const unsigned char* texture_data, int width, int height)
+    {
+      // always unload the texture before loading
+      Unload();
+
+      // guard: bind the default texture for empty images
+      if (!texture_data || width <= 0 || height <= 0)
       {
         Load();
+        return;
       }
+
+      std::size_t texture_size = static_cast<std::size_t>(width) * height * 4;
+      m_texture_data = new unsigned char[texture_size];
+      memcpy(m_texture_data, texture_data, texture_size);
+      m_width = width;
+      m_height = height;
+
+      Internal_LoadTextureForOpenGL(&m_texture, m_texture_data, m_width, m_height);
     }
 
     void Texture::Unload()
@@ -266,7 +292,7 @@ namespace FlexEngine
 
       if (m_texture)
       {
-        glDeleteTextures(1, &m_texture);
+        OpenGLState::DeleteTextures(1, &m_texture);
         m_texture = 0;
       }
 
@@ -279,18 +305,19 @@ namespace FlexEngine
 
     void Texture::Bind(const Shader& shader, const char* name, unsigned int texture_unit) const
     {
-      glActiveTexture(GL_TEXTURE0 + texture_unit);
+      if (OpenGLRenderer::IsNullBackend()) return;
 
       std::string texture_name = name;
       texture_name += std::to_string(texture_unit);
-      glUniform1i(glGetUniformLocation(shader.Get(), texture_name.c_str()), texture_unit);
+      glUniform1i(shader.GetUniform<int>(texture_name.c_str()).location, texture_unit);
 
-      glBindTexture(GL_TEXTURE_2D, m_texture);
+      OpenGLState::BindTexture(m_texture, texture_unit);
     }
 
     void Texture::Unbind() const
     {
-      glBindTexture(GL_TEXTURE_2D, 0);
+      if (OpenGLRenderer::IsNullBackend()) return;
+      OpenGLState::BindTexture(0);
     }
 
     #pragma endregion
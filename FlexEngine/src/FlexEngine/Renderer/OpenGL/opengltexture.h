@@ -73,6 +73,10 @@ namespace FlexEngine
       // Load a texture from a path
       void Load(const Path& path_to_texture);
 
+      // Load a texture from RGBA8 pixels, width * height * 4 bytes
+      // Used for cooked textures that are already decoded
+      void Load(const unsigned char* texture_data, int width, int height);
+
       void Unload();
 
       #pragma endregion
@@ -12,6 +12,7 @@
 /////////////////////////////////////////////////////////////////////////////
 
 #include "videodecoder.h"
+#include "openglstate.h"
 #include <FlexEngine.h>
 
 
@@ -136,20 +137,25 @@ namespace FlexEngine
 		m_frame = av_frame_alloc();
 
 		#pragma region OpenGL 
+		// Frames are still decoded on the null backend, only the texture is skipped
+		const bool upload = !OpenGLRenderer::IsNullBackend();
+
 		// Create a OpenGL texture identifier
-		glGenTextures(1, &m_texture);
-		glActiveTexture(GL_TEXTURE0);
-		glBindTexture(GL_TEXTURE_2D, m_texture);
+		if (upload)
+		{
+			glGenTextures(1, &m_texture);
+			OpenGLState::BindTexture(m_texture, 0);
 
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST); // GL_NEAREST for pixel art, find some way to toggle this for non-pixel art
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST); // GL_NEAREST for pixel art, find some way to toggle this for non-pixel art
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+		}
 
 		// Upload pixels into opengl texture
 		if (!DecodeNextFrame()) Log::Error("Video first frame Decode failed");
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, m_width, m_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, m_rgba_data[0]);
+		if (upload) glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, m_width, m_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, m_rgba_data[0]);
 		//glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, m_width, m_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
 		#pragma endregion
 
@@ -161,13 +167,13 @@ namespace FlexEngine
 
 	void VideoDecoder::Bind(const Asset::Shader& shader, const char* name, unsigned int texture_unit) const
 	{
-		glActiveTexture(GL_TEXTURE0 + texture_unit);
+		if (OpenGLRenderer::IsNullBackend()) return;
 
 		std::string texture_name = name;
 		texture_name += std::to_string(texture_unit);
-		glUniform1i(glGetUniformLocation(shader.Get(), texture_name.c_str()), texture_unit);
+		glUniform1i(shader.GetUniform<int>(texture_name.c_str()).location, texture_unit);
 
-		glBindTexture(GL_TEXTURE_2D, m_texture);
+		OpenGLState::BindTexture(m_texture, texture_unit);
 		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, m_width, m_height, GL_RGBA, GL_UNSIGNED_BYTE, m_rgba_data[0]);
 	}
 
@@ -0,0 +1,591 @@
+// WLVERSE [https://wlverse.web.app]
+// postprocessgraph.cpp
+//
+// Compiled chain of post processing effects.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#include "pch.h"
+
+#include "postprocessgraph.h"
+
+#include "Renderer/OpenGL/openglshader.h"
+#include "DataStructures/freequeue.h"
+
+#include <GLFW/glfw3.h> // glfwGetTime
+
+namespace FlexEngine
+{
+
+  #pragma region Effects
+
+  PostProcessGraph::EffectKind PostProcessGraph::GetKind(Effect effect)
+  {
+    switch (effect)
+    {
+    case Effect::Bloom:
+    case Effect::GaussianBlur:
+      return EffectKind::MultiPass;
+    case Effect::ChromaticAberration:
+    case Effect::Pixelate:
+    case Effect::Warp:
+      return EffectKind::Remap;
+    case Effect::ColorGrading:
+    case Effect::Vignette:
+    case Effect::FilmGrain:
+    default:
+      return EffectKind::Point;
+    }
+  }
+
+  const char* PostProcessGraph::GetName(Effect effect)
+  {
+    switch (effect)
+    {
+    case Effect::Bloom:               return "Bloom";
+    case Effect::GaussianBlur:        return "GaussianBlur";
+    case Effect::ChromaticAberration: return "ChromaticAberration";
+    case Effect::ColorGrading:        return "ColorGrading";
+    case Effect::Vignette:            return "Vignette";
+    case Effect::FilmGrain:           return "FilmGrain";
+    case Effect::Pixelate:            return "Pixelate";
+    case Effect::Warp:                return "Warp";
+    default:                          return "Unknown";
+    }
+  }
+
+  bool PostProcessGraph::Description::operator==(const Description& other) const
+  {
+    return effects == other.effects
+      && bloom_blur_passes == other.bloom_blur_passes
+      && blur_passes == other.blur_passes;
+  }
+
+  PostProcessGraph::Description PostProcessGraph::Describe(const Renderer2D_GlobalPPSettings& settings)
+  {
+    Description description;
+    if (settings.enableBloom) description.effects.push_back(Effect::Bloom);
+    if (settings.enableGaussianBlur) description.effects.push_back(Effect::GaussianBlur);
+    if (settings.enableChromaticAberration) description.effects.push_back(Effect::ChromaticAberration);
+    if (settings.enableColorGrading) description.effects.push_back(Effect::ColorGrading);
+    if (settings.enableVignette) description.effects.push_back(Effect::Vignette);
+    if (settings.enableFilmGrain) description.effects.push_back(Effect::FilmGrain);
+    if (settings.enablePixelate) description.effects.push_back(Effect::Pixelate);
+    if (settings.enableWarp) description.effects.push_back(Effect::Warp);
+
+    // the pass counts only change the graph when their effect is in it
+    if (settings.enableBloom) description.bloom_blur_passes = (std::max)(settings.bloomBlurPasses, 0);
+    if (settings.enableGaussianBlur) description.blur_passes = (std::max)(settings.blurPasses, 0);
+
+    return description;
+  }
+
+  #pragma endregion
+
+  #pragma region Compile
+
+  bool PostProcessGraph::Compile(const Description& description, bool write_to_destination)
+  {
+    // guard: nothing changed
+    if (m_compiled && m_description == description && m_write_to_destination == write_to_destination) return false;
+
+    m_description = description;
+    m_write_to_destination = write_to_destination;
+    m_compiled = true;
+    m_passes.clear();
+    m_target_count = 0;
+
+    // Build the passes with every result numbered on its own, the numbers are
+    // replaced by framebuffer slots below.
+    Target next_value = 0;
+    Target current = SOURCE;
+
+    auto add_pass = [&](PassType type, Effect owner, std::initializer_list<Target> inputs) -> Pass&
+    {
+      Pass pass;
+      pass.type = type;
+      pass.owner = owner;
+      for (Target input : inputs) pass.inputs[pass.input_count++] = input;
+      pass.output = next_value++;
+      m_passes.push_back(std::move(pass));
+      return m_passes.back();
+    };
+
+    // H/V ping-pong like the original loop, returns the last horizontal and
+    // vertical results (NONE if that direction never ran)
+    auto add_blur = [&](Effect owner, Target input, int passes, Target& last_horizontal, Target& last_vertical)
+    {
+      last_horizontal = last_vertical = NONE;
+      bool horizontal = true;
+      for (int i = 0; i < passes; ++i)
+      {
+        input = add_pass(horizontal ? PassType::BlurHorizontal : PassType::BlurVertical, owner, { input }).output;
+        (horizontal ? last_horizontal : last_vertical) = input;
+        horizontal = !horizontal;
+      }
+    };
+
+    // fused pass that can still take point effects
+    constexpr size_t no_group = ~size_t(0);
+    size_t open_group = no_group;
+
+    for (Effect effect : description.effects)
+    {
+      switch (GetKind(effect))
+      {
+      case EffectKind::Point:
+        if (open_group == no_group)
+        {
+          current = add_pass(PassType::Fused, effect, { current }).output;
+          open_group = m_passes.size() - 1;
+        }
+        m_passes[open_group].fused.push_back(effect);
+        break;
+
+      case EffectKind::Remap:
+        // reads pixels the open group has not written yet, so it starts a new one
+        current = add_pass(PassType::Fused, effect, { current }).output;
+        open_group = m_passes.size() - 1;
+        m_passes[open_group].fused.push_back(effect);
+        break;
+
+      case EffectKind::MultiPass:
+      {
+        open_group = no_group;
+        Target last_horizontal, last_vertical;
+        if (effect == Effect::Bloom)
+        {
+          Target bright = add_pass(PassType::BrightnessExtract, effect, { current }).output;
+          add_blur(effect, bright, description.bloom_blur_passes, last_horizontal, last_vertical);
+          current = add_pass(PassType::BloomComposite, effect, { current, last_horizontal, last_vertical }).output;
+        }
+        else
+        {
+          add_blur(effect, current, description.blur_passes, last_horizontal, last_vertical);
+          current = add_pass(PassType::BlurComposite, effect, { last_horizontal, last_vertical }).output;
+        }
+        break;
+      }
+      }
+    }
+
+    // guard: empty chain, the result is the source
+    if (m_passes.empty())
+    {
+      m_result = SOURCE;
+      return true;
+    }
+
+    if (write_to_destination) m_passes.back().output = DESTINATION;
+
+    #pragma region Target Allocation
+
+    // Linear scan: a result holds its slot from the pass that writes it to the
+    // last pass that reads it. The output of a pass is given a slot before its
+    // inputs are released, so a pass never reads and writes the same framebuffer.
+    const Target result_value = m_passes.back().output;
+
+    std::vector<size_t> last_use(next_value, 0);
+    for (size_t i = 0; i < m_passes.size(); ++i)
+    {
+      const Pass& pass = m_passes[i];
+      if (pass.output < next_value) last_use[pass.output] = i;
+      for (uint8_t j = 0; j < pass.input_count; ++j)
+      {
+        if (pass.inputs[j] < next_value) last_use[pass.inputs[j]] = i;
+      }
+    }
+
+    std::vector<Target> slot_of(next_value, NONE);
+    std::vector<bool> slot_in_use;
+
+    for (size_t i = 0; i < m_passes.size(); ++i)
+    {
+      Pass& pass = m_passes[i];
+      const Target value = pass.output;
+
+      if (value < next_value)
+      {
+        Target slot = 0;
+        while (slot < slot_in_use.size() && slot_in_use[slot]) ++slot;
+        if (slot == slot_in_use.size()) slot_in_use.push_back(false);
+        slot_in_use[slot] = true;
+        slot_of[value] = slot;
+        pass.output = slot;
+
+        // never read, free straight away
+        if (last_use[value] == i && value != result_value) slot_in_use[slot] = false;
+      }
+
+      for (uint8_t j = 0; j < pass.input_count; ++j)
+      {
+        const Target input = pass.inputs[j];
+        if (input >= next_value) continue;
+
+        pass.inputs[j] = slot_of[input];
+        if (last_use[input] == i && input != result_value) slot_in_use[slot_of[input]] = false;
+      }
+    }
+
+    m_target_count = static_cast<uint32_t>(slot_in_use.size());
+    m_result = m_passes.back().output;
+
+    #pragma endregion
+
+    return true;
+  }
+
+  #pragma endregion
+
+  #pragma region Shader Generation
+
+  namespace
+  {
+    const char* vertex_source = R"(#version 330 core
+
+layout (location = 0) in vec3 m_position;
+layout (location = 1) in vec2 m_tex_coord;
+
+out vec2 tex_coord;
+
+void main()
+{
+    gl_Position = vec4(m_position, 1.0);
+    tex_coord = m_tex_coord;
+}
+)";
+
+    // The bodies are the ones in assets/shaders, turned into functions so they can be chained.
+
+    const char* chromatic_aberration_source = R"(
+uniform float u_ChromaIntensity;
+uniform vec2 u_RedOffset;
+uniform vec2 u_GreenOffset;
+uniform vec2 u_BlueOffset;
+uniform vec2 u_EdgeRadius;
+uniform vec2 u_EdgeSoftness;
+
+vec4 fx_ChromaticAberration(vec2 uv)
+{
+    vec2 texDim = vec2(textureSize(u_InputTex, 0));
+    vec2 normRed   = (u_RedOffset   / texDim) * u_ChromaIntensity;
+    vec2 normGreen = (u_GreenOffset / texDim) * u_ChromaIntensity;
+    vec2 normBlue  = (u_BlueOffset  / texDim) * u_ChromaIntensity;
+
+    float distX = min(uv.x, 1.0 - uv.x);
+    float distY = min(uv.y, 1.0 - uv.y);
+    float factorX = 1.0 - smoothstep(u_EdgeRadius.x, u_EdgeRadius.x + u_EdgeSoftness.x, distX);
+    float factorY = 1.0 - smoothstep(u_EdgeRadius.y, u_EdgeRadius.y + u_EdgeSoftness.y, distY);
+    float edgeFactor = max(factorX, factorY);
+
+    float red   = texture(u_InputTex, uv + normRed * edgeFactor).r;
+    float green = texture(u_InputTex, uv + normGreen * edgeFactor).g;
+    float blue  = texture(u_InputTex, uv + normBlue * edgeFactor).b;
+    return vec4(red, green, blue, texture(u_InputTex, uv).a);
+}
+)";
+
+    const char* pixelate_source = R"(
+uniform float u_PixelWidth;
+uniform float u_PixelHeight;
+
+vec4 fx_Pixelate(vec2 uv)
+{
+    ivec2 texSize = textureSize(u_InputTex, 0);
+    vec2 blockSize = vec2(u_PixelWidth / float(texSize.x), u_PixelHeight / float(texSize.y));
+    vec2 snapped = floor(uv / blockSize) * blockSize + blockSize * 0.5;
+    return vec4(texture(u_InputTex, snapped).rgb, 1.0);
+}
+)";
+
+    const char* warp_source = R"(
+uniform float u_WarpStrength;
+uniform float u_WarpRadius;
+
+vec4 fx_Warp(vec2 uv)
+{
+    vec2 offset = uv - vec2(0.5, 0.5);
+    float r = length(offset);
+    if (r > u_WarpRadius) return texture(u_InputTex, uv);
+
+    float theta = atan(offset.y, offset.x);
+    float rn = r / u_WarpRadius;
+    float rDistorted = r * (1.0 + u_WarpStrength * rn * rn);
+    vec2 newUV = clamp(vec2(0.5, 0.5) + vec2(cos(theta), sin(theta)) * rDistorted, 0.0, 1.0);
+    return texture(u_InputTex, newUV);
+}
+)";
+
+    const char* color_grading_source = R"(
+uniform float u_Brightness;
+uniform float u_Contrast;
+uniform float u_Saturation;
+
+vec4 fx_ColorGrading(vec4 color, vec2 uv)
+{
+    vec3 c = color.rgb + u_Brightness;
+    c = (c - 0.5) * u_Contrast + 0.5;
+    float luminance = dot(c, vec3(0.2126, 0.7152, 0.0722));
+    return vec4(mix(vec3(luminance), c, u_Saturation), 1.0);
+}
+)";
+
+    const char* vignette_source = R"(
+uniform float u_VignetteIntensity;
+uniform vec2 u_VignetteRadius;
+uniform vec2 u_VignetteSoftness;
+
+vec4 fx_Vignette(vec4 color, vec2 uv)
+{
+    float distX = min(uv.x, 1.0 - uv.x);
+    float distY = min(uv.y, 1.0 - uv.y);
+    float factorX = 1.0 - smoothstep(u_VignetteRadius.x, u_VignetteRadius.x + u_VignetteSoftness.x, distX);
+    float factorY = 1.0 - smoothstep(u_VignetteRadius.y, u_VignetteRadius.y + u_VignetteSoftness.y, distY);
+    float edgeFactor = max(factorX, factorY);
+    return vec4(color.rgb * (1.0 - u_VignetteIntensity * edgeFactor), 1.0);
+}
+)";
+
+    const char* film_grain_source = R"(
+uniform float u_FilmGrainIntensity;
+uniform float u_FilmGrainSize;
+uniform int u_FilmGrainAnimate;
+uniform float u_Time;
+
+float rand(vec2 co)
+{
+    return fract(sin(dot(co.xy, vec2(12.9898, 78.233))) * 43758.5453);
+}
+
+vec4 fx_FilmGrain(vec4 color, vec2 uv)
+{
+    vec2 grainUV = uv * u_FilmGrainSize;
+    if (u_FilmGrainAnimate == 1) grainUV += vec2(u_Time);
+    float noise = rand(grainUV) - 0.5;
+    return vec4(color.rgb + noise * u_FilmGrainIntensity, 1.0);
+}
+)";
+
+    const char* GetEffectSource(PostProcessGraph::Effect effect)
+    {
+      using Effect = PostProcessGraph::Effect;
+      switch (effect)
+      {
+      case Effect::ChromaticAberration: return chromatic_aberration_source;
+      case Effect::Pixelate:            return pixelate_source;
+      case Effect::Warp:                return warp_source;
+      case Effect::ColorGrading:        return color_grading_source;
+      case Effect::Vignette:            return vignette_source;
+      case Effect::FilmGrain:           return film_grain_source;
+      default:                          return "";
+      }
+    }
+  }
+
+  std::string PostProcessGraph::GenerateFusedShader(const std::vector<Effect>& effects)
+  {
+    std::string source =
+      "#version 330 core\n"
+      "\n"
+      "in vec2 tex_coord;\n"
+      "out vec4 FragColor;\n"
+      "\n"
+      "uniform sampler2D u_InputTex;\n";
+
+    for (Effect effect : effects) source += GetEffectSource(effect);
+
+    source += "\nvoid main()\n{\n";
+
+    size_t first_point = 0;
+    if (!effects.empty() && GetKind(effects.front()) == EffectKind::Remap)
+    {
+      source += "    vec4 color = fx_" + std::string(GetName(effects.front())) + "(tex_coord);\n";
+      first_point = 1;
+    }
+    else
+    {
+      source += "    vec4 color = texture(u_InputTex, tex_coord);\n";
+    }
+
+    // clamped like it would be when stored between separate passes
+    for (size_t i = first_point; i < effects.size(); ++i)
+    {
+      source += "    color = clamp(fx_" + std::string(GetName(effects[i])) + "(color, tex_coord), 0.0, 1.0);\n";
+    }
+
+    source += "    FragColor = color;\n}\n";
+    return source;
+  }
+
+  #pragma endregion
+
+  #pragma region Execute
+
+  namespace
+  {
+    // generated shaders, keyed by the effects of the fused pass
+    std::unordered_map<std::string, std::unique_ptr<Asset::Shader>> fused_shaders;
+
+    Asset::Shader& GetFusedShader(const std::vector<PostProcessGraph::Effect>& effects)
+    {
+      std::string key(effects.size(), '\0');
+      for (size_t i = 0; i < effects.size(); ++i) key[i] = static_cast<char>(effects[i]);
+
+      auto it = fused_shaders.find(key);
+      if (it != fused_shaders.end()) return *it->second;
+
+      if (fused_shaders.empty()) FreeQueue::Push(&PostProcessGraph::ReleaseShaders, "PostProcessGraph");
+
+      std::string name = "Fused Post Processing";
+      for (PostProcessGraph::Effect effect : effects) name += std::string(" ") + PostProcessGraph::GetName(effect);
+
+      auto shader = std::make_unique<Asset::Shader>();
+      shader->LoadFromSource(name, vertex_source, PostProcessGraph::GenerateFusedShader(effects));
+      return *fused_shaders.emplace(std::move(key), std::move(shader)).first->second;
+    }
+
+    void SetFusedUniforms(Asset::Shader& shader, PostProcessGraph::Effect effect, const Renderer2D_GlobalPPSettings& settings)
+    {
+      using Effect = PostProcessGraph::Effect;
+      switch (effect)
+      {
+      case Effect::ChromaticAberration:
+        shader.SetUniform_float("u_ChromaIntensity", settings.chromaIntensity);
+        shader.SetUniform_vec2("u_RedOffset", settings.chromaRedOffset);
+        shader.SetUniform_vec2("u_GreenOffset", settings.chromaGreenOffset);
+        shader.SetUniform_vec2("u_BlueOffset", settings.chromaBlueOffset);
+        shader.SetUniform_vec2("u_EdgeRadius", settings.chromaEdgeRadius);
+        shader.SetUniform_vec2("u_EdgeSoftness", settings.chromaEdgeSoftness);
+        break;
+      case Effect::Pixelate:
+        shader.SetUniform_float("u_PixelWidth", static_cast<float>(settings.pixelWidth));
+        shader.SetUniform_float("u_PixelHeight", static_cast<float>(settings.pixelHeight));
+        break;
+      case Effect::Warp:
+        shader.SetUniform_float("u_WarpStrength", settings.warpStrength);
+        shader.SetUniform_float("u_WarpRadius", settings.warpRadius);
+        break;
+      case Effect::ColorGrading:
+        shader.SetUniform_float("u_Brightness", settings.colorBrightness);
+        shader.SetUniform_float("u_Contrast", settings.colorContrast);
+        shader.SetUniform_float("u_Saturation", settings.colorSaturation);
+        break;
+      case Effect::Vignette:
+        shader.SetUniform_float("u_VignetteIntensity", settings.vignetteIntensity);
+        shader.SetUniform_vec2("u_VignetteRadius", settings.vignetteRadius);
+        shader.SetUniform_vec2("u_VignetteSoftness", settings.vignetteSoftness);
+        break;
+      case Effect::FilmGrain:
+        shader.SetUniform_float("u_FilmGrainIntensity", settings.filmGrainIntensity);
+        shader.SetUniform_float("u_FilmGrainSize", settings.filmGrainSize);
+        shader.SetUniform_int("u_FilmGrainAnimate", settings.filmGrainAnimate ? 1 : 0);
+        if (settings.filmGrainAnimate) shader.SetUniform_float("u_Time", static_cast<float>(glfwGetTime()));
+        break;
+      default:
+        break;
+      }
+    }
+  }
+
+  OpenGLFrameBufferManager::Handle PostProcessGraph::Execute(
+    OpenGLFrameBufferManager& manager,
+    std::vector<OpenGLFrameBufferManager::Handle>& pool,
+    OpenGLFrameBufferManager::Handle source,
+    OpenGLFrameBufferManager::Handle destination,
+    const Renderer2D_GlobalPPSettings& settings
+  ) const
+  {
+    FLX_FLOW_FUNCTION();
+
+    // guard: nothing to run
+    OpenGLFrameBuffer* source_framebuffer = manager.GetFrameBuffer(source);
+    if (m_passes.empty() || !source_framebuffer) return source;
+
+    // intermediate targets match the source
+    const int width = source_framebuffer->GetWidth();
+    const int height = source_framebuffer->GetHeight();
+    while (pool.size() < m_target_count)
+    {
+      std::string name = "Post Processing Transient " + std::to_string(pool.size());
+      pool.push_back(manager.AddFrameBuffer(name, Vector2(static_cast<float>(width), static_cast<float>(height))));
+    }
+    for (uint32_t i = 0; i < m_target_count; ++i)
+    {
+      OpenGLFrameBuffer* framebuffer = manager.GetFrameBuffer(pool[i]);
+      if (framebuffer->GetWidth() != width || framebuffer->GetHeight() != height) framebuffer->Resize(width, height);
+    }
+
+    auto to_handle = [&](Target target) -> OpenGLFrameBufferManager::Handle
+    {
+      if (target == SOURCE) return source;
+      if (target == DESTINATION) return destination;
+      return pool[target];
+    };
+
+    auto to_texture = [&](Target target) -> GLuint
+    {
+      if (target == NONE) return 0;
+      return manager.GetFrameBuffer(to_handle(target))->GetColorAttachment();
+    };
+
+    for (const Pass& pass : m_passes)
+    {
+      manager.SetCurrentFrameBuffer(to_handle(pass.output));
+      OpenGLRenderer::ClearFrameBuffer();
+
+      const GLuint input = to_texture(pass.inputs[0]);
+      const bool is_bloom = (pass.owner == Effect::Bloom);
+
+      switch (pass.type)
+      {
+      case PassType::BrightnessExtract:
+        OpenGLRenderer::ApplyBrightnessPass(input, settings.bloomThreshold);
+        break;
+
+      case PassType::BlurHorizontal:
+      case PassType::BlurVertical:
+        OpenGLRenderer::ApplyGaussianBlur(
+          input,
+          is_bloom ? settings.bloomBlurDistance : settings.blurDistance,
+          is_bloom ? settings.bloomBlurIntensity : settings.blurIntensity,
+          pass.type == PassType::BlurHorizontal
+        );
+        break;
+
+      case PassType::BloomComposite:
+        OpenGLRenderer::ApplyBloomFinalComposition(
+          input, to_texture(pass.inputs[1]), to_texture(pass.inputs[2]),
+          settings.bloomIntensity, settings.bloomRadius
+        );
+        break;
+
+      case PassType::BlurComposite:
+        OpenGLRenderer::ApplyBlurFinalComposition(input, to_texture(pass.inputs[1]));
+        break;
+
+      case PassType::Fused:
+      {
+        Asset::Shader& shader = GetFusedShader(pass.fused);
+        shader.Use();
+        for (Effect effect : pass.fused) SetFusedUniforms(shader, effect, settings);
+        OpenGLRenderer::ApplyPostProcessShader(shader, input);
+        break;
+      }
+      }
+    }
+
+    return to_handle(m_result);
+  }
+
+  void PostProcessGraph::ReleaseShaders()
+  {
+    fused_shaders.clear();
+  }
+
+  #pragma endregion
+
+}
@@ -0,0 +1,163 @@
+// WLVERSE [https://wlverse.web.app]
+// postprocessgraph.h
+//
+// Compiled chain of post processing effects.
+//
+// The effects used to run one after the other, each drawing into a scratch
+// framebuffer and copying the result back into the source. The graph is
+// compiled from the list of enabled effects instead, only when that list
+// changes, into a list of passes where:
+//  - consecutive per-pixel effects are fused into one pass with a generated
+//    shader (see GenerateFusedShader), a fused pass may start with one effect
+//    that samples its input somewhere else (chromatic aberration, pixelate,
+//    warp), every other effect in it only reads the pixel it writes
+//  - bloom and the Gaussian blur expand into their brightness, blur and
+//    composite passes, they read neighbouring pixels so they are never fused
+//  - every pass reads the previous pass's output directly, nothing is copied
+//  - the intermediate results share as few framebuffers as their lifetimes
+//    allow, a framebuffer is reused as soon as its last reader has run
+//
+// Compiling does not touch OpenGL, so the passes, fusion and target allocation
+// can be tested without a GPU. Execute runs the passes with framebuffer handles.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#pragma once
+
+#include "flx_api.h"
+
+#include "Renderer/OpenGL/openglframebuffermanager.h"
+#include "Renderer/OpenGL/openglrenderer.h" // Renderer2D_GlobalPPSettings
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace FlexEngine
+{
+
+  class __FLX_API PostProcessGraph
+  {
+  public:
+    enum class Effect : uint8_t
+    {
+      Bloom,
+      GaussianBlur,
+      ChromaticAberration,
+      ColorGrading,
+      Vignette,
+      FilmGrain,
+      Pixelate,
+      Warp
+    };
+
+    // How an effect reads its input, which decides what it can be fused with.
+    enum class EffectKind : uint8_t
+    {
+      Point,    // reads only the pixel it writes
+      Remap,    // reads a few pixels at computed coordinates, can start a fused pass
+      MultiPass // reads neighbourhoods of intermediate results, never fused
+    };
+
+    static EffectKind GetKind(Effect effect);
+    static const char* GetName(Effect effect);
+
+    // What to compile. Two equal descriptions compile to the same graph.
+    struct __FLX_API Description
+    {
+      std::vector<Effect> effects; // in the order they are applied
+      int bloom_blur_passes = 0;
+      int blur_passes = 0;
+
+      bool operator==(const Description& other) const;
+      bool operator!=(const Description& other) const { return !(*this == other); }
+    };
+
+    // The enabled effects of the settings, in the order the post processing has always applied them.
+    static Description Describe(const Renderer2D_GlobalPPSettings& settings);
+
+    #pragma region Compiled Graph
+
+    // A pass input or output. Intermediate results are numbered from 0, the
+    // number is the framebuffer slot they were given, not the result.
+    using Target = uint32_t;
+    static constexpr Target SOURCE = ~0u - 2;      // the framebuffer the chain reads
+    static constexpr Target DESTINATION = ~0u - 1; // the framebuffer the chain writes, if it has one
+    static constexpr Target NONE = ~0u;            // nothing was written, reads as an empty texture
+
+    enum class PassType : uint8_t
+    {
+      Fused,
+      BrightnessExtract,
+      BlurHorizontal,
+      BlurVertical,
+      BloomComposite,
+      BlurComposite
+    };
+
+    struct __FLX_API Pass
+    {
+      PassType type = PassType::Fused;
+      Effect owner = Effect::Bloom;   // the effect the pass belongs to, the first one for fused passes
+      std::vector<Effect> fused;      // fused passes only, applied in order
+      std::array<Target, 3> inputs = { NONE, NONE, NONE };
+      uint8_t input_count = 0;
+      Target output = NONE;
+    };
+
+    // Compiles the description unless it is the one already compiled.
+    // With write_to_destination the last pass writes DESTINATION, otherwise the
+    // result is left in an intermediate framebuffer (see GetResult).
+    // Returns true if the graph was compiled.
+    bool Compile(const Description& description, bool write_to_destination);
+
+    const Description& GetDescription() const { return m_description; }
+    const std::vector<Pass>& GetPasses() const { return m_passes; }
+
+    // Number of intermediate framebuffers the passes need
+    uint32_t GetTargetCount() const { return m_target_count; }
+
+    // Where the chain's result ends up: SOURCE if there are no passes,
+    // DESTINATION if it was asked for, an intermediate otherwise.
+    Target GetResult() const { return m_result; }
+
+    // The fragment shader of a fused pass. The effects must be a valid fused
+    // pass: one optional Remap effect followed by Point effects.
+    static std::string GenerateFusedShader(const std::vector<Effect>& effects);
+
+    #pragma endregion
+
+    #pragma region Execution
+
+    // Runs the passes. Intermediate targets are taken from the pool, which is
+    // shared between graphs that run one after the other and grows as needed.
+    // Returns the framebuffer holding the result.
+    OpenGLFrameBufferManager::Handle Execute(
+      OpenGLFrameBufferManager& manager,
+      std::vector<OpenGLFrameBufferManager::Handle>& pool,
+      OpenGLFrameBufferManager::Handle source,
+      OpenGLFrameBufferManager::Handle destination,
+      const Renderer2D_GlobalPPSettings& settings
+    ) const;
+
+    // Deletes the generated shaders of every graph.
+    static void ReleaseShaders();
+
+    #pragma endregion
+
+  private:
+    Description m_description;
+    bool m_compiled = false;
+    bool m_write_to_destination = false;
+
+    std::vector<Pass> m_passes;
+    uint32_t m_target_count = 0;
+    Target m_result = SOURCE;
+  };
+
+}
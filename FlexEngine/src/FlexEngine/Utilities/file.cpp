@@ -59,6 +59,9 @@ namespace FlexEngine
     FLX_FLOW_FUNCTION();
     FLX_SCOPED_TIMER(__FUNCTION__ + std::string(" ") + std::to_string(path));
 
+    // guard: already in memory, see AssetArchive
+    if (preloaded) return data;
+
     // guard
     if (!path.is_file())
     {
@@ -46,6 +46,10 @@ namespace FlexEngine
     Path path;
     std::string data;
 
+    // Set for files that were loaded from the cooked asset archive,
+    // Read() returns the data instead of reading the file from disk.
+    bool preloaded = false;
+
     #pragma region File Registry Management Functions
 
     // Adds a file to the registry if it doesn't exist
@@ -86,6 +86,17 @@ namespace FlexEngine
 
   std::string FlxFmtFile::ToString() const
   {
+    if (metadata.encoding == FlxFmtEncoding::Binary)
+    {
+      Reflection::BinaryWriter out(data.size() + 32);
+      out.WriteBytes(FLXFMT_BINARY_MAGIC, 4);
+      out.WriteVarUInt(metadata.format_version);
+      out.WriteVarUInt(metadata.save_version);
+      out.WriteU64(metadata.schema_hash);
+      out.WriteBytes(data.data(), data.size());
+      return out.GetBuffer();
+    }
+
     std::string out;
     out = std::string("{") +
       R"("format":)"          + R"(")" + metadata.format                                  + R"(")" + R"(,)" +
@@ -117,6 +128,8 @@ namespace FlexEngine
       metadata.last_edited      == other.metadata.last_edited &&
       metadata.save_version     == other.metadata.save_version &&
       metadata.file_type        == other.metadata.file_type &&
+      metadata.encoding         == other.metadata.encoding &&
+      metadata.schema_hash      == other.metadata.schema_hash &&
       data                      == other.data
     ;
   }
@@ -141,6 +154,20 @@ namespace FlexEngine
     return file;
   }
 
+  FlxFmtFile FlexFormatter::CreateBinary(const std::string& data, uint64_t schema_hash, bool save_version_enabled)
+  {
+    FlxFmtFile file = Create(data, save_version_enabled);
+    file.metadata.encoding = FlxFmtEncoding::Binary;
+    file.metadata.schema_hash = schema_hash;
+    return file;
+  }
+
+  FlxFmtEncoding FlexFormatter::DetectEncoding(const std::string& contents)
+  {
+    if (contents.size() >= 4 && contents.compare(0, 4, FLXFMT_BINARY_MAGIC) == 0) return FlxFmtEncoding::Binary;
+    return FlxFmtEncoding::Json;
+  }
+
   FlxFmtFile FlexFormatter::Parse(FlexEngine::File& file, FlxFmtFileType expected_file_type)
   {
     // read file into file.data
@@ -181,6 +208,38 @@ namespace FlexEngine
       return FlxFmtFile::Null;
     }
 
+    // binary files have their own header, the data is left for the caller to deserialize
+    if (DetectEncoding(file.data) == FlxFmtEncoding::Binary)
+    {
+      Reflection::BinaryReader in(file.data.data() + 4, file.data.size() - 4);
+
+      FlxFmtFile flxfmtfile = FlxFmtFile::Null;
+      flxfmtfile.metadata.format_version = static_cast<FlxFmtMetadata::Version>(in.ReadVarUInt());
+      flxfmtfile.metadata.save_version = static_cast<FlxFmtMetadata::Version>(in.ReadVarUInt());
+      flxfmtfile.metadata.schema_hash = in.ReadU64();
+      flxfmtfile.metadata.file_type = file_type;
+      flxfmtfile.metadata.encoding = FlxFmtEncoding::Binary;
+
+      if (in.Failed())
+      {
+        Log::Error("Truncated binary header in file: " + file.path.string());
+        return FlxFmtFile::Null;
+      }
+
+      if (flxfmtfile.metadata.format_version != FLXFMT_VERSION)
+      {
+        Log::Warning(
+          "File format version mismatch: " + std::to_string(flxfmtfile.metadata.format_version) +
+          " Expected: " + std::to_string(FLXFMT_VERSION)
+        );
+        return FlxFmtFile::Null;
+      }
+
+      std::size_t remaining = in.Remaining();
+      flxfmtfile.data.assign(in.ReadBytes(remaining), remaining);
+      return flxfmtfile;
+    }
+
     // parse file into document
     Document document;
     document.Parse(file.data.c_str());
@@ -11,6 +11,11 @@
 // Example usage: 
 // FlxFmtFile flxfmtfile_scene = FlexFormatter::Parse(file_scene,
 // FlxFmtFileType::Scene); 
+// 
+// The data section can either be json text (default) or the compact binary
+// reflection format. Binary files start with FLXFMT_BINARY_MAGIC instead of a
+// json object and store the schema hash of the serialized type in the header.
+// Parse() detects the encoding automatically.
 //
 // AUTHORS
 // [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
@@ -24,6 +29,7 @@
 
 #include "Utilities/datetime.h" // <iostream> <chrono> <string>
 #include "Utilities/file.h" // <filesystem> <iostream> <string> <exception> <unordered_map> <set> <fstream>
+#include "Reflection/binarystream.h" // <cstdint> <cstring> <string>
 
 #include <sstream>
 
@@ -44,6 +50,10 @@ namespace rapidjson
 #define FLXFMT_NAME     "flxfmt"
 #define FLXFMT_VERSION  1
 
+// Binary FlexFormat files start with these 4 bytes.
+// Header: magic | format_version (varint) | save_version (varint) | schema_hash (u64) | data
+#define FLXFMT_BINARY_MAGIC "FLXB"
+
 namespace FlexEngine
 {
 
@@ -64,6 +74,17 @@ namespace FlexEngine
 
   #pragma endregion
 
+  #pragma region FlxFmtEncoding
+
+  // How the data section of the file is stored.
+  enum class __FLX_API FlxFmtEncoding
+  {
+    Json = 0,
+    Binary
+  };
+
+  #pragma endregion
+
   #pragma region FlxFmtMetadata
 
   // Contains metadata for the FlexFormat file.
@@ -78,6 +99,8 @@ namespace FlexEngine
     Date last_edited = Date::Now();
     Version save_version = 0;                           // 0 = version not saved
     FlxFmtFileType file_type = FlxFmtFileType::Other;
+    FlxFmtEncoding encoding = FlxFmtEncoding::Json;
+    uint64_t schema_hash = 0;                           // binary only, see TypeDescriptor::GetSchemaHash
   };
 
   #pragma endregion
@@ -124,6 +147,14 @@ namespace FlexEngine
     // Creates a new FlxFmtFile wrapper.
     static FlxFmtFile Create(const std::string& data = "", bool save_version_enabled = false);
 
+    // Creates a new FlxFmtFile wrapper for binary data.
+    // The schema hash is checked by whoever deserializes the data.
+    static FlxFmtFile CreateBinary(const std::string& data, uint64_t schema_hash, bool save_version_enabled = false);
+
+    // Returns the encoding of the raw file contents without parsing them.
+    // Empty files are treated as json.
+    static FlxFmtEncoding DetectEncoding(const std::string& contents);
+
     // Parses the format into a FlxFmtFile using RapidJSON.
     // If there is a parse error, an empty FlxFmtFile is returned.
     // Usage: FlxFmtFile flxfmtfile_scene = FlexFormatter::Parse(file_scene, FlxFmtFileType::Scene);
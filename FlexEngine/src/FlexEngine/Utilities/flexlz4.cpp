@@ -0,0 +1,211 @@
+// WLVERSE [https://wlverse.web.app]
+// flexlz4.cpp
+//
+// LZ4 block compression and decompression.
+//
+// Block format: a sequence of
+//   token (literal length << 4 | match length - 4)
+//   [extra literal length bytes] literals
+//   match offset (2 bytes, little endian) [extra match length bytes]
+// The last sequence has literals only. Lengths of 15 continue in the
+// following bytes, each adding up to 255.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#include "pch.h"
+
+#include "flexlz4.h"
+
+#include <algorithm> // std::min
+#include <cstring>   // std::memcpy
+
+namespace FlexEngine
+{
+  namespace LZ4
+  {
+
+    #pragma region Internal Functions
+
+    namespace
+    {
+      constexpr std::size_t MIN_MATCH = 4;
+      constexpr std::size_t LAST_LITERALS = 5;  // the block always ends with at least 5 literals
+      constexpr std::size_t MATCH_LIMIT = 12;   // no match may start in the last 12 bytes
+      constexpr std::size_t MAX_OFFSET = 65535;
+      constexpr int HASH_BITS = 12;
+
+      uint32_t Read32(const uint8_t* p)
+      {
+        uint32_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+      }
+
+      uint32_t Hash(uint32_t sequence)
+      {
+        return (sequence * 2654435761u) >> (32 - HASH_BITS);
+      }
+
+      // Writes a length of 15 or more as a run of 255s and a remainder
+      uint8_t* WriteLength(uint8_t* out, std::size_t length)
+      {
+        for (; length >= 255; length -= 255) *out++ = 255;
+        *out++ = static_cast<uint8_t>(length);
+        return out;
+      }
+    }
+
+    #pragma endregion
+
+    std::size_t CompressBound(std::size_t size)
+    {
+      return size + size / 255 + 16;
+    }
+
+    std::size_t Compress(const void* src, std::size_t size, void* dst, std::size_t capacity)
+    {
+      // guard: the output must fit the worst case so that the loop does not need bounds checks
+      if (capacity < CompressBound(size)) return 0;
+
+      const uint8_t* in = static_cast<const uint8_t*>(src);
+      const uint8_t* in_end = in + size;
+      const uint8_t* literal_start = in;
+      uint8_t* out = static_cast<uint8_t*>(dst);
+
+      if (size > MATCH_LIMIT)
+      {
+        uint32_t table[1 << HASH_BITS] = {}; // position + 1, 0 is empty
+        const uint8_t* match_limit = in_end - MATCH_LIMIT;
+
+        const uint8_t* ip = in;
+        while (ip < match_limit)
+        {
+          uint32_t sequence = Read32(ip);
+          uint32_t h = Hash(sequence);
+          uint32_t candidate = table[h];
+          table[h] = static_cast<uint32_t>(ip - in) + 1;
+
+          const uint8_t* ref = in + candidate - 1;
+          if (candidate == 0 || static_cast<std::size_t>(ip - ref) > MAX_OFFSET || Read32(ref) != sequence)
+          {
+            ++ip;
+            continue;
+          }
+
+          // extend the match, stopping before the last literals
+          const uint8_t* match_end = ip + MIN_MATCH;
+          const uint8_t* ref_end = ref + MIN_MATCH;
+          while (match_end < in_end - LAST_LITERALS && *match_end == *ref_end)
+          {
+            ++match_end;
+            ++ref_end;
+          }
+
+          std::size_t literal_length = static_cast<std::size_t>(ip - literal_start);
+          std::size_t match_length = static_cast<std::size_t>(match_end - ip) - MIN_MATCH;
+          std::size_t offset = static_cast<std::size_t>(ip - ref);
+
+          uint8_t* token = out++;
+          *token = static_cast<uint8_t>((literal_length >= 15 ? 15 : literal_length) << 4);
+          if (literal_length >= 15) out = WriteLength(out, literal_length - 15);
+          std::memcpy(out, literal_start, literal_length);
+          out += literal_length;
+
+          *out++ = static_cast<uint8_t>(offset & 0xFF);
+          *out++ = static_cast<uint8_t>(offset >> 8);
+
+          *token |= static_cast<uint8_t>(match_length >= 15 ? 15 : match_length);
+          if (match_length >= 15) out = WriteLength(out, match_length - 15);
+
+          ip = match_end;
+          literal_start = ip;
+        }
+      }
+
+      // last literals
+      std::size_t literal_length = static_cast<std::size_t>(in_end - literal_start);
+      uint8_t* token = out++;
+      *token = static_cast<uint8_t>((literal_length >= 15 ? 15 : literal_length) << 4);
+      if (literal_length >= 15) out = WriteLength(out, literal_length - 15);
+      std::memcpy(out, literal_start, literal_length);
+      out += literal_length;
+
+      return static_cast<std::size_t>(out - static_cast<uint8_t*>(dst));
+    }
+
+    bool Decompress(const void* src, std::size_t size, void* dst, std::size_t decompressed_size)
+    {
+      const uint8_t* in = static_cast<const uint8_t*>(src);
+      const uint8_t* in_end = in + size;
+      uint8_t* out_start = static_cast<uint8_t*>(dst);
+      uint8_t* out = out_start;
+      uint8_t* out_end = out_start + decompressed_size;
+
+      while (in < in_end)
+      {
+        uint8_t token = *in++;
+
+        // literals
+        std::size_t literal_length = token >> 4;
+        if (literal_length == 15)
+        {
+          uint8_t extra = 255;
+          while (extra == 255)
+          {
+            if (in >= in_end) return false;
+            extra = *in++;
+            literal_length += extra;
+          }
+        }
+        if (literal_length > static_cast<std::size_t>(in_end - in) || literal_length > static_cast<std::size_t>(out_end - out)) return false;
+        std::memcpy(out, in, literal_length);
+        in += literal_length;
+        out += literal_length;
+
+        // the last sequence has no match
+        if (in == in_end) break;
+
+        // match
+        if (in_end - in < 2) return false;
+        std::size_t offset = in[0] | (in[1] << 8);
+        in += 2;
+        if (offset == 0 || offset > static_cast<std::size_t>(out - out_start)) return false;
+
+        std::size_t match_length = token & 0x0F;
+        if (match_length == 15)
+        {
+          uint8_t extra = 255;
+          while (extra == 255)
+          {
+            if (in >= in_end) return false;
+            extra = *in++;
+            match_length += extra;
+          }
+        }
+        match_length += MIN_MATCH;
+        if (match_length > static_cast<std::size_t>(out_end - out)) return false;
+
+        // an overlapping match repeats the last offset bytes, the repeated part is
+        // copied in chunks that double in size so that no copy overlaps itself
+        const uint8_t* ref = out - offset;
+        std::size_t copied = 0;
+        std::size_t chunk = offset;
+        while (copied < match_length)
+        {
+          std::size_t n = std::min(chunk, match_length - copied);
+          std::memcpy(out + copied, ref, n);
+          copied += n;
+          chunk = copied;
+        }
+        out += match_length;
+      }
+
+      return out == out_end;
+    }
+
+  }
+}
@@ -0,0 +1,40 @@
+// WLVERSE [https://wlverse.web.app]
+// flexlz4.h
+//
+// LZ4 block compression and decompression.
+//
+// Writes and reads the standard LZ4 block format (no frame header), so blocks
+// can be checked with the reference lz4 tools. The compressor is the simple
+// greedy one with a 4 byte hash table, it favours decompression speed over
+// ratio, which is what the cooked asset archive needs.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#pragma once
+
+#include "flx_api.h"
+
+#include <cstddef> // std::size_t
+
+namespace FlexEngine
+{
+  namespace LZ4
+  {
+
+    // Worst case size of a compressed block, for sizing the output buffer.
+    __FLX_API std::size_t CompressBound(std::size_t size);
+
+    // Compresses src into dst.
+    // Returns the compressed size, or 0 if dst is too small.
+    __FLX_API std::size_t Compress(const void* src, std::size_t size, void* dst, std::size_t capacity);
+
+    // Decompresses a block into dst, which must be exactly the decompressed size.
+    // Returns false if the block is malformed, never reads or writes out of bounds.
+    __FLX_API bool Decompress(const void* src, std::size_t size, void* dst, std::size_t decompressed_size);
+
+  }
+}
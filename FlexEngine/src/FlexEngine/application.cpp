@@ -26,8 +26,13 @@
 #include "StateManager/statemanager.h"
 #include "input.h"
 #include "flexprefs.h"
+#include "settings.h"
 #include "FMOD/FMODWrapper.h" // Include for initializing fmod system at application start
 #include "Renderer/Camera/cameramanager.h" //Include for starting up the camera bank
+#include "FlexECS/sceneloader.h" // Include for joining scene loading threads on exit
+#include "FlexECS/scenetemplatecache.h" // Include for releasing cached scenes on exit
+#include "FlexECS/systemschedule.h" // Include for stopping the system workers on exit
+#include "headless.h"
 namespace FlexEngine
 {
   // static member initialization
@@ -349,38 +354,79 @@ namespace FlexEngine
   {
     FLX_FLOW_BEGINSCOPE();
 
-    // initialize glfw
-    FLX_CORE_ASSERT(glfwInit(), "Failed to initialize GLFW!");
+    // headless runs have no display, so glfw is never initialized
+    if (Headless::IsEnabled())
+    {
+      Headless::Init();
+    }
+    else
+    {
+      // initialize glfw
+      FLX_CORE_ASSERT(glfwInit(), "Failed to initialize GLFW!");
+    }
 
     // Load the saved preferences from file.
+    // The engine settings are declared right after, everything below reads them.
     FlexPrefs::Load();
+    EngineSettings::Declare();
+
+    SystemSchedule::SetSerial(EngineSettings::game_serial_systems.Get());
+    Settings::AddListener(EngineSettings::game_serial_systems, [](bool serial) { SystemSchedule::SetSerial(serial); });
 
-    FMODWrapper::Load();
+    FMODWrapper::Load(Headless::IsEnabled() ? FMOD_OUTPUTTYPE_NOSOUND_NRT : FMOD_OUTPUTTYPE_AUTODETECT);
 
   }
 
   Application::~Application()
   {
-    glfwMakeContextCurrent(NULL);
-    glfwTerminate();
+    // scenes still loading in the background must finish before the engine goes away
+    FlexECS::SceneLoader::Shutdown();
+    FlexECS::SceneTemplateCache::Clear();
+    SystemSchedule::Shutdown();
+
+    if (Headless::IsEnabled())
+    {
+      Headless::Shutdown();
+    }
+    else
+    {
+      glfwMakeContextCurrent(NULL);
+      glfwTerminate();
+    }
     FMODWrapper::Unload();
+
+    // finish writing any settings that are still being saved
+    FlexPrefs::Shutdown();
     FLX_FLOW_ENDSCOPE();
   }
 
   void Application::Run()
   {
     // This is the main loop of the application
+    const bool headless = Headless::IsEnabled();
+
     while (m_is_running)
     {
       // poll IO events (keys pressed/released, mouse moved etc.)
       // this is suggested to always come first in the loop
-      glfwPollEvents();
-      Input::UpdateGamepadInput();
+      // headless runs have no window to poll, so all input stays released
+      if (headless)
+      {
+        Headless::BeginFrame();
+      }
+      else
+      {
+        glfwPollEvents();
+        Input::UpdateGamepadInput();
+      }
 
       // run the layerstack
       Application::GetLayerStack().Update();
       FMODWrapper::Update();
 
+      // save the settings that changed, on a worker thread
+      Settings::Update();
+
       //ApplicationStateManager::Update();
 
       // keybind to close the application
@@ -396,6 +442,9 @@ namespace FlexEngine
       // input cleanup (updates key states and mouse delta for the next frame)
       Input::Cleanup();
 
+      // headless runs stop by themselves after the requested number of frames
+      if (headless && Headless::EndFrame()) Quit();
+
       // state switching only happens at the very end of the frame
       //ApplicationStateManager::UpdateManager();
     }
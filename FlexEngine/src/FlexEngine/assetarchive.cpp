@@ -0,0 +1,485 @@
+// WLVERSE [https://wlverse.web.app]
+// assetarchive.cpp
+//
+// Cooked asset archive (.flxpak).
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#include "pch.h"
+
+#include "assetarchive.h"
+
+#include "Utilities/flexlz4.h"
+
+#include "stb_image.h" // the implementation is in opengltexture.cpp
+
+#include <algorithm> // std::sort, std::lower_bound
+#include <chrono>
+#include <cstring>   // std::memcpy
+#include <fstream>
+#include <iomanip>   // std::setprecision
+#include <iostream>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>    // open
+#include <sys/mman.h> // mmap
+#include <sys/stat.h> // fstat
+#include <unistd.h>   // close
+#endif
+
+namespace FlexEngine
+{
+
+  static_assert(sizeof(AssetArchive::Header) == 32, "The archive header is read straight from the file.");
+  static_assert(sizeof(AssetArchive::Entry) == 48, "Archive entries are read straight from the file.");
+
+  #pragma region Internal Functions
+
+  namespace
+  {
+    constexpr uint64_t DATA_ALIGNMENT = 16;
+
+    uint64_t Align(uint64_t offset)
+    {
+      return (offset + DATA_ALIGNMENT - 1) & ~(DATA_ALIGNMENT - 1);
+    }
+
+    char NormalizeSeparator(char c)
+    {
+      return (c == '\\') ? '/' : c;
+    }
+  }
+
+  #pragma endregion
+
+  AssetArchive::~AssetArchive()
+  {
+    Close();
+  }
+
+  #pragma region Reading
+
+  bool AssetArchive::Open(const Path& path)
+  {
+    FLX_FLOW_FUNCTION();
+
+    Close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileW(path.get().c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+    {
+      CloseHandle(file);
+      return false;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping == NULL)
+    {
+      CloseHandle(file);
+      return false;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == NULL)
+    {
+      CloseHandle(mapping);
+      CloseHandle(file);
+      return false;
+    }
+
+    m_file_handle = file;
+    m_mapping_handle = mapping;
+    m_data = static_cast<const uint8_t*>(view);
+    m_size = static_cast<std::size_t>(size.QuadPart);
+#else
+    int file = open(path.get().c_str(), O_RDONLY);
+    if (file < 0) return false;
+
+    struct stat info;
+    if (fstat(file, &info) != 0 || info.st_size == 0)
+    {
+      close(file);
+      return false;
+    }
+
+    void* view = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+    close(file); // the mapping keeps the file open
+    if (view == MAP_FAILED) return false;
+
+    m_data = static_cast<const uint8_t*>(view);
+    m_size = static_cast<std::size_t>(info.st_size);
+#endif
+
+    // check the header and that the keys and table of contents are inside the file
+    Header header;
+    bool valid = m_size >= sizeof(Header);
+    if (valid)
+    {
+      std::memcpy(&header, m_data, sizeof(Header));
+      valid =
+        header.magic == MAGIC && header.version == VERSION &&
+        header.keys_offset <= header.toc_offset && header.toc_offset <= m_size &&
+        header.toc_offset % alignof(Entry) == 0 &&
+        header.entry_count <= (m_size - header.toc_offset) / sizeof(Entry);
+    }
+    if (!valid)
+    {
+      Log::Warning("The asset archive is not a valid .flxpak file: " + path.string());
+      Close();
+      return false;
+    }
+
+    m_entries = reinterpret_cast<const Entry*>(m_data + header.toc_offset);
+    m_entry_count = header.entry_count;
+    m_keys = reinterpret_cast<const char*>(m_data + header.keys_offset);
+    return true;
+  }
+
+  void AssetArchive::Close()
+  {
+    // guard
+    if (!m_data) return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(m_data);
+    CloseHandle(static_cast<HANDLE>(m_mapping_handle));
+    CloseHandle(static_cast<HANDLE>(m_file_handle));
+#else
+    munmap(const_cast<uint8_t*>(m_data), m_size);
+#endif
+
+    m_data = nullptr;
+    m_size = 0;
+    m_entries = nullptr;
+    m_entry_count = 0;
+    m_keys = nullptr;
+    m_file_handle = nullptr;
+    m_mapping_handle = nullptr;
+  }
+
+  std::string_view AssetArchive::GetKey(const Entry& entry) const
+  {
+    std::size_t keys_size = static_cast<std::size_t>(reinterpret_cast<const char*>(m_entries) - m_keys);
+
+    // guard: a malformed entry gets an empty key instead of reading past the keys
+    if (entry.key_offset > keys_size || entry.key_size > keys_size - entry.key_offset) return {};
+
+    return std::string_view(m_keys + entry.key_offset, entry.key_size);
+  }
+
+  const AssetArchive::Entry* AssetArchive::Find(std::string_view key) const
+  {
+    // guard
+    if (!IsOpen()) return nullptr;
+
+    uint64_t hash = HashKey(key);
+    const Entry* end = m_entries + m_entry_count;
+    const Entry* it = std::lower_bound(
+      m_entries, end, hash,
+      [](const Entry& entry, uint64_t value) { return entry.hash < value; }
+    );
+
+    // check the key in case of a hash collision
+    for (; it != end && it->hash == hash; ++it)
+    {
+      std::string_view entry_key = GetKey(*it);
+      if (entry_key.size() != key.size()) continue;
+
+      bool match = true;
+      for (std::size_t i = 0; i < key.size() && match; ++i) match = NormalizeSeparator(key[i]) == entry_key[i];
+      if (match) return it;
+    }
+
+    return nullptr;
+  }
+
+  bool AssetArchive::Read(const Entry& entry, void* dst) const
+  {
+    // guard: the data must be inside the file
+    if (!IsOpen() || entry.data_offset > m_size || entry.stored_size > m_size - entry.data_offset) return false;
+
+    const uint8_t* data = m_data + entry.data_offset;
+    switch (entry.compression)
+    {
+    case Compression::None:
+      if (entry.stored_size != entry.raw_size) return false;
+      std::memcpy(dst, data, entry.raw_size);
+      return true;
+    case Compression::LZ4:
+      return LZ4::Decompress(data, entry.stored_size, dst, entry.raw_size);
+    default:
+      return false;
+    }
+  }
+
+  bool AssetArchive::ReadText(const Entry& entry, std::string& text) const
+  {
+    text.resize(entry.raw_size);
+    return Read(entry, text.data());
+  }
+
+  uint64_t AssetArchive::HashKey(std::string_view key)
+  {
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : key)
+    {
+      hash ^= static_cast<uint8_t>(NormalizeSeparator(c));
+      hash *= 1099511628211ull;
+    }
+    return hash;
+  }
+
+  bool AssetArchive::IsCookedTexture(const std::string& extension)
+  {
+    // same extensions as AssetManager::Load
+    return extension == ".png" || extension == ".jpg" || extension == ".jpeg";
+  }
+
+  bool AssetArchive::IsCookedText(const std::string& extension)
+  {
+    return
+      extension == ".flxshader" || extension == ".vert" || extension == ".frag" ||
+      extension == ".flxspritesheet" ||
+      extension == ".flxbattle" || extension == ".flxcharacter" || extension == ".flxmove" ||
+      extension == ".flxdialogue" || extension == ".flxcutscene" || extension == ".flxvideocutscene";
+  }
+
+  #pragma endregion
+
+  #pragma region Cooking
+
+  bool AssetArchive::Cook(const Path& asset_directory, const std::filesystem::path& archive_path, CookStats& stats)
+  {
+    FLX_FLOW_FUNCTION();
+
+    auto start = std::chrono::high_resolution_clock::now();
+    stats = CookStats();
+
+    struct CookedEntry
+    {
+      Entry entry;
+      std::string key;
+      std::vector<uint8_t> data;
+    };
+    std::vector<CookedEntry> cooked;
+
+    std::vector<uint8_t> raw;
+    std::error_code error;
+    for (auto it = std::filesystem::recursive_directory_iterator(asset_directory.get(), error); !error && it != std::filesystem::recursive_directory_iterator(); it.increment(error))
+    {
+      if (!it->is_regular_file()) continue;
+
+      const std::filesystem::path& file_path = it->path();
+      std::string extension = file_path.extension().string();
+      bool is_texture = IsCookedTexture(extension);
+
+      // guard: left loose
+      if (!is_texture && !IsCookedText(extension))
+      {
+        stats.loose++;
+        continue;
+      }
+
+      CookedEntry entry;
+
+      // same key as the asset manager, with '/' separators
+      entry.key = "/" + std::filesystem::relative(file_path, asset_directory.get()).generic_string();
+
+      if (is_texture)
+      {
+        // decoded the same way as Texture::Load, without flipping
+        int width = 0, height = 0;
+        unsigned char* pixels = stbi_load(file_path.string().c_str(), &width, &height, NULL, 4);
+        if (!pixels)
+        {
+          std::cerr << "Could not decode " << file_path.string() << ", it is left loose.\n";
+          stats.loose++;
+          continue;
+        }
+
+        raw.assign(pixels, pixels + static_cast<std::size_t>(width) * height * 4);
+        stbi_image_free(pixels);
+
+        entry.entry.type = EntryType::Texture;
+        entry.entry.width = static_cast<uint32_t>(width);
+        entry.entry.height = static_cast<uint32_t>(height);
+        stats.textures++;
+      }
+      else
+      {
+        std::ifstream file(file_path, std::ios::binary);
+        raw.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        if (file.bad())
+        {
+          std::cerr << "Could not read " << file_path.string() << "\n";
+          return false;
+        }
+
+        entry.entry.type = EntryType::Text;
+        stats.text++;
+      }
+
+      uint64_t source_size = it->file_size();
+      stats.source_bytes += source_size;
+      stats.raw_bytes += raw.size();
+
+      // keep the entry uncompressed if compressing does not help
+      entry.data.resize(LZ4::CompressBound(raw.size()));
+      std::size_t compressed_size = LZ4::Compress(raw.data(), raw.size(), entry.data.data(), entry.data.size());
+      if (compressed_size != 0 && compressed_size < raw.size())
+      {
+        entry.data.resize(compressed_size);
+        entry.entry.compression = Compression::LZ4;
+      }
+      else
+      {
+        entry.data = raw;
+        entry.entry.compression = Compression::None;
+      }
+
+      // png and jpg compress pixels far better than LZ4, keep the source file
+      // when the pixels would take much more space than it
+      if (is_texture && entry.data.size() > source_size * MAX_PIXEL_GROWTH)
+      {
+        std::ifstream file(file_path, std::ios::binary);
+        raw.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        if (file.bad())
+        {
+          std::cerr << "Could not read " << file_path.string() << "\n";
+          return false;
+        }
+
+        entry.data = raw;
+        entry.entry.type = EntryType::EncodedTexture;
+        entry.entry.compression = Compression::None;
+        stats.encoded_textures++;
+      }
+
+      entry.entry.raw_size = static_cast<uint32_t>(raw.size());
+      entry.entry.stored_size = static_cast<uint32_t>(entry.data.size());
+      entry.entry.hash = HashKey(entry.key);
+      cooked.push_back(std::move(entry));
+    }
+
+    // guard
+    if (error)
+    {
+      std::cerr << "Could not read the asset directory " << asset_directory.string() << ": " << error.message() << "\n";
+      return false;
+    }
+
+    // sorted for the binary search in Find, ties by key so that cooks are reproducible
+    std::sort(
+      cooked.begin(), cooked.end(),
+      [](const CookedEntry& a, const CookedEntry& b) { return (a.entry.hash != b.entry.hash) ? a.entry.hash < b.entry.hash : a.key < b.key; }
+    );
+
+    // lay out the data, then the keys, then the table of contents
+    Header header;
+    header.entry_count = static_cast<uint32_t>(cooked.size());
+
+    uint64_t offset = Align(sizeof(Header));
+    for (CookedEntry& entry : cooked)
+    {
+      entry.entry.data_offset = offset;
+      offset = Align(offset + entry.data.size());
+    }
+
+    header.keys_offset = offset;
+    uint32_t key_offset = 0;
+    for (CookedEntry& entry : cooked)
+    {
+      entry.entry.key_offset = key_offset;
+      entry.entry.key_size = static_cast<uint32_t>(entry.key.size());
+      key_offset += entry.entry.key_size;
+    }
+    header.toc_offset = Align(header.keys_offset + key_offset);
+
+    std::ofstream file(archive_path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+      std::cerr << "Could not open " << archive_path.string() << " for writing.\n";
+      return false;
+    }
+
+    auto pad_to = [&file](uint64_t position)
+    {
+      static const char zeros[DATA_ALIGNMENT] = {};
+      uint64_t current = static_cast<uint64_t>(file.tellp());
+      if (position > current) file.write(zeros, static_cast<std::streamsize>(position - current));
+    };
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    for (const CookedEntry& entry : cooked)
+    {
+      pad_to(entry.entry.data_offset);
+      file.write(reinterpret_cast<const char*>(entry.data.data()), static_cast<std::streamsize>(entry.data.size()));
+    }
+    pad_to(header.keys_offset);
+    for (const CookedEntry& entry : cooked) file.write(entry.key.data(), static_cast<std::streamsize>(entry.key.size()));
+    pad_to(header.toc_offset);
+    for (const CookedEntry& entry : cooked) file.write(reinterpret_cast<const char*>(&entry.entry), sizeof(Entry));
+
+    stats.archive_bytes = static_cast<uint64_t>(file.tellp());
+    file.close();
+    if (file.fail())
+    {
+      std::cerr << "Could not write " << archive_path.string() << "\n";
+      return false;
+    }
+
+    stats.seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+    return true;
+  }
+
+  int AssetArchive::RunCommandLine(int argc, char** argv)
+  {
+    std::string asset_directory = "assets";
+    std::string out_path = "assets.flxpak";
+
+    for (int i = 1; i < argc; i++)
+    {
+      std::string arg = argv[i];
+      bool has_value = (i + 1 < argc);
+
+      if (arg == "--cook") continue;
+      else if (arg == "--assets" && has_value) asset_directory = argv[++i];
+      else if (arg == "--out" && has_value) out_path = argv[++i];
+      else
+      {
+        std::cerr
+          << "Unknown option: " << arg << "\n"
+          << "Usage: --cook [--assets assets] [--out assets.flxpak]\n";
+        return 1;
+      }
+    }
+
+    CookStats stats;
+    if (!Cook(Path(asset_directory), out_path, stats)) return 1;
+
+    auto megabytes = [](uint64_t bytes) { return bytes / (1024.0 * 1024.0); };
+    std::cout
+      << std::fixed << std::setprecision(2)
+      << "Cooked " << asset_directory << " into " << out_path << " in " << stats.seconds << "s\n"
+      << "  textures:      " << stats.textures << " (" << stats.encoded_textures << " kept as png/jpg)\n"
+      << "  text assets:   " << stats.text << "\n"
+      << "  left loose:    " << stats.loose << "\n"
+      << "  source files:  " << megabytes(stats.source_bytes) << " MB\n"
+      << "  decoded:       " << megabytes(stats.raw_bytes) << " MB\n"
+      << "  archive:       " << megabytes(stats.archive_bytes) << " MB\n";
+    return 0;
+  }
+
+  #pragma endregion
+
+}
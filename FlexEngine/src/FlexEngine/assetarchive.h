@@ -0,0 +1,166 @@
+// WLVERSE [https://wlverse.web.app]
+// assetarchive.h
+//
+// Cooked asset archive (.flxpak).
+//
+// The cook step packs the assets that the engine decodes itself into one file:
+//  - textures (.png .jpg .jpeg) are decoded once and stored as RGBA8 pixels,
+//    unless the compressed pixels would be more than MAX_PIXEL_GROWTH times the
+//    source file. Those keep their png/jpg bytes and are decoded from memory at
+//    load, otherwise large sprite sheets make the archive several times the size
+//    of the loose assets.
+//  - text assets (shaders, spritesheets, battles, characters, moves, dialogues,
+//    cutscenes) are stored as they are and still parsed at load
+// Every entry is LZ4 compressed, unless that does not make it smaller.
+// Sounds, videos and fonts stay loose because FMOD, the video decoder and
+// FreeType open them by path. Scenes stay loose because the editor saves them.
+//
+// At runtime the archive is memory mapped and entries are decompressed straight
+// from the mapping when they are read, there is no per-file open or read call
+// and no png/jpg decoding. AssetManager::Load uses the archive when it exists
+// next to the assets folder (assets.flxpak), loose files that are newer than
+// the archive are loaded from disk instead so that edits are not hidden by an
+// old cook.
+//
+// Layout (little endian):
+//   Header
+//   entry data, each entry 16 byte aligned
+//   key strings (normalized to '/', starting with '/', not null terminated)
+//   table of contents, sorted by key hash
+//
+// Command line:
+//   Game.exe --cook [--assets assets] [--out assets.flxpak]
+// The Game project runs it on the copied assets with the CookAssets target:
+//   msbuild Game/Game.vcxproj /t:CookAssets /p:Configuration=Release /p:Platform=x64
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#pragma once
+
+#include "flx_api.h"
+
+#include "Utilities/path.h"
+
+#include <cstdint> // uint16_t, uint32_t, uint64_t
+#include <string>
+#include <string_view>
+
+namespace FlexEngine
+{
+
+  class __FLX_API AssetArchive
+  {
+  public:
+    static constexpr uint32_t MAGIC = 0x4B415046; // "FPAK"
+    static constexpr uint32_t VERSION = 2;
+
+    // Largest stored pixels to source file ratio for a texture to be stored as pixels
+    static constexpr double MAX_PIXEL_GROWTH = 1.5;
+
+    enum class EntryType : uint16_t
+    {
+      Text = 0,
+      Texture = 1,       // RGBA8, width * height * 4 bytes
+      EncodedTexture = 2 // the source png/jpg file
+    };
+
+    enum class Compression : uint16_t
+    {
+      None = 0,
+      LZ4 = 1
+    };
+
+    struct Header
+    {
+      uint32_t magic = MAGIC;
+      uint32_t version = VERSION;
+      uint32_t entry_count = 0;
+      uint32_t reserved = 0;
+      uint64_t keys_offset = 0;
+      uint64_t toc_offset = 0;
+    };
+
+    struct Entry
+    {
+      uint64_t hash = 0; // FNV-1a of the normalized key
+      uint64_t data_offset = 0;
+      uint32_t stored_size = 0;
+      uint32_t raw_size = 0;
+      uint32_t key_offset = 0; // from the start of the key strings
+      uint32_t key_size = 0;
+      EntryType type = EntryType::Text;
+      Compression compression = Compression::None;
+      uint32_t width = 0; // textures and encoded textures
+      uint32_t height = 0;
+      uint32_t reserved = 0;
+    };
+
+    struct CookStats
+    {
+      std::size_t textures = 0;
+      std::size_t encoded_textures = 0; // textures kept in their source encoding, also counted in textures
+      std::size_t text = 0;
+      std::size_t loose = 0;         // files left out of the archive
+      uint64_t source_bytes = 0;     // size of the cooked files on disk
+      uint64_t raw_bytes = 0;        // decoded size
+      uint64_t archive_bytes = 0;
+      double seconds = 0.0;
+    };
+
+    AssetArchive() = default;
+    ~AssetArchive();
+
+    // the mapping is owned by the archive
+    AssetArchive(const AssetArchive&) = delete;
+    AssetArchive& operator=(const AssetArchive&) = delete;
+
+    // Maps the archive and checks the header and table of contents.
+    // Returns false (and stays closed) if the file is missing or malformed.
+    bool Open(const Path& path);
+    void Close();
+    bool IsOpen() const { return m_data != nullptr; }
+
+    std::size_t GetEntryCount() const { return m_entry_count; }
+    const Entry& GetEntry(std::size_t index) const { return m_entries[index]; }
+    std::string_view GetKey(const Entry& entry) const;
+
+    // Binary search by key hash, the key can use either separator.
+    // Returns nullptr if the key is not in the archive.
+    const Entry* Find(std::string_view key) const;
+
+    // Decompresses the entry into dst, which must hold raw_size bytes.
+    // Returns false if the entry is malformed.
+    bool Read(const Entry& entry, void* dst) const;
+    bool ReadText(const Entry& entry, std::string& text) const;
+
+    // Hash used for the table of contents, separators are normalized to '/'
+    static uint64_t HashKey(std::string_view key);
+
+    // Whether the cook step packs files with this extension
+    static bool IsCookedTexture(const std::string& extension);
+    static bool IsCookedText(const std::string& extension);
+
+    // Cooks every texture and text asset in the directory into the archive.
+    static bool Cook(const Path& asset_directory, const std::filesystem::path& archive_path, CookStats& stats);
+
+    // Entry point for --cook, see the top of this file for the options.
+    // Returns the process exit code.
+    static int RunCommandLine(int argc, char** argv);
+
+  private:
+    const uint8_t* m_data = nullptr;
+    std::size_t m_size = 0;
+    const Entry* m_entries = nullptr;
+    std::size_t m_entry_count = 0;
+    const char* m_keys = nullptr;
+
+    // platform handles for the mapping
+    void* m_file_handle = nullptr;
+    void* m_mapping_handle = nullptr;
+  };
+
+}
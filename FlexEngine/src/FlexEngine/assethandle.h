@@ -0,0 +1,59 @@
+// WLVERSE [https://wlverse.web.app]
+// assethandle.h
+//
+// Typed integer handle to an asset in the asset manager.
+//
+// A handle is a slot index in the per-type handle table plus the generation of
+// that slot. Resolving a handle is an array index and a generation compare,
+// instead of hashing the asset key and checking the variant type.
+// Handles to assets that were unloaded stop resolving instead of pointing at
+// whatever takes the slot next.
+//
+// The asset key stays the name of the asset for the editor and for
+// serialization. Components keep the key as a StringIndex and cache the handle
+// next to it in a CachedAssetHandle, see
+// AssetManager::Get(CachedAssetHandle<T>&, std::size_t, GetKey&&).
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#pragma once
+
+#include <cstddef> // std::size_t
+#include <cstdint> // uint32_t
+
+namespace FlexEngine
+{
+
+  // T is only used to keep handles of different asset types apart, it can be incomplete.
+  // Handles are trivially copyable so that they can be stored in ECS components.
+  template <typename T>
+  struct AssetHandle
+  {
+    uint32_t index = 0; // slot + 1, 0 is never a valid handle
+    uint32_t generation = 0;
+
+    bool IsValid() const { return index != 0; }
+
+    bool operator==(const AssetHandle& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const AssetHandle& other) const { return !(*this == other); }
+  };
+
+  // A handle cached next to the integer key it was resolved from.
+  // Components keep their asset key as a Scene::StringIndex. Assigning another key changes that
+  // integer, so the handle is dropped on its next use without comparing any strings.
+  // Code that edits the string behind a StringIndex in place must reset the cache itself.
+  template <typename T>
+  struct CachedAssetHandle
+  {
+    AssetHandle<T> handle;
+    std::size_t key_index = 0;
+
+    bool operator==(const CachedAssetHandle& other) const { return handle == other.handle && key_index == other.key_index; }
+    bool operator!=(const CachedAssetHandle& other) const { return !(*this == other); }
+  };
+
+}
@@ -20,15 +20,132 @@
 #include "pch.h"
 
 #include "assetmanager.h"
-
+#include "assetarchive.h"
+#include "heapcounter.h"
 // #include "Utilities/assimp.h"
 
+#include "stb_image.h" // the implementation is in opengltexture.cpp
+
 namespace FlexEngine
 {
 
   // static member initialization
   Path AssetManager::default_directory = Path::current("assets");
   std::unordered_map<AssetKey, AssetVariant> AssetManager::assets;
+  std::array<AssetManager::HandleTable, std::variant_size_v<AssetVariant>> AssetManager::handle_tables;
+
+  #pragma region Static Internal Functions
+
+  // Memory tag for the allocations made while loading an asset, see heapcounter.h
+  static MemoryTag Internal_GetMemoryTag(const std::string& extension)
+  {
+    if (extension == ".jpg" || extension == ".jpeg" || extension == ".png") return MemoryTag::AssetTexture;
+    if (extension == ".flxshader") return MemoryTag::AssetShader;
+    if (extension == ".flxspritesheet") return MemoryTag::AssetSpritesheet;
+    if (extension == ".mp3" || extension == ".wav") return MemoryTag::AssetSound;
+    if (extension == ".ttf") return MemoryTag::AssetFont;
+    if (extension == ".mp4") return MemoryTag::AssetVideo;
+    return MemoryTag::AssetData;
+  }
+
+  // Loads the textures in the cooked archive next to the asset directory (assets.flxpak)
+  // and preloads its text files. The text files are added to the list so that they go
+  // through the same loaders as loose files.
+  static void Internal_LoadArchive(const Path& directory, FileList& list)
+  {
+    FLX_FLOW_FUNCTION();
+
+    std::filesystem::path archive_path = directory.get();
+    archive_path += ".flxpak";
+
+    // guard: not cooked, everything is loaded from the loose files
+    std::error_code error;
+    auto archive_time = std::filesystem::last_write_time(archive_path, error);
+    if (error) return;
+
+    AssetArchive archive;
+    if (!archive.Open(archive_path)) return;
+
+    std::size_t loaded = 0;
+    std::vector<unsigned char> pixels; // reused for every texture
+    for (std::size_t i = 0; i < archive.GetEntryCount(); ++i)
+    {
+      const AssetArchive::Entry& entry = archive.GetEntry(i);
+
+      // the archive uses '/', asset keys use the platform separator
+      AssetKey key(archive.GetKey(entry));
+      std::replace(key.begin(), key.end(), '/', Path::separator);
+
+      // guard: malformed key
+      if (key.size() < 2 || key[0] != Path::separator) continue;
+
+      std::filesystem::path path = directory.get() / key.substr(1);
+
+      // guard: the loose file was edited after the cook, the loose walk loads it
+      auto loose_time = std::filesystem::last_write_time(path, error);
+      bool has_loose_file = !error;
+      if (has_loose_file && loose_time > archive_time) continue;
+
+      // the text entries are parsed later by the loose loaders, the preloaded text counts as data
+      bool is_texture = entry.type == AssetArchive::EntryType::Texture || entry.type == AssetArchive::EntryType::EncodedTexture;
+      HeapCounter::TagScope memory_tag(is_texture ? MemoryTag::AssetTexture : MemoryTag::AssetData);
+
+      if (entry.type == AssetArchive::EntryType::Texture)
+      {
+        pixels.resize(entry.raw_size);
+        if (entry.raw_size != uint64_t(entry.width) * entry.height * 4 || !archive.Read(entry, pixels.data()))
+        {
+          Log::Warning("Could not read the cooked texture, loading the loose file instead. Asset key: " + key);
+          continue;
+        }
+
+        AssetManager::assets.emplace(key, Asset::Texture());
+        Asset::Texture& texture = std::get<Asset::Texture>(AssetManager::assets[key]);
+        texture.Load(pixels.data(), static_cast<int>(entry.width), static_cast<int>(entry.height));
+      }
+      else if (entry.type == AssetArchive::EntryType::EncodedTexture)
+      {
+        // the png/jpg is decoded from the archive, there is still no file to open
+        pixels.resize(entry.raw_size);
+        int width = 0, height = 0;
+        unsigned char* decoded = nullptr;
+        if (archive.Read(entry, pixels.data()))
+          decoded = stbi_load_from_memory(pixels.data(), static_cast<int>(pixels.size()), &width, &height, NULL, 4);
+        if (!decoded)
+        {
+          Log::Warning("Could not decode the cooked texture, loading the loose file instead. Asset key: " + key);
+          continue;
+        }
+
+        AssetManager::assets.emplace(key, Asset::Texture());
+        Asset::Texture& texture = std::get<Asset::Texture>(AssetManager::assets[key]);
+        texture.Load(decoded, width, height);
+        stbi_image_free(decoded);
+      }
+      else
+      {
+        std::string text;
+        if (!archive.ReadText(entry, text))
+        {
+          Log::Warning("Could not read the cooked file, loading the loose file instead. Asset key: " + key);
+          continue;
+        }
+
+        File& file = File::Open(path);
+        file.data = std::move(text);
+        file.preloaded = true;
+
+        // loose files are already in the list
+        if (!has_loose_file) list.push_back(file.path);
+      }
+
+      loaded++;
+    }
+
+    Log::Info("Loaded " + std::to_string(loaded) + " cooked assets from " + archive_path.string());
+  }
+
+  #pragma endregion
 
   AssetKey AssetManager::AddTexture(const std::string& assetkey, const Asset::Texture& texture)
   {
@@ -61,6 +178,9 @@ namespace FlexEngine
     // load all assets
     FileList list = FileList::GetAllFilesInDirectoryRecursively(default_directory);
 
+    // cooked assets, see assetarchive.h
+    Internal_LoadArchive(default_directory, list);
+
     // guard
     if (list.size() == 0)
     {
@@ -85,6 +205,11 @@ namespace FlexEngine
     list.each(
       [&default_directory_length](File& file)
       {
+        // guard: already loaded from the cooked archive
+        if (assets.count(file.path.string().substr(default_directory_length)) != 0) return;
+
+        HeapCounter::TagScope memory_tag(Internal_GetMemoryTag(file.path.extension().string()));
+
         // determine what type of asset it is
         //
         // currently supported:
@@ -216,6 +341,8 @@ namespace FlexEngine
   {
     FLX_FLOW_FUNCTION();
 
+    Internal_InvalidateHandles();
+
     for (auto& [key, asset] : assets)
     {
       std::visit(
@@ -240,6 +367,7 @@ namespace FlexEngine
 
 
     auto file_extension = file.path.extension();
+    HeapCounter::TagScope memory_tag(Internal_GetMemoryTag(file_extension.string()));
 
     if (file_extension.string() == ".jpg" || file_extension.string() == ".jpeg" ||
         file_extension.string() == ".png")
@@ -325,6 +453,99 @@ namespace FlexEngine
     return &assets[key];
   }
 
+  #pragma region Handles
+
+  uint32_t AssetManager::Internal_GetHandle(std::size_t type_index, AssetKey key, void* (*extract)(AssetVariant&), uint32_t& generation)
+  {
+    std::replace(key.begin(), key.end(), '/', Path::separator);
+    std::replace(key.begin(), key.end(), '\\', Path::separator);
+
+    HandleTable& table = handle_tables[type_index];
+
+    // already resolved
+    auto it = table.lookup.find(key);
+    if (it != table.lookup.end())
+    {
+      generation = table.slots[it->second].generation;
+      return it->second + 1;
+    }
+
+    // guard: asset not found
+    auto asset_it = assets.find(key);
+    if (asset_it == assets.end()) return 0;
+
+    // guard: asset has another type
+    // the value inside an unordered_map node never moves, so the pointer stays valid
+    void* asset = extract(asset_it->second);
+    if (asset == nullptr) return 0;
+
+    uint32_t slot_index = 0;
+    if (!table.free_slots.empty())
+    {
+      slot_index = table.free_slots.back();
+      table.free_slots.pop_back();
+    }
+    else
+    {
+      slot_index = static_cast<uint32_t>(table.slots.size());
+      table.slots.emplace_back();
+    }
+
+    HandleSlot& slot = table.slots[slot_index];
+    slot.asset = asset;
+    slot.key = key;
+    slot.ref_count = 0;
+    table.lookup[key] = slot_index;
+
+    generation = slot.generation;
+    return slot_index + 1;
+  }
+
+  const AssetKey& AssetManager::Internal_GetKey(std::size_t type_index, uint32_t index, uint32_t generation)
+  {
+    static const AssetKey empty_key;
+
+    const HandleSlot* slot = Internal_GetSlot(type_index, index, generation);
+    return slot ? slot->key : empty_key;
+  }
+
+  void AssetManager::Internal_AddRef(std::size_t type_index, uint32_t index, uint32_t generation, int amount)
+  {
+    // guard: stale handles do not count
+    if (Internal_GetSlot(type_index, index, generation) == nullptr) return;
+
+    HandleSlot& slot = handle_tables[type_index].slots[index - 1];
+    if (amount < 0 && slot.ref_count == 0)
+    {
+      Log::Warning("Released an asset handle more times than it was referenced. Asset key: " + slot.key);
+      return;
+    }
+    slot.ref_count += amount;
+  }
+
+  void AssetManager::Internal_InvalidateHandles()
+  {
+    for (HandleTable& table : handle_tables)
+    {
+      for (uint32_t i = 0; i < table.slots.size(); ++i)
+      {
+        HandleSlot& slot = table.slots[i];
+        if (slot.asset == nullptr) continue;
+
+        slot.asset = nullptr;
+        slot.key.clear();
+        slot.ref_count = 0;
+
+        // generation 0 is never handed out
+        if (++slot.generation == 0) slot.generation = 1;
+        table.free_slots.push_back(i);
+      }
+      table.lookup.clear();
+    }
+  }
+
+  #pragma endregion
+
   Path AssetManager::DefaultDirectory()
   {
     return default_directory;
@@ -10,6 +10,10 @@
 // 
 // The key is specifically the relative path to the asset from the default 
 // directory. This is to ensure that the asset manager can easily find the asset. 
+// 
+// Code that looks up the same asset every frame should use a typed handle
+// (assethandle.h) instead, which resolves through a per-type array without
+// hashing the key.
 //
 // AUTHORS
 // [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
@@ -32,12 +36,15 @@
 #include "Renderer/OpenGL/opengltexture.h"
 #include "Renderer/OpenGL/videodecoder.h"
 #include "Utilities/path.h"
+#include "assethandle.h"
 #include "assetkey.h"
 
 #include "Renderer/OpenGL/openglfont.h"
 #include "fmod/Sound.h"
 
+#include <array>
 #include <string>
+#include <type_traits> // std::is_same_v
 #include <unordered_map>
 #include <variant>
 
@@ -49,11 +56,32 @@ namespace FlexEngine
     Asset::Texture, Asset::Spritesheet, Asset::Shader, Asset::Model, Asset::Sound, Asset::Font, Asset::Battle,
     Asset::Character, Asset::Move, Asset::Dialogue, Asset::Cutscene, Asset::VideoCutscene, VideoDecoder>;
 
+  // Index of an asset type in AssetVariant, used to pick its handle table
+  template <typename T, typename... Ts>
+  constexpr std::size_t Internal_AssetTypeIndex(std::variant<Ts...>*)
+  {
+    constexpr bool matches[] = { std::is_same_v<T, Ts>... };
+    for (std::size_t i = 0; i < sizeof...(Ts); ++i)
+    {
+      if (matches[i]) return i;
+    }
+    return sizeof...(Ts);
+  }
+
+  template <typename T>
+  constexpr std::size_t AssetTypeIndex = Internal_AssetTypeIndex<T>(static_cast<AssetVariant*>(nullptr));
+
   // Helper macro to get an asset by its key.
   // Deprecation warning: This macro is deprecated and will be removed in the future.
   // Example usage: FLX_ASSET_GET(Asset::Texture, R"(/images/flexengine/flexengine-256.png)")
   #define FLX_ASSET_GET(TYPE, KEY) AssetManager::Get<TYPE>(KEY)
 
+  // Helper macro to get an asset through the handle a component caches next to its StringIndex key.
+  // FLX_STRING_GET only runs when the handle has to be resolved again. Returns nullptr for an empty key.
+  // Example usage: FLX_ASSET_GET_CACHED(sprite.sprite_asset, sprite.sprite_handle)
+  #define FLX_ASSET_GET_CACHED(CACHE, STRING_INDEX) \
+    AssetManager::Get(CACHE, STRING_INDEX, [&]() -> const AssetKey& { return FLX_STRING_GET(STRING_INDEX); })
+
   class __FLX_API AssetManager
   {
     static Path default_directory;
@@ -61,6 +89,25 @@ namespace FlexEngine
   public:
     static std::unordered_map<AssetKey, AssetVariant> assets;
 
+    // One slot per asset that a handle was requested for
+    struct __FLX_API HandleSlot
+    {
+      void* asset = nullptr; // the value inside the AssetVariant, nullptr when the slot is free
+      AssetKey key;          // normalized key
+      uint32_t generation = 1;
+      uint32_t ref_count = 0;
+    };
+
+    // Per-type dense array of handle slots, indexed by AssetTypeIndex<T>
+    struct __FLX_API HandleTable
+    {
+      std::vector<HandleSlot> slots;
+      std::vector<uint32_t> free_slots;
+      std::unordered_map<AssetKey, uint32_t> lookup; // normalized key to slot
+    };
+
+    static std::array<HandleTable, std::variant_size_v<AssetVariant>> handle_tables;
+
     // Add a custom texture asset
     // Saves it to a custom root path (/internal)
     static AssetKey AddTexture(const std::string& assetkey, const Asset::Texture& texture);
@@ -70,6 +117,7 @@ namespace FlexEngine
 
     // Explicitly call this function to free all assets
     // Frees OpenGL textures and shaders
+    // Invalidates every asset handle
     static void Unload();
 
     static void LoadFileFromPath(std::filesystem::path path);
@@ -106,6 +154,128 @@ namespace FlexEngine
 
     #pragma endregion
 
+    #pragma region Handles
+
+  public:
+    // Resolves the key once and returns a handle to the asset.
+    // Asking for the same key again returns the same handle.
+    // Returns an invalid handle if the asset is not found or is not a T.
+    template <typename T>
+    static AssetHandle<T> GetHandle(const AssetKey& key)
+    {
+      uint32_t generation = 0;
+      uint32_t index = Internal_GetHandle(AssetTypeIndex<T>, key, &Internal_Extract<T>, generation);
+      return { index, generation };
+    }
+
+    // O(1), returns nullptr if the handle is invalid or its asset was unloaded
+    template <typename T>
+    static T* Resolve(AssetHandle<T> handle)
+    {
+      const HandleSlot* slot = Internal_GetSlot(AssetTypeIndex<T>, handle.index, handle.generation);
+      return slot ? static_cast<T*>(slot->asset) : nullptr;
+    }
+
+    // Get an asset by its handle
+    // This will return a reference to the asset or throw an error if the handle does not resolve
+    template <typename T>
+    static T& Get(AssetHandle<T> handle)
+    {
+      T* asset = Resolve(handle);
+      if (asset == nullptr)
+      {
+        throw std::runtime_error("Asset handle does not resolve to an asset: " + std::to_string(handle.index));
+      }
+      return *asset;
+    }
+
+    // Get an asset by its key, caching the handle.
+    // While the cached handle resolves it is trusted, this is a slot and generation check and the key is not read.
+    // Whoever writes the key must reset the cache, the key is then looked up again on the next call.
+    // Throws the same errors as Get(key).
+    template <typename T>
+    static T& Get(AssetHandle<T>& cache, const AssetKey& key)
+    {
+      const HandleSlot* slot = Internal_GetSlot(AssetTypeIndex<T>, cache.index, cache.generation);
+      if (slot) return *static_cast<T*>(slot->asset);
+
+      cache = GetHandle<T>(key);
+      if (!cache.IsValid()) return Get<T>(key);
+      return *Resolve(cache);
+    }
+
+    // Get an asset through a handle cached next to the integer key it was resolved from.
+    // get_key returns the AssetKey for key_index and is only called when the handle has to be resolved again,
+    // so the per-frame path is an integer compare and a slot and generation check.
+    // Returns nullptr if the key is empty, components use an empty key for no asset.
+    // Throws the same errors as Get(key) otherwise.
+    template <typename T, typename GetKey>
+    static T* Get(CachedAssetHandle<T>& cache, std::size_t key_index, GetKey&& get_key)
+    {
+      if (cache.key_index == key_index)
+      {
+        if (T* asset = Resolve(cache.handle)) return asset;
+      }
+
+      cache.key_index = key_index;
+      cache.handle = {};
+
+      const AssetKey& key = get_key();
+      if (key.empty()) return nullptr;
+      return &Get(cache.handle, key);
+    }
+
+    // Returns the key of the asset, or an empty key if the handle does not resolve
+    template <typename T>
+    static const AssetKey& GetKey(AssetHandle<T> handle)
+    {
+      return Internal_GetKey(AssetTypeIndex<T>, handle.index, handle.generation);
+    }
+
+    // Reference counts are kept by whoever owns the handle, the cached Get does not count.
+    // They are not used to unload anything yet.
+    template <typename T>
+    static void AddRef(AssetHandle<T> handle) { Internal_AddRef(AssetTypeIndex<T>, handle.index, handle.generation, 1); }
+    template <typename T>
+    static void Release(AssetHandle<T> handle) { Internal_AddRef(AssetTypeIndex<T>, handle.index, handle.generation, -1); }
+    template <typename T>
+    static uint32_t GetRefCount(AssetHandle<T> handle)
+    {
+      const HandleSlot* slot = Internal_GetSlot(AssetTypeIndex<T>, handle.index, handle.generation);
+      return slot ? slot->ref_count : 0;
+    }
+
+  private:
+    template <typename T>
+    static void* Internal_Extract(AssetVariant& asset)
+    {
+      return std::get_if<T>(&asset);
+    }
+
+    // Returns nullptr if the handle is invalid or stale
+    static const HandleSlot* Internal_GetSlot(std::size_t type_index, uint32_t index, uint32_t generation)
+    {
+      const std::vector<HandleSlot>& slots = handle_tables[type_index].slots;
+      if (index == 0 || index > slots.size()) return nullptr;
+
+      const HandleSlot& slot = slots[index - 1];
+      if (slot.asset == nullptr || slot.generation != generation) return nullptr;
+      return &slot;
+    }
+
+    // INTERNAL FUNCTION
+    // Finds or creates the handle slot for the key, returns 0 if the asset is not found or has another type
+    static uint32_t Internal_GetHandle(std::size_t type_index, AssetKey key, void* (*extract)(AssetVariant&), uint32_t& generation);
+
+    static const AssetKey& Internal_GetKey(std::size_t type_index, uint32_t index, uint32_t generation);
+
+    static void Internal_AddRef(std::size_t type_index, uint32_t index, uint32_t generation, int amount);
+
+    // Frees every slot and bumps their generations, called by Unload
+    static void Internal_InvalidateHandles();
+
+    #pragma endregion
+
   public:
     // Get the default directory
     static Path DefaultDirectory();
@@ -21,6 +21,8 @@
 
 #include "application.h"
 
+#include <mutex>
+
 // Helper macros for colorizing console output
 #pragma region Colors
 
@@ -55,6 +57,9 @@ namespace FlexEngine
   Log::LogLevel Log::log_level = LogLevel_All;
   const std::string Log::datetime = DateTime::GetFormattedDateTime("%Y-%m-%d-%H-%M-%S");
 
+  // guards the log stream and console output
+  static std::mutex log_mutex;
+
   // static member initialization (file splitter)
   //const size_t Log::max_log_file_size = 1024 * 1024 * 10; // 10MB
   //const size_t Log::max_log_file_size = 20;
@@ -243,30 +248,35 @@ namespace FlexEngine
       log_string.erase(pos, end - pos + 1);
     }
 
-    current_file_size += log_string.size() + 1; // +1 for newline
+    // scenes can be loaded on a worker thread (SceneLoader), keep the output in one piece
+    {
+      std::lock_guard<std::mutex> lock(log_mutex);
 
-    // if log file is too large, increment log file
-    //if (current_file_size > max_log_file_size)
-    //{
-    //  Internal_IncrementLogFile();
-    //}
+      current_file_size += log_string.size() + 1; // +1 for newline
 
-    // log to console and file based on warning level
-    #ifdef _DEBUG
-    std::cout << ss.str();
+      // if log file is too large, increment log file
+      //if (current_file_size > max_log_file_size)
+      //{
+      //  Internal_IncrementLogFile();
+      //}
 
-    // file will be opened and updated frequently in debug mode
-    log_stream.open(log_file_path.string(), std::ios::out | std::ios::app);
-    log_stream << log_string;
-    log_stream.close();
-    #else
-        // full logs will be saved in release mode
-    if (!log_stream.is_open())
-    {
+      // log to console and file based on warning level
+      #ifdef _DEBUG
+      std::cout << ss.str();
+
+      // file will be opened and updated frequently in debug mode
       log_stream.open(log_file_path.string(), std::ios::out | std::ios::app);
+      log_stream << log_string;
+      log_stream.close();
+      #else
+          // full logs will be saved in release mode
+      if (!log_stream.is_open())
+      {
+        log_stream.open(log_file_path.string(), std::ios::out | std::ios::app);
+      }
+      log_stream << log_string;
+      #endif
     }
-    log_stream << log_string;
-    #endif
 
     // quit application if fatal
     if (level == LogLevel_Fatal)
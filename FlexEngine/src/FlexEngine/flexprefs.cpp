@@ -1,7 +1,12 @@
 #include "pch.h"
 #include "flexprefs.h"
+#include "settings.h"
 #include "FlexEngine/Utilities/flexformatter.h" // rapidjson
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 constexpr const char* SAVE_FILE_NAME = "flxprefs.json";
 constexpr const char* container_name = "flexprefs"; // The object containing all key-value pairs
 
@@ -17,14 +22,86 @@ namespace FlexEngine
         return Path::current("assets/saves/").append(SAVE_FILE_NAME);
     }
 
+    namespace
+    {
+        // Writes the saves requested by SaveAsync one at a time.
+        // Only the latest save is kept while the worker is busy, older ones would be overwritten anyway.
+        struct SaveWorker
+        {
+            std::thread thread;
+            std::mutex mutex;
+            std::condition_variable wake;  // a save was requested or the worker should stop
+            std::condition_variable idle;  // nothing is pending or being written
+            std::string path;
+            std::string contents;
+            bool pending = false;
+            bool writing = false;
+            bool stop = false;
+        };
+
+        SaveWorker save_worker;
+
+        // Writes next to the file and renames it over, so a crash while writing never leaves half a file
+        void WriteFile(const std::string& path, const std::string& contents)
+        {
+            std::string temp_path = path + ".tmp";
+            {
+                std::ofstream ofs(temp_path.c_str(), std::ios::binary | std::ios::trunc);
+                if (!ofs.is_open())
+                {
+                    Log::Warning("Failed to open FlexPrefs for saving at " + temp_path);
+                    return;
+                }
+                ofs << contents;
+            }
+
+            std::error_code error;
+            std::filesystem::rename(temp_path, path, error);
+            if (error) Log::Warning("Failed to save FlexPrefs to " + path + ": " + error.message());
+        }
+
+        void SaveWorkerLoop()
+        {
+            std::unique_lock<std::mutex> lock(save_worker.mutex);
+            while (true)
+            {
+                save_worker.wake.wait(lock, []() { return save_worker.pending || save_worker.stop; });
+                if (!save_worker.pending) break;
+
+                std::string path = std::move(save_worker.path);
+                std::string contents = std::move(save_worker.contents);
+                save_worker.pending = false;
+                save_worker.writing = true;
+
+                lock.unlock();
+                WriteFile(path, contents);
+                lock.lock();
+
+                save_worker.writing = false;
+                save_worker.idle.notify_all();
+            }
+        }
+
+        // Blocks until the worker has written everything it was given
+        void WaitForSaveWorker()
+        {
+            std::unique_lock<std::mutex> lock(save_worker.mutex);
+            save_worker.idle.wait(lock, []() { return !save_worker.pending && !save_worker.writing; });
+        }
+    }
+
     void FlexPrefs::Load()
     {
+        // a save that is still being written is newer than the file
+        WaitForSaveWorker();
+
         std::string filePath = GetSaveFilePath();
         std::ifstream ifs(filePath.c_str());
         if (!ifs.is_open())
         {
             Log::Warning("Failed to open FlexPrefs at " + filePath);
             Internal_Create();
+            Settings::Internal_Reload();
             return;
         }
 
@@ -34,6 +111,7 @@ namespace FlexEngine
         {
             Log::Error("Failed to parse FlexPrefs; recreating default.");
             Internal_Create();
+            Settings::Internal_Reload();
             return;
         }
         ifs.close();
@@ -45,11 +123,16 @@ namespace FlexEngine
             Internal_Create();
         }
 
+        Settings::Internal_Reload();
+
         Log::Info("Loaded FlexPrefs successfully from " + filePath);
     }
 
     void FlexPrefs::Save(bool prettify)
     {
+        // the file is written here, a save on the worker must not land after it
+        WaitForSaveWorker();
+
         std::string filePath = GetSaveFilePath();
         std::ofstream ofs(filePath.c_str());
         if (!ofs.is_open())
@@ -75,17 +158,48 @@ namespace FlexEngine
         Log::Info("Saved FlexPrefs successfully to " + filePath);
     }
 
+    void FlexPrefs::SaveAsync(bool prettify)
+    {
+        std::string contents = Internal_Serialize(prettify);
+
+        std::lock_guard<std::mutex> lock(save_worker.mutex);
+        if (!save_worker.thread.joinable())
+        {
+            save_worker.stop = false;
+            save_worker.thread = std::thread(SaveWorkerLoop);
+        }
+
+        save_worker.path = GetSaveFilePath();
+        save_worker.contents = std::move(contents);
+        save_worker.pending = true;
+        save_worker.wake.notify_one();
+    }
+
+    void FlexPrefs::Shutdown()
+    {
+        {
+            std::lock_guard<std::mutex> lock(save_worker.mutex);
+            if (!save_worker.thread.joinable()) return;
+            save_worker.stop = true;
+            save_worker.wake.notify_one();
+        }
+
+        // the worker writes what is pending before it stops
+        save_worker.thread.join();
+    }
+
     void FlexPrefs::DeleteAll()
     {
         m_document.RemoveAllMembers();
         Internal_Create(); // Reset to our default state.
         Save();
+        Settings::Internal_Reload();
     }
 
     bool FlexPrefs::HasKey(const std::string& key)
     {
         // Check that our container exists first.
-        if (!m_document.HasMember(container_name))
+        if (!m_document.IsObject() || !m_document.HasMember(container_name))
             return false;
         return m_document[container_name].HasMember(key);
     }
@@ -102,6 +216,11 @@ namespace FlexEngine
         }
     }
 
+    const Value* FlexPrefs::Internal_Find(const std::string& key)
+    {
+        return HasKey(key) ? &m_document[container_name][key] : nullptr;
+    }
+
     #pragma region Getters
 
     float FlexPrefs::GetFloat(const std::string& key, float default_value)
@@ -130,13 +249,14 @@ namespace FlexEngine
 
     void FlexPrefs::SetFloat(const std::string& key, float value)
     {
-        if (HasKey(key))
+        Value& container = Internal_GetContainer();
+        if (container.HasMember(key))
         {
-            m_document[container_name][key].SetFloat(value);
+            container[key].SetFloat(value);
         }
         else
         {
-            m_document[container_name].AddMember(
+            container.AddMember(
                 Value(key.c_str(), m_document.GetAllocator()).Move(),
                 Value(value).Move(),
                 m_document.GetAllocator());
@@ -145,13 +265,14 @@ namespace FlexEngine
 
     void FlexPrefs::SetInt(const std::string& key, int value)
     {
-        if (HasKey(key))
+        Value& container = Internal_GetContainer();
+        if (container.HasMember(key))
         {
-            m_document[container_name][key].SetInt(value);
+            container[key].SetInt(value);
         }
         else
         {
-            m_document[container_name].AddMember(
+            container.AddMember(
                 Value(key.c_str(), m_document.GetAllocator()).Move(),
                 Value(value).Move(),
                 m_document.GetAllocator());
@@ -160,13 +281,14 @@ namespace FlexEngine
 
     void FlexPrefs::SetString(const std::string& key, const std::string& value)
     {
-        if (HasKey(key))
+        Value& container = Internal_GetContainer();
+        if (container.HasMember(key))
         {
-            m_document[container_name][key].SetString(value.c_str(), m_document.GetAllocator());
+            container[key].SetString(value.c_str(), m_document.GetAllocator());
         }
         else
         {
-            m_document[container_name].AddMember(
+            container.AddMember(
                 Value(key.c_str(), m_document.GetAllocator()).Move(),
                 Value(value.c_str(), m_document.GetAllocator()).Move(),
                 m_document.GetAllocator());
@@ -175,13 +297,14 @@ namespace FlexEngine
 
     void FlexPrefs::SetBool(const std::string& key, bool value)
     {
-        if (HasKey(key))
+        Value& container = Internal_GetContainer();
+        if (container.HasMember(key))
         {
-            m_document[container_name][key].SetBool(value);
+            container[key].SetBool(value);
         }
         else
         {
-            m_document[container_name].AddMember(
+            container.AddMember(
                 Value(key.c_str(), m_document.GetAllocator()).Move(),
                 Value(value).Move(),
                 m_document.GetAllocator());
@@ -221,4 +344,33 @@ namespace FlexEngine
 
         Log::Info("Created default FlexPrefs file at " + GetSaveFilePath());
     }
+
+    Value& FlexPrefs::Internal_GetContainer()
+    {
+        // Before Load, or if the document was never valid, start from an empty container in memory
+        if (!m_document.IsObject()) m_document.SetObject();
+        if (!m_document.HasMember(container_name))
+        {
+            m_document.AddMember(Value(container_name, m_document.GetAllocator()).Move(),
+                                 Value(kObjectType).Move(),
+                                 m_document.GetAllocator());
+        }
+        return m_document[container_name];
+    }
+
+    std::string FlexPrefs::Internal_Serialize(bool prettify)
+    {
+        rapidjson::StringBuffer buffer;
+        if (prettify)
+        {
+            PrettyWriter<rapidjson::StringBuffer> prettywriter(buffer);
+            m_document.Accept(prettywriter);
+        }
+        else
+        {
+            Writer<rapidjson::StringBuffer> writer(buffer);
+            m_document.Accept(writer);
+        }
+        return std::string(buffer.GetString(), buffer.GetSize());
+    }
 }
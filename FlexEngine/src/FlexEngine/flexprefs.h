@@ -7,6 +7,10 @@
 // - Call FlexPrefs::Load() to load the FlexPrefs file.It will automatically create one if none is available.
 // - Use the getters and setters to get and set values.Eg FlexPrefs::SetInt("score", 100);
 // - Call FlexPrefs::Save() to update changes made by the getters / setters and save the FlexPrefs file.
+// - Or call FlexPrefs::SaveAsync() to write the file on a worker thread instead of blocking.
+//
+// Settings read every frame should be declared in the Settings registry (settings.h) instead of
+// being looked up by key, the registry keeps its values in FlexPrefs so they are saved the same way.
 // 
 // Note: Will generate warnings in the console.
 //
@@ -43,6 +47,19 @@ namespace FlexEngine
     */
     static void Save(bool prettify = true);
 
+    /*
+      \brief Saves the FlexPrefs file on a worker thread.
+      The document is copied to a string on the calling thread, so it can be changed right after.
+      If a save is still waiting to be written, it is replaced by this one.
+    */
+    static void SaveAsync(bool prettify = true);
+
+    /*
+      \brief Finishes writing the pending save and stops the worker thread.
+      Called by the application on shutdown.
+    */
+    static void Shutdown();
+
     /*
       \brief Removes all keys and values from the preferences.
       Use with caution as this is not reversible.
@@ -77,11 +94,23 @@ namespace FlexEngine
 
     #pragma endregion
 
+    // INTERNAL FUNCTION
+    // Returns the value of the key, or nullptr if the key does not exist
+    static const Value* Internal_Find(const std::string& key);
+
   private:
 
     // INTERNAL FUNCTION
     // Creates a new FlexPrefs file with default values
     static void Internal_Create();
+
+    // INTERNAL FUNCTION
+    // Returns the object containing all key-value pairs, creating it if it does not exist
+    static Value& Internal_GetContainer();
+
+    // INTERNAL FUNCTION
+    // Writes the document into a string
+    static std::string Internal_Serialize(bool prettify);
   };
 
 }
\ No newline at end of file
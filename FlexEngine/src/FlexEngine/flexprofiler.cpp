@@ -14,12 +14,15 @@
 #include "flexprofiler.h"
 #include "flexlogger.h"
 
+#include <algorithm> // std::max
+
 namespace FlexEngine
 {
   bool Profiler::paused = false;
   long long Profiler::combined_time = 0;
   std::unordered_map<std::string, std::chrono::high_resolution_clock::time_point> Profiler::start_times; // auto erased by endcounter
   std::unordered_map<std::string, std::chrono::microseconds> Profiler::execute_times;
+  std::map<std::string, std::vector<Profiler::ScheduleSpan>> Profiler::schedules;
 
   void Profiler::StartCounter(std::string const& name) 
   { 
@@ -44,6 +47,13 @@ namespace FlexEngine
     else Log::Warning("No timer exists with name: " + name + ". Make sure you start a timer before calling end");
   }
 
+  void Profiler::SubmitSchedule(std::string const& schedule, std::vector<ScheduleSpan> spans)
+  {
+    if (paused) return;
+
+    schedules[schedule] = std::move(spans);
+  }
+
   // Create profiler window with IMGUI
   void Profiler::ShowProfilerWindow() 
   {
@@ -76,6 +86,47 @@ namespace FlexEngine
     // Clear every frame as long as not frozen
     if (!paused) execute_times.clear();
 
+    // Timeline of every schedule, one row per thread
+    if (!schedules.empty() && ImGui::CollapsingHeader("Schedules", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+      for (const auto& [schedule, spans] : schedules)
+      {
+        long long total_us = 1;
+        std::size_t threads = 1;
+        for (const ScheduleSpan& span : spans)
+        {
+          total_us = std::max(total_us, span.end_us);
+          threads = std::max(threads, span.thread + 1);
+        }
+
+        ImGui::Text("%s: %lld microseconds on %zu threads", schedule.c_str(), total_us, threads);
+
+        ImDrawList* draw_list = ImGui::GetWindowDrawList();
+        ImVec2 origin = ImGui::GetCursorScreenPos();
+        float width = ImGui::GetContentRegionAvail().x;
+        float row = ImGui::GetTextLineHeightWithSpacing();
+
+        for (const ScheduleSpan& span : spans)
+        {
+          ImVec2 min(origin.x + width * span.start_us / total_us, origin.y + row * span.thread);
+          ImVec2 max(origin.x + width * span.end_us / total_us, min.y + row - 2.0f);
+          max.x = std::max(max.x, min.x + 2.0f);
+
+          draw_list->AddRectFilled(min, max, IM_COL32(70, 110, 170, 255));
+          draw_list->PushClipRect(min, max, true);
+          draw_list->AddText(ImVec2(min.x + 2.0f, min.y), IM_COL32_WHITE, span.name.c_str());
+          draw_list->PopClipRect();
+
+          if (ImGui::IsMouseHoveringRect(min, max))
+          {
+            ImGui::SetTooltip("%s: %lld microseconds", span.name.c_str(), span.end_us - span.start_us);
+          }
+        }
+
+        ImGui::Dummy(ImVec2(width, row * threads));
+      }
+    }
+
     ImGui::End();
     #endif
   }
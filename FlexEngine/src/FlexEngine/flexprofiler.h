@@ -12,7 +12,10 @@
 #pragma once
 
 #include <chrono>
+#include <map>
+#include <string>
 #include <unordered_map>
+#include <vector>
 #ifndef GAME
 #include "imgui.h"
 #endif
@@ -30,13 +33,27 @@ namespace FlexEngine
   //        
   //        // Show results
   //        profiler.ShowProfilerWindow();
+  //
+  // The last run of every SystemSchedule is drawn as a timeline with one row per thread.
   class __FLX_API Profiler
   {
+  public:
+    // A system that ran as part of a SystemSchedule, the times are from the start of the schedule
+    struct ScheduleSpan
+    {
+      std::string name;
+      std::size_t thread; // 0 is the main thread
+      long long start_us;
+      long long end_us;
+    };
+
+  private:
     static Profiler profiler;
     static std::unordered_map<std::string, std::chrono::high_resolution_clock::time_point> start_times;
     static std::unordered_map<std::string, std::chrono::microseconds> execute_times;
     static long long combined_time;
     static bool paused;
+    static std::map<std::string, std::vector<ScheduleSpan>> schedules;
 
   public:
     Profiler() = default;
@@ -45,6 +62,9 @@ namespace FlexEngine
     static void StartCounter(std::string const& name);
     static void EndCounter(std::string const& name);
 
+    // Replaces the timeline of the schedule, called by SystemSchedule::Run
+    static void SubmitSchedule(std::string const& schedule, std::vector<ScheduleSpan> spans);
+
     // Create profiler window with IMGUI
     static void ShowProfilerWindow();
   };
@@ -15,12 +15,21 @@
 
 #include "frameratecontroller.h"
 
+#include "flexlogger.h"
+
 #include <algorithm> // For std::max
+#include <iomanip> // std::setprecision
+#include <sstream>
 #include <thread>
 
 namespace FlexEngine
 {
 
+  FramerateController::FramerateController()
+  {
+    Internal_UpdateSpikeThreshold();
+  }
+
   void FramerateController::BeginFrame()
   {
     // Calculate delta time
@@ -29,26 +38,46 @@ namespace FlexEngine
     m_delta_time = time_diff.count();
     m_last_time = current_time;
 
+    // The first frame is measured from construction, which includes loading
+    if (m_is_first_frame) m_is_first_frame = false;
+    else m_histogram.Add(m_delta_time * 1000.0);
+
     // Calculate FPS
-    static float calc_fps_time = 0.0f;
-    calc_fps_time += m_delta_time;
+    m_fps_time_accumulator += m_delta_time;
     m_frame_counter++;
-    /*if (m_frame_time_accumulator >= 1.0f)
+    if (m_fps_time_accumulator >= 1.0f)
     {
       m_fps = m_frame_counter;
       m_frame_counter = 0;
-      calc_fps_time -= 1.0f;
-    }*/
-    if (calc_fps_time >= 1.0f)
-    {
-      m_fps = m_frame_counter;
-      m_frame_counter = 0;
-      calc_fps_time = 0.0f;
+      m_fps_time_accumulator = 0.0f;
+
+      // Report budget overruns once per second instead of every frame
+      if (m_budget_overruns > 0)
+      {
+        std::stringstream ss;
+        ss << std::fixed << std::setprecision(2)
+          << "Frame budget of " << m_frame_budget_ms << " ms exceeded " << m_budget_overruns
+          << " times in the last second, worst frame " << m_worst_overrun_ms << " ms.";
+        Log::Warning(ss);
+
+        m_budget_overruns = 0;
+        m_worst_overrun_ms = 0.0f;
+      }
     }
   }
 
   void FramerateController::EndFrame()
   {
+    if (m_frame_budget_ms > 0.0f)
+    {
+      std::chrono::duration<float, std::milli> frame_time = std::chrono::high_resolution_clock::now() - m_last_time;
+      if (frame_time.count() > m_frame_budget_ms)
+      {
+        m_budget_overruns++;
+        m_worst_overrun_ms = std::max(m_worst_overrun_ms, frame_time.count());
+      }
+    }
+
     if (m_target_fps == 0) return;
 
     m_number_of_steps = 0;
@@ -67,10 +96,44 @@ namespace FlexEngine
     // Clamp accumulator to avoid negative values due to precision errors
     m_frame_time_accumulator = std::max(0.0f, m_frame_time_accumulator);
 
-    // Calculate remaining time to sleep
-    //float remaining_time = target_frame_time - m_frame_time_accumulator;
-    //if (remaining_time > 0.0f)
-    //  std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<int>(remaining_time * 1000.0f + 0.5f)));
+    if (m_frame_pacing) Internal_WaitForTargetFrameTime();
+  }
+
+  void FramerateController::Internal_WaitForTargetFrameTime()
+  {
+    using clock = std::chrono::high_resolution_clock;
+
+    auto frame_end = m_last_time + std::chrono::duration_cast<clock::duration>(
+      std::chrono::duration<double>(1.0 / m_target_fps)
+    );
+
+    // Sleep while there is enough time left for another sleep.
+    // The estimate jumps up on a late wake-up and slowly drifts back down,
+    // so one slow sleep does not make every later frame spin longer.
+    while (true)
+    {
+      auto now = clock::now();
+      double remaining_ms = std::chrono::duration<double, std::milli>(frame_end - now).count();
+      if (remaining_ms <= m_sleep_estimate_ms) break;
+
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+      double slept_ms = std::chrono::duration<double, std::milli>(clock::now() - now).count();
+      if (slept_ms > m_sleep_estimate_ms) m_sleep_estimate_ms = slept_ms;
+      else m_sleep_estimate_ms = m_sleep_estimate_ms * 0.95 + slept_ms * 0.05;
+    }
+
+    // Spin for the rest, this is where the sub-millisecond precision comes from
+    while (clock::now() < frame_end)
+    {
+      std::this_thread::yield();
+    }
+  }
+
+  void FramerateController::Internal_UpdateSpikeThreshold()
+  {
+    // A spike is a frame that took at least two target frames
+    m_histogram.SetSpikeThreshold(m_target_fps > 0 ? 2000.0 / m_target_fps : 0.0);
   }
 
   float FramerateController::GetDeltaTime() const
@@ -96,6 +159,39 @@ namespace FlexEngine
   void FramerateController::SetTargetFPS(unsigned int fps)
   {
     m_target_fps = fps;
+    Internal_UpdateSpikeThreshold();
+  }
+
+  unsigned int FramerateController::GetTargetFPS() const
+  {
+    return m_target_fps;
+  }
+
+  void FramerateController::SetFramePacing(bool enabled)
+  {
+    m_frame_pacing = enabled;
+  }
+
+  bool FramerateController::IsFramePacing() const
+  {
+    return m_frame_pacing;
+  }
+
+  void FramerateController::SetFrameBudget(float ms)
+  {
+    m_frame_budget_ms = std::max(0.0f, ms);
+    m_budget_overruns = 0;
+    m_worst_overrun_ms = 0.0f;
+  }
+
+  float FramerateController::GetFrameBudget() const
+  {
+    return m_frame_budget_ms;
+  }
+
+  const FrameTimeHistogram& FramerateController::GetFrameTimeHistogram() const
+  {
+    return m_histogram;
   }
 
 } // namespace FlexEngine
\ No newline at end of file
@@ -7,6 +7,14 @@
 // implement load sharing yet so all the extra frames will be calculated in one
 // frame. 
 //
+// With frame pacing on, EndFrame waits until the target frame time has passed
+// since BeginFrame. It sleeps while there is more time left than a sleep is
+// expected to take, then spins for the rest. The sleep estimate adapts to the
+// timer resolution of the machine, so the spin is short when Sleep is precise
+// and longer when it is not.
+//
+// Every frame time goes into a rolling histogram for the statistics panel.
+//
 // AUTHORS
 // [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
 //   - Main Author
@@ -17,6 +25,8 @@
 
 #include "flx_api.h"
 
+#include "frametimehistogram.h"
+
 #include <chrono>
 
 namespace FlexEngine
@@ -27,14 +37,33 @@ namespace FlexEngine
     std::chrono::time_point<std::chrono::high_resolution_clock> m_last_time = std::chrono::high_resolution_clock::now();
     float m_delta_time = 0.0f;
     float m_frame_time_accumulator = 0.0f;
+    float m_fps_time_accumulator = 0.0f;
     unsigned int m_fps = 0;
     unsigned int m_frame_counter = 0;
     unsigned int m_target_fps = 60;
+    bool m_is_first_frame = true;
 
     // Number of fixed steps to process
     unsigned int m_number_of_steps = 0;
 
+    // Frame pacing
+    bool m_frame_pacing = false;
+    double m_sleep_estimate_ms = 1.0; // how long a 1 ms sleep actually takes
+
+    // Frame budget, the time spent between BeginFrame and EndFrame
+    float m_frame_budget_ms = 0.0f;
+    unsigned int m_budget_overruns = 0;
+    float m_worst_overrun_ms = 0.0f;
+
+    // 10 seconds at 60 fps
+    FrameTimeHistogram m_histogram{ 600 };
+
+    void Internal_WaitForTargetFrameTime();
+    void Internal_UpdateSpikeThreshold();
+
   public:
+    FramerateController();
+
     void BeginFrame();
     void EndFrame();
 
@@ -47,8 +76,23 @@ namespace FlexEngine
     unsigned int GetNumberOfSteps() const;
 
     void SetTargetFPS(unsigned int fps = 0);
+    unsigned int GetTargetFPS() const;
+
+    // Waits out the rest of the target frame time in EndFrame.
+    // Has no effect when the target fps is 0.
+    void SetFramePacing(bool enabled);
+    bool IsFramePacing() const;
+
+    // Logs a warning, at most once per second, when a frame takes longer than
+    // the budget before pacing. 0 disables the warning.
+    void SetFrameBudget(float ms = 0.0f);
+    float GetFrameBudget() const;
+
+    // Rolling frame times of the last 600 frames.
+    // A spike is a frame longer than two target frames.
+    const FrameTimeHistogram& GetFrameTimeHistogram() const;
 
 #pragma endregion
   };
 
-} // namespace FlexEngine
\ No newline at end of file
+} // namespace FlexEngine
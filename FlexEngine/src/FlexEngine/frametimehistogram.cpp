@@ -0,0 +1,127 @@
+// WLVERSE [https://wlverse.web.app]
+// frametimehistogram.cpp
+//
+// Frame time histogram for p50/p95/p99/max and spike counts.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#include "frametimehistogram.h"
+
+#include <algorithm> // std::min, std::max
+#include <cmath>     // std::ceil
+
+namespace FlexEngine
+{
+
+  FrameTimeHistogram::FrameTimeHistogram(std::size_t window)
+    : m_window(window)
+  {
+    m_buckets.assign(BUCKET_COUNT, 0);
+    m_samples.reserve(m_window);
+  }
+
+  void FrameTimeHistogram::Add(double ms)
+  {
+    if (ms < 0.0) ms = 0.0;
+
+    // evict the oldest frame once the window is full
+    if (m_window != 0 && m_samples.size() == m_window)
+    {
+      double oldest = m_samples[m_next_sample];
+      m_buckets[GetBucket(oldest)]--;
+      m_total_ms -= oldest;
+      m_frames--;
+      if (IsSpike(oldest)) m_spikes--;
+
+      m_samples[m_next_sample] = static_cast<float>(ms);
+      m_next_sample = (m_next_sample + 1) % m_window;
+    }
+    else if (m_window != 0)
+    {
+      m_samples.push_back(static_cast<float>(ms));
+    }
+    else
+    {
+      m_max_ms = std::max(m_max_ms, ms);
+    }
+
+    // the window stores floats, count the same value that will be evicted later
+    if (m_window != 0) ms = static_cast<float>(ms);
+
+    m_buckets[GetBucket(ms)]++;
+    m_total_ms += ms;
+    m_frames++;
+    if (IsSpike(ms)) m_spikes++;
+  }
+
+  void FrameTimeHistogram::Clear()
+  {
+    std::fill(m_buckets.begin(), m_buckets.end(), 0);
+    m_frames = 0;
+    m_spikes = 0;
+    m_total_ms = 0.0;
+    m_max_ms = 0.0;
+    m_samples.clear();
+    m_next_sample = 0;
+  }
+
+  void FrameTimeHistogram::SetSpikeThreshold(double ms)
+  {
+    m_spike_threshold_ms = std::max(0.0, ms);
+
+    // recount the frames that are still in the window, a whole run starts counting from here
+    m_spikes = 0;
+    for (float sample : m_samples)
+    {
+      if (IsSpike(sample)) m_spikes++;
+    }
+  }
+
+  double FrameTimeHistogram::Percentile(double p) const
+  {
+    if (m_frames == 0) return 0.0;
+
+    uint64_t rank = static_cast<uint64_t>(std::ceil(std::min(std::max(p, 0.0), 1.0) * m_frames));
+    if (rank == 0) rank = 1;
+
+    uint64_t seen = 0;
+    for (std::size_t i = 0; i < m_buckets.size(); ++i)
+    {
+      seen += m_buckets[i];
+      if (seen >= rank) return std::min((i + 1) * BUCKET_MS, Max());
+    }
+    return Max();
+  }
+
+  double FrameTimeHistogram::Max() const
+  {
+    if (m_window == 0) return m_max_ms;
+
+    float max_ms = 0.0f;
+    for (float sample : m_samples) max_ms = std::max(max_ms, sample);
+    return max_ms;
+  }
+
+  FrameTimeHistogram::Stats FrameTimeHistogram::GetStats() const
+  {
+    Stats stats;
+    stats.frames = m_frames;
+    stats.spikes = m_spikes;
+    stats.average_ms = m_frames ? m_total_ms / m_frames : 0.0;
+    stats.p50_ms = Percentile(0.50);
+    stats.p95_ms = Percentile(0.95);
+    stats.p99_ms = Percentile(0.99);
+    stats.max_ms = Max();
+    return stats;
+  }
+
+  std::size_t FrameTimeHistogram::GetBucket(double ms)
+  {
+    return std::min(static_cast<std::size_t>(ms / BUCKET_MS), BUCKET_COUNT - 1);
+  }
+
+} // namespace FlexEngine
@@ -0,0 +1,85 @@
+// WLVERSE [https://wlverse.web.app]
+// frametimehistogram.h
+//
+// Frame time histogram for p50/p95/p99/max and spike counts.
+//
+// Frame times are sorted into fixed 0.05 ms buckets up to 250 ms, slower frames
+// go into the last bucket. Queries walk the buckets, so the cost does not
+// depend on how many frames were added.
+//
+// With a window size, only the last window frames are kept (rolling stats for
+// the statistics panel). Without one, every frame is counted (whole run stats
+// for the headless timing log).
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#pragma once
+
+#include "flx_api.h"
+
+#include <cstdint> // uint32_t, uint64_t
+#include <vector>
+
+namespace FlexEngine
+{
+
+  class __FLX_API FrameTimeHistogram
+  {
+  public:
+    static constexpr double BUCKET_MS = 0.05;
+    static constexpr std::size_t BUCKET_COUNT = 5000;
+
+    struct Stats
+    {
+      uint64_t frames = 0;
+      uint64_t spikes = 0; // frames slower than the spike threshold
+      double average_ms = 0.0;
+      double p50_ms = 0.0;
+      double p95_ms = 0.0;
+      double p99_ms = 0.0;
+      double max_ms = 0.0;
+    };
+
+    // window = 0 keeps every frame
+    FrameTimeHistogram(std::size_t window = 0);
+
+    void Add(double ms);
+    void Clear();
+
+    // Frames slower than this are counted as spikes. 0 disables spike counting.
+    void SetSpikeThreshold(double ms);
+    double GetSpikeThreshold() const { return m_spike_threshold_ms; }
+
+    std::size_t GetWindow() const { return m_window; }
+    uint64_t GetFrameCount() const { return m_frames; }
+
+    // p is from 0 to 1, returns the upper edge of the bucket (never more than the max)
+    double Percentile(double p) const;
+    double Max() const;
+
+    Stats GetStats() const;
+
+  private:
+    std::size_t m_window = 0;
+
+    std::vector<uint32_t> m_buckets;
+    uint64_t m_frames = 0;
+    uint64_t m_spikes = 0;
+    double m_total_ms = 0.0;
+    double m_max_ms = 0.0; // only tracked when every frame is kept
+
+    // ring of the last m_window frame times, unused when every frame is kept
+    std::vector<float> m_samples;
+    std::size_t m_next_sample = 0;
+
+    double m_spike_threshold_ms = 0.0;
+
+    static std::size_t GetBucket(double ms);
+    bool IsSpike(double ms) const { return m_spike_threshold_ms > 0.0 && ms > m_spike_threshold_ms; }
+  };
+
+} // namespace FlexEngine
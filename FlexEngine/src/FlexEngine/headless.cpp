@@ -0,0 +1,308 @@
+// WLVERSE [https://wlverse.web.app]
+// headless.cpp
+//
+// Headless runtime for soak tests, performance runs and battle replays on
+// machines without a GPU, display or audio device.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#include "pch.h"
+
+#include "headless.h"
+
+#include "frametimehistogram.h"
+#include "heapcounter.h"
+#include "FlexECS/datastructures.h"
+#include "Renderer/OpenGL/openglrecorder.h"
+#include "Renderer/OpenGL/openglrenderer.h"
+
+#include <chrono>
+#include <fstream>
+#include <iomanip> // std::setprecision
+
+namespace FlexEngine
+{
+
+  namespace
+  {
+    using Clock = std::chrono::high_resolution_clock;
+
+    Headless::Options options;
+
+    std::ofstream timings_file;
+
+    Clock::time_point run_start;
+    Clock::time_point frame_start;
+    uint64_t frame_count = 0;
+
+    // Every frame of the run, so that long soak runs use a fixed amount of memory
+    FrameTimeHistogram frame_histogram;
+
+    std::ofstream memory_file;
+    HeapCounter::Snapshot memory_start;
+    HeapCounter::Snapshot memory_previous;
+    FlexECS::Scene::ChangeListenerID scene_listener = 0;
+
+    // Writes the snapshot and its difference to the previous one
+    void WriteMemorySnapshot(const char* event)
+    {
+      HeapCounter::Snapshot snapshot = HeapCounter::TakeSnapshot();
+      HeapCounter::WriteCsv(memory_file, event, snapshot);
+      HeapCounter::WriteCsv(memory_file, (std::string(event) + "_diff").c_str(), HeapCounter::Diff(memory_previous, snapshot));
+      memory_previous = snapshot;
+    }
+
+    double ElapsedMilliseconds(Clock::time_point since)
+    {
+      return std::chrono::duration<double, std::milli>(Clock::now() - since).count();
+    }
+
+    void UpdateLayer(Layer& layer)
+    {
+      // guard: no file, no need to time it
+      if (!timings_file.is_open())
+      {
+        layer.Update();
+        return;
+      }
+
+      Clock::time_point start = Clock::now();
+      layer.Update();
+      timings_file << frame_count << ',' << layer.GetName() << ',' << ElapsedMilliseconds(start) << '\n';
+    }
+  }
+
+  bool Headless::ParseCommandLine(int argc, char** argv, Options& out)
+  {
+    for (int i = 1; i < argc; i++)
+    {
+      std::string arg = argv[i];
+      bool has_value = (i + 1 < argc);
+
+      if (arg == "--headless") out.enabled = true;
+      else if (arg == "--record-gl") out.record_gl = true;
+      else if (arg == "--frames")
+      {
+        // guard: missing value
+        if (!has_value)
+        {
+          Log::Error("--frames requires the number of frames to run.");
+          return false;
+        }
+
+        try
+        {
+          out.max_frames = std::stoull(argv[++i]);
+        }
+        catch (const std::exception&)
+        {
+          Log::Error("--frames requires a number. Got: " + std::string(argv[i]));
+          return false;
+        }
+      }
+      else if (arg == "--timings")
+      {
+        // guard: missing value
+        if (!has_value)
+        {
+          Log::Error("--timings requires a file path.");
+          return false;
+        }
+
+        out.timings_path = argv[++i];
+      }
+      else if (arg == "--memory-report")
+      {
+        // guard: missing value
+        if (!has_value)
+        {
+          Log::Error("--memory-report requires a file path.");
+          return false;
+        }
+
+        out.memory_report_path = argv[++i];
+      }
+      else if (arg == "--spike-ms")
+      {
+        // guard: missing value
+        if (!has_value)
+        {
+          Log::Error("--spike-ms requires a frame time in milliseconds.");
+          return false;
+        }
+
+        try
+        {
+          out.spike_ms = std::stod(argv[++i]);
+        }
+        catch (const std::exception&)
+        {
+          Log::Error("--spike-ms requires a number. Got: " + std::string(argv[i]));
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  void Headless::SetOptions(const Options& _options)
+  {
+    options = _options;
+  }
+
+  const Headless::Options& Headless::GetOptions()
+  {
+    return options;
+  }
+
+  bool Headless::IsEnabled()
+  {
+    return options.enabled;
+  }
+
+  #pragma region Application Hooks
+
+  void Headless::Init()
+  {
+    FLX_FLOW_FUNCTION();
+
+    // the recorder is a full driver as far as the renderer knows
+    bool recording = options.record_gl && OpenGLRecorder::Install();
+    if (options.record_gl && !recording) Log::Warning("Falling back to the null backend, OpenGL calls will not be recorded.");
+    OpenGLRenderer::SetNullBackend(!recording);
+
+    frame_count = 0;
+    frame_histogram.Clear();
+    frame_histogram.SetSpikeThreshold(options.spike_ms);
+    run_start = Clock::now();
+
+    if (!options.timings_path.empty())
+    {
+      timings_file.open(options.timings_path, std::ios::trunc);
+      if (timings_file.is_open())
+      {
+        timings_file << std::fixed << std::setprecision(4) << "frame,scope,ms\n";
+      }
+      else
+      {
+        Log::Warning("Could not open the frame timings file, timings will only be summarized. File: " + options.timings_path);
+      }
+    }
+
+    if (!options.memory_report_path.empty())
+    {
+      memory_file.open(options.memory_report_path, std::ios::trunc);
+      if (memory_file.is_open())
+      {
+        HeapCounter::SetTracking(true);
+        HeapCounter::WriteCsvHeader(memory_file);
+        memory_start = memory_previous = HeapCounter::TakeSnapshot();
+        HeapCounter::WriteCsv(memory_file, "start", memory_start);
+
+        scene_listener = FlexECS::Scene::AddChangeListener(
+          [](FlexECS::Scene::ChangeType type, FlexECS::EntityID, const FlexECS::ComponentID&)
+          {
+            if (type == FlexECS::Scene::ChangeType::ActiveSceneChanged) WriteMemorySnapshot("scene_switch");
+          }
+        );
+      }
+      else
+      {
+        Log::Warning("Could not open the memory report file, allocations will not be tracked. File: " + options.memory_report_path);
+      }
+    }
+
+    Log::Info(
+      "Running headless" +
+      (options.max_frames ? " for " + std::to_string(options.max_frames) + " frames" : std::string()) +
+      (timings_file.is_open() ? ", writing frame timings to " + options.timings_path : std::string())
+    );
+  }
+
+  void Headless::Shutdown()
+  {
+    FLX_FLOW_FUNCTION();
+
+    if (timings_file.is_open()) timings_file.close();
+
+    if (memory_file.is_open())
+    {
+      FlexECS::Scene::RemoveChangeListener(scene_listener);
+      WriteMemorySnapshot("end");
+      memory_file.close();
+
+      HeapCounter::TagStats leaked = HeapCounter::Diff(memory_start, memory_previous).Total();
+      HeapCounter::TagStats total = memory_previous.Total();
+      Log::Info(
+        "Headless memory: " + std::to_string(total.live_bytes / 1024) + " KB live in " + std::to_string(total.live_allocations) +
+        " allocations, " + std::to_string(leaked.live_bytes / 1024) + " KB more than at the start. Report: " + options.memory_report_path
+      );
+    }
+
+    double seconds = ElapsedMilliseconds(run_start) / 1000.0;
+    FrameTimeHistogram::Stats stats = frame_histogram.GetStats();
+
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(3)
+      << "Headless run: " << frame_count << " frames in " << seconds << "s"
+      << " (" << (seconds > 0.0 ? frame_count / seconds : 0.0) << " fps)."
+      << " Frame ms avg " << stats.average_ms
+      << ", p50 " << stats.p50_ms
+      << ", p95 " << stats.p95_ms
+      << ", p99 " << stats.p99_ms
+      << ", max " << stats.max_ms
+      << ". Spikes over " << options.spike_ms << " ms: " << stats.spikes;
+    Log::Info(ss);
+
+    if (OpenGLRecorder::IsInstalled() && OpenGLRecorder::GetFrameCount() > 0)
+    {
+      const OpenGLRecorder::Counts& gl = OpenGLRecorder::GetTotalCounts();
+      const OpenGLRecorder::Counts& last = OpenGLRecorder::GetCountsLastFrame();
+      double frames = static_cast<double>(OpenGLRecorder::GetFrameCount());
+
+      std::stringstream gl_ss;
+      gl_ss << std::fixed << std::setprecision(1)
+        << "Headless OpenGL calls per frame: avg " << gl.total / frames << " (last frame " << last.total << ")"
+        << ", glUseProgram " << gl.use_program / frames
+        << ", glBindTexture " << gl.bind_texture / frames
+        << ", glActiveTexture " << gl.active_texture / frames
+        << ", glBindVertexArray " << gl.bind_vertex_array / frames
+        << ", blend " << gl.blend / frames
+        << ", glGetUniformLocation " << gl.get_uniform_location / frames << " (last frame " << last.get_uniform_location << ")"
+        << ", glUniform* " << gl.uniform / frames
+        << ", draws " << gl.draw / frames;
+      Log::Info(gl_ss);
+    }
+  }
+
+  void Headless::BeginFrame()
+  {
+    frame_start = Clock::now();
+  }
+
+  bool Headless::EndFrame()
+  {
+    double ms = ElapsedMilliseconds(frame_start);
+    frame_histogram.Add(ms);
+
+    if (timings_file.is_open()) timings_file << frame_count << ",Frame," << ms << '\n';
+    if (OpenGLRecorder::IsInstalled()) OpenGLRecorder::NewFrame();
+
+    frame_count++;
+    return options.max_frames != 0 && frame_count >= options.max_frames;
+  }
+
+  void Headless::UpdateLayerStack(LayerStack& layerstack)
+  {
+    for (std::size_t i = 0; i < layerstack.GetLayerCount(); ++i) UpdateLayer(*layerstack.GetLayer(i));
+    for (std::size_t i = 0; i < layerstack.GetOverlayCount(); ++i) UpdateLayer(*layerstack.GetOverlay(i));
+  }
+
+  #pragma endregion
+
+}
@@ -0,0 +1,109 @@
+// WLVERSE [https://wlverse.web.app]
+// headless.h
+//
+// Headless runtime for soak tests, performance runs and battle replays on
+// machines without a GPU, display or audio device.
+//
+// Started with --headless on the command line. The application runs the same
+// layers as usual (physics, animator, scripting, battle logic...), but:
+//  - windows do not create a GLFW window or OpenGL context, they only keep their size
+//  - the OpenGL renderer runs on its null backend, so draw calls, framebuffers
+//    and GPU resources are skipped (textures still know their size)
+//  - input is never polled, so every key and button reads as released
+//  - FMOD mixes to FMOD_OUTPUTTYPE_NOSOUND_NRT instead of an audio device
+//  - the frame rate is uncapped because nothing waits for vsync
+//
+// The time of every frame and of every window layer is written to a csv file
+// with the columns frame,scope,ms. The scope is "Frame" for the whole frame or
+// the name of the layer. A summary (average, p50/p95/p99/max and the number of
+// spikes) is logged when the application closes.
+//
+// --memory-report turns on allocation tracking (see heapcounter.h) and writes
+// the memory of every tag to a csv file at the start, at every scene switch and
+// at the end of the run. Every snapshot is followed by its difference to the
+// previous one, so a scene that does not release its memory shows up as live
+// bytes that keep growing in the *_diff rows of the same switch.
+//
+// --record-gl runs the renderer against the OpenGL recorder (see openglrecorder.h)
+// instead of the null backend, and logs the average number of OpenGL calls per
+// frame when the application closes.
+//
+// Command line:
+//   Game.exe --headless [--frames 36000] [--timings frame_timings.csv] [--spike-ms 33.3] [--memory-report memory.csv] [--record-gl]
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#pragma once
+
+#include "flx_api.h"
+
+#include "Layer/layerstack.h"
+
+#include <cstdint> // uint64_t
+#include <string>
+
+namespace FlexEngine
+{
+
+  class __FLX_API Headless
+  {
+  public:
+    struct __FLX_API Options
+    {
+      bool enabled = false;
+
+      // Quits after this many frames. 0 runs until the application quits by itself.
+      uint64_t max_frames = 0;
+
+      // Per-frame timings csv. Empty disables the file, the summary is still logged.
+      std::string timings_path = "frame_timings.csv";
+
+      // Frames slower than this are counted as spikes in the summary. Two 60 fps frames by default.
+      double spike_ms = 1000.0 / 30.0;
+
+      // Memory snapshots csv. Empty (the default) leaves allocation tracking off.
+      std::string memory_report_path = "";
+
+      // Renders against the OpenGL recorder instead of the null backend.
+      bool record_gl = false;
+    };
+
+    // Reads --headless, --frames, --timings, --spike-ms, --memory-report and --record-gl, other arguments are ignored.
+    // Returns false and logs the reason if a value is missing or malformed.
+    static bool ParseCommandLine(int argc, char** argv, Options& out);
+
+    // Must be set before the application is created.
+    static void SetOptions(const Options& options);
+    static const Options& GetOptions();
+
+    static bool IsEnabled();
+
+    #pragma region Application Hooks
+
+    // Switches the renderer to its null backend (or the OpenGL recorder) and opens the timings and memory report files.
+    // Called by the application constructor.
+    static void Init();
+
+    // Closes the files and logs the frame time, memory and OpenGL call summary.
+    // Called by the application destructor.
+    static void Shutdown();
+
+    // Marks the start of an application frame.
+    static void BeginFrame();
+
+    // Marks the end of an application frame and writes its timings.
+    // Returns true once max_frames have run and the application should quit.
+    static bool EndFrame();
+
+    // Updates a window layer stack in the same order as LayerStack::Update,
+    // timing each layer and overlay.
+    static void UpdateLayerStack(LayerStack& layerstack);
+
+    #pragma endregion
+  };
+
+}
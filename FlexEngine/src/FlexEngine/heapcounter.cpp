@@ -0,0 +1,370 @@
+// WLVERSE [https://wlverse.web.app]
+// heapcounter.cpp
+//
+// Counts heap allocations made through operator new.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#include "heapcounter.h"
+
+#include <algorithm>  // std::max
+#include <atomic>
+#include <cstdlib>    // std::malloc, std::free
+#include <functional> // std::hash
+#include <mutex>
+#include <new>        // std::bad_alloc
+#include <ostream>
+#include <unordered_map>
+
+namespace FlexEngine
+{
+
+  namespace
+  {
+    constexpr std::size_t TAG_COUNT = static_cast<std::size_t>(MemoryTag::Count);
+
+    // constant initialized, so allocations made before static initialization are counted too
+    std::atomic<uint64_t> s_allocations{ 0 };
+    std::atomic<uint64_t> s_frees{ 0 };
+    std::atomic<uint64_t> s_bytes_allocated{ 0 };
+
+    uint64_t s_frame_start_allocations = 0;
+    uint64_t s_frame_start_bytes = 0;
+    uint64_t s_allocations_last_frame = 0;
+    uint64_t s_bytes_allocated_last_frame = 0;
+    uint64_t s_frame = 0;
+
+    #pragma region Tracking State
+
+    std::atomic<bool> s_tracking{ false };
+    std::atomic<int64_t> s_tracked_blocks{ 0 }; // frees only look up the records while this is not 0
+
+    thread_local MemoryTag t_tag = MemoryTag::Untagged;
+
+    struct TagCounters
+    {
+      std::atomic<int64_t> live_bytes{ 0 };
+      std::atomic<int64_t> live_allocations{ 0 };
+      std::atomic<int64_t> peak_bytes{ 0 };
+      std::atomic<int64_t> allocations{ 0 };
+      std::atomic<int64_t> bytes_allocated{ 0 };
+      std::atomic<int64_t> external_bytes{ 0 };
+
+      // only touched by NewFrame
+      int64_t frame_start_allocations = 0;
+      int64_t frame_start_bytes = 0;
+      int64_t allocations_last_frame = 0;
+      int64_t bytes_allocated_last_frame = 0;
+    };
+
+    TagCounters s_tags[TAG_COUNT];
+
+    TagCounters& GetCounters(MemoryTag tag)
+    {
+      return s_tags[static_cast<std::size_t>(tag)];
+    }
+
+    // The records must not allocate through operator new, or every insert would recurse
+    template <typename T>
+    struct MallocAllocator
+    {
+      using value_type = T;
+
+      MallocAllocator() = default;
+      template <typename U>
+      MallocAllocator(const MallocAllocator<U>&) noexcept {}
+
+      T* allocate(std::size_t count)
+      {
+        void* ptr = std::malloc(count * sizeof(T));
+        if (!ptr) throw std::bad_alloc();
+        return static_cast<T*>(ptr);
+      }
+      void deallocate(T* ptr, std::size_t) noexcept { std::free(ptr); }
+
+      template <typename U>
+      bool operator==(const MallocAllocator<U>&) const noexcept { return true; }
+      template <typename U>
+      bool operator!=(const MallocAllocator<U>&) const noexcept { return false; }
+    };
+
+    struct Record
+    {
+      std::size_t size = 0;
+      MemoryTag tag = MemoryTag::Untagged;
+    };
+
+    // Sharded by address so that threads allocating at the same time rarely share a lock
+    struct Shard
+    {
+      std::mutex mutex;
+      std::unordered_map<void*, Record, std::hash<void*>, std::equal_to<void*>, MallocAllocator<std::pair<void* const, Record>>> records;
+    };
+
+    constexpr std::size_t SHARD_COUNT = 16;
+
+    Shard& GetShard(void* ptr)
+    {
+      // never destroyed, blocks can still be freed while other statics are destructed
+      static Shard* shards = []()
+      {
+        Shard* memory = static_cast<Shard*>(std::malloc(sizeof(Shard) * SHARD_COUNT));
+        if (!memory) throw std::bad_alloc();
+        for (std::size_t i = 0; i < SHARD_COUNT; ++i) new (&memory[i]) Shard();
+        return memory;
+      }();
+
+      // the low bits are always zero because of the allocation alignment
+      std::size_t index = (reinterpret_cast<uintptr_t>(ptr) >> 4) % SHARD_COUNT;
+      return shards[index];
+    }
+
+    void UpdatePeak(std::atomic<int64_t>& peak, int64_t value)
+    {
+      int64_t current = peak.load(std::memory_order_relaxed);
+      while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+    }
+
+    void TrackAllocation(void* ptr, std::size_t size)
+    {
+      MemoryTag tag = t_tag;
+
+      Shard& shard = GetShard(ptr);
+      {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.records[ptr] = { size, tag };
+      }
+      s_tracked_blocks.fetch_add(1, std::memory_order_relaxed);
+
+      TagCounters& counters = GetCounters(tag);
+      int64_t bytes = static_cast<int64_t>(size);
+      counters.allocations.fetch_add(1, std::memory_order_relaxed);
+      counters.bytes_allocated.fetch_add(bytes, std::memory_order_relaxed);
+      counters.live_allocations.fetch_add(1, std::memory_order_relaxed);
+      UpdatePeak(counters.peak_bytes, counters.live_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+    }
+
+    void TrackFree(void* ptr)
+    {
+      Record record;
+      Shard& shard = GetShard(ptr);
+      {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.records.find(ptr);
+
+        // guard: allocated before tracking was turned on
+        if (it == shard.records.end()) return;
+
+        record = it->second;
+        shard.records.erase(it);
+      }
+      s_tracked_blocks.fetch_sub(1, std::memory_order_relaxed);
+
+      TagCounters& counters = GetCounters(record.tag);
+      counters.live_allocations.fetch_sub(1, std::memory_order_relaxed);
+      counters.live_bytes.fetch_sub(static_cast<int64_t>(record.size), std::memory_order_relaxed);
+    }
+
+    #pragma endregion
+  }
+
+  void* HeapCounter::Allocate(std::size_t size)
+  {
+    // operator new must return a unique pointer for zero sized allocations
+    void* ptr = std::malloc(size ? size : 1);
+    if (!ptr) throw std::bad_alloc();
+
+    s_allocations.fetch_add(1, std::memory_order_relaxed);
+    s_bytes_allocated.fetch_add(size, std::memory_order_relaxed);
+
+    if (s_tracking.load(std::memory_order_relaxed)) TrackAllocation(ptr, size);
+    return ptr;
+  }
+
+  void HeapCounter::Free(void* ptr) noexcept
+  {
+    // guard
+    if (!ptr) return;
+
+    s_frees.fetch_add(1, std::memory_order_relaxed);
+    if (s_tracked_blocks.load(std::memory_order_relaxed) != 0) TrackFree(ptr);
+    std::free(ptr);
+  }
+
+  void HeapCounter::NewFrame()
+  {
+    uint64_t allocations = s_allocations.load(std::memory_order_relaxed);
+    uint64_t bytes = s_bytes_allocated.load(std::memory_order_relaxed);
+
+    s_allocations_last_frame = allocations - s_frame_start_allocations;
+    s_bytes_allocated_last_frame = bytes - s_frame_start_bytes;
+    s_frame_start_allocations = allocations;
+    s_frame_start_bytes = bytes;
+    s_frame++;
+
+    for (TagCounters& counters : s_tags)
+    {
+      int64_t tag_allocations = counters.allocations.load(std::memory_order_relaxed);
+      int64_t tag_bytes = counters.bytes_allocated.load(std::memory_order_relaxed);
+      counters.allocations_last_frame = tag_allocations - counters.frame_start_allocations;
+      counters.bytes_allocated_last_frame = tag_bytes - counters.frame_start_bytes;
+      counters.frame_start_allocations = tag_allocations;
+      counters.frame_start_bytes = tag_bytes;
+    }
+  }
+
+  HeapCounter::Stats HeapCounter::GetStats()
+  {
+    Stats stats;
+    stats.allocations = s_allocations.load(std::memory_order_relaxed);
+    stats.frees = s_frees.load(std::memory_order_relaxed);
+    stats.bytes_allocated = s_bytes_allocated.load(std::memory_order_relaxed);
+    stats.allocations_last_frame = s_allocations_last_frame;
+    stats.bytes_allocated_last_frame = s_bytes_allocated_last_frame;
+    return stats;
+  }
+
+  #pragma region Tracking
+
+  void HeapCounter::SetTracking(bool enabled)
+  {
+    s_tracking.store(enabled, std::memory_order_relaxed);
+  }
+
+  bool HeapCounter::IsTracking()
+  {
+    return s_tracking.load(std::memory_order_relaxed);
+  }
+
+  HeapCounter::TagScope::TagScope(MemoryTag tag)
+    : m_previous(t_tag)
+  {
+    t_tag = tag;
+  }
+
+  HeapCounter::TagScope::~TagScope()
+  {
+    t_tag = m_previous;
+  }
+
+  MemoryTag HeapCounter::GetCurrentTag()
+  {
+    return t_tag;
+  }
+
+  const char* HeapCounter::GetTagName(MemoryTag tag)
+  {
+    switch (tag)
+    {
+    case MemoryTag::Untagged:         return "Untagged";
+    case MemoryTag::ECS:              return "ECS";
+    case MemoryTag::Strings:          return "Strings";
+    case MemoryTag::Renderer:         return "Renderer";
+    case MemoryTag::Audio:            return "Audio";
+    case MemoryTag::Scripting:        return "Scripting";
+    case MemoryTag::AssetTexture:     return "Assets/Texture";
+    case MemoryTag::AssetShader:      return "Assets/Shader";
+    case MemoryTag::AssetSpritesheet: return "Assets/Spritesheet";
+    case MemoryTag::AssetSound:       return "Assets/Sound";
+    case MemoryTag::AssetFont:        return "Assets/Font";
+    case MemoryTag::AssetVideo:       return "Assets/Video";
+    case MemoryTag::AssetData:        return "Assets/Data";
+    default:                          return "Unknown";
+    }
+  }
+
+  void HeapCounter::AddExternal(MemoryTag tag, int64_t bytes)
+  {
+    GetCounters(tag).external_bytes.fetch_add(bytes, std::memory_order_relaxed);
+  }
+
+  HeapCounter::TagStats HeapCounter::Snapshot::Total() const
+  {
+    TagStats total;
+    for (const TagStats& tag : tags)
+    {
+      total.live_bytes += tag.live_bytes;
+      total.live_allocations += tag.live_allocations;
+      total.peak_bytes += tag.peak_bytes;
+      total.allocations += tag.allocations;
+      total.bytes_allocated += tag.bytes_allocated;
+      total.allocations_last_frame += tag.allocations_last_frame;
+      total.bytes_allocated_last_frame += tag.bytes_allocated_last_frame;
+      total.external_bytes += tag.external_bytes;
+    }
+    return total;
+  }
+
+  HeapCounter::Snapshot HeapCounter::TakeSnapshot()
+  {
+    Snapshot snapshot;
+    snapshot.frame = s_frame;
+    for (std::size_t i = 0; i < TAG_COUNT; ++i)
+    {
+      const TagCounters& counters = s_tags[i];
+      TagStats& stats = snapshot.tags[i];
+      stats.live_bytes = counters.live_bytes.load(std::memory_order_relaxed);
+      stats.live_allocations = counters.live_allocations.load(std::memory_order_relaxed);
+      stats.peak_bytes = counters.peak_bytes.load(std::memory_order_relaxed);
+      stats.allocations = counters.allocations.load(std::memory_order_relaxed);
+      stats.bytes_allocated = counters.bytes_allocated.load(std::memory_order_relaxed);
+      stats.allocations_last_frame = counters.allocations_last_frame;
+      stats.bytes_allocated_last_frame = counters.bytes_allocated_last_frame;
+      stats.external_bytes = counters.external_bytes.load(std::memory_order_relaxed);
+    }
+    return snapshot;
+  }
+
+  HeapCounter::Snapshot HeapCounter::Diff(const Snapshot& before, const Snapshot& after)
+  {
+    Snapshot diff;
+    diff.frame = after.frame - before.frame;
+    for (std::size_t i = 0; i < TAG_COUNT; ++i)
+    {
+      const TagStats& a = before.tags[i];
+      const TagStats& b = after.tags[i];
+      TagStats& d = diff.tags[i];
+      d.live_bytes = b.live_bytes - a.live_bytes;
+      d.live_allocations = b.live_allocations - a.live_allocations;
+      d.peak_bytes = b.peak_bytes;
+      d.allocations = b.allocations - a.allocations;
+      d.bytes_allocated = b.bytes_allocated - a.bytes_allocated;
+      d.allocations_last_frame = b.allocations_last_frame - a.allocations_last_frame;
+      d.bytes_allocated_last_frame = b.bytes_allocated_last_frame - a.bytes_allocated_last_frame;
+      d.external_bytes = b.external_bytes - a.external_bytes;
+    }
+    return diff;
+  }
+
+  void HeapCounter::WriteCsvHeader(std::ostream& out)
+  {
+    out << "event,frame,tag,live_bytes,live_allocations,peak_bytes,allocations,bytes_allocated,external_bytes\n";
+  }
+
+  void HeapCounter::WriteCsv(std::ostream& out, const char* event, const Snapshot& snapshot)
+  {
+    for (std::size_t i = 0; i < TAG_COUNT; ++i)
+    {
+      const TagStats& stats = snapshot.tags[i];
+
+      // guard: nothing was ever tracked for this tag
+      if (stats.allocations == 0 && stats.live_bytes == 0 && stats.external_bytes == 0) continue;
+
+      out << event << ',' << snapshot.frame << ',' << GetTagName(static_cast<MemoryTag>(i)) << ','
+        << stats.live_bytes << ',' << stats.live_allocations << ',' << stats.peak_bytes << ','
+        << stats.allocations << ',' << stats.bytes_allocated << ',' << stats.external_bytes << '\n';
+    }
+  }
+
+  #pragma endregion
+
+}
+
+// Replacements for the engine module, see heapcounter.h
+// The array, nothrow and sized forms forward to these.
+void* operator new(std::size_t size) { return FlexEngine::HeapCounter::Allocate(size); }
+void operator delete(void* ptr) noexcept { FlexEngine::HeapCounter::Free(ptr); }
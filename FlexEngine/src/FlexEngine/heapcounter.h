@@ -0,0 +1,160 @@
+// WLVERSE [https://wlverse.web.app]
+// heapcounter.h
+//
+// Counts heap allocations made through operator new.
+//
+// The engine replaces the global operator new and delete in its own module,
+// and entrypoint.h does the same for the application, both forward to
+// HeapCounter::Allocate and HeapCounter::Free. Other modules (the scripts DLL,
+// third party DLLs) keep their own allocators and are not counted.
+//
+// Used to check that the frame arena keeps the frame loop off the heap, see
+// DataStructures/framearena.h.
+//
+// Allocation tracking (opt-in)
+// SetTracking(true) records the size and the memory tag of every allocation,
+// so that live bytes, peak and allocation rate are known per subsystem. The
+// tag comes from the innermost FLX_MEMORY_TAG scope on the allocating thread,
+// allocations outside of any scope are Untagged. Tracking costs a locked map
+// insert per allocation and is off by default, the totals above are always
+// counted. Blocks allocated while tracking stay tracked until they are freed,
+// even if tracking is turned off in between.
+//
+// Memory that does not go through operator new (FMOD sounds) is reported with
+// AddExternal and shown separately from the heap bytes of its tag.
+//
+// TakeSnapshot and Diff compare two points of a run, for example before and
+// after a scene switch to find what was not released. The editor statistics
+// panel shows the live table, and a headless run writes every scene switch to
+// the file given by --memory-report.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#pragma once
+
+#include "flx_api.h"
+
+#include <array>
+#include <cstddef> // std::size_t
+#include <cstdint> // uint64_t, int64_t
+#include <iosfwd>  // std::ostream
+
+namespace FlexEngine
+{
+
+  enum class MemoryTag : uint8_t
+  {
+    Untagged,
+    ECS,              // component data, archetypes and entity records
+    Strings,          // strings added to the scene string storage, the ones loaded with a scene count as ECS
+    Renderer,
+    Audio,
+    Scripting,
+    AssetTexture,
+    AssetShader,
+    AssetSpritesheet,
+    AssetSound,
+    AssetFont,
+    AssetVideo,
+    AssetData,        // battles, characters, moves, dialogues and cutscenes
+    Count
+  };
+
+  class __FLX_API HeapCounter
+  {
+  public:
+    // static class
+    HeapCounter() = delete;
+
+    // malloc and free with counting, used by the operator new and delete replacements
+    static void* Allocate(std::size_t size);
+    static void Free(void* ptr) noexcept;
+
+    struct Stats
+    {
+      uint64_t allocations = 0;            // since the start of the program
+      uint64_t frees = 0;
+      uint64_t bytes_allocated = 0;        // requested bytes, frees are not sized
+      uint64_t allocations_last_frame = 0;
+      uint64_t bytes_allocated_last_frame = 0;
+    };
+
+    // Ends the current frame for the per frame counts.
+    // Called at the start of Window::Update.
+    static void NewFrame();
+
+    static Stats GetStats();
+
+    #pragma region Tracking
+
+    static void SetTracking(bool enabled);
+    static bool IsTracking();
+
+    // Sets the memory tag of the current thread until the end of the scope.
+    // Scopes nest, use FLX_MEMORY_TAG instead of creating one directly.
+    class __FLX_API TagScope
+    {
+      MemoryTag m_previous;
+
+    public:
+      TagScope(MemoryTag tag);
+      ~TagScope();
+
+      TagScope(const TagScope&) = delete;
+      TagScope& operator=(const TagScope&) = delete;
+    };
+
+    static MemoryTag GetCurrentTag();
+    static const char* GetTagName(MemoryTag tag);
+
+    // Memory owned by a tag that is not allocated with operator new.
+    // Pass a negative size when it is released.
+    static void AddExternal(MemoryTag tag, int64_t bytes);
+
+    // Signed so that the difference of two snapshots uses the same type
+    struct TagStats
+    {
+      int64_t live_bytes = 0;
+      int64_t live_allocations = 0;
+      int64_t peak_bytes = 0;              // highest live_bytes, not meaningful in a diff
+      int64_t allocations = 0;             // since tracking started
+      int64_t bytes_allocated = 0;
+      int64_t allocations_last_frame = 0;
+      int64_t bytes_allocated_last_frame = 0;
+      int64_t external_bytes = 0;
+    };
+
+    struct __FLX_API Snapshot
+    {
+      uint64_t frame = 0; // frames since the start of the program
+      std::array<TagStats, static_cast<std::size_t>(MemoryTag::Count)> tags{};
+
+      const TagStats& operator[](MemoryTag tag) const { return tags[static_cast<std::size_t>(tag)]; }
+
+      // Sum of every tag, the peak is the sum of the peaks
+      TagStats Total() const;
+    };
+
+    static Snapshot TakeSnapshot();
+
+    // after - before for every counter except the peak, which is the peak of after.
+    // A live_bytes that keeps growing across the same scene switch is a leak.
+    static Snapshot Diff(const Snapshot& before, const Snapshot& after);
+
+    // Writes one csv row per tag with the columns
+    // event,frame,tag,live_bytes,live_allocations,peak_bytes,allocations,bytes_allocated,external_bytes
+    static void WriteCsvHeader(std::ostream& out);
+    static void WriteCsv(std::ostream& out, const char* event, const Snapshot& snapshot);
+
+    #pragma endregion
+  };
+
+}
+
+// Tags the heap allocations of the current thread until the end of the scope.
+// Usage: FLX_MEMORY_TAG(ECS);
+#define FLX_MEMORY_TAG(tag) FlexEngine::HeapCounter::TagScope flx_memory_tag_scope(FlexEngine::MemoryTag::tag)
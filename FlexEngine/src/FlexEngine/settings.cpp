@@ -0,0 +1,285 @@
+// WLVERSE [https://wlverse.web.app]
+// settings.cpp
+//
+// Typed settings registry on top of FlexPrefs.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#include "pch.h"
+
+#include "settings.h"
+#include "flexprefs.h"
+
+#include <chrono>
+
+namespace FlexEngine
+{
+
+  namespace
+  {
+    using Clock = std::chrono::steady_clock;
+
+    // How long the settings must stay unchanged before they are saved
+    constexpr std::chrono::milliseconds SAVE_DELAY(500);
+
+    using SettingValue = std::variant<bool, int, float, std::string>;
+
+    struct SettingEntry
+    {
+      std::string key;
+      SettingValue value;
+      SettingValue default_value;
+      double min = 0.0; // range of int and float settings, a double holds both exactly
+      double max = 0.0;
+      std::vector<std::pair<Settings::ListenerID, std::function<void()>>> listeners;
+    };
+
+    // A deque keeps the entries in place as more are declared, the handles point into it
+    std::deque<SettingEntry> entries;
+    std::unordered_map<std::string, uint32_t> entry_lookup;
+
+    Settings::ListenerID next_listener_id = 1;
+
+    bool dirty = false;
+    Clock::time_point last_change;
+
+    #pragma region Helpers
+
+    const char* TypeName(const SettingValue& value)
+    {
+      switch (value.index())
+      {
+      case 0: return "bool";
+      case 1: return "int";
+      case 2: return "float";
+      default: return "string";
+      }
+    }
+
+    // Reads the saved value of the entry, keeps the current one if the key is missing or has another type
+    void ReadSaved(SettingEntry& entry)
+    {
+      const Value* saved = FlexPrefs::Internal_Find(entry.key);
+      if (saved == nullptr) return;
+
+      bool read = std::visit([&](auto& value)
+      {
+        using T = std::decay_t<decltype(value)>;
+        if constexpr (std::is_same_v<T, bool>)
+        {
+          if (!saved->IsBool()) return false;
+          value = saved->GetBool();
+        }
+        else if constexpr (std::is_same_v<T, int>)
+        {
+          if (!saved->IsNumber()) return false;
+          value = saved->IsInt() ? saved->GetInt() : static_cast<int>(saved->GetDouble());
+          value = std::clamp(value, static_cast<int>(entry.min), static_cast<int>(entry.max));
+        }
+        else if constexpr (std::is_same_v<T, float>)
+        {
+          if (!saved->IsNumber()) return false;
+          value = std::clamp(saved->GetFloat(), static_cast<float>(entry.min), static_cast<float>(entry.max));
+        }
+        else
+        {
+          if (!saved->IsString()) return false;
+          value = saved->GetString();
+        }
+        return true;
+      }, entry.value);
+
+      if (!read) Log::Warning("Setting " + entry.key + " is saved with the wrong type, expected " + TypeName(entry.value) + ". Using the default.");
+    }
+
+    // Writes the value of the entry into FlexPrefs
+    void WriteSaved(const SettingEntry& entry)
+    {
+      std::visit([&](const auto& value)
+      {
+        using T = std::decay_t<decltype(value)>;
+        if constexpr (std::is_same_v<T, bool>) FlexPrefs::SetBool(entry.key, value);
+        else if constexpr (std::is_same_v<T, int>) FlexPrefs::SetInt(entry.key, value);
+        else if constexpr (std::is_same_v<T, float>) FlexPrefs::SetFloat(entry.key, value);
+        else FlexPrefs::SetString(entry.key, value);
+      }, entry.value);
+    }
+
+    void Notify(const SettingEntry& entry)
+    {
+      // a listener may add or remove listeners
+      auto listeners = entry.listeners;
+      for (auto& [id, callback] : listeners) callback();
+    }
+
+    template <typename T>
+    std::pair<const T*, uint32_t> Declare(const std::string& key, const T& default_value, double min, double max)
+    {
+      auto it = entry_lookup.find(key);
+      if (it != entry_lookup.end())
+      {
+        SettingEntry& existing = entries[it->second];
+        FLX_ASSERT(
+          std::holds_alternative<T>(existing.value),
+          "Setting " + key + " was declared as " + TypeName(existing.value) + " and again as " + TypeName(SettingValue(default_value))
+        );
+        return { &std::get<T>(existing.value), it->second };
+      }
+
+      uint32_t index = static_cast<uint32_t>(entries.size());
+      SettingEntry& entry = entries.emplace_back();
+      entry.key = key;
+      entry.value = default_value;
+      entry.default_value = default_value;
+      entry.min = min;
+      entry.max = max;
+      ReadSaved(entry);
+
+      entry_lookup.emplace(key, index);
+      return { &std::get<T>(entry.value), index };
+    }
+
+    template <typename T>
+    void SetValue(uint32_t index, T value)
+    {
+      SettingEntry& entry = entries[index];
+      T& current = std::get<T>(entry.value);
+      if constexpr (std::is_same_v<T, int>) value = std::clamp(value, static_cast<int>(entry.min), static_cast<int>(entry.max));
+      else if constexpr (std::is_same_v<T, float>) value = std::clamp(value, static_cast<float>(entry.min), static_cast<float>(entry.max));
+
+      // guard: nothing changed
+      if (current == value) return;
+
+      current = std::move(value);
+      WriteSaved(entry);
+
+      dirty = true;
+      last_change = Clock::now();
+
+      Notify(entry);
+    }
+
+    #pragma endregion
+  }
+
+  #pragma region Declaration
+
+  Setting<bool> Settings::DeclareBool(const std::string& key, bool default_value)
+  {
+    auto [value, index] = Declare<bool>(key, default_value, 0.0, 0.0);
+    return Setting<bool>(value, index);
+  }
+
+  Setting<int> Settings::DeclareInt(const std::string& key, int default_value, int min, int max)
+  {
+    auto [value, index] = Declare<int>(key, std::clamp(default_value, min, max), min, max);
+    return Setting<int>(value, index);
+  }
+
+  Setting<float> Settings::DeclareFloat(const std::string& key, float default_value, float min, float max)
+  {
+    auto [value, index] = Declare<float>(key, std::clamp(default_value, min, max), min, max);
+    return Setting<float>(value, index);
+  }
+
+  Setting<std::string> Settings::DeclareString(const std::string& key, const std::string& default_value)
+  {
+    auto [value, index] = Declare<std::string>(key, default_value, 0.0, 0.0);
+    return Setting<std::string>(value, index);
+  }
+
+  #pragma endregion
+
+  #pragma region Changes
+
+  void Settings::Set(Setting<bool> setting, bool value) { SetValue<bool>(setting.m_index, value); }
+  void Settings::Set(Setting<int> setting, int value) { SetValue<int>(setting.m_index, value); }
+  void Settings::Set(Setting<float> setting, float value) { SetValue<float>(setting.m_index, value); }
+  void Settings::Set(Setting<std::string> setting, const std::string& value) { SetValue<std::string>(setting.m_index, value); }
+
+  Settings::ListenerID Settings::Internal_AddListener(uint32_t index, std::function<void()> callback)
+  {
+    ListenerID id = next_listener_id++;
+    entries[index].listeners.emplace_back(id, std::move(callback));
+    return id;
+  }
+
+  void Settings::RemoveListener(ListenerID id)
+  {
+    for (SettingEntry& entry : entries)
+    {
+      auto& listeners = entry.listeners;
+      listeners.erase(
+        std::remove_if(listeners.begin(), listeners.end(), [id](const auto& listener) { return listener.first == id; }),
+        listeners.end()
+      );
+    }
+  }
+
+  #pragma endregion
+
+  #pragma region Persistence
+
+  void Settings::Update()
+  {
+    if (dirty && Clock::now() - last_change >= SAVE_DELAY) Flush();
+  }
+
+  void Settings::Flush()
+  {
+    if (!dirty) return;
+    dirty = false;
+    FlexPrefs::SaveAsync();
+  }
+
+  void Settings::Internal_Reload()
+  {
+    for (SettingEntry& entry : entries)
+    {
+      SettingValue previous = entry.value;
+      entry.value = entry.default_value;
+      ReadSaved(entry);
+      if (entry.value != previous) Notify(entry);
+    }
+  }
+
+  #pragma endregion
+
+  #pragma region Engine Settings
+
+  Setting<bool> EngineSettings::game_batching;
+  Setting<bool> EngineSettings::editor_batching;
+  Setting<bool> EngineSettings::game_fullscreen;
+  Setting<bool> EngineSettings::game_vsync;
+  Setting<bool> EngineSettings::game_frame_pacing;
+  Setting<bool> EngineSettings::game_serial_systems;
+  Setting<float> EngineSettings::game_frame_budget_ms;
+  Setting<int> EngineSettings::game_resolution_index;
+  Setting<float> EngineSettings::game_volume;
+  Setting<float> EngineSettings::game_sfx_volume;
+  Setting<float> EngineSettings::editor_camera_speed;
+  Setting<int> EngineSettings::editor_theme_index;
+
+  void EngineSettings::Declare()
+  {
+    game_batching = Settings::DeclareBool("game.batching", false);
+    editor_batching = Settings::DeclareBool("editor.batching", false);
+    game_fullscreen = Settings::DeclareBool("game.fullscreen", false);
+    game_vsync = Settings::DeclareBool("game.vsync", false);
+    game_frame_pacing = Settings::DeclareBool("game.framePacing", false);
+    game_serial_systems = Settings::DeclareBool("game.serialSystems", false);
+    game_frame_budget_ms = Settings::DeclareFloat("game.frameBudgetMs", 0.f, 0.f, 50.f);
+    game_resolution_index = Settings::DeclareInt("game.resolutionIndex", 0, 0, 3);
+    game_volume = Settings::DeclareFloat("game.volume", 0.f, 0.f, 1.f);
+    game_sfx_volume = Settings::DeclareFloat("game.sfx.volume", 0.f, 0.f, 1.f);
+    editor_camera_speed = Settings::DeclareFloat("editor.cameraSpeed", 1.f, 0.1f, 10.f);
+    editor_theme_index = Settings::DeclareInt("editor.themeIndex", 0, 0, 1);
+  }
+
+  #pragma endregion
+
+}
@@ -0,0 +1,146 @@
+// WLVERSE [https://wlverse.web.app]
+// settings.h
+//
+// Typed settings registry on top of FlexPrefs.
+//
+// A setting is declared once with its key, type, default and range, and the
+// declaration returns a typed handle. Reading a handle is a load through a
+// pointer, so settings can be read every frame instead of searching the
+// FlexPrefs document by name. Changes go through Settings::Set, which clamps
+// the value, writes it into FlexPrefs and calls the listeners of the setting,
+// so systems can keep state derived from it up to date.
+//
+// Persistence still goes through flxprefs.json. Settings::Update saves the
+// file on the FlexPrefs worker thread once the changed settings have settled,
+// so dragging a slider results in a single write and never blocks the frame.
+//
+// Usage:
+//   Setting<float> volume = Settings::DeclareFloat("game.volume", 1.f, 0.f, 1.f);
+//   float v = volume.Get();
+//   Settings::Set(volume, 0.5f);
+//   Settings::ListenerID id = Settings::AddListener(volume, [](float v) { ... });
+//
+// The settings used by the engine are declared in EngineSettings.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+//
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#pragma once
+
+#include "flx_api.h"
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+
+namespace FlexEngine
+{
+
+  // Handle to a declared setting.
+  // Handles stay valid for the lifetime of the application.
+  template <typename T>
+  class Setting
+  {
+  public:
+    Setting() = default;
+
+    const T& Get() const { return *m_value; }
+
+    bool IsValid() const { return m_value != nullptr; }
+
+  private:
+    friend class Settings;
+
+    Setting(const T* value, uint32_t index) : m_value(value), m_index(index) {}
+
+    const T* m_value = nullptr;
+    uint32_t m_index = 0;
+  };
+
+  // All functions must be called from the main thread.
+  class __FLX_API Settings
+  {
+  public:
+    // static class
+    Settings() = delete;
+    Settings(const Settings&) = delete;
+    Settings& operator=(const Settings&) = delete;
+
+    #pragma region Declaration
+
+    // Declares the setting and reads its value from FlexPrefs, or uses the default if it is not there.
+    // Declaring a key again returns the same handle, it must have the same type.
+    static Setting<bool> DeclareBool(const std::string& key, bool default_value);
+    static Setting<int> DeclareInt(const std::string& key, int default_value, int min = (std::numeric_limits<int>::min)(), int max = (std::numeric_limits<int>::max)());
+    static Setting<float> DeclareFloat(const std::string& key, float default_value, float min = -(std::numeric_limits<float>::max)(), float max = (std::numeric_limits<float>::max)());
+    static Setting<std::string> DeclareString(const std::string& key, const std::string& default_value);
+
+    #pragma endregion
+
+    #pragma region Changes
+
+    // Sets the value, clamped to the range of the setting.
+    // Does nothing if the value did not change, otherwise the listeners are called and the file is saved later.
+    static void Set(Setting<bool> setting, bool value);
+    static void Set(Setting<int> setting, int value);
+    static void Set(Setting<float> setting, float value);
+    static void Set(Setting<std::string> setting, const std::string& value);
+
+    using ListenerID = std::size_t;
+
+    // Called with the new value every time the setting changes, including when FlexPrefs is loaded again.
+    template <typename T, typename Callback>
+    static ListenerID AddListener(Setting<T> setting, Callback callback)
+    {
+      const T* value = setting.m_value;
+      return Internal_AddListener(setting.m_index, [value, callback]() { callback(*value); });
+    }
+
+    static void RemoveListener(ListenerID id);
+
+    #pragma endregion
+
+    #pragma region Persistence
+
+    // Saves the changed settings once they have not changed for a moment.
+    // Called once per frame by the application.
+    static void Update();
+
+    // Starts saving the changed settings now, without waiting for them to settle.
+    static void Flush();
+
+    // INTERNAL FUNCTION
+    // Reads every declared setting from FlexPrefs again, called when FlexPrefs is loaded or reset.
+    static void Internal_Reload();
+
+    #pragma endregion
+
+  private:
+    static ListenerID Internal_AddListener(uint32_t index, std::function<void()> callback);
+  };
+
+  // Settings used by the engine and the editor settings panel, declared by the application after FlexPrefs is loaded.
+  // The defaults are the values the engine used when the key was missing from flxprefs.json.
+  struct __FLX_API EngineSettings
+  {
+    static Setting<bool> game_batching;
+    static Setting<bool> editor_batching;
+    static Setting<bool> game_fullscreen;
+    static Setting<bool> game_vsync;
+    static Setting<bool> game_frame_pacing;
+    static Setting<bool> game_serial_systems; // runs every SystemSchedule on the main thread, for debugging
+    static Setting<float> game_frame_budget_ms;
+    static Setting<int> game_resolution_index;
+    static Setting<float> game_volume;
+    static Setting<float> game_sfx_volume;
+    static Setting<float> editor_camera_speed;
+    static Setting<int> editor_theme_index;
+
+    static void Declare();
+  };
+
+}
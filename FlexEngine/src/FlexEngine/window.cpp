@@ -25,10 +25,15 @@
 #endif
 
 #include "input.h"
+#include "headless.h"
+#include "heapcounter.h"
+#include "DataStructures/framearena.h"
 #include "Renderer/OpenGL/openglrenderer.h"
+#include "Renderer/OpenGL/openglstate.h"
 #include "FMOD/FMODWrapper.h"
 
 #include "flexprefs.h"  
+#include "settings.h"
 
 #ifdef _WIN32
 #define GLFW_EXPOSE_NATIVE_WIN32  //to expose glfwGetWin32Window
@@ -103,6 +108,15 @@ namespace FlexEngine
 
     FLX_CORE_ASSERT(!is_init, "Internal_Open is being called on an already initialized window.");
 
+    // headless windows only keep their size, there is no glfw window, context or imgui
+    if (Headless::IsEnabled())
+    {
+      m_is_full_screen = false;
+      is_init = true;
+      FrameBufferManager.Init();
+      return;
+    }
+
     // window hints
     glfwDefaultWindowHints();
     for (auto& [hint, value] : m_props.window_hints)
@@ -113,7 +127,7 @@ namespace FlexEngine
     // Fullscreen overrides any option
     bool should_fs = false;
     //#ifdef GAME_BUILD
-    should_fs = FlexPrefs::GetBool("game.fullscreen");
+    should_fs = EngineSettings::game_fullscreen.Get();
     //#else
     //should_fs = FlexPrefs::GetBool("editor.fullscreen");
     //#endif
@@ -138,7 +152,9 @@ namespace FlexEngine
 
     FLX_NULLPTR_ASSERT(m_glfwwindow, "Failed to create GLFW window");
     glfwMakeContextCurrent(m_glfwwindow);
-    glfwSwapInterval(FlexPrefs::GetBool("game.vsync") ? 1 : 0);
+    glfwSwapInterval(EngineSettings::game_vsync.Get() ? 1 : 0);
+    m_frameratecontroller.SetFramePacing(EngineSettings::game_frame_pacing.Get());
+    m_frameratecontroller.SetFrameBudget(EngineSettings::game_frame_budget_ms.Get());
 
     // load all OpenGL function pointers (glad)
     FLX_CORE_ASSERT(gladLoadGL(), "Failed to initialize GLAD!");
@@ -197,6 +213,13 @@ namespace FlexEngine
 
     FLX_WINDOW_ISOPEN_ASSERT;
 
+    if (Headless::IsEnabled())
+    {
+      Application::Internal_SetCurrentWindow(nullptr);
+      is_init = false;
+      return;
+    }
+
     #ifndef IMGUI_DISABLE
     // shutdown imgui
     // the imgui initialization is done in the window constructor
@@ -224,6 +247,22 @@ namespace FlexEngine
     // make sure the current window is the one we are working with
     SetCurrentContext();
 
+    // frame memory from the last frame is released here, see framearena.h
+    FrameArena::NewFrame();
+    HeapCounter::NewFrame();
+
+    // each window has its own context, and anything else may have touched it since the last frame
+    OpenGLState::Invalidate();
+
+    // headless windows have nothing to clear, draw or swap, and time each layer instead
+    if (Headless::IsEnabled())
+    {
+      m_frameratecontroller.BeginFrame();
+      Headless::UpdateLayerStack(m_layerstack);
+      m_frameratecontroller.EndFrame();
+      return;
+    }
+
     // clear screen
     OpenGLRenderer::ClearColor({ 0.0f, 0.0f, 0.0f, 0.0f });
     OpenGLRenderer::ClearFrameBuffer();
@@ -253,6 +292,9 @@ namespace FlexEngine
 
     FLX_WINDOW_ISOPEN_ASSERT;
 
+    // guard: no window to set the icon of
+    if (Headless::IsEnabled()) return;
+
     // create the image
     GLFWimage image{};
     image.width = icon.GetWidth();
@@ -269,6 +311,9 @@ namespace FlexEngine
 
     FLX_WINDOW_ISOPEN_ASSERT;
 
+    // guard: no window to move
+    if (Headless::IsEnabled()) return;
+
     // get the primary monitor
     GLFWmonitor* monitor = glfwGetPrimaryMonitor();
     FLX_NULLPTR_ASSERT(monitor, "Failed to get primary monitor while trying to center the window.");
@@ -305,8 +350,8 @@ namespace FlexEngine
   {
     Application::Internal_SetCurrentWindow(this);
 
-    // glfw and imgui context are not ready yet
-    if (!is_init) return;
+    // glfw and imgui context are not ready yet, or never will be when headless
+    if (!is_init || Headless::IsEnabled()) return;
 
     FLX_GLFW_ALIGNCONTEXT();
 
@@ -327,6 +372,9 @@ namespace FlexEngine
     m_params.cached_mini_window_width = m_props.width;
     m_params.cached_mini_window_height = m_props.height;
 
+    // guard: no window to get the position of
+    if (Headless::IsEnabled()) return;
+
     // get the position of the window
     glfwGetWindowPos(m_glfwwindow, &xpos, &ypos);
     m_params.cached_mini_window_xpos = xpos;
@@ -346,6 +394,9 @@ namespace FlexEngine
 
   void Window::ToggleFullScreen(bool fs)
   {
+    // guard: headless windows are never fullscreen
+    if (Headless::IsEnabled()) return;
+
     // Toggle fullscreen
     if (fs)
     {
@@ -370,8 +421,7 @@ namespace FlexEngine
       m_is_full_screen = false;
     }
 
-    // Set the preference
-    FlexPrefs::SetBool("game.fullscreen", fs);
-    FlexPrefs::Save();
+    // Set the preference, it is saved in the background
+    Settings::Set(EngineSettings::game_fullscreen, fs);
   }
 }
\ No newline at end of file
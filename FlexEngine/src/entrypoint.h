@@ -17,26 +17,54 @@
 #include <crtdbg.h>
 #endif
 
+#include <cstdio>   // freopen_s
+#include <iostream>
 #include <memory>
+#include <string>
 
 #include "flexlogger.h"
 #include "application.h"
 #include "DataStructures/freequeue.h"
+#include "Battle/battlesim.h"
+#include "assetarchive.h"
+#include "headless.h"
+#include "heapcounter.h"
 
 // WinMain for release mode because it doesn't use the console.
 #ifdef NDEBUG
 //int APIENTRY WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine, int nCmdShow)
 int APIENTRY WinMain(HINSTANCE, HINSTANCE, LPSTR, int)
 {
-  return main(0, nullptr);
+  // The command line modes print their results to stdout and stderr, which go
+  // nowhere without a console. Use the console they were started from, or open one.
+  for (int i = 1; i < __argc; i++)
+  {
+    std::string arg = __argv[i];
+    if (arg != "--battle-sim" && arg != "--cook") continue;
+
+    if (!AttachConsole(ATTACH_PARENT_PROCESS)) AllocConsole();
+    FILE* stream = nullptr;
+    freopen_s(&stream, "CONOUT$", "w", stdout);
+    freopen_s(&stream, "CONOUT$", "w", stderr);
+    std::cout.clear();
+    std::cerr.clear();
+    break;
+  }
+
+  return main(__argc, __argv);
 }
 #endif
 
+// Count the application's heap allocations, the engine counts its own.
+// See heapcounter.h
+void* operator new(std::size_t size) { return FlexEngine::HeapCounter::Allocate(size); }
+void operator delete(void* ptr) noexcept { FlexEngine::HeapCounter::Free(ptr); }
+
 // Create an application.
 // Use it by creating a new class that inherits from FlexEngine::Application and override the CreateApplication function.
 extern FlexEngine::Application* FlexEngine::CreateApplication();
 
-int main(int, char**)
+int main(int argc, char** argv)
 {
   // Enable run-time memory check for debug builds.
   #ifdef _DEBUG
@@ -53,6 +81,23 @@ int main(int, char**)
   auto log = new FlexEngine::Log();
   FlexEngine::FreeQueue::Push([log]() { delete log; });
 
+  // Headless battle simulation, runs without creating a window
+  for (int i = 1; i < argc; i++)
+  {
+    if (std::string(argv[i]) == "--battle-sim") std::exit(FlexEngine::BattleSim::RunCommandLine(argc, argv));
+  }
+
+  // Asset cook step, packs the assets into assets.flxpak and exits
+  for (int i = 1; i < argc; i++)
+  {
+    if (std::string(argv[i]) == "--cook") std::exit(FlexEngine::AssetArchive::RunCommandLine(argc, argv));
+  }
+
+  // Headless runtime, runs the application without a window, renderer or audio device
+  FlexEngine::Headless::Options headless_options;
+  if (!FlexEngine::Headless::ParseCommandLine(argc, argv, headless_options)) std::exit(1);
+  FlexEngine::Headless::SetOptions(headless_options);
+
   // Create the application
   auto app = FlexEngine::CreateApplication();
   FlexEngine::FreeQueue::Push([app]() { delete app; });
@@ -18,3 +18,4 @@
 #include "Layers/scriptinglayer.h"
 #include "Layers/townlayer.h"
 #include "Layers/tutoriallayer.h"
+#include "Layers/tweenlayer.h"
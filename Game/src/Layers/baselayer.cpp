@@ -43,6 +43,7 @@ namespace Game
 
     // Third, add the engine behavior layers
     FLX_COMMAND_ADD_WINDOW_LAYER("Game", std::make_shared<PhysicsLayer>());
+    FLX_COMMAND_ADD_WINDOW_LAYER("Game", std::make_shared<TweenLayer>());
     FLX_COMMAND_ADD_WINDOW_LAYER("Game", std::make_shared<RenderingLayer>());
     FLX_COMMAND_ADD_WINDOW_LAYER("Game", std::make_shared<AudioLayer>());
     FLX_COMMAND_ADD_WINDOW_LAYER("Game", std::make_shared<ScriptingLayer>());
@@ -21,39 +21,24 @@ namespace Game
         std::string name = "";
         int speed = 0;
 
-        //For reference, effects are: Damage Heal Speed_Up Speed_Down Attack_Up Attack_Down Stun Shield Protect Strip Cleanse
-        std::vector<std::string> effect;
-        std::vector<int> value;
-        std::vector<std::string> target;
+        // compiled from the Effect/Value/Target lists in the .flxmove
+        std::vector<Asset::MoveOp> ops;
+        bool targets_allies = false; // the first target is an ally or self
 
         std::string description = "";
     };
 
-    struct _Character
+    // The health, speed and buff state is in BattleState::Combatant, shared with the battle simulator.
+    // character_id (1-5) also determines the animations and sprites which are hardcoded.
+    struct _Character : BattleState::Combatant
     {
         std::string name = "";
 
-        int character_id = 0; // 1-5, determines the animations and sprites which are hardcoded
-        int health = 0;
-        int speed = 0;
-
         _Move move_one = {};
         _Move move_two = {};
         _Move move_three = {};
 
-        int attack_debuff_duration = 0;
-        int attack_buff_duration = 0;
-        int stun_debuff_duration = 0;
-        int shield_buff_duration = 0;
-        int protect_buff_duration = 0;
-
-        int current_health = 0;
-        int current_speed = 0;
-        int current_slot = 0;          // 0-4, 0-1 for drifters, 0-4 for enemies
-
         int previous_health = 0;
-        int speed_change = 0;
-        bool is_alive = true;
     };
 
     struct _Battle
@@ -99,11 +84,10 @@ namespace Game
 
         int battle_num = 0;
         int tutorial_info = 0;
-        int boss_move = 0;
+        BattleState::BossScript boss_script;
         bool is_tutorial = false;
         bool is_tutorial_running = false;
         bool is_boss = false;
-        bool is_boss_running = false;
         FlexECS::Entity tutorial_text;
 
         bool start_of_turn = false;
@@ -151,6 +135,7 @@ namespace Game
     void ClearBattleStruct();
     void Start_Of_Turn();
     void Move_Select();
+    void Apply_Move_Effects();
     void Move_Resolution();
     void End_Of_Turn();
     void Win_Battle();
@@ -196,11 +181,10 @@ namespace Game
 
       battle.battle_num = 0;
       battle.tutorial_info = 0;
-      battle.boss_move = 0;
+      battle.boss_script = {};
       battle.is_tutorial = false;
       battle.is_tutorial_running = false;
       battle.is_boss = false;
-      battle.is_boss_running = false;
       battle.tutorial_text;
 
       battle.start_of_turn = false;
@@ -286,9 +270,7 @@ namespace Game
             character.speed = character_asset.speed;
             character.character_id = character_asset.character_id;
 
-            character.current_health = character.health;
-            character.current_speed = character.speed;
-            character.is_alive = true;
+            BattleState::Reset(character);
 
             if (character_asset.move_one != "None")
             {
@@ -299,9 +281,8 @@ namespace Game
                 ReplaceUnderscoresWithSpaces(move_one.name);
                 move_one.speed = move_one_asset.speed;
 
-                move_one.effect = move_one_asset.effect;
-                move_one.value = move_one_asset.value;
-                move_one.target = move_one_asset.target;
+                move_one.ops = move_one_asset.ops;
+                move_one.targets_allies = move_one_asset.targets_allies;
 
                 move_one.description = move_one_asset.description;
                 character.move_one = move_one;
@@ -315,9 +296,8 @@ namespace Game
                 ReplaceUnderscoresWithSpaces(move_two.name);
                 move_two.speed = move_two_asset.speed;
 
-                move_two.effect = move_two_asset.effect;
-                move_two.value = move_two_asset.value;
-                move_two.target = move_two_asset.target;
+                move_two.ops = move_two_asset.ops;
+                move_two.targets_allies = move_two_asset.targets_allies;
 
                 move_two.description = move_two_asset.description;
                 character.move_two = move_two;
@@ -331,9 +311,8 @@ namespace Game
                 ReplaceUnderscoresWithSpaces(move_three.name);
                 move_three.speed = move_three_asset.speed;
 
-                move_three.effect = move_three_asset.effect;
-                move_three.value = move_three_asset.value;
-                move_three.target = move_three_asset.target;
+                move_three.ops = move_three_asset.ops;
+                move_three.targets_allies = move_three_asset.targets_allies;
 
                 move_three.description = move_three_asset.description;
                 character.move_three = move_three;
@@ -414,9 +393,7 @@ namespace Game
             character.speed = character_asset.speed;
             character.character_id = character_asset.character_id;
 
-            character.current_health = character.health;
-            character.current_speed = character.speed;
-            character.is_alive = true;
+            BattleState::Reset(character);
 
             if (character_asset.move_one != "None")
             {
@@ -427,9 +404,8 @@ namespace Game
                 ReplaceUnderscoresWithSpaces(move_one.name);
                 move_one.speed = move_one_asset.speed;
 
-                move_one.effect = move_one_asset.effect;
-                move_one.value = move_one_asset.value;
-                move_one.target = move_one_asset.target;
+                move_one.ops = move_one_asset.ops;
+                move_one.targets_allies = move_one_asset.targets_allies;
 
                 move_one.description = move_one_asset.description;
                 character.move_one = move_one;
@@ -444,9 +420,8 @@ namespace Game
                 ReplaceUnderscoresWithSpaces(move_two.name);
                 move_two.speed = move_two_asset.speed;
 
-                move_two.effect = move_two_asset.effect;
-                move_two.value = move_two_asset.value;
-                move_two.target = move_two_asset.target;
+                move_two.ops = move_two_asset.ops;
+                move_two.targets_allies = move_two_asset.targets_allies;
 
                 move_two.description = move_two_asset.description;
                 character.move_two = move_two;
@@ -461,9 +436,8 @@ namespace Game
                 ReplaceUnderscoresWithSpaces(move_three.name);
                 move_three.speed = move_three_asset.speed;
 
-                move_three.effect = move_three_asset.effect;
-                move_three.value = move_three_asset.value;
-                move_three.target = move_three_asset.target;
+                move_three.ops = move_three_asset.ops;
+                move_three.targets_allies = move_three_asset.targets_allies;
 
                 move_three.description = move_three_asset.description;
                 character.move_three = move_three;
@@ -638,7 +612,7 @@ namespace Game
 
         if (battle.is_boss)
         {
-            battle.is_boss_running = true;
+            battle.boss_script = {};
             //set up tutorial text
 
             FlexECS::Entity boss_box = FlexECS::Scene::CreateEntity("boss_textbox"); // can always use GetEntityByName to find the entity
@@ -729,22 +703,8 @@ namespace Game
     void Update_Speed_Bar()
     {
 
-        //speed bar update
-        std::stable_sort(
-      battle.speed_bar.begin(), battle.speed_bar.end(),
-      [](const _Character* a, const _Character* b)
-        {
-            return a->current_speed < b->current_speed;
-        }
-        );
-
-        // resolve the speed bar (just minus the speed by the value of the first character)
-        int first_speed = battle.speed_bar[0]->current_speed;
-        if (first_speed > 0)
-            for (auto& character : battle.speed_bar)
-            {
-                character->current_speed -= first_speed;
-            }
+        //speed bar update, the front character takes the next turn
+        BattleState::AdvanceSpeedBar(battle.speed_bar);
 
         // update the character id in the slot based on the speed bar order
         for (FlexECS::Entity& entity : FlexECS::Scene::GetActiveScene()->CachedQuery<Transform, SpeedBarSlot>())
@@ -997,9 +957,9 @@ namespace Game
       if (battle.current_move && battle.is_player_turn)
       {
         std::vector<_Character> targets;
-        for (int i = 0; i < battle.current_move->effect.size(); i++)
+        for (int i = 0; i < battle.current_move->ops.size(); i++)
         {
-          if (battle.current_move->target[i] == "ALL_ENEMIES")
+          if (battle.current_move->ops[i].target == Asset::MoveTarget::All_Enemies)
           {
             for (auto character : battle.drifters_and_enemies)
             {
@@ -1009,7 +969,7 @@ namespace Game
               }
             }
           }
-          else if (battle.current_move->target[i] == "ADJACENT_ENEMIES")
+          else if (battle.current_move->ops[i].target == Asset::MoveTarget::Adjacent_Enemies)
           {
             for (auto character : battle.drifters_and_enemies)
             {
@@ -1022,7 +982,7 @@ namespace Game
               }
             }
           }
-          else if (battle.current_move->target[i] == "SINGLE_ENEMY")
+          else if (battle.current_move->ops[i].target == Asset::MoveTarget::Single_Enemy)
           {
             for (auto character : battle.drifters_and_enemies)
             {
@@ -1044,9 +1004,9 @@ namespace Game
             {
               //if current move is a buff stripper, add enemy to damage calculations
               bool stripping_effect = false;
-              for (size_t j = 0; j < battle.current_move->effect.size(); j++)
+              for (size_t j = 0; j < battle.current_move->ops.size(); j++)
               {
-                if (battle.current_move->effect[j] == "Strip" || battle.god_mode)
+                if (battle.current_move->ops[j].effect == Asset::MoveEffect::Strip || battle.god_mode)
                 {
                   stripping_effect = true;
                   break;
@@ -1065,50 +1025,28 @@ namespace Game
             float right_edge_pos = (healthbar->original_position.x - (70 * (1.0f - current_health_percentage)))
               + (70 * (current_health_percentage));
 
+            // the attacker's durations tick before the move resolves, so preview with the ticked buffs
+            BattleState::Combatant attacker = *battle.current_character;
+            BattleState::TickDurations(attacker);
+
             float damage_taken = 0;
-            for (int k = 0; k < battle.current_move->effect.size(); k++)
+            for (int k = 0; k < battle.current_move->ops.size(); k++)
             {
-                if (battle.current_move->effect[k] == "Damage")
+                if (battle.current_move->ops[k].effect == Asset::MoveEffect::Damage)
                 {
-                    if (battle.current_move->target[k] == "SINGLE_ENEMY" && battle.initial_target->current_slot == target.current_slot)
+                    if (battle.current_move->ops[k].target == Asset::MoveTarget::Single_Enemy && battle.initial_target->current_slot == target.current_slot)
                     {
-                        float current_damage = static_cast<float>(battle.current_move->value[k]);
-                        if (battle.current_character->attack_buff_duration > 1)
-                        {
-                            current_damage += current_damage / 2;
-                        }
-                        if (battle.current_character->attack_debuff_duration > 1)
-                        {
-                            current_damage -= current_damage / 2;
-                        }
-                        if (battle.god_mode)
-                        {
-                            current_damage *= 10;
-                        }
-                        damage_taken += current_damage;
+                        damage_taken += static_cast<float>(BattleState::GetDamage(attacker, battle.current_move->ops[k].value, battle.god_mode));
                     }
-                    else if (battle.current_move->target[k] == "ALL_ENEMIES")
+                    else if (battle.current_move->ops[k].target == Asset::MoveTarget::All_Enemies)
                     {
-                        float current_damage = static_cast<float>(battle.current_move->value[k]);
-                        if (battle.current_character->attack_buff_duration > 1)
-                        {
-                            current_damage += current_damage / 2;
-                        }
-                        if (battle.current_character->attack_debuff_duration > 1)
-                        {
-                            current_damage -= current_damage / 2;
-                        }
-                        if (battle.god_mode)
-                        {
-                            current_damage *= 10;
-                        }
-                        damage_taken += current_damage;
+                        damage_taken += static_cast<float>(BattleState::GetDamage(attacker, battle.current_move->ops[k].value, battle.god_mode));
                     }
                 }
             }
-            /*if (battle.current_move->effect[i] == "Damage")
+            /*if (battle.current_move->ops[i].effect == Asset::MoveEffect::Damage)
             {
-              damage_taken = static_cast<float>(battle.current_move->value[i]);
+              damage_taken = static_cast<float>(battle.current_move->ops[i].value);
             }
             if (battle.current_character->attack_buff_duration > 0)
             {
@@ -1215,122 +1153,79 @@ namespace Game
         return a + t * (b - a);
     }
 
-    // Returns a value of 1-sin with a lowest value of 0.5. i.e Goes from 0.5 to 1 to 0.5
-   float HalfSinCurve(float t) 
-   {
-      //float constexpr M_PI = 3.14f;
-      float constexpr pi = 3.14f;
-      return std::max(1 - std::sinf(t * pi), 0.5f); // Sin function maps t to 0 to pi
-   }
-
+    // Pulses the icon of the character that just took its turn, then jumps it back to its new slot in an arc
+    // while the icons in between slide forward by one slot. Played as a timeline, this only starts it.
     void PlaySpeedbarAnimation()
     {
+        static TweenHandle animation;
+        if (TweenSystem::IsActive(animation)) return;
+
         battle.curr_char_highlight.GetComponent<Transform>()->is_active = false; // Disable curr char accent otherwise animation will look weird
 
-        constexpr float duration = 0.8f; // Duration for each phase
-        constexpr float pulse_dur = 1.f;
+        constexpr float duration = 0.8f; // Duration of the move
         constexpr float max_arc_height = -200.f;
 
-        static float time_played = 0.5f;
-        static Vector3 dest[7];
-        static bool is_init = false;
-        static bool pulse_played = false;
-
         // Clamp to max number of alive characters
         battle.curr_char_pos_after_taking_turn = std::min(static_cast<int>(battle.speed_bar.size()) - 1, battle.curr_char_pos_after_taking_turn);
+        int last = std::min(battle.curr_char_pos_after_taking_turn, static_cast<int>(battle.speed_slot_position.size()) - 1);
 
-        if (!pulse_played)
+        // The element to move goes to the slot of the last one, every other one moves up by one
+        Vector3 dest[7];
+        dest[0] = battle.speed_slot_icons[last].GetComponent<Position>()->position;
+        for (int i{ 1 }; i <= last; ++i)
         {
-          // Pulse the character icon for duration amount of time 
-          if (time_played < pulse_dur)
-          {
-            float t = time_played / duration;
-            t = std::clamp(t, 0.f, 1.f);
-
-            battle.speed_slot_icons[0].GetComponent<Scale>()->scale = Vector3(HalfSinCurve(t) + 0.2f, HalfSinCurve(t) + 0.2f, HalfSinCurve(t) + 0.2f);
-
-            time_played += Application::GetCurrentWindow()->GetFramerateController().GetDeltaTime() * 2.f;
-            return;
-          }
-
-          pulse_played = true;
+            dest[i] = battle.speed_slot_icons[i - 1].GetComponent<Position>()->position;
         }
 
-        if (!is_init)
+        for (int i{ 0 }; i <= last; ++i)
         {
-          time_played = 0.f; // Reset from pulse played
-
-            // Set the initial position of the element to move
-            dest[0] = battle.speed_slot_icons[battle.curr_char_pos_after_taking_turn].GetComponent<Position>()->position;
-
-            // Cache lerp values for all inbetween elements
-            for (int i{ 1 }; i < battle.speed_slot_position.size(); ++i)
-            {
-                if (i == battle.curr_char_pos_after_taking_turn + 1)
-                    break;
-
-                dest[i] = battle.speed_slot_icons[i - 1].GetComponent<Position>()->position;
-            }
-
-            is_init = true;
+            battle.speed_slot_icons[i].GetComponent<Position>()->position = battle.speed_slot_position[i];
         }
 
-        // Lerp to the supposed position
-        if (time_played < duration)
-        {
-            float t = time_played / duration;
-            t = std::clamp(t, 0.f, 1.f);
-
-            float arc_t = 1.f - (2.f * t - 1.f) * (2.f * t - 1.f); // Parabolic arc
+        FlexECS::Entity icon = battle.speed_slot_icons[0];
+        Timeline timeline;
 
-            battle.speed_slot_icons[0].GetComponent<Position>()->position = Vector3(Lerp(battle.speed_slot_position[0].x, dest[0].x, t),
-                                                                                       Lerp(battle.speed_slot_position[0].y, dest[0].y, t) + max_arc_height * arc_t,
-                                                                                       Lerp(battle.speed_slot_position[0].z, dest[0].z, t));
+        // Pulse the character icon
+        timeline
+          .Append(icon, TweenVector::Scale, Vector3(0.7f, 0.7f, 0.7f), 0.067f, Ease::OutSine)
+          .AppendInterval(0.267f)
+          .Append(icon, TweenVector::Scale, Vector3(1.2f, 1.2f, 1.2f), 0.067f, Ease::InSine)
+          .AppendInterval(0.1f);
 
-            battle.speed_slot_icons[0].GetComponent<Scale>()->scale = Vector3(HalfSinCurve(t), HalfSinCurve(t), HalfSinCurve(t));
+        // Move in a parabolic arc, shrinking while in the air
+        float move = timeline.GetDuration();
+        float peak = (battle.speed_slot_position[0].y + dest[0].y) * 0.5f + max_arc_height;
+        timeline
+          .Append(icon, TweenField::PositionX, dest[0].x, duration)
+          .Join(icon, TweenField::PositionZ, dest[0].z, duration)
+          .Insert(move, icon, TweenField::PositionY, peak, duration * 0.5f, Ease::OutQuad)
+          .Insert(move + duration * 0.5f, icon, TweenField::PositionY, dest[0].y, duration * 0.5f, Ease::InQuad)
+          .Insert(move, icon, TweenVector::Scale, Vector3(0.5f, 0.5f, 0.5f), duration / 6.f, Ease::OutSine)
+          .Insert(move + duration * 5.f / 6.f, icon, TweenVector::Scale, Vector3(1.f, 1.f, 1.f), duration / 6.f, Ease::InSine);
 
-            // Lerp the rest of the icons
-            for (int i{ 1 }; i < battle.speed_slot_position.size(); ++i)
-            {
-                if (i == battle.curr_char_pos_after_taking_turn + 1)
-                {
-                    break;
-                }
-
-                battle.speed_slot_icons[i].GetComponent<Position>()->position = Vector3(Lerp(battle.speed_slot_position[i].x, dest[i].x, t),
-                                                                                           Lerp(battle.speed_slot_position[i].y, dest[i].y, t),
-                                                                                           Lerp(battle.speed_slot_position[i].z, dest[i].z, t));
-            }
-
-            time_played += Application::GetCurrentWindow()->GetFramerateController().GetDeltaTime();
-            return;
-        }
-
-        // Ensure final position is set
-        for (int i{ 0 }; i < battle.speed_slot_position.size(); ++i)
+        // Move the rest of the icons
+        for (int i{ 1 }; i <= last; ++i)
         {
-            if (i == battle.curr_char_pos_after_taking_turn + 1)
-            {
-                break;
-            }
-
-            battle.speed_slot_icons[i].GetComponent<Position>()->position = dest[i];
+            timeline.Insert(move, battle.speed_slot_icons[i], TweenVector::Position, dest[i], duration);
         }
 
-        // Reset for next animation
-        time_played = 0.f;
+        timeline.AppendCallback([]()
+        {
+            battle.speedbar_animating = false;
+            battle.end_of_turn = true;
+        });
 
-        battle.speedbar_animating = false;
-        battle.end_of_turn = true;
-        is_init = false;
-        pulse_played = false;
+        animation = timeline.Play();
     }
 
     void Start_Of_Game()
     {
-        File& file = File::Open(Path::current("assets/saves/battlescene_v12.flxscene"));
+        FlexECS::Scene::SetActiveScene(FlexECS::SceneLoader::Take(Path::current("assets/saves/battlescene_v12.flxscene")));
 
-        FlexECS::Scene::SetActiveScene(FlexECS::Scene::Load(file));
+        // load the scene that follows a win in the background, a loss reloads this layer
+        if (file_name == "/data/tutorial_battle.flxbattle") FlexECS::SceneLoader::LoadAsync(Path::current("assets/saves/town_v7.flxscene"));
+        else if (file_name == "/data/robot_battle.flxbattle") FlexECS::SceneLoader::LoadAsync(Path::current("assets/saves/town_v7_2.flxscene"));
+        else if (file_name == "/data/boss_battle.flxbattle") FlexECS::SceneLoader::LoadAsync(Path::current("assets/saves/endingcutscene.flxscene"));
 
         battle.curr_char_highlight = FlexECS::Scene::GetEntityByName("Curr Char Highlight");
 
@@ -1511,21 +1406,9 @@ namespace Game
 
             battle.anim_timer = 1.0f;
             //skip turn if stunned, go straight to end of turn resolution
-            if (battle.current_character->stun_debuff_duration > 0 && !(battle.current_character->character_id == 5))
+            if (BattleState::LosesTurn(*battle.current_character))
             {
-                battle.current_character->stun_debuff_duration -= 1;
-
-                if (battle.current_character->attack_buff_duration > 0)
-                    battle.current_character->attack_buff_duration -= 1;
-
-                if (battle.current_character->attack_debuff_duration > 0)
-                    battle.current_character->attack_debuff_duration -= 1;
-
-                if (battle.current_character->shield_buff_duration > 0)
-                    battle.current_character->shield_buff_duration -= 1;
-
-                if (battle.current_character->protect_buff_duration > 0)
-                    battle.current_character->protect_buff_duration -= 1;
+                BattleState::TickDurations(*battle.current_character);
 
                 Update_Character_Status();
 
@@ -1551,8 +1434,7 @@ namespace Game
                     }
                 battle.curr_char_pos_after_taking_turn = slot_number; // might need to -1
 
-                battle.current_character->current_speed = battle.current_character->speed_change;
-                battle.current_character->speed_change = 0;
+                BattleState::EndTurn(*battle.current_character, 0);
 
                 battle.start_of_turn = false;
                 battle.move_select = false;
@@ -1578,7 +1460,7 @@ namespace Game
                     //default selects move target
                     for (auto &character : battle.drifters_and_enemies)
                     {
-                        if (battle.current_move->target[0] == "ALL_ALLIES" || battle.current_move->target[0] == "NEXT_ALLY" || battle.current_move->target[0] == "SINGLE_ALLY" || battle.current_move->target[0] == "SELF")
+                        if (battle.current_move->targets_allies)
                         {
                             if (character.is_alive && character.character_id <= 2)
                             {
@@ -1600,184 +1482,79 @@ namespace Game
                 }//player default selects move and target
                 else //enemy default selects move and target
                 {
-                    //default select move 1-3
-                    if (battle.is_boss && battle.is_boss_running)
+                    //default select move 1-3, the boss follows its script
+                    if (battle.is_boss)
                     {
-                        battle.current_move = &battle.current_character->move_three;
-                        battle.boss_move++;
-                        if (battle.boss_move > 3)
+                        bool is_scripted = battle.boss_script.running;
+                        battle.move_num = battle.boss_script.NextMove();
+                        if (is_scripted)
                         {
-                            battle.boss_move = 1;
+                            switch (battle.move_num)
+                            {
+                            case 1:
+                                FlexECS::Scene::GetEntityByName("boss_dialogue_textbox").GetComponent<Transform>()->is_active = true;
+                                //FlexECS::Scene::GetEntityByName("boss_press_button").GetComponent<Transform>()->is_active = true;
+                                (FlexECS::Scene::GetEntityByName("boss_dialogue_text").GetComponent<Position>()->position) = Vector3{ 1225, 600, 0 };
+                                FLX_STRING_GET(FlexECS::Scene::GetEntityByName("boss_dialogue_text").GetComponent<Text>()->text) = "Time to end this, Renko.";
+                                battle.disable_input_timer += 2.5f;
+                                break;
+                            case 2:
+                                FlexECS::Scene::GetEntityByName("boss_dialogue_textbox").GetComponent<Transform>()->is_active = true;
+                                //FlexECS::Scene::GetEntityByName("boss_press_button").GetComponent<Transform>()->is_active = true;
+                                FLX_STRING_GET(FlexECS::Scene::GetEntityByName("boss_dialogue_text").GetComponent<Text>()->text) = "Out of my way, Grace.";
+                                battle.disable_input_timer += 2.0f;
+                                break;
+                            case 3:
+                                FlexECS::Scene::GetEntityByName("boss_dialogue_textbox").GetComponent<Transform>()->is_active = true;
+                                //FlexECS::Scene::GetEntityByName("boss_press_button").GetComponent<Transform>()->is_active = true;
+                                FLX_STRING_GET(FlexECS::Scene::GetEntityByName("boss_dialogue_text").GetComponent<Text>()->text) = "No one will hear you scream...";
+                                FlexECS::Scene::GetEntityByName("boss_dialogue_text").GetComponent<Position>()->position += Vector3(0, 10, 0);
+                                battle.disable_input_timer += 2.0f;
+                                break;
+                            }
                         }
-                        battle.move_num = battle.boss_move;
-                        switch (battle.boss_move)
+                        else
                         {
-                        case 1:
-                            battle.current_move = &battle.current_character->move_one;
                             FlexECS::Scene::GetEntityByName("boss_dialogue_textbox").GetComponent<Transform>()->is_active = true;
                             //FlexECS::Scene::GetEntityByName("boss_press_button").GetComponent<Transform>()->is_active = true;
                             (FlexECS::Scene::GetEntityByName("boss_dialogue_text").GetComponent<Position>()->position) = Vector3{ 1225, 600, 0 };
-                            FLX_STRING_GET(FlexECS::Scene::GetEntityByName("boss_dialogue_text").GetComponent<Text>()->text) = "Time to end this, Renko.";
-                            battle.disable_input_timer += 2.5f;
-                            break;
-                        case 2:
-                            battle.current_move = &battle.current_character->move_two;
-                            FlexECS::Scene::GetEntityByName("boss_dialogue_textbox").GetComponent<Transform>()->is_active = true;
-                            //FlexECS::Scene::GetEntityByName("boss_press_button").GetComponent<Transform>()->is_active = true;
-                            FLX_STRING_GET(FlexECS::Scene::GetEntityByName("boss_dialogue_text").GetComponent<Text>()->text) = "Out of my way, Grace.";
-                            battle.disable_input_timer += 2.0f;
-                            break;
-                        case 3:
-                            battle.current_move = &battle.current_character->move_three;
-                            FlexECS::Scene::GetEntityByName("boss_dialogue_textbox").GetComponent<Transform>()->is_active = true;
-                            //FlexECS::Scene::GetEntityByName("boss_press_button").GetComponent<Transform>()->is_active = true;
-                            FLX_STRING_GET(FlexECS::Scene::GetEntityByName("boss_dialogue_text").GetComponent<Text>()->text) = "No one will hear you scream...";
-                            FlexECS::Scene::GetEntityByName("boss_dialogue_text").GetComponent<Position>()->position += Vector3(0, 10, 0);
-                            battle.is_boss_running = false;
-                            battle.disable_input_timer += 2.0f;
-                            break;
+                            FLX_STRING_GET(FlexECS::Scene::GetEntityByName("boss_dialogue_text").GetComponent<Text>()->text) = "You should just perish.";
+                            battle.disable_input_timer += 3.0f;
                         }
                     }
-                    else if (battle.is_boss)
-                    {
-                        battle.boss_move++;
-                        if (battle.boss_move > 3)
-                        {
-                            battle.boss_move = 0;
-                            battle.is_boss_running = true;
-                        }
-                        battle.current_move = &battle.current_character->move_one;
-                        battle.move_num = 1;
-
-                        FlexECS::Scene::GetEntityByName("boss_dialogue_textbox").GetComponent<Transform>()->is_active = true;
-                        //FlexECS::Scene::GetEntityByName("boss_press_button").GetComponent<Transform>()->is_active = true;
-                        (FlexECS::Scene::GetEntityByName("boss_dialogue_text").GetComponent<Position>()->position) = Vector3{ 1225, 600, 0 };
-                        FLX_STRING_GET(FlexECS::Scene::GetEntityByName("boss_dialogue_text").GetComponent<Text>()->text) = "You should just perish.";
-                        battle.disable_input_timer += 3.0f;
-                    }
                     else
                     {
                         battle.move_num = Range<int>(1, 3).Get();
-                        switch (battle.move_num)
-                        {
-                        case 1:
-                            battle.current_move = &battle.current_character->move_one;
-                            break;
-                        case 2:
-                            battle.current_move = &battle.current_character->move_two;
-                            break;
-                        case 3:
-                            battle.current_move = &battle.current_character->move_three;
-                            break;
-                        }
+                    }
+
+                    switch (battle.move_num)
+                    {
+                    case 1:
+                        battle.current_move = &battle.current_character->move_one;
+                        break;
+                    case 2:
+                        battle.current_move = &battle.current_character->move_two;
+                        break;
+                    case 3:
+                        battle.current_move = &battle.current_character->move_three;
+                        break;
                     }
 
                     //default selects move target
                     if (battle.is_boss)
                     {
-                        switch (battle.move_num)
-                        {
-                        case 1:
-                            for (auto& character : battle.drifters_and_enemies)
-                            {
-                                if (character.is_alive && character.character_id == 1)
-                                {
-                                    battle.initial_target = &character;
-                                    battle.target_num = character.current_slot;
-                                    break;
-                                }
-                            }
-                            if (battle.initial_target == nullptr || !battle.initial_target->is_alive)
-                            {
-                                for (auto& character : battle.drifters_and_enemies)
-                                {
-                                    if (character.is_alive && character.character_id == 2)
-                                    {
-                                        battle.initial_target = &character;
-                                        battle.target_num = character.current_slot;
-                                        break;
-                                    }
-                                }
-                            }
-                            break;
-                        case 2:
-                            for (auto& character : battle.drifters_and_enemies)
-                            {
-                                if (character.is_alive && character.character_id == 2)
-                                {
-                                    battle.initial_target = &character;
-                                    battle.target_num = character.current_slot;
-                                    break;
-                                }
-                            }
-                            if (battle.initial_target == nullptr || !battle.initial_target->is_alive)
-                            {
-                                for (auto& character : battle.drifters_and_enemies)
-                                {
-                                    if (character.is_alive && character.character_id == 1)
-                                    {
-                                        battle.initial_target = &character;
-                                        battle.target_num = character.current_slot;
-                                        break;
-                                    }
-                                }
-                            }
-                            break;
-                        case 3:
-                            for (auto& character : battle.drifters_and_enemies)
-                            {
-                                if (character.is_alive && character.character_id == 1)
-                                {
-                                    battle.initial_target = &character;
-                                    battle.target_num = character.current_slot;
-                                    break;
-                                }
-                            }
-                            if (battle.initial_target == nullptr || !battle.initial_target->is_alive)
-                            {
-                                for (auto& character : battle.drifters_and_enemies)
-                                {
-                                    if (character.is_alive && character.character_id == 2)
-                                    {
-                                        battle.initial_target = &character;
-                                        battle.target_num = character.current_slot;
-                                        break;
-                                    }
-                                }
-                            }
-                            break;
-                        }
+                        battle.initial_target = BattleState::ChooseBossTarget(battle.drifters_and_enemies, battle.move_num);
                     }
                     else
                     {
-                        while (battle.initial_target == nullptr || !battle.initial_target->is_alive)
-                        {
-                            if (battle.current_move->target[0] == "ALL_ALLIES" || battle.current_move->target[0] == "NEXT_ALLY" || battle.current_move->target[0] == "SINGLE_ALLY" || battle.current_move->target[0] == "SELF")
-                            {
-                                battle.target_num = Range<int>(0, 4).Get();
-                                for (auto& character : battle.drifters_and_enemies)
-                                {
-                                    if (character.is_alive && character.current_slot == battle.target_num && character.character_id > 2)
-                                    {
-                                        battle.initial_target = &character;
-                                        break;
-                                    }
-                                }
-                            }
-                            else
-                            {
-                                battle.target_num = Range<int>(0, 1).Get();
-                                for (auto& character : battle.drifters_and_enemies)
-                                {
-                                    if (character.is_alive && character.current_slot == battle.target_num && character.character_id <= 2)
-                                    {
-                                        battle.initial_target = &character;
-                                        break;
-                                    }
-                                }
-                            }
-                        }
+                        // enemy moves aimed at allies pick a random enemy, the rest pick a random drifter
+                        battle.initial_target = BattleState::ChooseRandomTarget(
+                            battle.drifters_and_enemies, !battle.current_move->targets_allies,
+                            [](int min, int max) { return Range<int>(min, max).Get(); }
+                        );
                     }
+                    FLX_ASSERT(battle.initial_target != nullptr, "Enemy has no target.");
+                    battle.target_num = battle.initial_target->current_slot;
                     //projected character UI
                     int projected_speed = battle.current_move->speed + battle.current_character->speed_change;
                     int slot_number = -1; //will always be bigger than first element (itself), account for +1 for slot 0.
@@ -1829,7 +1606,7 @@ namespace Game
 
                 for (auto &character : battle.drifters_and_enemies)
                 {
-                    if (battle.current_move->target[0] == "ALL_ALLIES" || battle.current_move->target[0] == "NEXT_ALLY" || battle.current_move->target[0] == "SINGLE_ALLY" || battle.current_move->target[0] == "SELF")
+                    if (battle.current_move->targets_allies)
                     {
                         if (character.is_alive && character.character_id <= 2)
                         {
@@ -1873,7 +1650,7 @@ namespace Game
 
                 for (auto &character : battle.drifters_and_enemies)
                 {
-                    if (battle.current_move->target[0] == "ALL_ALLIES" || battle.current_move->target[0] == "NEXT_ALLY" || battle.current_move->target[0] == "SINGLE_ALLY" || battle.current_move->target[0] == "SELF")
+                    if (battle.current_move->targets_allies)
                     {
                         if (character.is_alive && character.character_id <= 2)
                         {
@@ -1903,7 +1680,7 @@ namespace Game
                     battle.target_num--;
                     for (auto &character : battle.drifters_and_enemies)
                     {
-                        if (battle.current_move->target[0] == "ALL_ALLIES" || battle.current_move->target[0] == "NEXT_ALLY" || battle.current_move->target[0] == "SINGLE_ALLY" || battle.current_move->target[0] == "SELF")
+                        if (battle.current_move->targets_allies)
                         {
                             if (battle.target_num < 0)
                             {
@@ -1940,7 +1717,7 @@ namespace Game
                     battle.target_num++;
                     for (auto &character : battle.drifters_and_enemies)
                     {
-                        if (battle.current_move->target[0] == "ALL_ALLIES" || battle.current_move->target[0] == "NEXT_ALLY" || battle.current_move->target[0] == "SINGLE_ALLY" || battle.current_move->target[0] == "SELF")
+                        if (battle.current_move->targets_allies)
                         {
                             if (battle.target_num > 1)
                             {
@@ -2030,7 +1807,7 @@ namespace Game
                 // only target slots that have a character in them
                 if (battle.initial_target != nullptr && battle.current_move != nullptr)
                 {
-                    if (battle.current_move->target[0] == "ALL_ALLIES" || battle.current_move->target[0] == "NEXT_ALLY" || battle.current_move->target[0] == "SINGLE_ALLY" || battle.current_move->target[0] == "SELF")
+                    if (battle.current_move->targets_allies)
                     {
                         transform.is_active = (character_slot.slot_number == (battle.target_num + 1));
                     }
@@ -2110,7 +1887,7 @@ namespace Game
 
             /*if (battle.is_boss)
             {
-                switch (battle.boss_move)
+                switch (battle.boss_script.move)
                 {
                 case 1:
                     if (battle.current_character->character_id == 1)
@@ -2139,7 +1916,7 @@ namespace Game
         }
 
 
-        if (battle.is_boss && battle.current_character->character_id == 5 && battle.boss_move == 3)
+        if (battle.is_boss && battle.current_character->character_id == 5 && battle.boss_script.move == 3)
         {
             if (battle.disable_input_timer > .0f)
             {
@@ -2231,20 +2008,7 @@ namespace Game
                 battle.disable_input_timer = 1.0f;
             }
 
-            if (battle.current_character->stun_debuff_duration > 0)
-                battle.current_character->stun_debuff_duration -= 1;
-
-            if (battle.current_character->attack_buff_duration > 0)
-                battle.current_character->attack_buff_duration -= 1;
-
-            if (battle.current_character->attack_debuff_duration > 0)
-                battle.current_character->attack_debuff_duration -= 1;
-
-            if (battle.current_character->shield_buff_duration > 0)
-                battle.current_character->shield_buff_duration -= 1;
-
-            if (battle.current_character->protect_buff_duration > 0)
-                battle.current_character->protect_buff_duration -= 1;
+            BattleState::TickDurations(*battle.current_character);
 
             Update_Character_Status();
 
@@ -2259,6 +2023,16 @@ namespace Game
         
     }
 
+    // Applies every op of the current move in order, with the same rules as the battle simulator
+    void Apply_Move_Effects()
+    {
+        std::vector<_Character*> targets;
+        BattleState::ApplyMove(
+            battle.current_move->ops, battle.current_move->targets_allies, *battle.current_character, battle.target_num,
+            battle.drifters_and_enemies, targets, battle.god_mode
+        );
+    }
+
     void Move_Resolution()
     {
         if (battle.anim_timer > 0.0f)
@@ -2267,7 +2041,7 @@ namespace Game
 
         if (battle.is_player_turn)
         {// Temporarily move the character if targeting enemy
-            if (battle.current_move->target[0] == "ALL_ALLIES" || battle.current_move->target[0] == "NEXT_ALLY" || battle.current_move->target[0] == "SINGLE_ALLY" || battle.current_move->target[0] == "SELF")
+            if (battle.current_move->targets_allies)
             {
                 // If targeting allies, does nothing
                 FlexECS::Scene::GetEntityByName("Drifter " + std::to_string(battle.current_character->current_slot + 1)).GetComponent<ZIndex>()->z = 999;
@@ -2304,7 +2078,7 @@ namespace Game
         }
         else
         {
-            if (battle.current_move->target[0] == "ALL_ALLIES" || battle.current_move->target[0] == "NEXT_ALLY" || battle.current_move->target[0] == "SINGLE_ALLY" || battle.current_move->target[0] == "SELF")
+            if (battle.current_move->targets_allies)
             {
                 // If targeting allies, does nothing
                 FlexECS::Scene::GetEntityByName("Enemy " + std::to_string(battle.current_character->current_slot + 1)).GetComponent<ZIndex>()->z = 999;
@@ -2364,256 +2138,10 @@ namespace Game
                 }
 
                 // apply the move
-                std::vector<_Character*> targets;
-                for (int i = 0; i < battle.current_move->effect.size(); i++) {
-                    if (battle.current_move->target[i] == "ALL_ENEMIES")
-                    {
-                        for (auto& character : battle.drifters_and_enemies)
-                        {
-                            if (character.is_alive && character.character_id > 2)
-                            {
-                                targets.push_back(&character);
-                            }
-                        }
-                    }
-                    else if (battle.current_move->target[i] == "ADJACENT_ENEMIES")
-                    {
-                        for (auto& character : battle.drifters_and_enemies)
-                        {
-                            if (character.is_alive && (character.current_slot == battle.target_num - 1 && character.character_id > 2 ||
-                                character.current_slot == battle.target_num && character.character_id > 2 || character.current_slot == battle.target_num + 1 && character.character_id > 2))
-                            {
-                                targets.push_back(&character);
-                            }
-                        }
-                    }
-                    else if (battle.current_move->target[i] == "NEXT_ENEMY")
-                    {
-                        for (auto& character : battle.drifters_and_enemies)
-                        {
-                            if (character.is_alive && character.character_id > 2)
-                            {
-                                targets.push_back(&character);
-                                break;
-                            }
-                        }
-                    }
-                    else if (battle.current_move->target[i] == "SINGLE_ENEMY")
-                    {
-                        for (auto& character : battle.drifters_and_enemies)
-                        {
-                            if (character.is_alive && character.current_slot == battle.target_num && character.character_id > 2)
-                            {
-                                targets.push_back(&character);
-                            }
-                        }
-                    }
-                    else if (battle.current_move->target[i] == "ALL_ALLIES")
-                    {
-                        for (auto& character : battle.drifters_and_enemies)
-                        {
-                            if (character.is_alive && character.character_id <= 2)
-                            {
-                                targets.push_back(&character);
-                            }
-                        }
-                    }
-                    else if (battle.current_move->target[i] == "NEXT_ALLY")
-                    {
-                        for (auto& character : battle.drifters_and_enemies)
-                        {
-                            if (character.is_alive && character.character_id <= 2 && character.character_id != battle.current_character->character_id)
-                            {
-                                targets.push_back(&character);
-                                break;
-                            }
-                        }
-                    }
-                    else if (battle.current_move->target[i] == "SINGLE_ALLY")
-                    {
-                        if (battle.current_move->target[0] == "ALL_ALLIES" || battle.current_move->target[0] == "NEXT_ALLY" || battle.current_move->target[0] == "SINGLE_ALLY" || battle.current_move->target[0] == "SELF") //fizzles if not targeting ally
-                        {
-                            for (auto& character : battle.drifters_and_enemies)
-                            {
-                                if (character.is_alive && character.current_slot == battle.target_num && character.character_id <= 2)
-                                {
-                                    targets.push_back(&character);
-                                }
-                            }
-                        }
-                        //else targets.push_back(*(battle.current_character)); //defaults to targeting self
-                    }
-                    else if (battle.current_move->target[i] == "ALL")
-                    {
-                        for (auto& character : battle.drifters_and_enemies)
-                        {
-                            if (character.is_alive)
-                                targets.push_back(&character);
-                        }
-                    }
-                    else if (battle.current_move->target[i] == "SELF")
-                    {
-                        targets.push_back(battle.current_character);
-                    }
-
-                    if (battle.current_move->effect[i] == "Damage")
-                    {
-                        for (auto character : targets)
-                        {
-
-                            if (battle.god_mode)
-                            {
-                                int final_damage = battle.current_move->value[i];
-                                if (battle.current_character->attack_buff_duration > 0)
-                                {
-                                    final_damage += battle.current_move->value[i] / 2;
-                                }
-                                if (battle.current_character->attack_debuff_duration > 0)
-                                {
-                                    final_damage -= battle.current_move->value[i] / 2;
-                                }
-                                final_damage *= 10;
-                                character->current_health -= final_damage;
-                            }
-                            else if (character->shield_buff_duration > 0)
-                            {
-                                continue;
-                            }
-                            else
-                            {
-                                int final_damage = battle.current_move->value[i];
-                                if (battle.current_character->attack_buff_duration > 0)
-                                {
-                                    final_damage += battle.current_move->value[i] / 2;
-                                }
-                                if (battle.current_character->attack_debuff_duration > 0)
-                                {
-                                    final_damage -= battle.current_move->value[i] / 2;
-                                }
-                                character->current_health -= final_damage;
-                            }
-                        }
-                    }
-                    if (battle.current_move->effect[i] == "Heal")
-                    {
-                        for (auto character : targets)
-                        {
-                            if (character->current_health + battle.current_move->value[i] > character->health)
-                            {
-                                character->current_health = character->health;
-                            }
-                            else character->current_health += battle.current_move->value[i];
-                        }
-                    }
-                    else if (battle.current_move->effect[i] == "Speed_Up")
-                    {
-                        for (auto character : targets)
-                        {
-                            character->speed_change -= battle.current_move->value[i];
-                            /*if (character->current_speed - battle.current_move->value[i] < 0)
-                            {
-                                character->current_speed = 0;
-                            }
-                            else character->current_speed -= battle.current_move->value[i];*/
-                        }
-                    }
-                    else if (battle.current_move->effect[i] == "Speed_Down")
-                    {
-                        for (auto character : targets)
-                        {
-                            character->speed_change += battle.current_move->value[i];
-                            /*for (auto character : targets)
-                            {
-                                character->current_speed += battle.current_move->value[i];
-                            }*/
-                        }
-                    }
-                    else if (battle.current_move->effect[i] == "Attack_Up")
-                    {
-                        for (auto character : targets)
-                        {
-                            character->attack_buff_duration += battle.current_move->value[i];
-                            if (character->attack_buff_duration > battle.current_move->value[i])
-                            {
-                                character->attack_buff_duration = battle.current_move->value[i];
-                            }
-                        }
-                    }
-                    else if (battle.current_move->effect[i] == "Attack_Down")
-                    {
-                        for (auto character : targets)
-                        {
-                            if (character->protect_buff_duration > 0) continue;
-                            else 
-                            {
-                                character->attack_debuff_duration += battle.current_move->value[i];
-                                if (character->attack_debuff_duration > battle.current_move->value[i])
-                                {
-                                    character->attack_debuff_duration = battle.current_move->value[i];
-                                }
-                            }
-                        }
-                    }
-                    else if (battle.current_move->effect[i] == "Stun")
-                    {
-                        for (auto character : targets)
-                        {
-                            if (character->protect_buff_duration > 0) continue;
-                            else
-                            {
-                                character->stun_debuff_duration += battle.current_move->value[i];
-                                if (character->stun_debuff_duration > battle.current_move->value[i])
-                                {
-                                    character->stun_debuff_duration = battle.current_move->value[i];
-                                }
-                            }
-                        }
-                    }
-                    else if (battle.current_move->effect[i] == "Shield")
-                    {
-                        for (auto character : targets)
-                        {
-                            character->shield_buff_duration += battle.current_move->value[i];
-                            if (character->shield_buff_duration > battle.current_move->value[i])
-                            {
-                                character->shield_buff_duration = battle.current_move->value[i];
-                            }
-                        }
-                    }
-                    else if (battle.current_move->effect[i] == "Protect")
-                    {
-                        for (auto character : targets)
-                        {
-                            character->protect_buff_duration += battle.current_move->value[i];
-                            if (character->protect_buff_duration > battle.current_move->value[i])
-                            {
-                                character->protect_buff_duration = battle.current_move->value[i];
-                            }
-                        }
-                    }
-                    else if (battle.current_move->effect[i] == "Strip")
-                    {
-                        for (auto character : targets)
-                        {
-                            character->attack_buff_duration = 0;
-                            character->shield_buff_duration = 0;
-                            character->protect_buff_duration = 0;
-                        }
-                    }
-                    else if (battle.current_move->effect[i] == "Cleanse")
-                    {
-                        for (auto character : targets)
-                        {
-                            character->attack_debuff_duration = 0;
-                            character->stun_debuff_duration = 0;
-                        }
-                    }
-                    targets.clear();
-                }
+                Apply_Move_Effects();
 
                 //add speed based on move used
-                battle.current_character->current_speed = battle.current_move->speed + battle.current_character->speed_change;
-                battle.current_character->speed_change = 0;
+                BattleState::EndTurn(*battle.current_character, battle.current_move->speed);
                 //apply player attack animation based on move used
                 auto& current_character_animator = *FlexECS::Scene::GetEntityByName("Drifter " + std::to_string(battle.current_character->current_slot + 1) ).GetComponent<Animator>();
                 switch (battle.move_num)
@@ -2711,245 +2239,10 @@ namespace Game
             else //resolve all move effects + play attack animation
             {
                 //apply the move
-                std::vector<_Character*> targets;
-                for (int i = 0; i < battle.current_move->effect.size(); i++) 
-                {
-                    if (battle.current_move->target[i] == "ALL_ENEMIES")
-                    {
-                        for (auto& character : battle.drifters_and_enemies)
-                        {
-                            if (character.is_alive && character.character_id <= 2)
-                            {
-                                targets.push_back(&character);
-                            }
-                        }
-                    }
-                    else if (battle.current_move->target[i] == "ADJACENT_ENEMIES")
-                    {
-                        for (auto& character : battle.drifters_and_enemies)
-                        {
-                            if (character.is_alive && (character.current_slot == battle.target_num - 1 && character.character_id <= 2 ||
-                                character.current_slot == battle.target_num && character.character_id <= 2 || character.current_slot == battle.target_num + 1 && character.character_id <= 2))
-                            {
-                                targets.push_back(&character);
-                            }
-                        }
-                    }
-                    else if (battle.current_move->target[i] == "NEXT_ENEMY")
-                    {
-                        for (auto& character : battle.drifters_and_enemies)
-                        {
-                            if (character.is_alive && character.character_id <= 2)
-                            {
-                                targets.push_back(&character);
-                                break;
-                            }
-                        }
-                    }
-                    else if (battle.current_move->target[i] == "SINGLE_ENEMY")
-                    {
-                        for (auto& character : battle.drifters_and_enemies)
-                        {
-                            if (character.is_alive && character.current_slot == battle.target_num && character.character_id <= 2)
-                            {
-                                targets.push_back(&character);
-                            }
-                        }
-                    }
-                    else if (battle.current_move->target[i] == "ALL_ALLIES")
-                    {
-                        for (auto& character : battle.drifters_and_enemies)
-                        {
-                            if (character.is_alive && character.character_id > 2)
-                            {
-                                targets.push_back(&character);
-                            }
-                        }
-                    }
-                    else if (battle.current_move->target[i] == "NEXT_ALLY")
-                    {
-                        for (auto& character : battle.drifters_and_enemies)
-                        {
-                            if (character.is_alive && character.character_id > 2 && character.character_id != battle.current_character->character_id)
-                            {
-                                targets.push_back(&character);
-                                break;
-                            }
-                        }
-                    }
-                    else if (battle.current_move->target[i] == "SINGLE_ALLY")
-                    {
-                        if (battle.current_move->target[0] == "ALL_ALLIES" || battle.current_move->target[0] == "NEXT_ALLY" || battle.current_move->target[0] == "SINGLE_ALLY" || battle.current_move->target[0] == "SELF") //fizzles if not targeting ally
-                        {
-                            for (auto& character : battle.drifters_and_enemies)
-                            {
-                                if (character.is_alive && character.current_slot == battle.target_num && character.character_id > 2)
-                                {
-                                    targets.push_back(&character);
-                                }
-                            }
-                        }
-                    }
-                    else if (battle.current_move->target[i] == "ALL")
-                    {
-                        for (auto& character : battle.drifters_and_enemies)
-                        {
-                            if (character.is_alive)
-                                targets.push_back(&character);
-                        }
-                    }
-                    else if (battle.current_move->target[i] == "SELF")
-                    {
-                        targets.push_back(battle.current_character);
-                    }
-
-                    if (battle.current_move->effect[i] == "Damage")
-                    {
-                        for (auto character : targets)
-                        {
-                            if (battle.god_mode)
-                            {
-                                continue;
-                            }
-                            else if (character->shield_buff_duration > 0)
-                            {
-                                continue;
-                            }
-                            else
-                            {
-                                int final_damage = battle.current_move->value[i];
-                                if (battle.current_character->attack_buff_duration > 0)
-                                {
-                                    final_damage += battle.current_move->value[i] / 2;
-                                }
-                                if (battle.current_character->attack_debuff_duration > 0)
-                                {
-                                    final_damage -= battle.current_move->value[i] / 2;
-                                }
-                                character->current_health -= final_damage;
-                            }
-                        }
-                    }
-                    if (battle.current_move->effect[i] == "Heal")
-                    {
-                        for (auto character : targets)
-                        {
-                            if (character->current_health + battle.current_move->value[i] > character->health)
-                            {
-                                character->current_health = character->health;
-                            }
-                            else character->current_health += battle.current_move->value[i];
-                        }
-                    }
-                    else if (battle.current_move->effect[i] == "Speed_Up")
-                    {
-                        for (auto character : targets)
-                        {
-                            character->speed_change -= battle.current_move->value[i];
-                            /*if (character->current_speed - battle.current_move->value[i] < 0)
-                            {
-                                character->current_speed = 0;
-                            }
-                            else character->current_speed -= battle.current_move->value[i];*/
-                        }
-                    }
-                    else if (battle.current_move->effect[i] == "Speed_Down")
-                    {
-                        for (auto character : targets)
-                        {
-                            character->speed_change += battle.current_move->value[i];
-                            /*for (auto character : targets)
-                            {
-                                character->current_speed += battle.current_move->value[i];
-                            }*/
-                        }
-                    }
-                    else if (battle.current_move->effect[i] == "Attack_Up")
-                    {
-                        for (auto character : targets)
-                        {
-                            character->attack_buff_duration += battle.current_move->value[i];
-                            if (character->attack_buff_duration > battle.current_move->value[i])
-                            {
-                                character->attack_buff_duration = battle.current_move->value[i];
-                            }
-                        }
-                    }
-                    else if (battle.current_move->effect[i] == "Attack_Down")
-                    {
-                        for (auto character : targets)
-                        {
-                            if (character->protect_buff_duration > 0) continue;
-                            else
-                            {
-                                character->attack_debuff_duration += battle.current_move->value[i];
-                                if (character->attack_debuff_duration > battle.current_move->value[i])
-                                {
-                                    character->attack_debuff_duration = battle.current_move->value[i];
-                                }
-                            }
-                        }
-                    }
-                    else if (battle.current_move->effect[i] == "Stun")
-                    {
-                        for (auto character : targets)
-                        {
-                            if (character->protect_buff_duration > 0) continue;
-                            else
-                            {
-                                character->stun_debuff_duration += battle.current_move->value[i];
-                                if (character->stun_debuff_duration > battle.current_move->value[i])
-                                {
-                                    character->stun_debuff_duration = battle.current_move->value[i];
-                                }
-                            }
-                        }
-                    }
-                    else if (battle.current_move->effect[i] == "Shield")
-                    {
-                        for (auto character : targets)
-                        {
-                            character->shield_buff_duration += battle.current_move->value[i];
-                            if (character->shield_buff_duration > battle.current_move->value[i])
-                            {
-                                character->shield_buff_duration = battle.current_move->value[i];
-                            }
-                        }
-                    }
-                    else if (battle.current_move->effect[i] == "Protect")
-                    {
-                        for (auto character : targets)
-                        {
-                            character->protect_buff_duration += battle.current_move->value[i];
-                            if (character->protect_buff_duration > battle.current_move->value[i])
-                            {
-                                character->protect_buff_duration = battle.current_move->value[i];
-                            }
-                        }
-                    }
-                    else if (battle.current_move->effect[i] == "Strip")
-                    {
-                        for (auto character : targets)
-                        {
-                            character->attack_buff_duration = 0;
-                            character->shield_buff_duration = 0;
-                            character->protect_buff_duration = 0;
-                        }
-                    }
-                    else if (battle.current_move->effect[i] == "Cleanse")
-                    {
-                        for (auto character : targets)
-                        {
-                            character->attack_debuff_duration = 0;
-                            character->stun_debuff_duration = 0;
-                        }
-                    }
-                    targets.clear();
-                }
+                Apply_Move_Effects();
 
                 //update speed based on move used
-                battle.current_character->current_speed = battle.current_move->speed + battle.current_character->speed_change;
-                battle.current_character->speed_change = 0;
+                BattleState::EndTurn(*battle.current_character, battle.current_move->speed);
 
                 // play the attack animation
                 auto& current_character_animator = *FlexECS::Scene::GetEntityByName("Enemy " + std::to_string(battle.current_character->current_slot + 1)).GetComponent<Animator>();
@@ -3074,14 +2367,14 @@ namespace Game
 
             //play damage animation for enemies
             float animation_time = .0f;
-            if (battle.current_move->target[0] == "ADJACENT_ENEMIES" || battle.current_move->target[0] == "ALL_ENEMIES")
+            if (battle.current_move->ops[0].target == Asset::MoveTarget::Adjacent_Enemies || battle.current_move->ops[0].target == Asset::MoveTarget::All_Enemies)
             {
               //std::vector<FlexECS::Entity> hit_entities;
                 for (auto& character : battle.drifters_and_enemies)
                 {
                     if (character.is_alive && character.character_id > 2)
                     {
-                        if (battle.current_move->target[0] == "ADJACENT_ENEMIES")
+                        if (battle.current_move->ops[0].target == Asset::MoveTarget::Adjacent_Enemies)
                         {
                             if (character.current_slot == battle.target_num - 1 || character.current_slot == battle.target_num || character.current_slot == battle.target_num + 1)
                             {
@@ -3195,7 +2488,7 @@ namespace Game
                 //Application::MessagingSystem::Send("ActivateChromaticAlteration", true);
                 battle.jerk_towards_defender = true;
             }
-            else if (battle.current_move->target[0] == "SINGLE_ENEMY" || battle.current_move->target[0] == "NEXT_ENEMY")
+            else if (battle.current_move->ops[0].target == Asset::MoveTarget::Single_Enemy || battle.current_move->ops[0].target == Asset::MoveTarget::Next_Enemy)
             {
                 auto target_entity = FlexECS::Scene::GetEntityByName("Enemy " + std::to_string(battle.initial_target->current_slot + 1));
                 auto& target_animator = *target_entity.GetComponent<Animator>();
@@ -3279,7 +2572,7 @@ namespace Game
 
             //play damage animation for players
             float animation_time = .0f;
-            if (battle.current_move->target[0] == "ADJACENT_ENEMIES" || battle.current_move->target[0] == "ALL_ENEMIES")
+            if (battle.current_move->ops[0].target == Asset::MoveTarget::Adjacent_Enemies || battle.current_move->ops[0].target == Asset::MoveTarget::All_Enemies)
             {
               //std::vector<FlexECS::Entity> hit_entities;
                 for (auto& character : battle.drifters_and_enemies)
@@ -3362,7 +2655,7 @@ namespace Game
                 }
                 battle.disable_input_timer += animation_time - 0.1f;// +1.f;
             }
-            else if (battle.current_move->target[0] == "SINGLE_ENEMY" || battle.current_move->target[0] == "NEXT_ENEMY")
+            else if (battle.current_move->ops[0].target == Asset::MoveTarget::Single_Enemy || battle.current_move->ops[0].target == Asset::MoveTarget::Next_Enemy)
             {
                 auto target_entity = FlexECS::Scene::GetEntityByName("Drifter " + std::to_string(battle.initial_target->current_slot + 1));;
                 auto& target_animator = *target_entity.GetComponent<Animator>();
@@ -3486,25 +2779,9 @@ namespace Game
             float animation_time = .0f;
             for (auto& character : battle.drifters_and_enemies)
             {
-                // check if any characters are dead
-                if (character.is_alive && character.current_health <= 0)
+                // check if any characters are dead, dead characters leave the speed bar
+                if (BattleState::CheckDeath(character, battle.speed_bar))
                 {
-                    // update state
-                    character.is_alive = false;
-                    character.current_health = 0;
-
-                    // remove from speed bar
-                    battle.speed_bar.erase(
-                      std::remove(battle.speed_bar.begin(), battle.speed_bar.end(), &character), battle.speed_bar.end()
-                    );
-
-                    character.attack_buff_duration = 0;
-                    character.attack_debuff_duration = 0;
-                    character.stun_debuff_duration = 0;
-                    character.shield_buff_duration = 0;
-                    character.protect_buff_duration = 0;
-
-
                     if (character.character_id > 2)
                     {
                         //FlexECS::Scene::GetEntityByName("Enemy " + std::to_string(character.current_slot + 1)).GetComponent<Transform>()->is_active = false;
@@ -3655,7 +2932,7 @@ namespace Game
 
             if (battle.is_boss && battle.current_character->character_id == 5)
             {
-                switch (battle.boss_move)
+                switch (battle.boss_script.move)
                 {
                 case 1:
                     FlexECS::Scene::GetEntityByName("boss_textbox").GetComponent<Transform>()->is_active = true;
@@ -3751,31 +3028,8 @@ namespace Game
         }
 
         //check for game over
-        int player_count = 0;
-        int enemy_count = 0;
-        for (auto& character : battle.drifters_and_enemies)
-        {
-            if (character.is_alive && character.character_id <= 2)
-            {
-                player_count++;
-            }
-            else if (character.is_alive && character.character_id > 2)
-            {
-                enemy_count++;
-            }
-        }
-        if (battle.is_boss)
-        {
-            for (auto& character : battle.drifters_and_enemies)
-            {
-                if (character.character_id == 1 && !character.is_alive)
-                {
-                    Lose_Battle();
-                    return;
-                }
-            }
-        }
-        if (battle.is_tutorial && enemy_count == 0)
+        BattleState::Headcount headcount = BattleState::CountSurvivors(battle.drifters_and_enemies);
+        if (battle.is_tutorial && headcount.enemies == 0)
         {
                 battle.tutorial_info = 6;
                 if (Input::AnyKeyDown())
@@ -3788,15 +3042,16 @@ namespace Game
                 return;
         }
 
-        if (!player_count)
+        switch (headcount.GetOutcome(battle.is_boss))
         {
+        case BattleState::Outcome::Lose:
             Lose_Battle();
             return;
-        }
-        else if (!enemy_count)
-        {
+        case BattleState::Outcome::Win:
             Win_Battle();
             return;
+        default:
+            break;
         }
 
         //change phase
@@ -4087,7 +3342,7 @@ namespace Game
         }
         if (battle.is_tutorial && battle.is_tutorial_running)
         {
-            std::string text_to_show;
+            const char* text_to_show = "";
             switch (battle.tutorial_info)
             {
             case 0:
@@ -4128,7 +3383,9 @@ namespace Game
                 break;
             }
 
-            FlexECS::Scene::GetEntityByName("tutorial_text").GetComponent<Text>()->text = FLX_STRING_NEW(text_to_show);
+            // runs every frame, the string is only written when the step changes so the string storage does not grow
+            std::string& tutorial_text = FLX_STRING_GET(battle.tutorial_text.ReadComponent<Text>()->text);
+            if (tutorial_text != text_to_show) tutorial_text = text_to_show;
         }
 
         if (Input::GetKeyDown(GLFW_KEY_X))
@@ -22,8 +22,10 @@ namespace Game
 
     void CutsceneLayer::OnAttach()
     {
-        File& file = File::Open(Path::current("assets/saves/cutscene3.flxscene"));
-        FlexECS::Scene::SetActiveScene(FlexECS::Scene::Load(file));
+        FlexECS::Scene::SetActiveScene(FlexECS::SceneLoader::Take(Path::current("assets/saves/cutscene3.flxscene")));
+
+        // the tutorial battle is next
+        FlexECS::SceneLoader::LoadAsync(Path::current("assets/saves/battlescene_v12.flxscene"));
 
         CameraManager::TryMainCamera();
 
@@ -53,6 +55,8 @@ namespace Game
         m_shadowdialoguebox = activeScene->GetEntityByName("Shadow Dialogue Box");
         //m_shadowdialoguebox.GetComponent<Text>()->textboxDimensions = Vector2(CameraManager::GetMainGameCamera()->GetOrthoWidth() * 0.8f, 70.0f);
         m_dialoguearrow = activeScene->GetEntityByName("Dialogue Arrow");
+        m_arrowBaseY = m_dialoguearrow.ReadComponent<Position>()->position.y;
+        m_dialoguearrow.GetComponent<Sprite>()->opacity = 0.0f;
 
         m_autoplayText = activeScene->GetEntityByName("Autoplay Text");
         m_autoplayBtn = activeScene->GetEntityByName("Autoplay");
@@ -63,6 +67,10 @@ namespace Game
         m_instructiontxt = activeScene->GetEntityByName("Instruction Text");
         m_instructiontxtopacityblk = activeScene->GetEntityByName("Instruction Text Opacity Block");
         m_skipwheel = activeScene->GetEntityByName("Skip Wheel");
+        // The skip text is revealed while ESC is held, the string is set once
+        m_skiptext.GetComponent<Text>()->text = FLX_STRING_NEW("Commencing Skip");
+        m_skiptext.GetComponent<Text>()->visible_glyphs = 0.0f;
+        m_skipwheel.GetComponent<Sprite>()->opacity = 0.0f;
         
         auto& font = FLX_ASSET_GET(Asset::Font, R"(/fonts/Electrolize/Electrolize-Regular.ttf)");
         font.SetFontSize(30);
@@ -79,6 +87,12 @@ namespace Game
         auto& font = FLX_ASSET_GET(Asset::Font, R"(/fonts/Electrolize/Electrolize-Regular.ttf)");
         font.SetFontSize(50);
 
+        // the callbacks of these refer to this layer
+        TweenSystem::Kill(m_instructionFade);
+        TweenSystem::Kill(m_arrowBob);
+        TweenSystem::Kill(m_skipFade);
+        TweenSystem::Kill(m_skipHold);
+
         FMODWrapper::Core::ForceFadeOut(1.f);
     }
 
@@ -264,8 +278,8 @@ namespace Game
         processGlobalInput();
 
         // Update UI animations:
-        updateInstructionAnimation(dt);  // for pre-transition instruction text
-        updateDialogueArrow(dt);         // for dialogue arrow in manual mode
+        updateInstructionAnimation();    // for pre-transition instruction text
+        updateDialogueArrow();           // for dialogue arrow in manual mode
         updateSkipUI(dt);                // for skip text and wheel
 
         // Update dialogue based on the current mode.
@@ -425,8 +439,10 @@ namespace Game
             const auto& dialogueBlock = m_CutsceneDialogue[m_currSectionIndex];
             if (m_currDialogueIndex < dialogueBlock.size())
             {
-                std::string fullText = FLX_STRING_GET(dialogueBlock[m_currDialogueIndex]);
-                size_t totalChars = fullText.size();
+                // The boxes show the whole line and the Text component reveals it when it is drawn,
+                // so no strings are made while the line plays.
+                FlexECS::Scene::StringIndex line = dialogueBlock[m_currDialogueIndex];
+                size_t totalChars = FLX_STRING_GET(line).size();
                 m_dialogueTimer += dt;
                 size_t charsToShow = static_cast<size_t>(m_dialogueTimer * m_dialogueTextRate);
                 if (charsToShow > totalChars)
@@ -434,10 +450,14 @@ namespace Game
                     charsToShow = totalChars;
                     m_dialogueIsWaitingForInput = true;
                 }
-                std::string displayedText = fullText.substr(0, charsToShow);
-                FlexECS::Scene::StringIndex txt = FLX_STRING_NEW(displayedText);
-                m_dialoguebox.GetComponent<Text>()->text = txt;
-                m_shadowdialoguebox.GetComponent<Text>()->text = txt;
+                float visibleGlyphs = (charsToShow < totalChars) ? m_dialogueTimer * m_dialogueTextRate : -1.0f;
+                for (FlexECS::Entity box : { m_dialoguebox, m_shadowdialoguebox })
+                {
+                    Text* text = box.GetComponent<Text>();
+                    text->text = line;
+                    text->visible_glyphs = visibleGlyphs;
+                    text->glyph_fade = m_dialogueGlyphFade;
+                }
             }
         }
     }
@@ -487,8 +507,7 @@ namespace Game
             const auto& dialogueBlock = m_CutsceneDialogue[m_currSectionIndex];
             if (m_currDialogueIndex < dialogueBlock.size())
             {
-                std::string fullText = FLX_STRING_GET(dialogueBlock[m_currDialogueIndex]);
-                size_t totalChars = fullText.size();
+                size_t totalChars = FLX_STRING_GET(dialogueBlock[m_currDialogueIndex]).size();
                 size_t currentChars = static_cast<size_t>(m_dialogueTimer * m_dialogueTextRate);
 
                 if (Input::GetKeyDown(GLFW_KEY_SPACE) || (Input::GetMouseButtonDown(GLFW_MOUSE_BUTTON_LEFT) && enable_clickingreaction))
@@ -497,9 +516,8 @@ namespace Game
                     {
                         // Skip text animation: show full text instantly.
                         m_dialogueTimer = totalChars / m_dialogueTextRate;
-                        FlexECS::Scene::StringIndex txt = FLX_STRING_NEW(fullText);
-                        m_dialoguebox.GetComponent<Text>()->text = txt;
-                        m_shadowdialoguebox.GetComponent<Text>()->text = txt;
+                        m_dialoguebox.GetComponent<Text>()->visible_glyphs = -1.0f;
+                        m_shadowdialoguebox.GetComponent<Text>()->visible_glyphs = -1.0f;
                     }
                     else
                     {
@@ -531,16 +549,14 @@ namespace Game
                 const auto& dialogueBlock = m_CutsceneDialogue[m_currSectionIndex];
                 if (m_currDialogueIndex < dialogueBlock.size())
                 {
-                    std::string fullText = FLX_STRING_GET(dialogueBlock[m_currDialogueIndex]);
-                    size_t totalChars = fullText.size();
+                    size_t totalChars = FLX_STRING_GET(dialogueBlock[m_currDialogueIndex]).size();
                     size_t currentChars = static_cast<size_t>(m_dialogueTimer * m_dialogueTextRate);
 
                     if (currentChars < totalChars)
                     {
                         m_dialogueTimer = totalChars / m_dialogueTextRate;
-                        FlexECS::Scene::StringIndex txt = FLX_STRING_NEW(fullText);
-                        m_dialoguebox.GetComponent<Text>()->text = txt;
-                        m_shadowdialoguebox.GetComponent<Text>()->text = txt;
+                        m_dialoguebox.GetComponent<Text>()->visible_glyphs = -1.0f;
+                        m_shadowdialoguebox.GetComponent<Text>()->visible_glyphs = -1.0f;
                     }
                     else
                     {
@@ -697,47 +713,64 @@ namespace Game
     #pragma endregion
 
     #pragma region UI Animation
-    void CutsceneLayer::updateInstructionAnimation(float dt)
+    void CutsceneLayer::updateInstructionAnimation()
     {
         if (!m_instructionActive)
             return;
 
-        if (Input::GetKey(GLFW_KEY_ESCAPE) || m_instructionTimer >= m_instructionDuration)
+        if (Input::GetKey(GLFW_KEY_ESCAPE))
         {
-            m_instructiontxt.GetComponent<Transform>()->is_active = false;
-            m_instructiontxtopacityblk.GetComponent<Sprite>()->opacity = 1.0f;
-            m_instructionActive = false;
+            endInstructionAnimation();
             return;
         }
 
-        m_instructionTimer += dt;
-        float progress = m_instructionTimer / m_instructionDuration; // instructionDuration is a set duration
-        auto* pos = m_instructiontxt.GetComponent<Position>();
-        pos->position.x = FlexMath::Lerp(pos->position.x, pos->position.x+1, progress); // Just move to the right a bit
-        auto* sprite = m_instructiontxtopacityblk.GetComponent<Sprite>();
-        sprite->opacity = FlexMath::Lerp(0.0f, 1.0f, progress);
+        // guard: already playing
+        if (m_instructionFade != TweenHandle{})
+            return;
+
+        // The text drifts right as far as the old per frame lerp took it at 60 fps,
+        // while the block over it fades in. Both end together.
+        float x = m_instructiontxt.ReadComponent<Position>()->position.x;
+        TweenSystem::To(m_instructiontxt, TweenField::PositionX, x + 30.0f * m_instructionDuration, m_instructionDuration, Ease::InQuad);
+        m_instructionFade = TweenSystem::FromTo(m_instructiontxtopacityblk, TweenField::Opacity, 0.0f, 1.0f, m_instructionDuration);
+        TweenSystem::OnComplete(m_instructionFade, [this]() { endInstructionAnimation(); });
+    }
+
+    void CutsceneLayer::endInstructionAnimation()
+    {
+        TweenSystem::Kill(m_instructionFade);
+        TweenSystem::KillAll(m_instructiontxt);
+
+        m_instructiontxt.GetComponent<Transform>()->is_active = false;
+        m_instructiontxtopacityblk.GetComponent<Sprite>()->opacity = 1.0f;
+        m_instructionActive = false;
     }
     
-    void CutsceneLayer::updateDialogueArrow(float dt)
+    void CutsceneLayer::updateDialogueArrow()
     {
-        static float m_totaltime = 0.0f;
-        static float m_arrowBaseY = m_dialoguearrow.GetComponent<Position>()->position.y;
-        m_totaltime += dt;
-        // Only run in manual mode when the current dialogue is fully revealed.
+        // Only shown in manual mode when the current dialogue is fully revealed.
         if (!is_autoplay && m_dialogueIsWaitingForInput)
         {
-            // Increase opacity over time
-            m_arrowTimer += dt;
-            m_dialoguearrow.GetComponent<Sprite>()->opacity = 1.0;
-
-            float offset = sin(m_totaltime * m_arrowOscillationFrequency) * m_arrowOscillationAmplitude;
-            auto* arrowpos = m_dialoguearrow.GetComponent<Position>();
-            arrowpos->position.y = m_arrowBaseY + offset;
+            if (TweenSystem::IsActive(m_arrowBob))
+                return;
+
+            // A yoyo with InOutSine is the same motion as offsetting by a sine every frame
+            m_dialoguearrow.GetComponent<Sprite>()->opacity = 1.0f;
+            float half_period = PIf / m_arrowOscillationFrequency;
+            m_arrowBob = TweenSystem::FromTo(
+                m_dialoguearrow, TweenField::PositionY,
+                m_arrowBaseY - m_arrowOscillationAmplitude, m_arrowBaseY + m_arrowOscillationAmplitude,
+                half_period, Ease::InOutSine
+            );
+            TweenSystem::SetLoops(m_arrowBob, -1, true);
         }
         else
         {
-            m_arrowTimer = 0.0f;
-            m_dialoguearrow.GetComponent<Sprite>()->opacity = 0;
+            if (TweenSystem::IsActive(m_arrowBob))
+            {
+                TweenSystem::Kill(m_arrowBob);
+                m_dialoguearrow.GetComponent<Sprite>()->opacity = 0;
+            }
             m_dialogueIsWaitingForInput = false;
         }
     }
@@ -746,41 +779,32 @@ namespace Game
     {
         if (Input::GetKey(GLFW_KEY_ESCAPE))
         {
+            // Just pressed: fade the instruction block out and skip once it is held long enough.
+            if (m_skipTimer == 0.0f)
+            {
+                m_skipwheel.GetComponent<Sprite>()->opacity = 1.0f;
+                m_skipFade = TweenSystem::FromTo(m_instructiontxtopacityblk, TweenField::Opacity, 1.0f, 0.0f, m_skipFadeDuration);
+                m_skipHold = TweenSystem::Delay(m_skipHoldThreshold);
+                TweenSystem::OnComplete(m_skipHold, []() { Application::MessagingSystem::Send("TransitionStart", std::pair<int, double>{ 2, 0.5 }); });
+            }
+
             m_skipTimer += dt;
             // Animate skip text: "Commencing Skip"
-            static std::string fullSkipText = "Commencing Skip";
-            size_t totalChars = fullSkipText.size();
-            size_t charsToShow = static_cast<size_t>(m_skipTimer * m_skipTextRate);
-            if (charsToShow > totalChars)
-                charsToShow = totalChars;
-            std::string displayedText = fullSkipText.substr(0, charsToShow);
-            m_skiptext.GetComponent<Text>()->text = FLX_STRING_NEW(displayedText.c_str());
-
-            // Animate skip wheel opacity and rotation.
-            auto* skipWheelSprite = m_skipwheel.GetComponent<Sprite>();
-            skipWheelSprite->opacity = 1.0f;
-            auto* skipWheelrotation = m_skipwheel.GetComponent<Rotation>();
+            m_skiptext.GetComponent<Text>()->visible_glyphs = m_skipTimer * m_skipTextRate;
+
             // Increase rotation speed based on skipTimer.
+            auto* skipWheelrotation = m_skipwheel.GetComponent<Rotation>();
             skipWheelrotation->rotation.z -= (m_baseRotationSpeed * m_skipTimer * dt);
-
-            // Animate opacity of skip wheel.
-            m_instructiontxtopacityblk.GetComponent<Sprite>()->opacity = FlexMath::Lerp(1.0f, 0.0f, m_skipTimer / m_skipFadeDuration);
-
-            // Check if held down long enough to trigger stop, and only send once.
-            if (m_skipTimer >= m_skipHoldThreshold && !m_messageSent)
-            {
-                Application::MessagingSystem::Send("TransitionStart", std::pair<int, double>{ 2, 0.5 });
-                m_messageSent = true;  // Mark that the message has been sent.
-            }
         }
-        else
+        else if (m_skipTimer > 0.0f)
         {
             // Reset skip UI if ESC is released.
+            TweenSystem::Kill(m_skipFade);
+            TweenSystem::Kill(m_skipHold);
             m_skipTimer = 0.0f;
-            m_skiptext.GetComponent<Text>()->text = FLX_STRING_NEW("");
+            m_skiptext.GetComponent<Text>()->visible_glyphs = 0.0f;
             m_skipwheel.GetComponent<Sprite>()->opacity = 0;
             m_skipwheel.GetComponent<Rotation>()->rotation.z = 0.0f;
-            m_messageSent = false; // Reset flag so that next press can send the message.
         }
     }
     #pragma endregion
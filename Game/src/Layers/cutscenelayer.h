@@ -77,6 +77,7 @@ namespace Game
         float m_dialogueTimer = 0.0f;    // Accumulates time for text animation.
         float m_dialogueHoldTimer = 0.0f;// Time after text is fully revealed.
         float m_dialogueTextRate = 30.0f;// Characters per second.
+        float m_dialogueGlyphFade = 2.0f;// Characters each revealed character takes to fade in.
         float m_dialogueHoldDuration = 1.0f; // Hold duration after full text reveal.
         bool is_autoplay = false;         // Determines if dialogue advances automatically.
         bool enable_clickingreaction = true;   // Determines if cutscene should be clickable
@@ -89,21 +90,23 @@ namespace Game
 
         // UI timers
         bool m_instructionActive = true;
-        float m_instructionTimer = 0.0f;
         float m_instructionDuration = 2.0f;
+        TweenHandle m_instructionFade;
         bool m_dialogueIsWaitingForInput = false;
-        float m_arrowTimer = 0.0f;
+        float m_arrowBaseY = 0.0f;
         float m_arrowOscillationFrequency = 3.0f;
         float m_arrowOscillationAmplitude = 3.0f;
+        TweenHandle m_arrowBob;
         float m_skipTimer = 0.0f;
         float m_skipFadeDuration = 2.0f;
+        TweenHandle m_skipFade;
+        TweenHandle m_skipHold;
         float m_skipTextRate = 20.0f;
         float m_baseRotationSpeed = 1200.0f;
         float m_skipHoldThreshold = 3.0f;
 
         // Overall cutscene activation flag.
         bool m_CutsceneActive = false;
-        bool m_messageSent = false;
         #pragma endregion
 
         #pragma region Helper Func
@@ -144,10 +147,13 @@ namespace Game
 
         #pragma region UI Animation
         // Updates the animation for the instructional "Click to continue" text.
-        void updateInstructionAnimation(float dt);
+        void updateInstructionAnimation();
+
+        // Hides the instruction text once its animation finished or was skipped.
+        void endInstructionAnimation();
 
         // Animates the dialogue arrow to indicate input is expected.
-        void updateDialogueArrow(float dt);
+        void updateDialogueArrow();
 
         // Updates skip button UI effects such as fading, spinning, and text visibility.
         void updateSkipUI(float dt);
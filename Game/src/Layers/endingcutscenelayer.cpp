@@ -21,8 +21,10 @@ namespace Game
 {
   void EndingCutsceneLayer::OnAttach()
   {
-    File& file = File::Open(Path::current("assets/saves/endingcutscene.flxscene"));
-    FlexECS::Scene::SetActiveScene(FlexECS::Scene::Load(file));
+    FlexECS::Scene::SetActiveScene(FlexECS::SceneLoader::Take(Path::current("assets/saves/endingcutscene.flxscene")));
+
+    // back to the menu after the credits
+    FlexECS::SceneLoader::LoadAsync(Path::current("assets/saves/mainmenu_v10.flxscene"));
 
     // Play cutscene audio
     FlexECS::Scene::GetEntityByName("CutsceneAudio").GetComponent<Audio>()->should_play = true;
@@ -32,6 +34,10 @@ namespace Game
     m_instructiontxtopacityblk = FlexECS::Scene::GetEntityByName("Instruction Text Opacity Block");
     m_skipwheel = FlexECS::Scene::GetEntityByName("Skip Wheel");
 
+    // The skip text is revealed while ESC is held, the string is set once
+    m_skiptext.GetComponent<Text>()->text = FLX_STRING_NEW("Commencing Skip");
+    m_skiptext.GetComponent<Text>()->visible_glyphs = 0.0f;
+
     auto& font = FLX_ASSET_GET(Asset::Font, R"(/fonts/Electrolize/Electrolize-Regular.ttf)");
     font.SetFontSize(30);
   
@@ -102,13 +108,7 @@ namespace Game
     {
       m_skipTimer += dt;
       // Animate skip text: "Commencing Skip"
-      static std::string fullSkipText = "Commencing Skip";
-      size_t totalChars = fullSkipText.size();
-      size_t charsToShow = static_cast<size_t>(m_skipTimer * m_skipTextRate);
-      if (charsToShow > totalChars)
-        charsToShow = totalChars;
-      std::string displayedText = fullSkipText.substr(0, charsToShow);
-      m_skiptext.GetComponent<Text>()->text = FLX_STRING_NEW(displayedText.c_str());
+      m_skiptext.GetComponent<Text>()->visible_glyphs = m_skipTimer * m_skipTextRate;
 
       // Animate skip wheel opacity and rotation.
       auto* skipWheelSprite = m_skipwheel.GetComponent<Sprite>();
@@ -132,7 +132,7 @@ namespace Game
     {
       // Reset skip UI if ESC is released.
       m_skipTimer = 0.0f;
-      m_skiptext.GetComponent<Text>()->text = FLX_STRING_NEW("");
+      m_skiptext.GetComponent<Text>()->visible_glyphs = 0.0f;
       m_skipwheel.GetComponent<Sprite>()->opacity = 0;
       m_skipwheel.GetComponent<Rotation>()->rotation.z = 0.0f;
       m_messageSent = false; // Reset flag so that next press can send the message.
@@ -257,8 +257,10 @@ namespace Game
   #pragma endregion
   void MenuLayer::OnAttach()
   {
-    File& file = File::Open(Path::current("assets/saves/mainmenu_v10.flxscene"));
-    FlexECS::Scene::SetActiveScene(FlexECS::Scene::Load(file));
+    FlexECS::Scene::SetActiveScene(FlexECS::SceneLoader::Take(Path::current("assets/saves/mainmenu_v10.flxscene")));
+
+    // load the opening cutscene in the background so starting the game does not stall
+    FlexECS::SceneLoader::LoadAsync(Path::current("assets/saves/cutscene3.flxscene"));
     
     // Trigger music to start
     FlexECS::Scene::GetEntityByName("Main Menu BGM").GetComponent<Audio>()->should_play = true;
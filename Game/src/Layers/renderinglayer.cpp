@@ -29,6 +29,8 @@ namespace Game
   {
     OpenGLRenderer::EnableBlending();
     PostProcessing::Init();
+
+    if (m_systems.GetSystemCount() == 0) BuildSystems();
   }
 
   // Function: RenderingLayer::OnDetach
@@ -40,172 +42,174 @@ namespace Game
     PostProcessing::Exit();
   }
 
-  // Function: RenderingLayer::Update
-  // Description: Performs per-frame updates including transform calculations,
-  //              animator & video systems, post-processing update, and final
-  //              rendering (batched or unbatched).
-  void RenderingLayer::Update()
+  // Function: RenderingLayer::BuildSystems
+  // Description: Adds the per-frame systems that run before rendering to the schedule.
+  //              The video transforms and the animators touch different data and run
+  //              at the same time, the video player decodes frames on the main thread.
+  void RenderingLayer::BuildSystems()
   {
-      #pragma region Transformation Calculations
-      // Update Transform component to obtain the true world representation of the entity
-      for (auto& element : FlexECS::Scene::GetActiveScene()->CachedQuery<Sprite, Position, Rotation, Scale, Transform>())
-      {
-          auto sprite = element.GetComponent<Sprite>();
-          auto position = element.GetComponent<Position>()->position;
-          auto rotation = element.GetComponent<Rotation>()->rotation;
-          auto scale = element.GetComponent<Scale>()->scale;
-          auto transform = element.GetComponent<Transform>();
+    // ChangedQuery advances the scene's change tick, so the transforms run on their own
+    m_systems.Add("Transforms", [this]() { UpdateTransforms(); }).Exclusive();
 
-          // "Model scale" in this case refers to the scale of the object itself...
-          Matrix4x4 model = Matrix4x4::Identity;
+    m_systems.Add("Video Transforms", [this]() { UpdateVideoTransforms(); })
+      .Reads<Position, Rotation, Scale>()
+      .Writes<VideoPlayer, Transform, VideoDecoder>();
 
-          // However, spritesheets have a different scale...
-          if (element.HasComponent<Animator>() && FLX_STRING_GET(element.GetComponent<Animator>()->spritesheet_handle) != "")
-          {
-              auto& animator = *element.GetComponent<Animator>();
-              auto& asset_spritesheet = FLX_ASSET_GET(Asset::Spritesheet, FLX_STRING_GET(animator.spritesheet_handle));
-              auto& sprite_info = FLX_ASSET_GET(Asset::Texture, asset_spritesheet.texture);
-
-              model.Scale(Vector3(static_cast<float>(sprite_info.GetWidth() / asset_spritesheet.columns),
-                  static_cast<float>(sprite_info.GetHeight() / asset_spritesheet.rows),
-                  1.f));
-              sprite->model_matrix = model;
-          }
-          else if (FLX_STRING_GET(sprite->sprite_handle) != "")
-          {
-              auto& sprite_info = FLX_ASSET_GET(Asset::Texture, FLX_STRING_GET(sprite->sprite_handle));
-              model.Scale(Vector3(static_cast<float>(sprite_info.GetWidth()),
-                  static_cast<float>(sprite_info.GetHeight()),
-                  1.f));
-              sprite->model_matrix = model;
-          }
+    m_systems.Add("Animator", []()
+    {
+      if (!CameraManager::has_main_camera) return;
 
-          Matrix4x4 translation_matrix = Matrix4x4::Translate(Matrix4x4::Identity, position);
-          Matrix4x4 rotation_matrix = Quaternion::FromEulerAnglesDeg(rotation).ToRotationMatrix();
-          Matrix4x4 scale_matrix = Matrix4x4::Scale(Matrix4x4::Identity, scale);
+      // advances every animator in one batch and writes the frame and its uv into the animator
+      AnimatorSystem::Update(Application::GetCurrentWindow()->GetFramerateController().GetDeltaTime());
+    })
+      .Reads<Sprite>()
+      .Writes<Animator, AnimatorSystem, Asset::Spritesheet, Asset::Texture>();
 
-          transform->transform = translation_matrix * rotation_matrix * scale_matrix * sprite->model_matrix;
-      }
-      
-      //For videos
-      for (auto& element : FlexECS::Scene::GetActiveScene()->CachedQuery<VideoPlayer, Position, Rotation, Scale, Transform>())
-      {
-        auto video = element.GetComponent<VideoPlayer>();
-        auto position = element.GetComponent<Position>()->position;
-        auto rotation = element.GetComponent<Rotation>()->rotation;
-        auto scale = element.GetComponent<Scale>()->scale;
+    m_systems.Add("Video Player", [this]() { UpdateVideoPlayers(); })
+      .MainThread()
+      .Writes<VideoPlayer, VideoDecoder>();
+  }
+
+  // Function: RenderingLayer::UpdateTransforms
+  // Description: Recomputes the transforms of the sprites whose inputs changed since last frame.
+  void RenderingLayer::UpdateTransforms()
+  {
+    // Update Transform component to obtain the true world representation of the entity
+    // Only the entities whose inputs were written to since last frame, the rest keep their transform.
+    // This needs every write to the inputs to go through GetComponent in the frame it happens,
+    // a write through a pointer kept from an earlier frame leaves the transform stale.
+    for (auto& element : FlexECS::Scene::GetActiveScene()->ChangedQuery<
+      FlexECS::Changed<Sprite, Position, Rotation, Scale, Animator>,
+      Sprite, Position, Rotation, Scale, Transform
+    >(m_transform_cursor))
+    {
+        const Sprite* sprite = element.ReadComponent<Sprite>();
+        auto position = element.ReadComponent<Position>()->position;
+        auto rotation = element.ReadComponent<Rotation>()->rotation;
+        auto scale = element.ReadComponent<Scale>()->scale;
         auto transform = element.GetComponent<Transform>();
 
         // "Model scale" in this case refers to the scale of the object itself...
-        Matrix4x4 model = Matrix4x4::Identity;
+        Matrix4x4 model = sprite->model_matrix;
 
-        auto& video_info = FLX_ASSET_GET(VideoDecoder, FLX_STRING_GET(video->video_file));
-        model.Scale(Vector3(static_cast<float>(video_info.GetWidth()),
-          static_cast<float>(video_info.GetHeight()),
-          1.f));
+        // However, spritesheets have a different scale...
+        const AnimationClip* clip = nullptr;
+        if (element.HasComponent<Animator>())
+        {
+            const Animator& animator = *element.ReadComponent<Animator>();
+            auto spritesheet_asset = animator.spritesheet_asset;
+            clip = AnimatorSystem::GetClip(spritesheet_asset, animator.spritesheet_handle);
+
+            if (spritesheet_asset != animator.spritesheet_asset) element.GetComponent<Animator>()->spritesheet_asset = spritesheet_asset;
+        }
+
+        if (clip)
+        {
+            model = Matrix4x4::Identity;
+            model.Scale(Vector3(clip->frame_size.x, clip->frame_size.y, 1.f));
+        }
+        else
+        {
+            auto sprite_asset = sprite->sprite_asset;
+            if (auto sprite_info = FLX_ASSET_GET_CACHED(sprite_asset, sprite->sprite_handle))
+            {
+                model = Matrix4x4::Identity;
+                model.Scale(Vector3(static_cast<float>(sprite_info->GetWidth()),
+                    static_cast<float>(sprite_info->GetHeight()),
+                    1.f));
+            }
+
+            if (sprite_asset != sprite->sprite_asset) element.GetComponent<Sprite>()->sprite_asset = sprite_asset;
+        }
+
+        // Writing to the sprite or animator brings the entity back next frame,
+        // so the model matrix and the cached handles are only written when they changed.
+        if (model != sprite->model_matrix) element.GetComponent<Sprite>()->model_matrix = model;
 
         Matrix4x4 translation_matrix = Matrix4x4::Translate(Matrix4x4::Identity, position);
         Matrix4x4 rotation_matrix = Quaternion::FromEulerAnglesDeg(rotation).ToRotationMatrix();
         Matrix4x4 scale_matrix = Matrix4x4::Scale(Matrix4x4::Identity, scale);
 
         transform->transform = translation_matrix * rotation_matrix * scale_matrix * model;
-      }
-      #pragma endregion 
-
-      if (!CameraManager::has_main_camera) return;
-
-      #pragma region Animator System
+    }
+  }
 
-      // animator system updates the time for all animators
-      // TODO: move this to a different layer
-      for (auto& element : FlexECS::Scene::GetActiveScene()->CachedQuery<Animator, Sprite>())
+  // Function: RenderingLayer::UpdateVideoTransforms
+  // Description: Recomputes the transforms of the video players.
+  void RenderingLayer::UpdateVideoTransforms()
+  {
+    for (auto& element : FlexECS::Scene::GetActiveScene()->CachedQuery<VideoPlayer, Position, Rotation, Scale, Transform>())
+    {
+      auto video = element.GetComponent<VideoPlayer>();
+      auto position = element.ReadComponent<Position>()->position;
+      auto rotation = element.ReadComponent<Rotation>()->rotation;
+      auto scale = element.ReadComponent<Scale>()->scale;
+      auto transform = element.GetComponent<Transform>();
+
+      // "Model scale" in this case refers to the scale of the object itself...
+      Matrix4x4 model = Matrix4x4::Identity;
+
+      if (auto video_info = FLX_ASSET_GET_CACHED(video->video_asset, video->video_file))
       {
-          Animator& animator = *element.GetComponent<Animator>();
-
-          if (!animator.should_play || FLX_STRING_GET(element.GetComponent<Animator>()->spritesheet_handle) == "") continue;
-
-          animator.frame_time += Application::GetCurrentWindow()->GetFramerateController().GetDeltaTime();
-
-          auto& asset_spritesheet = FLX_ASSET_GET(Asset::Spritesheet, FLX_STRING_GET(animator.spritesheet_handle));
-
-          // calculate the total frames
-          if (animator.total_frames != asset_spritesheet.columns * asset_spritesheet.rows)
-              animator.total_frames = asset_spritesheet.columns * asset_spritesheet.rows;
-
-          // TODO: debug why this is happening
-          if (animator.current_frame >= asset_spritesheet.frame_times.size()) animator.current_frame = 0;
+        model.Scale(Vector3(static_cast<float>(video_info->GetWidth()),
+          static_cast<float>(video_info->GetHeight()),
+          1.f));
+      }
 
-          // get the current frame time
-          animator.current_frame_time = asset_spritesheet.frame_times[animator.current_frame];
+      Matrix4x4 translation_matrix = Matrix4x4::Translate(Matrix4x4::Identity, position);
+      Matrix4x4 rotation_matrix = Quaternion::FromEulerAnglesDeg(rotation).ToRotationMatrix();
+      Matrix4x4 scale_matrix = Matrix4x4::Scale(Matrix4x4::Identity, scale);
 
-          // handling of animations
-          // move to the next frame
-          // loop if looping
-          // stop if not looping
-          // return to default and continue looping if return_to_default is true
-          if (animator.frame_time >= animator.current_frame_time)
-          {
-              // skip frames if needed
-              while (animator.frame_time >= animator.current_frame_time)
-              {
-                  animator.current_frame++;
-                  animator.frame_time -= animator.current_frame_time;
-              }
+      transform->transform = translation_matrix * rotation_matrix * scale_matrix * model;
+    }
+  }
 
-              // loop
-              if (animator.is_looping && animator.current_frame >= animator.total_frames)
-              {
-                  animator.current_frame = 0;
-              }
+  // Function: RenderingLayer::UpdateVideoPlayers
+  // Description: Advances the video players and decodes their next frames.
+  void RenderingLayer::UpdateVideoPlayers()
+  {
+    if (!CameraManager::has_main_camera) return;
 
-              // not looping
-              if (!animator.is_looping && animator.current_frame >= animator.total_frames)
-              {
-                  // return to default and continue looping
-                  if (animator.return_to_default)
-                  {
-                      animator.spritesheet_handle = animator.default_spritesheet_handle;
-                      animator.is_looping = true;
-                  }
-                  // stop at the last frame
-                  else
-                  {
-                      animator.current_frame = animator.total_frames - 1;
-                      animator.should_play = false;
-                  }
-              }
-          }
-      }
+    for (auto& element : FlexECS::Scene::GetActiveScene()->CachedQuery<VideoPlayer>())
+    {
+      float deltatime = Application::GetCurrentWindow()->GetFramerateController().GetDeltaTime();
+      VideoPlayer& video_player = *element.GetComponent<VideoPlayer>();
+      auto video_asset = FLX_ASSET_GET_CACHED(video_player.video_asset, video_player.video_file);
+      if (!video_asset) continue;
+      auto& video = *video_asset;
 
-      #pragma endregion
+      if (!video_player.should_play) continue;
 
-      #pragma region Video Player System
-      // Video player frame calculations
-      for (auto& element : FlexECS::Scene::GetActiveScene()->CachedQuery<VideoPlayer>())
+      video.m_current_time += deltatime * video_player.playback_speed;
+      if (video.m_current_time >= video.GetNextFrameTime())
       {
-        float deltatime = Application::GetCurrentWindow()->GetFramerateController().GetDeltaTime();
-        VideoPlayer& video_player = *element.GetComponent<VideoPlayer>();
-        if (FLX_STRING_GET(video_player.video_file) == "") continue;
-
-        auto& video = FLX_ASSET_GET(VideoDecoder, FLX_STRING_GET(video_player.video_file));
-
-        if (!video_player.should_play) continue;
-
-        video.m_current_time += deltatime * video_player.playback_speed;
-        if (video.m_current_time >= video.GetNextFrameTime())
+        if(!video.DecodeNextFrame())
         {
-          if(!video.DecodeNextFrame())
+          if (video_player.is_looping)
           {
-            if (video_player.is_looping)
-            {
-              video.RestartVideo();
-            }
-            //video.m_current_time = video.GetNextFrameTime();  //fake pause the video
+            video.RestartVideo();
           }
+          //video.m_current_time = video.GetNextFrameTime();  //fake pause the video
         }
       }
+    }
+  }
+
+  // Function: RenderingLayer::Update
+  // Description: Performs per-frame updates including transform calculations,
+  //              animator & video systems (run as a SystemSchedule), post-processing
+  //              update, and final rendering (batched or unbatched).
+  void RenderingLayer::Update()
+  {
+      FLX_MEMORY_TAG(Renderer);
+
+      #pragma region Systems
+      // Transforms, animators and video players, see BuildSystems for what each of them touches
+      m_systems.Run();
       #pragma endregion
 
+      if (!CameraManager::has_main_camera) return;
+
       PostProcessing::Update();
 
       #pragma region Render Game
@@ -213,24 +217,22 @@ namespace Game
 
       FunctionQueue game_queue;
 
-      if (!FlexPrefs::GetBool("game.batching"))
+      if (!EngineSettings::game_batching.Get())
       {
           FlexECS::Entity UICam = FlexECS::Scene::GetActiveScene()->GetEntityByName("UI Camera");
 
           #pragma region Sprite Renderer System
           auto ppIndex = PostProcessing::GetPostProcessZIndex();
           // render all sprites
-          for (auto& element : FlexECS::Scene::GetActiveScene()->CachedQuery<Transform, Sprite, Position, Rotation, Scale>())
+          for (auto& element : FlexECS::Scene::GetActiveScene()->ActiveQuery<Transform, Sprite, Position, Rotation, Scale>())
           {
-              if (!element.GetComponent<Transform>()->is_active) continue;
-
-              Sprite& sprite = *element.GetComponent<Sprite>();
+              const Sprite& sprite = *element.ReadComponent<Sprite>();
               Renderer2DProps props;
 
               // overload for animator
-              if (element.HasComponent<Animator>() && FLX_STRING_GET(element.GetComponent<Animator>()->spritesheet_handle) != "")
+              if (element.HasComponent<Animator>() && FLX_STRING_GET(element.ReadComponent<Animator>()->spritesheet_handle) != "")
               {
-                  Animator& animator = *element.GetComponent<Animator>();
+                  const Animator& animator = *element.ReadComponent<Animator>();
 
                   props.asset = FLX_STRING_GET(animator.spritesheet_handle);
                   props.texture_index = animator.current_frame;
@@ -265,10 +267,8 @@ namespace Game
           #pragma endregion
 
           #pragma region Render Video
-          for (auto& element : FlexECS::Scene::GetActiveScene()->CachedQuery<Transform, VideoPlayer, Position, Rotation, Scale>())
+          for (auto& element : FlexECS::Scene::GetActiveScene()->ActiveQuery<Transform, VideoPlayer, Position, Rotation, Scale>())
           {
-            if (!element.GetComponent<Transform>()->is_active) continue;
-
             VideoPlayer& video = *element.GetComponent<VideoPlayer>();
             Renderer2DProps props;
 
@@ -290,10 +290,8 @@ namespace Game
           #pragma region Text Renderer System
 
           // Text
-          for (auto& element : FlexECS::Scene::GetActiveScene()->CachedQuery<Text>())
+          for (auto& element : FlexECS::Scene::GetActiveScene()->ActiveQuery<Text>())
           {
-              if (!element.GetComponent<Transform>()->is_active) continue;
-
               const auto textComponent = element.GetComponent<Text>();
 
               Renderer2DText sample;
@@ -312,13 +310,15 @@ namespace Game
               // TODO: Need to convert text to similar to camera class
               // Temp
               sample.m_transform = Matrix4x4(
-                element.GetComponent<Scale>()->scale.x, 0.00, 0.00, 0.00, 0.00, element.GetComponent<Scale>()->scale.y, 0.00,
-                0.00, 0.00, 0.00, element.GetComponent<Scale>()->scale.z, 0.00, element.GetComponent<Position>()->position.x,
-                element.GetComponent<Position>()->position.y, element.GetComponent<Position>()->position.z, 1.00
+                element.ReadComponent<Scale>()->scale.x, 0.00, 0.00, 0.00, 0.00, element.ReadComponent<Scale>()->scale.y, 0.00,
+                0.00, 0.00, 0.00, element.ReadComponent<Scale>()->scale.z, 0.00, element.ReadComponent<Position>()->position.x,
+                element.ReadComponent<Position>()->position.y, element.ReadComponent<Position>()->position.z, 1.00
               );
               sample.m_alignment = std::pair{ static_cast<Renderer2DText::AlignmentX>(textComponent->alignment.first),
                                               static_cast<Renderer2DText::AlignmentY>(textComponent->alignment.second) };
               sample.m_textboxDimensions = textComponent->textboxDimensions;
+              sample.m_visible_glyphs = textComponent->visible_glyphs;
+              sample.m_glyph_fade = textComponent->glyph_fade;
               sample.m_linespacing = 12.0f;
 
               if (UICam != FlexECS::Entity::Null && index >= 1000)
@@ -339,11 +339,8 @@ namespace Game
           #pragma region Post Processing Render
          // Insert the global post-processing draw call into the game queue.
           Vector2 windowSize = Vector2((float)FlexEngine::Application::GetCurrentWindow()->GetWidth(), (float)FlexEngine::Application::GetCurrentWindow()->GetHeight());
-          for (auto& element : FlexECS::Scene::GetActiveScene()->CachedQuery<PostProcessingMarker>())
+          for (auto& element : FlexECS::Scene::GetActiveScene()->ActiveQuery<PostProcessingMarker>())
           {
-              if (!element.GetComponent<Transform>()->is_active)
-                  continue;
-
               Window::FrameBufferManager.SetCurrentFrameBuffer("Final Post Processing");
               GLuint texture = Window::FrameBufferManager.GetCurrentFrameBuffer()->GetColorAttachment();
               Matrix4x4 transform = element.GetComponent<Transform>()->transform;
@@ -365,23 +362,21 @@ namespace Game
       {
           #pragma region Batch Sprite Renderer System
 
-          FunctionQueue batch_render_queue;
-          std::vector<std::pair<std::string, FlexECS::Entity>> sortedEntities;
+          // the queue is flushed every frame, keeping it around reuses its storage
+          static FunctionQueue batch_render_queue;
+          // the keys point into the scene string storage, which is not modified while batching
+          FrameVector<std::pair<std::string_view, FlexECS::Entity>> sortedEntities;
           //Sprite
-          for (auto& entity : FlexECS::Scene::GetActiveScene()->CachedQuery<Transform, Sprite, Position, Rotation, Scale>())
+          for (auto& entity : FlexECS::Scene::GetActiveScene()->ActiveQuery<Transform, Sprite, Position, Rotation, Scale>())
           {
-              if (!entity.GetComponent<Transform>()->is_active) continue;
-
               if (entity.HasComponent<Animator>())
-                  sortedEntities.emplace_back(FLX_STRING_GET(entity.GetComponent<Animator>()->spritesheet_handle), entity);
+                  sortedEntities.emplace_back(FLX_STRING_GET(entity.ReadComponent<Animator>()->spritesheet_handle), entity);
               else
-                  sortedEntities.emplace_back(FLX_STRING_GET(entity.GetComponent<Sprite>()->sprite_handle), entity);
+                  sortedEntities.emplace_back(FLX_STRING_GET(entity.ReadComponent<Sprite>()->sprite_handle), entity);
           }
           //Text
-          for (auto& entity : FlexECS::Scene::GetActiveScene()->CachedQuery<Transform, Text, Position, Rotation, Scale>())
+          for (auto& entity : FlexECS::Scene::GetActiveScene()->ActiveQuery<Transform, Text, Position, Rotation, Scale>())
           {
-              if (!entity.GetComponent<Transform>()->is_active) continue;
-
               sortedEntities.emplace_back(FLX_STRING_GET(entity.GetComponent<Text>()->fonttype), entity);
           }
 
@@ -395,7 +390,7 @@ namespace Game
 
           //QUEUE
           Renderer2DSpriteBatch currentBatch;
-          std::string currentTexture = "";
+          std::string_view currentTexture = "";
 
           for (auto& [batchKey, entity] : sortedEntities)
           {
@@ -426,13 +421,15 @@ namespace Game
                       sample.m_fonttype = FLX_STRING_GET(textComponent->fonttype);
 
                       sample.m_transform = Matrix4x4(
-                        entity.GetComponent<Scale>()->scale.x, 0.00, 0.00, 0.00, 0.00, entity.GetComponent<Scale>()->scale.y, 0.00,
-                        0.00, 0.00, 0.00, entity.GetComponent<Scale>()->scale.z, 0.00, entity.GetComponent<Position>()->position.x,
-                        entity.GetComponent<Position>()->position.y, entity.GetComponent<Position>()->position.z, 1.00
+                        entity.ReadComponent<Scale>()->scale.x, 0.00, 0.00, 0.00, 0.00, entity.ReadComponent<Scale>()->scale.y, 0.00,
+                        0.00, 0.00, 0.00, entity.ReadComponent<Scale>()->scale.z, 0.00, entity.ReadComponent<Position>()->position.x,
+                        entity.ReadComponent<Position>()->position.y, entity.ReadComponent<Position>()->position.z, 1.00
                       );
                       sample.m_alignment = std::pair{ static_cast<Renderer2DText::AlignmentX>(textComponent->alignment.first),
                                                       static_cast<Renderer2DText::AlignmentY>(textComponent->alignment.second) };
                       sample.m_textboxDimensions = textComponent->textboxDimensions;
+                      sample.m_visible_glyphs = textComponent->visible_glyphs;
+                      sample.m_glyph_fade = textComponent->glyph_fade;
                       sample.m_linespacing = 12.0f;
                       batch_render_queue.Insert({ [sample]()
                                           {
@@ -466,12 +463,12 @@ namespace Game
   // Function: RenderingLayer::AddBatchToQueue
   // Description: Inserts a batched draw call into the provided queue using
   //              the current texture key and accumulated batch data.
-  void RenderingLayer::AddBatchToQueue(FunctionQueue& queue, const std::string& texture, const Renderer2DSpriteBatch& batch)
+  void RenderingLayer::AddBatchToQueue(FunctionQueue& queue, std::string_view texture, const Renderer2DSpriteBatch& batch)
   {
       if (!batch.m_zindex.empty())
       {
           Renderer2DProps props;
-          props.asset = texture;
+          props.asset = std::string(texture);
           //props.vbo_id = vbo_id;
           // Send camera data as parameter instead of ID.
           queue.Insert({ [props, batch]() { OpenGLRenderer::DrawBatchTexture2D(props, batch, *CameraManager::GetMainGameCamera()); }, "", batch.m_zindex.back() });
@@ -486,7 +483,7 @@ namespace Game
       auto z_index = entity.HasComponent<ZIndex>() ? entity.GetComponent<ZIndex>()->z : 0;
       batch.m_zindex.push_back(z_index);
       batch.m_transformationData.push_back(entity.GetComponent<Transform>()->transform);
-      batch.m_opacity.push_back(entity.GetComponent<Sprite>()->opacity);
+      batch.m_opacity.push_back(entity.ReadComponent<Sprite>()->opacity);
 
       //Checks for other components present that would influence batch
       //Color has been removed as it was not added in sprite component
@@ -498,14 +495,13 @@ namespace Game
       //    colorMul *= entity.GetComponent<Button>()->finalColorMul;
       //}
 
-      if (entity.HasComponent<Animator>() && FLX_STRING_GET(entity.GetComponent<Animator>()->spritesheet_handle) != "")
+      if (entity.HasComponent<Animator>() && FLX_STRING_GET(entity.ReadComponent<Animator>()->spritesheet_handle) != "")
       {
-          auto anim = entity.GetComponent<Animator>();
+          auto anim = entity.ReadComponent<Animator>();
 
           //batch.m_colorAddData.push_back(colorAdd + anim->color_to_add);
           //batch.m_colorMultiplyData.push_back(colorMul * anim->color_to_multiply);
-          auto& asset_spritesheet = FLX_ASSET_GET(Asset::Spritesheet, FLX_STRING_GET(entity.GetComponent<Animator>()->spritesheet_handle));
-          batch.m_UVmap.push_back(asset_spritesheet.GetUV(anim->current_frame)); //No choice, must do here, cannot be in engine
+          batch.m_UVmap.push_back(anim->current_uv); // written by the animator system
       }
       else
       {
@@ -36,8 +36,20 @@ namespace Game
     virtual void OnDetach() override;
     virtual void Update() override;
 
-    void AddBatchToQueue(FunctionQueue& queue, const std::string& texture, const Renderer2DSpriteBatch& batch);
+    void AddBatchToQueue(FunctionQueue& queue, std::string_view texture, const Renderer2DSpriteBatch& batch);
     void AddEntityToBatch(FlexECS::Entity& entity, Renderer2DSpriteBatch& batch);
+
+  private:
+    void BuildSystems();
+    void UpdateTransforms();
+    void UpdateVideoTransforms();
+    void UpdateVideoPlayers();
+
+    // Sprite transforms are only recomputed for the entities that changed since the last frame
+    FlexECS::ChangeCursor m_transform_cursor;
+
+    // The systems that run before rendering, built on attach
+    SystemSchedule m_systems{ "Rendering" };
   };
 
 }
@@ -22,8 +22,10 @@ namespace Game
     //              reset logo opacity, elapsed timers, and flags.
     void SplashScreenLayer::OnAttach()
     {
-        File& file = File::Open(Path::current("assets/saves/DigipenSplashScreen.flxscene"));
-        FlexECS::Scene::SetActiveScene(FlexECS::Scene::Load(file));
+        FlexECS::Scene::SetActiveScene(FlexECS::SceneLoader::Take(Path::current("assets/saves/DigipenSplashScreen.flxscene")));
+
+        // the menu is next, load it while the splash screen plays
+        FlexECS::SceneLoader::LoadAsync(Path::current("assets/saves/mainmenu_v10.flxscene"));
         CameraManager::TryMainCamera();
 
         auto activeScene = FlexECS::Scene::GetActiveScene();
@@ -81,6 +81,14 @@ namespace Game
     #pragma endregion
   }
 
+  // Grows the highlight of a pause menu button to its full width, at the speed the menu has always used.
+  void Slide_In_Pause_Button(FlexECS::Entity button) {
+    float full_width = button.ReadComponent<Slider>()->original_scale.x;
+    float width = button.ReadComponent<Scale>()->scale.x;
+    TweenSystem::KillAll(button);
+    if (width != full_width) TweenSystem::To(button, TweenField::ScaleX, full_width, (full_width - width) / 10.f);
+  }
+
   void Town_Pause_Functionality() {
     is_paused ^= true;
     FlexECS::Entity cam = CameraManager::GetMainGameCameraID();
@@ -98,14 +106,20 @@ namespace Game
       else state_to_set ^= true;
     }
 
-    if (is_paused) FlexECS::Scene::GetEntityByName("Resume Button Sprite").GetComponent<Transform>()->is_active = true;
+    if (is_paused) {
+      FlexECS::Scene::GetEntityByName("Resume Button Sprite").GetComponent<Transform>()->is_active = true;
+      Slide_In_Pause_Button(FlexECS::Scene::GetEntityByName(active_pause_button));
+      Slide_In_Pause_Button(FlexECS::Scene::GetEntityByName(active_volume_button));
+    }
   }
 
   void TownLayer::OnAttach()
   {
     //File& file = File::Open(Path::current("assets/saves/town_v4.flxscene"));
-    File& file = File::Open(Path::current(town_version));
-    FlexECS::Scene::SetActiveScene(FlexECS::Scene::Load(file));
+    FlexECS::Scene::SetActiveScene(FlexECS::SceneLoader::Take(Path::current(town_version)));
+
+    // every way out of town is a battle
+    FlexECS::SceneLoader::LoadAsync(Path::current("assets/saves/battlescene_v12.flxscene"));
 
     // Trigger music to start
     FlexECS::Scene::GetEntityByName("Town BGM").GetComponent<Audio>()->should_play = true;
@@ -451,6 +465,7 @@ namespace Game
           FlexECS::Scene::GetEntityByName(active_pause_sprite.first).GetComponent<Scale>()->scale.x = 0.f;
           FlexECS::Scene::GetEntityByName(active_pause_sprite.first).GetComponent<Transform>()->is_active = true;
           active_pause_button = active_pause_sprite.first;
+          Slide_In_Pause_Button(FlexECS::Scene::GetEntityByName(active_pause_button));
 
           if (active_pause_button != "Settings Button Sprite") {
             for (FlexECS::Entity entity : FlexECS::Scene::GetActiveScene()->CachedQuery<Transform, PauseUI, PauseHoverUI, SettingsUI>()) {
@@ -466,31 +481,16 @@ namespace Game
             FlexECS::Scene::GetEntityByName("Settings Button Sprite").GetComponent<Scale>()->scale.x = 0.f;
             FlexECS::Scene::GetEntityByName("Settings Button Sprite").GetComponent<Transform>()->is_active = true;
             active_pause_button = "Settings Button Sprite";
+            Slide_In_Pause_Button(FlexECS::Scene::GetEntityByName(active_pause_button));
           }
           FlexECS::Scene::GetEntityByName(active_volume_button).GetComponent<Transform>()->is_active = false;
           FlexECS::Scene::GetEntityByName(active_volume_sprite.first).GetComponent<Scale>()->scale.x = 0.f;
           FlexECS::Scene::GetEntityByName(active_volume_sprite.first).GetComponent<Transform>()->is_active = true;
           active_volume_button = active_volume_sprite.first;
+          Slide_In_Pause_Button(FlexECS::Scene::GetEntityByName(active_volume_button));
         }
       }
 
-      if (FlexECS::Scene::GetEntityByName(active_pause_button).GetComponent<Scale>()->scale.x !=
-          FlexECS::Scene::GetEntityByName(active_pause_button).GetComponent<Slider>()->original_scale.x) {
-        FlexECS::Scene::GetEntityByName(active_pause_button).GetComponent<Scale>()->scale.x +=
-          Application::GetCurrentWindow()->GetFramerateController().GetDeltaTime() * 10.f;
-        FlexECS::Scene::GetEntityByName(active_pause_button).GetComponent<Scale>()->scale.x =
-          std::clamp(FlexECS::Scene::GetEntityByName(active_pause_button).GetComponent<Scale>()->scale.x,
-          0.f, FlexECS::Scene::GetEntityByName(active_pause_button).GetComponent<Slider>()->original_scale.x);
-      }
-
-      if (FlexECS::Scene::GetEntityByName(active_volume_button).GetComponent<Scale>()->scale.x !=
-          FlexECS::Scene::GetEntityByName(active_volume_button).GetComponent<Slider>()->original_scale.x) {
-        FlexECS::Scene::GetEntityByName(active_volume_button).GetComponent<Scale>()->scale.x +=
-          Application::GetCurrentWindow()->GetFramerateController().GetDeltaTime() * 10.f;
-        FlexECS::Scene::GetEntityByName(active_volume_button).GetComponent<Scale>()->scale.x =
-          std::clamp(FlexECS::Scene::GetEntityByName(active_volume_button).GetComponent<Scale>()->scale.x,
-          0.f, FlexECS::Scene::GetEntityByName(active_volume_button).GetComponent<Slider>()->original_scale.x);
-      }
       return;
     }
     else {
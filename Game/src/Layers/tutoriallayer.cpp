@@ -429,8 +429,7 @@ namespace Game
     {
         //CameraManager::SetMainGameCameraID(FlexECS::Scene::GetEntityByName("Camera"));
 
-        File& file = File::Open(Path::current("assets/saves/battlescene_v3.flxscene"));
-        FlexECS::Scene::SetActiveScene(FlexECS::Scene::Load(file));
+        FlexECS::Scene::SetActiveScene(FlexECS::SceneLoader::Take(Path::current("assets/saves/battlescene_v3.flxscene")));
 
         #pragma region Load Battle Data
 
@@ -0,0 +1,32 @@
+// WLVERSE [https://wlverse.web.app]
+// tweenlayer.cpp
+// 
+// Tween layer for the game.
+// Runs before the rendering layer so that tweened fields are drawn in the same frame.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+// 
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#include "Layers.h"
+
+namespace Game
+{
+
+  void TweenLayer::OnAttach()
+  {
+  }
+
+  void TweenLayer::OnDetach()
+  {
+    TweenSystem::Clear();
+  }
+
+  void TweenLayer::Update()
+  {
+    TweenSystem::Update(Application::GetCurrentWindow()->GetFramerateController().GetDeltaTime());
+  }
+
+}
@@ -0,0 +1,31 @@
+// WLVERSE [https://wlverse.web.app]
+// tweenlayer.h
+// 
+// Tween layer for the game.
+//
+// AUTHORS
+// [100%] Chan Wen Loong (wenloong.c\@digipen.edu)
+//   - Main Author
+// 
+// Copyright (c) 2025 DigiPen, All rights reserved.
+
+#pragma once
+
+#include <FlexEngine.h>
+using namespace FlexEngine;
+
+namespace Game
+{
+
+  class TweenLayer : public FlexEngine::Layer
+  {
+  public:
+    TweenLayer() : Layer("Tween Layer") {}
+    ~TweenLayer() = default;
+
+    virtual void OnAttach() override;
+    virtual void OnDetach() override;
+    virtual void Update() override;
+  };
+
+}
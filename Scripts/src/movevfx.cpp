@@ -90,9 +90,8 @@ private:
     void UpdatePseudoColorEffect(float elapsedTime, float totalDuration)
     {
         bool enableEffect = elapsedTime < (totalDuration - 0.05f);
-        for (auto& entity : FlexECS::Scene::GetActiveScene()->CachedQuery<PostProcessingMarker, Transform>())
+        for (auto& entity : FlexECS::Scene::GetActiveScene()->ActiveQuery<PostProcessingMarker, Transform>())
         {
-            if (!entity.GetComponent<Transform>()->is_active) continue;
             if (!entity.HasComponent<PostProcessingColorGrading>())
                 entity.AddComponent<PostProcessingColorGrading>({});
 
@@ -121,9 +120,8 @@ private:
     void UpdateJackUltEffect(float elapsedTime, float totalDuration)
     {
         float progress = FlexMath::Clamp(elapsedTime / totalDuration, 0.0f, 1.0f);
-        for (auto& entity : FlexECS::Scene::GetActiveScene()->CachedQuery<PostProcessingMarker, Transform>())
+        for (auto& entity : FlexECS::Scene::GetActiveScene()->ActiveQuery<PostProcessingMarker, Transform>())
         {
-            if (!entity.GetComponent<Transform>()->is_active) continue;
             if (!entity.HasComponent<PostProcessingColorGrading>())
                 entity.AddComponent<PostProcessingColorGrading>({});
 
@@ -2991,4 +2991,2173 @@ namespace T_FlexID
 
   };
 
-}
\ No newline at end of file
+}
+namespace T_SpatialIndex
+{
+
+  // Deterministic boxes scattered over a large world
+  static std::vector<AABBTree::Box> GenerateBoxes(std::size_t count, uint32_t seed)
+  {
+    std::vector<AABBTree::Box> boxes;
+    boxes.reserve(count);
+
+    uint32_t state = seed;
+    auto next = [&state]() { state = state * 1664525u + 1013904223u; return (state >> 8) / float(1 << 24); };
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      float x = next() * 20000.0f;
+      float y = next() * 20000.0f;
+      float w = 8.0f + next() * 120.0f;
+      float h = 8.0f + next() * 120.0f;
+      boxes.push_back({ x, y, x + w, y + h });
+    }
+    return boxes;
+  }
+
+  TEST_CLASS(T_AABBTree)
+  {
+  public:
+
+    TEST_METHOD(T_InsertRemove_Validate)
+    {
+      AABBTree tree;
+      auto boxes = GenerateBoxes(2000, 1);
+
+      std::vector<int> proxies;
+      for (std::size_t i = 0; i < boxes.size(); ++i) proxies.push_back(tree.Insert(boxes[i], i));
+
+      Assert::IsTrue(tree.Validate());
+      Assert::AreEqual((size_t)2000, tree.GetProxyCount());
+
+      // remove every other leaf
+      for (std::size_t i = 0; i < proxies.size(); i += 2) tree.Remove(proxies[i]);
+
+      Assert::IsTrue(tree.Validate());
+      Assert::AreEqual((size_t)1000, tree.GetProxyCount());
+
+      tree.Clear();
+      Assert::AreEqual((size_t)0, tree.GetProxyCount());
+      Assert::AreEqual(0, tree.GetHeight());
+    }
+
+    TEST_METHOD(T_Balanced)
+    {
+      AABBTree tree;
+      auto boxes = GenerateBoxes(10000, 2);
+      for (std::size_t i = 0; i < boxes.size(); ++i) tree.Insert(boxes[i], i);
+
+      // a degenerate tree would be thousands of nodes tall
+      Assert::IsTrue(tree.GetHeight() < 40);
+    }
+
+    TEST_METHOD(T_Move_SmallMovementKeepsLeaf)
+    {
+      AABBTree tree(10.0f);
+      int proxy = tree.Insert({ 0, 0, 10, 10 }, 7);
+
+      Assert::IsFalse(tree.Move(proxy, { 2, 2, 12, 12 }));
+      Assert::IsTrue(tree.Move(proxy, { 100, 100, 110, 110 }));
+      Assert::IsTrue(tree.GetFatBox(proxy).Contains(AABBTree::Box{ 100, 100, 110, 110 }));
+      Assert::AreEqual((uint64_t)7, tree.GetUserData(proxy));
+      Assert::IsTrue(tree.Validate());
+    }
+
+    TEST_METHOD(T_SegmentOverlaps)
+    {
+      AABBTree::Box box = { 0, 0, 10, 10 };
+      Assert::IsTrue(AABBTree::SegmentOverlaps(box, -5, 5, 20, 0));
+      Assert::IsTrue(AABBTree::SegmentOverlaps(box, 5, 5, 0, 0));
+      Assert::IsFalse(AABBTree::SegmentOverlaps(box, -5, 15, 20, 0));
+      Assert::IsFalse(AABBTree::SegmentOverlaps(box, -5, 5, 4, 0));
+    }
+
+  };
+
+  TEST_CLASS(T_Queries)
+  {
+  public:
+
+    TEST_METHOD(T_Query_MatchesBruteForce)
+    {
+      SpatialIndex index;
+      auto boxes = GenerateBoxes(5000, 3);
+
+      index.BeginSync();
+      for (std::size_t i = 0; i < boxes.size(); ++i)
+        index.Update(i + 1, Vector2(boxes[i].min_x, boxes[i].min_y), Vector2(boxes[i].max_x, boxes[i].max_y));
+      index.EndSync();
+
+      auto probes = GenerateBoxes(200, 4);
+      for (auto& probe : probes)
+      {
+        // point
+        std::vector<SpatialIndex::EntityID> expected, actual;
+        for (std::size_t i = 0; i < boxes.size(); ++i)
+          if (boxes[i].Contains(probe.min_x, probe.min_y)) expected.push_back(i + 1);
+        index.QueryPoint(Vector2(probe.min_x, probe.min_y), actual);
+        std::sort(actual.begin(), actual.end());
+        Assert::IsTrue(expected == actual);
+
+        // rect
+        expected.clear(); actual.clear();
+        for (std::size_t i = 0; i < boxes.size(); ++i)
+          if (boxes[i].Overlaps(probe)) expected.push_back(i + 1);
+        index.QueryRect(Vector2(probe.min_x, probe.min_y), Vector2(probe.max_x, probe.max_y), actual);
+        std::sort(actual.begin(), actual.end());
+        Assert::IsTrue(expected == actual);
+
+        // ray
+        expected.clear(); actual.clear();
+        float dx = (probe.max_x - probe.min_x) * 10.0f;
+        float dy = (probe.max_y - probe.min_y) * 10.0f;
+        for (std::size_t i = 0; i < boxes.size(); ++i)
+          if (AABBTree::SegmentOverlaps(boxes[i], probe.min_x, probe.min_y, dx, dy)) expected.push_back(i + 1);
+        index.QueryRay(Vector2(probe.min_x, probe.min_y), Vector2(probe.min_x + dx, probe.min_y + dy), actual);
+        std::sort(actual.begin(), actual.end());
+        Assert::IsTrue(expected == actual);
+      }
+    }
+
+    TEST_METHOD(T_Pick_ZOrder)
+    {
+      SpatialIndex index;
+      index.BeginSync();
+      index.Update(1, Vector2(0, 0), Vector2(10, 10), 0.0f);
+      index.Update(2, Vector2(0, 0), Vector2(10, 10), 5.0f);
+      index.Update(3, Vector2(0, 0), Vector2(10, 10), 5.0f);
+      index.Update(4, Vector2(20, 20), Vector2(30, 30), 9.0f);
+      index.EndSync();
+
+      std::vector<SpatialIndex::EntityID> picked;
+      index.Pick(Vector2(5, 5), picked);
+
+      Assert::AreEqual((size_t)3, picked.size());
+      Assert::AreEqual((uint64_t)2, picked[0]);
+      Assert::AreEqual((uint64_t)3, picked[1]);
+      Assert::AreEqual((uint64_t)1, picked[2]);
+    }
+
+    TEST_METHOD(T_EndSync_RemovesStale)
+    {
+      SpatialIndex index;
+      index.BeginSync();
+      Assert::IsTrue(index.Update(1, Vector2(0, 0), Vector2(10, 10)));
+      Assert::IsTrue(index.Update(2, Vector2(0, 0), Vector2(10, 10)));
+      index.EndSync();
+
+      index.BeginSync();
+      Assert::IsFalse(index.Update(1, Vector2(50, 50), Vector2(60, 60)));
+      index.EndSync();
+
+      Assert::AreEqual((size_t)1, index.Size());
+      Assert::IsTrue(index.Contains(1));
+      Assert::IsFalse(index.Contains(2));
+
+      Vector2 min, max;
+      Assert::IsTrue(index.GetBounds(1, &min, &max));
+      AreEqualVector(Vector2(50, 50), min);
+      AreEqualVector(Vector2(60, 60), max);
+
+      std::vector<SpatialIndex::EntityID> picked;
+      index.QueryPoint(Vector2(5, 5), picked);
+      Assert::IsTrue(picked.empty());
+    }
+
+  };
+
+}
+
+namespace T_Reflection
+{
+
+  struct TestInner
+  { FLX_REFL_SERIALIZABLE
+    float x = 0.0f;
+    int y = 0;
+  };
+
+  struct TestOuter
+  { FLX_REFL_SERIALIZABLE
+    int a = 0;
+    unsigned b = 0;
+    int64_t c = 0;
+    uint64_t d = 0;
+    double e = 0.0;
+    float f = 0.0f;
+    bool g = false;
+    std::string h;
+    std::vector<TestInner> v;
+    std::unordered_map<std::string, int> m;
+    std::pair<int, std::string> p;
+    std::shared_ptr<TestInner> sp;
+    std::shared_ptr<TestInner> sn;
+  };
+
+  // Same as TestInner with the members swapped
+  struct TestInnerSwapped
+  { FLX_REFL_SERIALIZABLE
+    int y = 0;
+    float x = 0.0f;
+  };
+
+  FLX_REFL_REGISTER_START(TestInner)
+    FLX_REFL_REGISTER_PROPERTY(x)
+    FLX_REFL_REGISTER_PROPERTY(y)
+  FLX_REFL_REGISTER_END;
+
+  FLX_REFL_REGISTER_START(TestOuter)
+    FLX_REFL_REGISTER_PROPERTY(a)
+    FLX_REFL_REGISTER_PROPERTY(b)
+    FLX_REFL_REGISTER_PROPERTY(c)
+    FLX_REFL_REGISTER_PROPERTY(d)
+    FLX_REFL_REGISTER_PROPERTY(e)
+    FLX_REFL_REGISTER_PROPERTY(f)
+    FLX_REFL_REGISTER_PROPERTY(g)
+    FLX_REFL_REGISTER_PROPERTY(h)
+    FLX_REFL_REGISTER_PROPERTY(v)
+    FLX_REFL_REGISTER_PROPERTY(m)
+    FLX_REFL_REGISTER_PROPERTY(p)
+    FLX_REFL_REGISTER_PROPERTY(sp)
+    FLX_REFL_REGISTER_PROPERTY(sn)
+  FLX_REFL_REGISTER_END;
+
+  FLX_REFL_REGISTER_START(TestInnerSwapped)
+    FLX_REFL_REGISTER_PROPERTY(y)
+    FLX_REFL_REGISTER_PROPERTY(x)
+  FLX_REFL_REGISTER_END;
+
+  static TestOuter MakeTestOuter()
+  {
+    TestOuter o;
+    o.a = -123456;
+    o.b = 4000000000u;
+    o.c = -(1ll << 60);
+    o.d = ~0ull;
+    o.e = 3.25;
+    o.f = -1.5f;
+    o.g = true;
+    o.h = "he\"llo\n";
+    for (int i = 0; i < 100; ++i) o.v.push_back({ i * 0.5f, -i });
+    o.m["one"] = 1;
+    o.m["neg"] = -7;
+    o.p = { 9, "nine" };
+    o.sp = std::make_shared<TestInner>(TestInner{ 2.0f, 3 });
+    return o;
+  }
+
+  static void AreEqualTestOuter(const TestOuter& expected, const TestOuter& actual)
+  {
+    Assert::AreEqual(expected.a, actual.a);
+    Assert::AreEqual(expected.b, actual.b);
+    Assert::AreEqual(expected.c, actual.c);
+    Assert::AreEqual(expected.d, actual.d);
+    Assert::AreEqual(expected.e, actual.e);
+    Assert::AreEqual(expected.f, actual.f);
+    Assert::AreEqual(expected.g, actual.g);
+    Assert::AreEqual(expected.h, actual.h);
+    Assert::AreEqual(expected.v.size(), actual.v.size());
+    for (std::size_t i = 0; i < expected.v.size(); ++i)
+    {
+      Assert::AreEqual(expected.v[i].x, actual.v[i].x);
+      Assert::AreEqual(expected.v[i].y, actual.v[i].y);
+    }
+    Assert::IsTrue(expected.m == actual.m);
+    Assert::IsTrue(expected.p == actual.p);
+    Assert::AreEqual((bool)expected.sp, (bool)actual.sp);
+    if (expected.sp) Assert::AreEqual(expected.sp->y, actual.sp->y);
+    Assert::AreEqual((bool)expected.sn, (bool)actual.sn);
+  }
+
+  TEST_CLASS(T_BinaryStream)
+  {
+  public:
+
+    TEST_METHOD(T_VarUInt)
+    {
+      Reflection::BinaryWriter out;
+      for (uint64_t value : { 0ull, 127ull, 128ull, 16383ull, 16384ull, ~0ull }) out.WriteVarUInt(value);
+
+      // 1 + 1 + 2 + 2 + 3 + 10
+      Assert::AreEqual((size_t)19, out.Size());
+
+      Reflection::BinaryReader in(out.GetBuffer());
+      for (uint64_t value : { 0ull, 127ull, 128ull, 16383ull, 16384ull, ~0ull }) Assert::AreEqual(value, in.ReadVarUInt());
+      Assert::IsFalse(in.Failed());
+      Assert::AreEqual((size_t)0, in.Remaining());
+    }
+
+    TEST_METHOD(T_VarInt_ZigZag)
+    {
+      Reflection::BinaryWriter out;
+      out.WriteVarInt(-1);
+      Assert::AreEqual((size_t)1, out.Size());
+
+      for (int64_t value : std::initializer_list<int64_t>{ 0, 1, -64, 64, INT64_MIN, INT64_MAX }) out.WriteVarInt(value);
+
+      Reflection::BinaryReader in(out.GetBuffer());
+      Assert::AreEqual((int64_t)-1, in.ReadVarInt());
+      for (int64_t value : std::initializer_list<int64_t>{ 0, 1, -64, 64, INT64_MIN, INT64_MAX }) Assert::AreEqual(value, in.ReadVarInt());
+      Assert::IsFalse(in.Failed());
+    }
+
+    TEST_METHOD(T_ReadPastEnd)
+    {
+      Reflection::BinaryWriter out;
+      out.WriteString("hello");
+
+      Reflection::BinaryReader in(out.GetBuffer().data(), 3);
+      Assert::AreEqual(std::string(""), in.ReadString());
+      Assert::IsTrue(in.Failed());
+      Assert::AreEqual((uint64_t)0, in.ReadVarUInt());
+    }
+
+  };
+
+  TEST_CLASS(T_BinarySerializer)
+  {
+  public:
+
+    TEST_METHOD(T_RoundTrip)
+    {
+      TestOuter original = MakeTestOuter();
+      Reflection::TypeDescriptor* type_desc = Reflection::TypeResolver<TestOuter>::Get();
+
+      Reflection::BinaryWriter out;
+      type_desc->SerializeBinary(&original, out);
+
+      TestOuter loaded;
+      Reflection::BinaryReader in(out.GetBuffer());
+      type_desc->DeserializeBinary(&loaded, in);
+
+      Assert::IsFalse(in.Failed());
+      Assert::AreEqual((size_t)0, in.Remaining());
+      AreEqualTestOuter(original, loaded);
+    }
+
+    TEST_METHOD(T_MatchesJson)
+    {
+      TestOuter original = MakeTestOuter();
+      Reflection::TypeDescriptor* type_desc = Reflection::TypeResolver<TestOuter>::Get();
+
+      std::stringstream ss;
+      type_desc->Serialize(&original, ss);
+      Document document;
+      document.Parse(ss.str().c_str());
+      TestOuter from_json;
+      type_desc->Deserialize(&from_json, document);
+
+      Reflection::BinaryWriter out;
+      type_desc->SerializeBinary(&from_json, out);
+      TestOuter from_binary;
+      Reflection::BinaryReader in(out.GetBuffer());
+      type_desc->DeserializeBinary(&from_binary, in);
+
+      AreEqualTestOuter(from_json, from_binary);
+      Assert::IsTrue(out.Size() < ss.str().size());
+    }
+
+    TEST_METHOD(T_Truncated)
+    {
+      TestOuter original = MakeTestOuter();
+      Reflection::TypeDescriptor* type_desc = Reflection::TypeResolver<TestOuter>::Get();
+
+      Reflection::BinaryWriter out;
+      type_desc->SerializeBinary(&original, out);
+
+      // every prefix of the data must fail cleanly
+      for (std::size_t size = 0; size < out.Size(); ++size)
+      {
+        TestOuter loaded;
+        Reflection::BinaryReader in(out.GetBuffer().data(), size);
+        type_desc->DeserializeBinary(&loaded, in);
+        Assert::IsTrue(in.Failed());
+      }
+    }
+
+    TEST_METHOD(T_SchemaHash)
+    {
+      uint64_t inner = Reflection::TypeResolver<TestInner>::Get()->GetSchemaHash();
+      uint64_t swapped = Reflection::TypeResolver<TestInnerSwapped>::Get()->GetSchemaHash();
+      uint64_t vector_inner = Reflection::TypeResolver<std::vector<TestInner>>::Get()->GetSchemaHash();
+      uint64_t vector_swapped = Reflection::TypeResolver<std::vector<TestInnerSwapped>>::Get()->GetSchemaHash();
+
+      Assert::AreEqual(inner, Reflection::TypeResolver<TestInner>::Get()->GetSchemaHash());
+      Assert::AreNotEqual(inner, swapped);
+      Assert::AreNotEqual(vector_inner, vector_swapped);
+    }
+
+  };
+
+}
+
+namespace T_BattleSim
+{
+
+  using namespace BattleSim;
+  using Asset::MoveEffect;
+  using Asset::MoveTarget;
+
+  static MoveData MakeMove(int speed, std::vector<Asset::MoveOp> ops)
+  {
+    MoveData move;
+    move.name = "Test Move";
+    move.speed = speed;
+    move.ops = std::move(ops);
+    return move;
+  }
+
+  static CharacterData MakeCharacter(int id, int slot, int health, int speed, std::vector<MoveData> moves)
+  {
+    CharacterData character;
+    character.name = "Character " + std::to_string(id);
+    character.character_id = id;
+    character.slot = slot;
+    character.health = health;
+    character.speed = speed;
+    character.moves = std::move(moves);
+    return character;
+  }
+
+  // Two drifters against three enemies with a mix of effects, close enough to
+  // the real battles that both sides win some of the time
+  static BattleData MakeMixedBattle()
+  {
+    BattleData battle;
+    battle.name = "Mixed";
+    battle.characters = {
+      MakeCharacter(1, 0, 60, 4, {
+        MakeMove(8, { { MoveEffect::Damage, MoveTarget::Single_Enemy, 12 } }),
+        MakeMove(10, { { MoveEffect::Damage, MoveTarget::Adjacent_Enemies, 6 }, { MoveEffect::Speed_Down, MoveTarget::Adjacent_Enemies, 3 } }),
+        MakeMove(6, { { MoveEffect::Attack_Up, MoveTarget::Self, 2 } })
+      }),
+      MakeCharacter(2, 1, 50, 6, {
+        MakeMove(9, { { MoveEffect::Heal, MoveTarget::Single_Ally, 10 } }),
+        MakeMove(8, { { MoveEffect::Damage, MoveTarget::Next_Enemy, 8 }, { MoveEffect::Stun, MoveTarget::Next_Enemy, 1 } }),
+        MakeMove(7, { { MoveEffect::Shield, MoveTarget::All_Allies, 1 } })
+      }),
+      MakeCharacter(3, 0, 40, 5, {
+        MakeMove(8, { { MoveEffect::Damage, MoveTarget::Single_Enemy, 9 } }),
+        MakeMove(9, { { MoveEffect::Attack_Down, MoveTarget::All_Enemies, 2 } }),
+        MakeMove(12, { { MoveEffect::Damage, MoveTarget::All_Enemies, 5 } })
+      }),
+      MakeCharacter(3, 1, 40, 7, {
+        MakeMove(8, { { MoveEffect::Damage, MoveTarget::Single_Enemy, 9 } }),
+        MakeMove(9, { { MoveEffect::Protect, MoveTarget::All_Allies, 2 } }),
+        MakeMove(10, { { MoveEffect::Strip, MoveTarget::Single_Enemy, 0 }, { MoveEffect::Damage, MoveTarget::Single_Enemy, 4 } })
+      }),
+      MakeCharacter(4, 2, 70, 9, {
+        MakeMove(12, { { MoveEffect::Damage, MoveTarget::Single_Enemy, 15 } }),
+        MakeMove(10, { { MoveEffect::Heal, MoveTarget::All_Allies, 15 } }),
+        MakeMove(14, { { MoveEffect::Cleanse, MoveTarget::All_Allies, 0 }, { MoveEffect::Speed_Up, MoveTarget::All_Allies, 4 } })
+      })
+    };
+    return battle;
+  }
+
+  // One drifter with one move against one enemy with one move, so the battle
+  // plays out the same way for every seed
+  static BattleData MakeDuel(MoveData drifter_move, int enemy_health, int enemy_speed, MoveData enemy_move)
+  {
+    BattleData battle;
+    battle.name = "Duel";
+    battle.characters = {
+      MakeCharacter(1, 0, 100, 1, { drifter_move }),
+      MakeCharacter(3, 0, enemy_health, enemy_speed, { enemy_move })
+    };
+    return battle;
+  }
+
+  TEST_CLASS(T_MoveOps)
+  {
+  public:
+
+    TEST_METHOD(T_Parse)
+    {
+      Assert::IsTrue(Asset::ParseMoveEffect("Damage") == MoveEffect::Damage);
+      Assert::IsTrue(Asset::ParseMoveEffect("Attack_Down") == MoveEffect::Attack_Down);
+      Assert::IsTrue(Asset::ParseMoveEffect("Cleanse") == MoveEffect::Cleanse);
+      Assert::IsTrue(Asset::ParseMoveEffect("damage") == MoveEffect::Unknown);
+      Assert::IsTrue(Asset::ParseMoveTarget("ADJACENT_ENEMIES") == MoveTarget::Adjacent_Enemies);
+      Assert::IsTrue(Asset::ParseMoveTarget("SELF") == MoveTarget::Self);
+      Assert::IsTrue(Asset::ParseMoveTarget("") == MoveTarget::Unknown);
+    }
+
+    // Only the first target decides the side
+    TEST_METHOD(T_TargetsAllies)
+    {
+      Assert::IsFalse(Asset::TargetsAllies({}));
+      Assert::IsTrue(Asset::TargetsAllies({ { MoveEffect::Heal, MoveTarget::Single_Ally, 10 }, { MoveEffect::Damage, MoveTarget::All_Enemies, 5 } }));
+      Assert::IsTrue(Asset::TargetsAllies({ { MoveEffect::Attack_Up, MoveTarget::Self, 2 } }));
+      Assert::IsFalse(Asset::TargetsAllies({ { MoveEffect::Damage, MoveTarget::Single_Enemy, 10 }, { MoveEffect::Heal, MoveTarget::Self, 5 } }));
+    }
+
+  };
+
+  TEST_CLASS(T_BattleState)
+  {
+  public:
+
+    // Moves 1, 2, 3, then a basic attack, then the sequence again
+    TEST_METHOD(T_BossScript)
+    {
+      BattleState::BossScript script;
+      for (int expected : { 1, 2, 3, 1, 1, 2, 3, 1 }) Assert::AreEqual(expected, script.NextMove());
+    }
+
+    TEST_METHOD(T_DeadLeaveTheSpeedBar)
+    {
+      std::vector<BattleState::Combatant> characters(3);
+      std::vector<BattleState::Combatant*> speed_bar;
+      for (int i = 0; i < 3; ++i)
+      {
+        characters[i].character_id = i + 1;
+        characters[i].health = 10;
+        characters[i].speed = 5 + i;
+        BattleState::Reset(characters[i]);
+        speed_bar.push_back(&characters[i]);
+      }
+
+      characters[0].current_health = 0;
+      characters[0].shield_buff_duration = 2;
+      Assert::IsTrue(BattleState::CheckDeath(characters[0], speed_bar));
+      Assert::IsFalse(BattleState::CheckDeath(characters[1], speed_bar));
+      Assert::AreEqual(0, characters[0].shield_buff_duration);
+      Assert::AreEqual((size_t)2, speed_bar.size());
+
+      Assert::IsTrue(BattleState::AdvanceSpeedBar(speed_bar) == &characters[1]);
+      Assert::AreEqual(0, characters[1].current_speed);
+      Assert::AreEqual(1, characters[2].current_speed);
+    }
+
+  };
+
+  TEST_CLASS(T_Rules)
+  {
+  public:
+
+    // The attack buff adds half the damage.
+    // The enemy is too slow to act, so the drifter attacks every turn.
+    TEST_METHOD(T_AttackBuff)
+    {
+      MoveData idle = MakeMove(10, {});
+
+      BattleData plain = MakeDuel(MakeMove(10, { { MoveEffect::Damage, MoveTarget::Next_Enemy, 10 } }), 30, 1000, idle);
+      Result result = Simulate(plain, 1);
+      Assert::IsTrue(result.outcome == Outcome::Win);
+      Assert::AreEqual(3, result.turns);
+
+      BattleData buffed = MakeDuel(MakeMove(10, { { MoveEffect::Attack_Up, MoveTarget::Self, 1 }, { MoveEffect::Damage, MoveTarget::Next_Enemy, 10 } }), 30, 1000, idle);
+      result = Simulate(buffed, 1);
+      Assert::IsTrue(result.outcome == Outcome::Win);
+      Assert::AreEqual(2, result.turns);
+    }
+
+    TEST_METHOD(T_ShieldBlocksDamage)
+    {
+      BattleData battle = MakeDuel(
+        MakeMove(10, { { MoveEffect::Shield, MoveTarget::Next_Enemy, 1 }, { MoveEffect::Damage, MoveTarget::Next_Enemy, 100 } }),
+        10, 1000, MakeMove(10, {})
+      );
+      Result result = Simulate(battle, 1, 20);
+      Assert::IsTrue(result.outcome == Outcome::Draw);
+      Assert::AreEqual(20, result.turns);
+      Assert::AreEqual(1, result.enemies_alive);
+    }
+
+    // The enemy acts on the second turn and would defeat the drifter unless it is stunned.
+    TEST_METHOD(T_StunSkipsTurn)
+    {
+      MoveData enemy_move = MakeMove(10, { { MoveEffect::Damage, MoveTarget::Next_Enemy, 100 } });
+
+      BattleData plain = MakeDuel(MakeMove(10, { { MoveEffect::Damage, MoveTarget::Next_Enemy, 1 } }), 50, 5, enemy_move);
+      Result result = Simulate(plain, 1, 2);
+      Assert::IsTrue(result.outcome == Outcome::Lose);
+      Assert::AreEqual(0, result.drifters_alive);
+
+      BattleData stunned = MakeDuel(MakeMove(10, { { MoveEffect::Stun, MoveTarget::Next_Enemy, 1 }, { MoveEffect::Damage, MoveTarget::Next_Enemy, 1 } }), 50, 5, enemy_move);
+      result = Simulate(stunned, 1, 2);
+      Assert::IsTrue(result.outcome == Outcome::Draw);
+      Assert::AreEqual(1, result.drifters_alive);
+    }
+
+  };
+
+  TEST_CLASS(T_Simulation)
+  {
+  public:
+
+    TEST_METHOD(T_SameSeedSameResult)
+    {
+      BattleData battle = MakeMixedBattle();
+      for (uint64_t seed = 0; seed < 100; ++seed)
+      {
+        Result a = Simulate(battle, seed);
+        Result b = Simulate(battle, seed);
+        Assert::IsTrue(a.outcome == b.outcome);
+        Assert::AreEqual(a.turns, b.turns);
+        Assert::AreEqual(a.drifters_alive, b.drifters_alive);
+        Assert::AreEqual(a.enemies_alive, b.enemies_alive);
+      }
+    }
+
+    // The summary must not depend on how the batch was split
+    TEST_METHOD(T_ThreadCountDoesNotChangeResults)
+    {
+      BattleData battle = MakeMixedBattle();
+      Summary single = SimulateMany(battle, 42, 2000, 1);
+      Summary multi = SimulateMany(battle, 42, 2000, 4);
+
+      Assert::AreEqual(2000, single.battles);
+      Assert::AreEqual(single.battles, multi.battles);
+      Assert::AreEqual(single.wins, multi.wins);
+      Assert::AreEqual(single.losses, multi.losses);
+      Assert::AreEqual(single.draws, multi.draws);
+      Assert::AreEqual(single.total_turns, multi.total_turns);
+      Assert::AreEqual(single.total_drifters_alive, multi.total_drifters_alive);
+      Assert::IsTrue(single.turn_counts == multi.turn_counts);
+      Assert::AreEqual(single.TurnPercentile(0.9), multi.TurnPercentile(0.9));
+    }
+
+    TEST_METHOD(T_Percentile)
+    {
+      Summary summary;
+      for (int turns = 1; turns <= 100; ++turns) summary.Add({ Outcome::Win, turns, 1, 0 });
+      Assert::AreEqual(50, summary.TurnPercentile(0.5));
+      Assert::AreEqual(90, summary.TurnPercentile(0.9));
+      Assert::AreEqual(100, summary.TurnPercentile(1.0));
+      Assert::AreEqual(1.0, summary.WinRate());
+    }
+
+  };
+
+}
+
+namespace T_Scripting
+{
+
+  class CountingScript : public IScript
+  {
+  public:
+    std::string name;
+    int updates = 0;
+    FlexECS::Entity last = FlexECS::Entity::Null;
+
+    explicit CountingScript(const std::string& _name) : name(_name) {}
+
+    void Update() override { updates++; last = self; }
+    std::string GetName() const override { return name; }
+  };
+
+  TEST_CLASS(T_ScriptRegistry)
+  {
+  public:
+
+    TEST_METHOD_CLEANUP(Cleanup)
+    {
+      ScriptRegistry::ClearScripts();
+    }
+
+    TEST_METHOD(T_Slots)
+    {
+      ScriptRegistry::ClearScripts();
+      CountingScript a("A"), b("B"), duplicate("A");
+
+      uint32_t generation = ScriptRegistry::GetGeneration();
+      ScriptRegistry::RegisterScript(&a);
+      ScriptRegistry::RegisterScript(&b);
+      ScriptRegistry::RegisterScript(&duplicate);
+      Assert::AreNotEqual(generation, ScriptRegistry::GetGeneration());
+
+      Assert::AreEqual(std::size_t(2), ScriptRegistry::GetSlotCount());
+      Assert::AreEqual(0, ScriptRegistry::GetScriptSlot("A"));
+      Assert::AreEqual(1, ScriptRegistry::GetScriptSlot("B"));
+      Assert::AreEqual(-1, ScriptRegistry::GetScriptSlot("C"));
+      Assert::IsTrue(ScriptRegistry::GetScriptBySlot(0) == &a);
+      Assert::IsTrue(ScriptRegistry::GetScriptBySlot(2) == nullptr);
+      Assert::IsTrue(ScriptRegistry::GetScriptBySlot(-1) == nullptr);
+
+      // a reload invalidates every cached slot
+      generation = ScriptRegistry::GetGeneration();
+      ScriptRegistry::ClearScripts();
+      Assert::AreNotEqual(generation, ScriptRegistry::GetGeneration());
+      Assert::AreEqual(-1, ScriptRegistry::GetScriptSlot("A"));
+    }
+
+    // The default UpdateBatch sets the context and calls Update for each entity
+    TEST_METHOD(T_DefaultUpdateBatch)
+    {
+      CountingScript script("A");
+      std::vector<FlexECS::Entity> entities = { FlexECS::Entity(1), FlexECS::Entity(2), FlexECS::Entity(3) };
+
+      script.UpdateBatch(entities);
+      Assert::AreEqual(3, script.updates);
+      Assert::IsTrue(script.last == entities.back());
+    }
+
+  };
+
+}
+
+namespace T_Audio
+{
+
+  enum Group { Music = 0, Effects = 1 };
+
+  // stand-in channels, the pool only stores the pointers
+  static int channel_storage[16];
+  static void* Channel(int i) { return &channel_storage[i]; }
+
+  TEST_CLASS(T_VoicePool)
+  {
+  public:
+
+    TEST_METHOD(T_HandlesGoStale)
+    {
+      VoicePool pool(4, 2);
+      void* stolen = nullptr;
+
+      VoicePool::Handle a = pool.Acquire(Effects, VoicePool::DEFAULT_PRIORITY, stolen);
+      Assert::AreNotEqual(VoicePool::INVALID_HANDLE, a);
+      pool.SetChannel(a, Channel(0));
+      Assert::IsTrue(pool.GetChannel(a) == Channel(0));
+
+      pool.Release(a);
+      Assert::IsFalse(pool.IsValid(a));
+      Assert::IsTrue(pool.GetChannel(a) == nullptr);
+
+      // the slot is reused, the old handle must not resolve to the new voice
+      VoicePool::Handle b = pool.Acquire(Effects, VoicePool::DEFAULT_PRIORITY, stolen);
+      Assert::AreNotEqual(a, b);
+      Assert::IsFalse(pool.IsValid(a));
+      Assert::IsTrue(pool.IsValid(b));
+
+      // releasing a stale handle does nothing
+      pool.Release(a);
+      Assert::IsTrue(pool.IsValid(b));
+      Assert::IsFalse(pool.IsValid(VoicePool::INVALID_HANDLE));
+    }
+
+    TEST_METHOD(T_GroupLimitStealsOldest)
+    {
+      VoicePool pool(8, 2);
+      pool.SetGroupLimit(Effects, 2);
+      void* stolen = nullptr;
+
+      VoicePool::Handle first = pool.Acquire(Effects, 128, stolen);
+      pool.SetChannel(first, Channel(0));
+      VoicePool::Handle second = pool.Acquire(Effects, 128, stolen);
+      pool.SetChannel(second, Channel(1));
+      VoicePool::Handle music = pool.Acquire(Music, 128, stolen);
+      pool.SetChannel(music, Channel(2));
+
+      VoicePool::Handle third = pool.Acquire(Effects, 128, stolen);
+      Assert::IsTrue(pool.IsValid(third));
+      Assert::IsTrue(stolen == Channel(0));
+      Assert::IsFalse(pool.IsValid(first));
+      Assert::IsTrue(pool.IsValid(second));
+      Assert::IsTrue(pool.IsValid(music)); // other groups are never stolen from when the group is full
+      Assert::AreEqual(std::size_t(2), pool.GetGroupCount(Effects));
+      Assert::AreEqual(std::size_t(1), pool.GetStats().stolen);
+    }
+
+    TEST_METHOD(T_PriorityProtectsVoices)
+    {
+      VoicePool pool(8, 2);
+      pool.SetGroupLimit(Effects, 2);
+      void* stolen = nullptr;
+
+      VoicePool::Handle important = pool.Acquire(Effects, 0, stolen);
+      VoicePool::Handle filler = pool.Acquire(Effects, 200, stolen);
+
+      // a less important sound is rejected instead of cutting anything off
+      Assert::AreEqual(VoicePool::INVALID_HANDLE, pool.Acquire(Effects, 250, stolen));
+      Assert::IsTrue(stolen == nullptr);
+      Assert::AreEqual(std::size_t(1), pool.GetStats().rejected);
+
+      // a more important sound steals the least important voice
+      VoicePool::Handle urgent = pool.Acquire(Effects, 10, stolen);
+      Assert::IsTrue(pool.IsValid(urgent));
+      Assert::IsTrue(pool.IsValid(important));
+      Assert::IsFalse(pool.IsValid(filler));
+    }
+
+    TEST_METHOD(T_ReleaseAll)
+    {
+      VoicePool pool(4, 2);
+      void* stolen = nullptr;
+      for (int i = 0; i < 3; ++i) pool.SetChannel(pool.Acquire(i % 2, 128, stolen), Channel(i));
+
+      std::vector<void*> channels = pool.ReleaseAll();
+      Assert::AreEqual(std::size_t(3), channels.size());
+      Assert::AreEqual(std::size_t(0), pool.GetStats().playing);
+      Assert::AreEqual(std::size_t(3), pool.GetStats().peak);
+    }
+
+  };
+
+  TEST_CLASS(T_LoadPolicy)
+  {
+  public:
+
+    TEST_METHOD(T_ChooseLoadPolicy)
+    {
+      using Policy = Asset::Sound::LoadPolicy;
+      const std::uintmax_t small = 64 * 1024;
+      const std::uintmax_t large = Asset::Sound::STREAM_THRESHOLD_BYTES;
+
+      Assert::IsTrue(Asset::Sound::ChooseLoadPolicy("/audio/bgm/menu (Timeout).mp3", small) == Policy::Stream);
+      Assert::IsTrue(Asset::Sound::ChooseLoadPolicy("\\audio\\bgm\\town.mp3", small) == Policy::Stream);
+      Assert::IsTrue(Asset::Sound::ChooseLoadPolicy("/audio/StartCutscene_Audio.wav", large) == Policy::Stream);
+      Assert::IsTrue(Asset::Sound::ChooseLoadPolicy("/audio/ButtonHover.wav", small) == Policy::Decompressed);
+      Assert::IsTrue(Asset::Sound::ChooseLoadPolicy("/audio/hover.MP3", small) == Policy::CompressedInMemory);
+    }
+
+  };
+
+}
+
+namespace T_Headless
+{
+
+  TEST_CLASS(T_CommandLine)
+  {
+  public:
+
+    TEST_METHOD(T_ParseCommandLine)
+    {
+      char exe[] = "Game.exe";
+      char headless[] = "--headless";
+      char frames[] = "--frames";
+      char frame_count[] = "600";
+      char timings[] = "--timings";
+      char timings_path[] = "soak.csv";
+      char other[] = "--something-else";
+
+      // defaults stay when the options are not given
+      char* none[] = { exe };
+      Headless::Options options;
+      Assert::IsTrue(Headless::ParseCommandLine(1, none, options));
+      Assert::IsFalse(options.enabled);
+      Assert::AreEqual(uint64_t(0), options.max_frames);
+      Assert::AreEqual(std::string("frame_timings.csv"), options.timings_path);
+
+      // unrelated options are left for other parsers
+      char* all[] = { exe, other, headless, frames, frame_count, timings, timings_path };
+      options = {};
+      Assert::IsTrue(Headless::ParseCommandLine(7, all, options));
+      Assert::IsTrue(options.enabled);
+      Assert::AreEqual(uint64_t(600), options.max_frames);
+      Assert::AreEqual(std::string("soak.csv"), options.timings_path);
+
+      // missing or malformed values fail
+      char* missing[] = { exe, headless, frames };
+      options = {};
+      Assert::IsFalse(Headless::ParseCommandLine(3, missing, options));
+
+      char* malformed[] = { exe, frames, timings_path };
+      options = {};
+      Assert::IsFalse(Headless::ParseCommandLine(3, malformed, options));
+
+      char spike[] = "--spike-ms";
+      char spike_ms[] = "20.5";
+      char* spikes[] = { exe, headless, spike, spike_ms };
+      options = {};
+      Assert::IsTrue(Headless::ParseCommandLine(4, spikes, options));
+      Assert::AreEqual(20.5, options.spike_ms);
+
+      // allocation tracking is off unless a report is asked for
+      Assert::IsTrue(options.memory_report_path.empty());
+      char memory[] = "--memory-report";
+      char memory_path[] = "memory.csv";
+      char* report[] = { exe, headless, memory, memory_path };
+      Assert::IsTrue(Headless::ParseCommandLine(4, report, options));
+      Assert::AreEqual(std::string("memory.csv"), options.memory_report_path);
+
+      char* report_missing[] = { exe, headless, memory };
+      Assert::IsFalse(Headless::ParseCommandLine(3, report_missing, options));
+
+      // the null backend is used unless the calls are recorded
+      Assert::IsFalse(options.record_gl);
+      char record[] = "--record-gl";
+      char* recorded[] = { exe, headless, record };
+      Assert::IsTrue(Headless::ParseCommandLine(3, recorded, options));
+      Assert::IsTrue(options.record_gl);
+    }
+
+  };
+
+}
+
+namespace T_FrameTimeHistogram
+{
+
+  TEST_CLASS(T_Stats)
+  {
+  public:
+
+    TEST_METHOD(T_WholeRun)
+    {
+      FrameTimeHistogram histogram;
+      histogram.SetSpikeThreshold(20.0);
+
+      // 98 frames of 10 ms, one of 30 ms and one of 400 ms (past the last bucket)
+      for (int i = 0; i < 98; ++i) histogram.Add(10.0);
+      histogram.Add(30.0);
+      histogram.Add(400.0);
+
+      FrameTimeHistogram::Stats stats = histogram.GetStats();
+      Assert::AreEqual(uint64_t(100), stats.frames);
+      Assert::AreEqual(uint64_t(2), stats.spikes);
+      Assert::AreEqual(10.0, stats.p50_ms, 0.1);
+      Assert::AreEqual(10.0, stats.p95_ms, 0.1);
+      Assert::AreEqual(30.0, stats.p99_ms, 0.1);
+      Assert::AreEqual(400.0, stats.max_ms);
+      Assert::AreEqual(14.1, stats.average_ms, 0.001);
+    }
+
+    TEST_METHOD(T_RollingWindow)
+    {
+      FrameTimeHistogram histogram(4);
+      histogram.SetSpikeThreshold(20.0);
+
+      histogram.Add(50.0);
+      histogram.Add(5.0);
+      Assert::AreEqual(uint64_t(1), histogram.GetStats().spikes);
+      Assert::AreEqual(50.0, histogram.Max());
+
+      // the 50 ms frame falls out of the window
+      for (int i = 0; i < 3; ++i) histogram.Add(5.0);
+
+      FrameTimeHistogram::Stats stats = histogram.GetStats();
+      Assert::AreEqual(uint64_t(4), stats.frames);
+      Assert::AreEqual(uint64_t(0), stats.spikes);
+      Assert::AreEqual(5.0, stats.max_ms);
+      Assert::AreEqual(5.0, stats.p99_ms, 0.1);
+      Assert::AreEqual(5.0, stats.average_ms, 0.001);
+
+      // changing the threshold recounts what is in the window
+      histogram.SetSpikeThreshold(4.0);
+      Assert::AreEqual(uint64_t(4), histogram.GetStats().spikes);
+
+      histogram.Clear();
+      Assert::AreEqual(uint64_t(0), histogram.GetFrameCount());
+      Assert::AreEqual(0.0, histogram.Percentile(0.5));
+    }
+
+  };
+
+}
+
+namespace T_AssetHandle
+{
+
+  TEST_CLASS(T_AssetManager)
+  {
+  public:
+
+    TEST_METHOD(T_Handles)
+    {
+      AssetKey key = std::string(1, Path::separator) + "unittests" + Path::separator + "handle.png";
+      AssetManager::assets.emplace(key, Asset::Texture());
+
+      // missing keys and other types do not resolve
+      Assert::IsFalse(AssetManager::GetHandle<Asset::Texture>("/unittests/missing.png").IsValid());
+      Assert::IsFalse(AssetManager::GetHandle<Asset::Sound>("/unittests/handle.png").IsValid());
+
+      // either separator gives the same handle
+      AssetHandle<Asset::Texture> handle = AssetManager::GetHandle<Asset::Texture>("/unittests/handle.png");
+      Assert::IsTrue(handle.IsValid());
+      Assert::IsTrue(handle == AssetManager::GetHandle<Asset::Texture>("\\unittests\\handle.png"));
+      Assert::IsTrue(AssetManager::Resolve(handle) == &AssetManager::Get<Asset::Texture>(key));
+      Assert::AreEqual(key, AssetManager::GetKey(handle));
+
+      // the cached get fills an empty cache and keeps it while the key is the same
+      AssetHandle<Asset::Texture> cache;
+      Assert::IsTrue(&AssetManager::Get(cache, "/unittests/handle.png") == AssetManager::Resolve(handle));
+      Assert::IsTrue(cache == handle);
+
+      cache.generation++;
+      AssetManager::Get(cache, "/unittests/handle.png");
+      Assert::IsTrue(cache == handle);
+
+      // the component cache only reads the key when the key index changes
+      CachedAssetHandle<Asset::Texture> component_cache;
+      int key_reads = 0;
+      auto get_key = [&]() -> const AssetKey& { key_reads++; return key; };
+      Assert::IsTrue(AssetManager::Get(component_cache, 7, get_key) == AssetManager::Resolve(handle));
+      Assert::IsTrue(AssetManager::Get(component_cache, 7, get_key) == AssetManager::Resolve(handle));
+      Assert::AreEqual(1, key_reads);
+
+      AssetManager::Get(component_cache, 8, get_key);
+      Assert::AreEqual(2, key_reads);
+
+      const AssetKey empty_key;
+      Assert::IsTrue(AssetManager::Get(component_cache, 9, [&]() -> const AssetKey& { return empty_key; }) == nullptr);
+      Assert::IsFalse(component_cache.handle.IsValid());
+
+      // reference counts
+      AssetManager::AddRef(handle);
+      AssetManager::AddRef(handle);
+      AssetManager::Release(handle);
+      Assert::AreEqual(uint32_t(1), AssetManager::GetRefCount(handle));
+
+      // unloading invalidates every handle
+      AssetManager::Unload();
+      Assert::IsTrue(AssetManager::Resolve(handle) == nullptr);
+      Assert::AreEqual(uint32_t(0), AssetManager::GetRefCount(handle));
+      Assert::IsTrue(AssetManager::GetKey(handle).empty());
+
+      AssetHandle<Asset::Texture> new_handle = AssetManager::GetHandle<Asset::Texture>("/unittests/handle.png");
+      Assert::IsTrue(new_handle.IsValid());
+      Assert::IsTrue(new_handle != handle);
+
+      AssetManager::assets.erase(key);
+    }
+
+  };
+
+}
+
+namespace T_AssetArchive
+{
+
+  TEST_CLASS(T_LZ4)
+  {
+  public:
+
+    TEST_METHOD(T_RoundTrip)
+    {
+      // repetitive pixels, text and a run long enough for the extra length bytes
+      std::string data;
+      for (int i = 0; i < 1000; ++i) data += "\x00\x00\x00\xff\x12\x34\x56\xff";
+      data += "The quick brown fox jumps over the lazy dog. The quick brown fox.";
+      data += std::string(5000, 'a');
+
+      std::vector<char> compressed(LZ4::CompressBound(data.size()));
+      std::size_t compressed_size = LZ4::Compress(data.data(), data.size(), compressed.data(), compressed.size());
+      Assert::IsTrue(compressed_size != 0 && compressed_size < data.size() / 10);
+
+      std::string decompressed(data.size(), '\0');
+      Assert::IsTrue(LZ4::Decompress(compressed.data(), compressed_size, decompressed.data(), decompressed.size()));
+      Assert::IsTrue(decompressed == data);
+
+      // too small to hold the worst case
+      Assert::AreEqual(std::size_t(0), LZ4::Compress(data.data(), data.size(), compressed.data(), 16));
+
+      // truncated blocks and the wrong size are rejected
+      Assert::IsFalse(LZ4::Decompress(compressed.data(), compressed_size / 2, decompressed.data(), decompressed.size()));
+      Assert::IsFalse(LZ4::Decompress(compressed.data(), compressed_size, decompressed.data(), decompressed.size() - 1));
+
+      // small inputs are stored as literals
+      std::string tiny = "flx";
+      std::size_t tiny_size = LZ4::Compress(tiny.data(), tiny.size(), compressed.data(), compressed.size());
+      std::string tiny_out(tiny.size(), '\0');
+      Assert::IsTrue(LZ4::Decompress(compressed.data(), tiny_size, tiny_out.data(), tiny_out.size()));
+      Assert::IsTrue(tiny_out == tiny);
+    }
+
+  };
+
+  TEST_CLASS(T_Archive)
+  {
+  public:
+
+    TEST_METHOD(T_CookAndRead)
+    {
+      std::filesystem::path directory = std::filesystem::temp_directory_path() / "flx_unittests_archive";
+      std::filesystem::remove_all(directory);
+      std::filesystem::create_directories(directory / "data");
+
+      std::string move_text = "name: Slash\ndescription: unit test move\n";
+      for (int i = 0; i < 32; ++i) move_text += "target: enemy\n";
+      std::ofstream(directory / "data" / "slash.flxmove", std::ios::binary) << move_text;
+      std::ofstream(directory / "data" / "music.mp3", std::ios::binary) << "not cooked";
+
+      std::filesystem::path archive_path = directory / "assets.flxpak";
+      AssetArchive::CookStats stats;
+      Assert::IsTrue(AssetArchive::Cook(Path(directory), archive_path, stats));
+      Assert::AreEqual(std::size_t(1), stats.text);
+      Assert::AreEqual(std::size_t(1), stats.loose);
+
+      AssetArchive archive;
+      Assert::IsTrue(archive.Open(Path(archive_path)));
+      Assert::AreEqual(std::size_t(1), archive.GetEntryCount());
+
+      // either separator finds the entry, sounds are left loose
+      const AssetArchive::Entry* entry = archive.Find("/data/slash.flxmove");
+      Assert::IsTrue(entry != nullptr);
+      Assert::IsTrue(entry == archive.Find("\\data\\slash.flxmove"));
+      Assert::IsTrue(entry->compression == AssetArchive::Compression::LZ4);
+      Assert::IsTrue(archive.Find("/data/music.mp3") == nullptr);
+
+      std::string text;
+      Assert::IsTrue(archive.ReadText(*entry, text));
+      Assert::IsTrue(text == move_text);
+
+      archive.Close();
+      std::filesystem::remove_all(directory);
+    }
+
+    TEST_METHOD(T_LargeTexturesKeepTheirSourceFile)
+    {
+      std::filesystem::path directory = std::filesystem::temp_directory_path() / "flx_unittests_archive_png";
+      std::filesystem::remove_all(directory);
+      std::filesystem::create_directories(directory / "images");
+
+      // 256x256 white 1-bit png, 108 bytes for 256 KB of RGBA pixels
+      const unsigned char png[] = {
+        0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52, 0x00, 0x00,
+        0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x74, 0x09, 0x95, 0xcb, 0x00, 0x00, 0x00,
+        0x33, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xed, 0xca, 0xa1, 0x01, 0x00, 0x00, 0x0c, 0x02, 0x20, 0xff, 0x7f,
+        0x5a, 0x4f, 0x58, 0x5d, 0x80, 0x4c, 0x7a, 0x88, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20,
+        0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0xc2, 0xef, 0x30, 0xf3, 0xd2,
+        0xe1, 0xd2, 0x3c, 0xcf, 0xf1, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
+      };
+      std::ofstream(directory / "images" / "white.png", std::ios::binary).write(reinterpret_cast<const char*>(png), sizeof(png));
+
+      std::filesystem::path archive_path = directory / "assets.flxpak";
+      AssetArchive::CookStats stats;
+      Assert::IsTrue(AssetArchive::Cook(Path(directory), archive_path, stats));
+      Assert::AreEqual(std::size_t(1), stats.textures);
+      Assert::AreEqual(std::size_t(1), stats.encoded_textures);
+
+      // even LZ4 pixels would be many times the png, so the png itself is stored
+      AssetArchive archive;
+      Assert::IsTrue(archive.Open(Path(archive_path)));
+      const AssetArchive::Entry* entry = archive.Find("/images/white.png");
+      Assert::IsTrue(entry != nullptr);
+      Assert::IsTrue(entry->type == AssetArchive::EntryType::EncodedTexture);
+      Assert::AreEqual(256u, entry->width);
+      Assert::AreEqual(256u, entry->height);
+
+      std::string bytes;
+      Assert::IsTrue(archive.ReadText(*entry, bytes));
+      Assert::IsTrue(bytes == std::string(reinterpret_cast<const char*>(png), sizeof(png)));
+
+      archive.Close();
+      std::filesystem::remove_all(directory);
+    }
+
+  };
+
+}
+
+namespace T_FrameArena
+{
+
+  TEST_CLASS(T_LinearArena)
+  {
+  public:
+
+    TEST_METHOD(T_AllocateAndReset)
+    {
+      LinearArena arena(256);
+
+      char* a = static_cast<char*>(arena.Allocate(3, 1));
+      double* b = static_cast<double*>(arena.Allocate(sizeof(double), alignof(double)));
+      Assert::IsTrue(reinterpret_cast<uintptr_t>(b) % alignof(double) == 0);
+      Assert::IsTrue(reinterpret_cast<char*>(b) > a);
+      Assert::AreEqual(std::size_t(16), arena.GetUsed());
+
+      // past the block, the rest of the frame goes to an overflow block
+      void* c = arena.Allocate(300, 16);
+      Assert::IsTrue(c != nullptr);
+      Assert::IsTrue(reinterpret_cast<uintptr_t>(c) % 16 == 0);
+      Assert::AreEqual(uint64_t(1), arena.GetOverflowCount());
+
+      // the block grows to fit the whole frame
+      std::size_t used = arena.GetUsed();
+      arena.Reset();
+      Assert::AreEqual(std::size_t(0), arena.GetUsed());
+      Assert::AreEqual(used, arena.GetHighWaterMark());
+      Assert::IsTrue(arena.GetCapacity() >= used);
+
+      // the same frame again fits
+      arena.Allocate(3, 1);
+      arena.Allocate(sizeof(double), alignof(double));
+      arena.Allocate(300, 16);
+      Assert::AreEqual(uint64_t(1), arena.GetOverflowCount());
+    }
+
+    TEST_METHOD(T_FrameVector)
+    {
+      LinearArena arena(1024);
+
+      FrameVector<int> numbers{ FrameAllocator<int>(arena) };
+      for (int i = 0; i < 100; ++i) numbers.push_back(i);
+      int sum = 0;
+      for (int number : numbers) sum += number;
+      Assert::AreEqual(4950, sum);
+      Assert::IsTrue(arena.GetUsed() >= 100 * sizeof(int));
+
+      // copies share the arena
+      FrameVector<int> copy = numbers;
+      Assert::IsTrue(copy.get_allocator() == numbers.get_allocator());
+
+      // without an arena the allocator uses the heap
+      FrameVector<int> heap{ FrameAllocator<int>(nullptr) };
+      std::size_t used = arena.GetUsed();
+      heap.assign(64, 7);
+      Assert::AreEqual(used, arena.GetUsed());
+    }
+
+  };
+
+}
+
+namespace T_HeapCounter
+{
+
+  TEST_CLASS(T_Tracking)
+  {
+  public:
+
+    TEST_METHOD_CLEANUP(Cleanup)
+    {
+      HeapCounter::SetTracking(false);
+    }
+
+    TEST_METHOD(T_TagsAndSnapshots)
+    {
+      HeapCounter::SetTracking(true);
+      HeapCounter::Snapshot before = HeapCounter::TakeSnapshot();
+
+      void* tagged = nullptr;
+      {
+        FLX_MEMORY_TAG(Scripting);
+        Assert::IsTrue(HeapCounter::GetCurrentTag() == MemoryTag::Scripting);
+        {
+          // scopes nest
+          FLX_MEMORY_TAG(Strings);
+          Assert::IsTrue(HeapCounter::GetCurrentTag() == MemoryTag::Strings);
+        }
+        tagged = HeapCounter::Allocate(1000);
+      }
+      Assert::IsTrue(HeapCounter::GetCurrentTag() == MemoryTag::Untagged);
+
+      HeapCounter::Snapshot during = HeapCounter::TakeSnapshot();
+      HeapCounter::Snapshot diff = HeapCounter::Diff(before, during);
+      Assert::AreEqual(int64_t(1000), diff[MemoryTag::Scripting].live_bytes);
+      Assert::AreEqual(int64_t(1), diff[MemoryTag::Scripting].live_allocations);
+      Assert::IsTrue(during[MemoryTag::Scripting].peak_bytes >= 1000);
+
+      // freed after tracking is turned off, still subtracted from its tag
+      HeapCounter::SetTracking(false);
+      HeapCounter::Free(tagged);
+      diff = HeapCounter::Diff(before, HeapCounter::TakeSnapshot());
+      Assert::AreEqual(int64_t(0), diff[MemoryTag::Scripting].live_bytes);
+      Assert::AreEqual(int64_t(1), diff[MemoryTag::Scripting].allocations);
+
+      // untracked blocks are ignored
+      void* untracked = HeapCounter::Allocate(64);
+      HeapCounter::Free(untracked);
+      Assert::AreEqual(int64_t(0), HeapCounter::Diff(before, HeapCounter::TakeSnapshot()).Total().live_bytes);
+
+      HeapCounter::AddExternal(MemoryTag::AssetSound, 4096);
+      Assert::AreEqual(int64_t(4096), HeapCounter::Diff(before, HeapCounter::TakeSnapshot())[MemoryTag::AssetSound].external_bytes);
+      HeapCounter::AddExternal(MemoryTag::AssetSound, -4096);
+    }
+
+  };
+
+}
+
+namespace T_SceneTemplateCache
+{
+
+  TEST_CLASS(T_Clone)
+  {
+  public:
+
+    TEST_METHOD_CLEANUP(Cleanup)
+    {
+      FlexECS::Scene::SetActiveScene(FlexECS::Scene::Null);
+    }
+
+    TEST_METHOD(T_CloneIsIndependent)
+    {
+      std::shared_ptr<FlexECS::Scene> original = std::make_shared<FlexECS::Scene>();
+      FlexECS::Scene::SetActiveScene(original);
+
+      FlexECS::Entity entity = FlexECS::Scene::CreateEntity("Clone Test");
+      entity.AddComponent<Position>({ Vector3(1.0f, 2.0f, 3.0f) });
+
+      std::shared_ptr<FlexECS::Scene> clone = original->Clone();
+      entity.GetComponent<Position>()->position = Vector3(5.0f, 6.0f, 7.0f);
+      FLX_STRING_GET(*entity.GetComponent<EntityName>()) = "Renamed";
+
+      FlexECS::Scene::SetActiveScene(clone);
+      Assert::AreEqual(1.0f, entity.GetComponent<Position>()->position.x);
+      Assert::AreEqual(std::string("Clone Test"), FLX_STRING_GET(*entity.GetComponent<EntityName>()));
+
+      // structural changes follow the clone's own archetypes
+      entity.AddComponent<Scale>({ Vector3(2.0f, 2.0f, 2.0f) });
+      entity.RemoveComponent<Position>();
+      Assert::IsTrue(entity.HasComponent<Scale>());
+      Assert::IsFalse(entity.HasComponent<Position>());
+
+      FlexECS::Scene::SetActiveScene(original);
+      Assert::IsFalse(entity.HasComponent<Scale>());
+      Assert::AreEqual(5.0f, entity.GetComponent<Position>()->position.x);
+    }
+
+  };
+
+}
+
+namespace T_SceneLoad
+{
+
+  TEST_CLASS(T_ComponentDefaults)
+  {
+  public:
+
+    TEST_METHOD_CLEANUP(Cleanup)
+    {
+      FlexECS::Scene::SetActiveScene(FlexECS::Scene::Null);
+    }
+
+    TEST_METHOD(T_UnserializedMembersKeepDefaults)
+    {
+      std::filesystem::path directory = std::filesystem::temp_directory_path() / "flx_unittests_scene";
+      std::filesystem::create_directories(directory);
+
+      for (FlxFmtEncoding encoding : { FlxFmtEncoding::Json, FlxFmtEncoding::Binary })
+      {
+        std::shared_ptr<FlexECS::Scene> scene = std::make_shared<FlexECS::Scene>();
+        FlexECS::Scene::SetActiveScene(scene);
+        FlexECS::Entity entity = FlexECS::Scene::CreateEntity("Dialogue");
+        entity.AddComponent<Text>({});
+        entity.AddComponent<Script>({});
+        entity.GetComponent<Script>()->script_slot = 7;
+        entity.AddComponent<Sprite>({});
+        entity.GetComponent<Sprite>()->sprite_asset = { { 3, 2 }, 5 };
+        entity.AddComponent<Animator>({});
+        entity.GetComponent<Animator>()->spritesheet_asset = { { 4, 1 }, 6 };
+        entity.GetComponent<Animator>()->current_uv = Vector4(0.5f, 0.5f, 0.25f, 0.25f);
+        entity.AddComponent<VideoPlayer>({});
+        entity.GetComponent<VideoPlayer>()->video_asset = { { 2, 9 }, 8 };
+        entity.AddComponent<Audio>({});
+        entity.GetComponent<Audio>()->voice = 12;
+
+        File file;
+        file.path = Path(directory / "defaults.flxscene");
+        scene->Save(file, encoding);
+
+        // the loaded components never ran their constructors before the fix
+        std::shared_ptr<FlexECS::Scene> loaded = FlexECS::Scene::Load(file);
+        FlexECS::Scene::SetActiveScene(loaded);
+        Assert::IsTrue(entity.HasComponent<Text>());
+        Assert::IsTrue(entity.ReadComponent<Text>()->visible_glyphs < 0.0f);
+        Assert::AreEqual(0.0f, entity.ReadComponent<Text>()->glyph_fade);
+
+        // the cached script slot is looked up again by name after a load
+        const Script& script = *entity.ReadComponent<Script>();
+        Assert::AreEqual(-1, script.script_slot);
+        Assert::AreEqual(0u, script.script_slot_generation);
+
+        // cached asset handles belong to the asset manager that made them
+        Assert::IsTrue(entity.ReadComponent<Sprite>()->sprite_asset == CachedAssetHandle<Asset::Texture>{});
+        Assert::IsTrue(entity.ReadComponent<Animator>()->spritesheet_asset == CachedAssetHandle<Asset::Spritesheet>{});
+        Assert::IsTrue(entity.ReadComponent<VideoPlayer>()->video_asset == CachedAssetHandle<VideoDecoder>{});
+
+        // a voice handle from the saved scene would stop or move an unrelated sound
+        Assert::AreEqual(0u, entity.ReadComponent<Audio>()->voice);
+
+        // stopped animators are skipped by the write back and render with this rect as is
+        Assert::IsTrue(entity.ReadComponent<Animator>()->current_uv == Vector4(0.0f, 0.0f, 1.0f, 1.0f));
+      }
+
+      std::filesystem::remove_all(directory);
+    }
+
+  };
+
+}
+
+namespace T_OpenGLState
+{
+
+  TEST_CLASS(T_Recorder)
+  {
+  public:
+
+    TEST_METHOD(T_RedundantBindsAreSkipped)
+    {
+      // the recorder only runs on 64-bit builds
+      if (!OpenGLRecorder::Install()) return;
+
+      // a frame that keeps binding the same state
+      for (int i = 0; i < 10; ++i)
+      {
+        OpenGLState::UseProgram(3);
+        OpenGLState::BindTexture(5, 1);
+        OpenGLState::BindVertexArray(7);
+        OpenGLState::SetBlending(true);
+        OpenGLState::SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+      }
+      OpenGLRecorder::NewFrame();
+
+      OpenGLRecorder::Counts counts = OpenGLRecorder::GetCountsLastFrame();
+      Assert::AreEqual(uint64_t(1), counts.use_program);
+      Assert::AreEqual(uint64_t(1), counts.bind_texture);
+      Assert::AreEqual(uint64_t(1), counts.active_texture);
+      Assert::AreEqual(uint64_t(1), counts.bind_vertex_array);
+      Assert::AreEqual(uint64_t(2), counts.blend);
+
+      // a deleted id can be reused, so it is bound again
+      GLuint vertex_array = 7;
+      OpenGLState::DeleteVertexArrays(1, &vertex_array);
+      OpenGLState::BindVertexArray(7);
+      OpenGLState::BindTexture(5, 1);
+
+      // after an invalidate everything reaches OpenGL once more
+      OpenGLState::Invalidate();
+      OpenGLState::UseProgram(3);
+      OpenGLState::UseProgram(3);
+      OpenGLRecorder::NewFrame();
+
+      counts = OpenGLRecorder::GetCountsLastFrame();
+      Assert::AreEqual(uint64_t(1), counts.bind_vertex_array);
+      Assert::AreEqual(uint64_t(0), counts.bind_texture);
+      Assert::AreEqual(uint64_t(1), counts.use_program);
+    }
+
+  };
+
+}
+
+namespace T_PostProcessGraph
+{
+
+  TEST_CLASS(T_Compile)
+  {
+  public:
+
+    TEST_METHOD(T_FusesPerPixelEffects)
+    {
+      Renderer2D_GlobalPPSettings settings;
+      settings.enableChromaticAberration = true;
+      settings.enableColorGrading = true;
+      settings.enableVignette = true;
+      settings.enableFilmGrain = true;
+      settings.enableWarp = true;
+
+      PostProcessGraph graph;
+      Assert::IsTrue(graph.Compile(PostProcessGraph::Describe(settings), true));
+
+      // chromatic aberration heads the per-pixel effects, warp needs their result
+      const auto& passes = graph.GetPasses();
+      Assert::AreEqual(size_t(2), passes.size());
+      Assert::AreEqual(size_t(4), passes[0].fused.size());
+      Assert::IsTrue(passes[0].inputs[0] == PostProcessGraph::SOURCE);
+      Assert::IsTrue(passes[1].fused.front() == PostProcessGraph::Effect::Warp);
+      Assert::IsTrue(passes[1].output == PostProcessGraph::DESTINATION);
+      Assert::AreEqual(uint32_t(1), graph.GetTargetCount());
+
+      // unchanged settings are not compiled again
+      Assert::IsFalse(graph.Compile(PostProcessGraph::Describe(settings), true));
+
+      std::string shader = PostProcessGraph::GenerateFusedShader(passes[0].fused);
+      Assert::IsTrue(shader.find("fx_ChromaticAberration(tex_coord)") != std::string::npos);
+      Assert::IsTrue(shader.find("fx_FilmGrain(color, tex_coord)") != std::string::npos);
+      Assert::IsTrue(shader.find("fx_Warp") == std::string::npos);
+    }
+
+    TEST_METHOD(T_BloomReusesTargets)
+    {
+      Renderer2D_GlobalPPSettings settings;
+      settings.enableBloom = true;
+      settings.bloomBlurPasses = 5;
+
+      PostProcessGraph graph;
+      graph.Compile(PostProcessGraph::Describe(settings), false);
+
+      // brightness, five blurs and the composite
+      const auto& passes = graph.GetPasses();
+      Assert::AreEqual(size_t(7), passes.size());
+      Assert::IsTrue(passes.front().type == PostProcessGraph::PassType::BrightnessExtract);
+      Assert::IsTrue(passes.back().type == PostProcessGraph::PassType::BloomComposite);
+
+      // the composite reads the source and the last blur in each direction
+      const PostProcessGraph::Pass& composite = passes.back();
+      Assert::IsTrue(composite.inputs[0] == PostProcessGraph::SOURCE);
+      Assert::IsTrue(composite.inputs[1] == passes[5].output);
+      Assert::IsTrue(composite.inputs[2] == passes[4].output);
+
+      // the blurs ping-pong between two targets, the composite needs a third
+      Assert::AreEqual(uint32_t(3), graph.GetTargetCount());
+      Assert::IsTrue(graph.GetResult() == composite.output);
+      for (const PostProcessGraph::Pass& pass : passes)
+      {
+        for (uint8_t i = 0; i < pass.input_count; ++i) Assert::IsTrue(pass.inputs[i] != pass.output);
+      }
+
+      // no effects, the source is the result
+      graph.Compile(PostProcessGraph::Describe(Renderer2D_GlobalPPSettings()), true);
+      Assert::IsTrue(graph.GetPasses().empty());
+      Assert::IsTrue(graph.GetResult() == PostProcessGraph::SOURCE);
+    }
+
+  };
+
+}
+
+namespace T_ActiveState
+{
+
+  TEST_CLASS(T_ActiveQuery)
+  {
+  public:
+
+    TEST_METHOD_CLEANUP(Cleanup)
+    {
+      FlexECS::Scene::SetActiveScene(FlexECS::Scene::Null);
+    }
+
+    TEST_METHOD(T_SkipsInactiveEntitiesAndChildren)
+    {
+      std::shared_ptr<FlexECS::Scene> scene = std::make_shared<FlexECS::Scene>();
+      FlexECS::Scene::SetActiveScene(scene);
+
+      FlexECS::Entity root = FlexECS::Scene::CreateEntity("Root");
+      root.AddComponent<Transform>({});
+      root.AddComponent<Position>({});
+
+      FlexECS::Entity child = FlexECS::Scene::CreateEntity("Child");
+      child.AddComponent<Transform>({});
+      child.AddComponent<Position>({});
+      child.AddComponent<Parent>({ root });
+
+      FlexECS::Entity other = FlexECS::Scene::CreateEntity("Other");
+      other.AddComponent<Transform>({});
+      other.AddComponent<Position>({});
+
+      auto contains = [](const FrameVector<FlexECS::Entity>& entities, FlexECS::Entity entity)
+      {
+        return std::find(entities.begin(), entities.end(), entity) != entities.end();
+      };
+
+      Assert::AreEqual(size_t(3), FlexECS::Scene::GetActiveScene()->ActiveQuery<Position>().size());
+
+      // disabling the root hides its child, but not the child's own state
+      root.SetActive(false);
+      auto active = FlexECS::Scene::GetActiveScene()->ActiveQuery<Position>();
+      Assert::AreEqual(size_t(1), active.size());
+      Assert::IsTrue(contains(active, other));
+      Assert::IsTrue(child.IsActiveSelf());
+      Assert::IsFalse(child.IsActive());
+
+      // the cached query still returns everything
+      Assert::AreEqual(size_t(3), FlexECS::Scene::GetActiveScene()->CachedQuery<Position>().size());
+
+      // toggling does not move the entity, it is back as soon as it is enabled
+      root.SetActive(true);
+      other.SetActive(false);
+      active = FlexECS::Scene::GetActiveScene()->ActiveQuery<Position>();
+      Assert::AreEqual(size_t(2), active.size());
+      Assert::IsTrue(contains(active, root));
+      Assert::IsTrue(contains(active, child));
+      Assert::IsFalse(contains(active, other));
+    }
+
+  };
+
+}
+
+namespace T_ChangeTicks
+{
+
+  TEST_CLASS(T_ChangedQuery)
+  {
+  public:
+
+    TEST_METHOD_CLEANUP(Cleanup)
+    {
+      FlexECS::Scene::SetActiveScene(FlexECS::Scene::Null);
+    }
+
+    TEST_METHOD(T_OnlyWrittenRowsAreReturned)
+    {
+      std::shared_ptr<FlexECS::Scene> scene = std::make_shared<FlexECS::Scene>();
+      FlexECS::Scene::SetActiveScene(scene);
+
+      std::vector<FlexECS::Entity> entities;
+      for (int i = 0; i < 4; ++i)
+      {
+        FlexECS::Entity entity = FlexECS::Scene::CreateEntity("Entity " + std::to_string(i));
+        entity.AddComponent<Position>({});
+        entity.AddComponent<Scale>({});
+        entities.push_back(entity);
+      }
+
+      FlexECS::ChangeCursor cursor;
+      auto query = [&]() { return scene->ChangedQuery<FlexECS::Changed<Position>, Position, Scale>(cursor); };
+      auto added_query = [&](FlexECS::ChangeCursor& added_cursor) { return scene->ChangedQuery<FlexECS::Added<Scale>, Position, Scale>(added_cursor); };
+
+      // everything is new the first time, nothing the second
+      Assert::AreEqual(size_t(4), query().size());
+      Assert::AreEqual(size_t(0), query().size());
+
+      // reads don't count, writes do, and so do writes to components outside the filter
+      entities[0].ReadComponent<Position>();
+      entities[1].GetComponent<Scale>()->scale.x = 2.0f;
+      Assert::AreEqual(size_t(0), query().size());
+
+      entities[2].GetComponent<Position>()->position.x = 1.0f;
+      auto changed = query();
+      Assert::AreEqual(size_t(1), changed.size());
+      Assert::IsTrue(changed[0] == entities[2]);
+
+      // the ticks follow their rows when another entity is swapped into its place
+      FlexECS::ChangeCursor added_cursor;
+      added_query(added_cursor);
+      entities[3].GetComponent<Position>()->position.x = 1.0f;
+      FlexECS::Scene::DestroyEntity(entities[0]);
+      changed = query();
+      Assert::AreEqual(size_t(1), changed.size());
+      Assert::IsTrue(changed[0] == entities[3]);
+
+      // moving to another archetype keeps the ticks, the new component counts as added
+      entities[1].AddComponent<Rotation>({});
+      Assert::AreEqual(size_t(0), query().size());
+      Assert::AreEqual(size_t(0), added_query(added_cursor).size());
+
+      FlexECS::Entity late = FlexECS::Scene::CreateEntity("Late");
+      late.AddComponent<Position>({});
+      late.AddComponent<Scale>({});
+      auto added = added_query(added_cursor);
+      Assert::AreEqual(size_t(1), added.size());
+      Assert::IsTrue(added[0] == late);
+
+      // a clone is a different scene, the cursor starts over
+      FlexECS::Scene::SetActiveScene(scene->Clone());
+      Assert::AreEqual(size_t(4), FlexECS::Scene::GetActiveScene()->ChangedQuery<FlexECS::Changed<Position>, Position, Scale>(cursor).size());
+    }
+
+  };
+
+}
+
+namespace T_Tween
+{
+
+  TEST_CLASS(T_TweenSystem)
+  {
+  public:
+
+    TEST_METHOD_CLEANUP(Cleanup)
+    {
+      TweenSystem::Clear();
+      FlexECS::Scene::SetActiveScene(FlexECS::Scene::Null);
+    }
+
+    TEST_METHOD(T_TweensWriteFieldsAndQueueCallbacks)
+    {
+      FlexECS::Scene::SetActiveScene(std::make_shared<FlexECS::Scene>());
+      FlexECS::Entity entity = FlexECS::Scene::CreateEntity("Button");
+      entity.AddComponent<Position>({});
+      entity.AddComponent<Sprite>({});
+      entity.GetComponent<Sprite>()->opacity = 0.25f;
+
+      int completed = 0;
+      TweenHandle move = TweenSystem::To(entity, TweenVector::Position, Vector3(10.0f, 20.0f, 0.0f), 1.0f);
+      TweenSystem::OnComplete(move, [&]() { completed++; });
+      TweenSystem::FromTo(entity, TweenField::Opacity, 1.0f, 0.0f, 2.0f, Ease::InQuad, 0.75f);
+      Assert::AreEqual(size_t(4), TweenSystem::GetLaneCount());
+
+      // the fade is still waiting for its delay and leaves the opacity alone
+      TweenSystem::Update(0.5f);
+      Assert::AreEqual(5.0f, entity.ReadComponent<Position>()->position.x);
+      Assert::AreEqual(10.0f, entity.ReadComponent<Position>()->position.y);
+      Assert::AreEqual(0.25f, entity.ReadComponent<Sprite>()->opacity);
+
+      TweenSystem::Update(0.5f);
+      Assert::AreEqual(10.0f, entity.ReadComponent<Position>()->position.x);
+      Assert::AreEqual(1, completed);
+      Assert::IsFalse(TweenSystem::IsActive(move));
+      Assert::AreEqual(1.0f - 0.125f * 0.125f, entity.ReadComponent<Sprite>()->opacity);
+
+      TweenSystem::Update(2.0f);
+      Assert::AreEqual(0.0f, entity.ReadComponent<Sprite>()->opacity);
+      Assert::AreEqual(size_t(0), TweenSystem::GetLaneCount());
+      Assert::AreEqual(1, completed);
+
+      // a yoyo plays back from where it ended, killing it leaves the field where it is
+      TweenHandle bob = TweenSystem::FromTo(entity, TweenField::PositionY, 0.0f, 4.0f, 1.0f);
+      TweenSystem::SetLoops(bob, -1, true);
+      TweenSystem::OnComplete(bob, [&]() { completed++; });
+      TweenSystem::Update(1.0f);
+      Assert::AreEqual(4.0f, entity.ReadComponent<Position>()->position.y);
+      TweenSystem::Update(0.5f);
+      Assert::AreEqual(2.0f, entity.ReadComponent<Position>()->position.y);
+      TweenSystem::Kill(bob);
+      TweenSystem::Update(0.25f);
+      Assert::AreEqual(2.0f, entity.ReadComponent<Position>()->position.y);
+      Assert::AreEqual(1, completed);
+
+      // a destroyed entity drops its tweens, a new scene drops all of them
+      TweenSystem::To(entity, TweenField::PositionX, 0.0f, 1.0f);
+      FlexECS::Scene::DestroyEntity(entity);
+      TweenSystem::Update(0.5f);
+      Assert::AreEqual(size_t(0), TweenSystem::GetLaneCount());
+
+      TweenSystem::OnComplete(TweenSystem::Delay(0.5f), [&]() { completed++; });
+      FlexECS::Scene::SetActiveScene(std::make_shared<FlexECS::Scene>());
+      TweenSystem::Update(1.0f);
+      Assert::AreEqual(1, completed);
+    }
+
+    TEST_METHOD(T_TimelineRunsStepsInOrder)
+    {
+      FlexECS::Scene::SetActiveScene(std::make_shared<FlexECS::Scene>());
+      FlexECS::Entity entity = FlexECS::Scene::CreateEntity("Icon");
+      entity.AddComponent<Position>({});
+
+      std::vector<int> order;
+      Timeline timeline;
+      timeline
+        .Append(entity, TweenField::PositionX, 10.0f, 1.0f)
+        .Join(entity, TweenField::PositionY, 5.0f, 0.5f, Ease::OutQuad)
+        .AppendCallback([&]() { order.push_back(1); })
+        .Append(entity, TweenField::PositionX, 0.0f, 1.0f)
+        .AppendInterval(0.5f)
+        .Insert(1.5f, entity, TweenField::PositionZ, 4.0f, 1.0f);
+      Assert::AreEqual(2.5f, timeline.GetDuration());
+
+      TweenHandle handle = timeline.Play();
+      TweenSystem::OnComplete(handle, [&]() { order.push_back(2); });
+
+      TweenSystem::Update(0.5f);
+      Assert::AreEqual(5.0f, entity.ReadComponent<Position>()->position.x);
+      Assert::AreEqual(5.0f, entity.ReadComponent<Position>()->position.y);
+
+      // the second move continues from the first one's target
+      TweenSystem::Update(0.5f);
+      Assert::AreEqual(10.0f, entity.ReadComponent<Position>()->position.x);
+      Assert::AreEqual(size_t(1), order.size());
+
+      TweenSystem::Update(0.5f);
+      Assert::AreEqual(5.0f, entity.ReadComponent<Position>()->position.x);
+      TweenSystem::Update(0.5f);
+      Assert::AreEqual(0.0f, entity.ReadComponent<Position>()->position.x);
+      Assert::AreEqual(2.0f, entity.ReadComponent<Position>()->position.z);
+      Assert::IsTrue(TweenSystem::IsActive(handle));
+
+      // the trailing interval, overlapped by the inserted step
+      TweenSystem::Update(0.5f);
+      Assert::AreEqual(4.0f, entity.ReadComponent<Position>()->position.z);
+      Assert::IsFalse(TweenSystem::IsActive(handle));
+      Assert::AreEqual(size_t(2), order.size());
+      Assert::AreEqual(2, order[1]);
+    }
+
+  };
+
+}
+
+namespace T_Animation
+{
+
+  TEST_CLASS(T_AnimationClip)
+  {
+  public:
+
+    static AnimationClip MakeClip(const std::vector<float>& frame_times)
+    {
+      AnimationClip clip;
+      float end = 0.0f;
+      for (float frame_time : frame_times)
+      {
+        end += frame_time;
+        clip.frame_ends.push_back(end);
+        clip.uvs.push_back(Vector4(0, 0, 1, 1));
+      }
+      clip.duration = end;
+      return clip;
+    }
+
+    TEST_METHOD(T_FrameAtSearchesPrefixSums)
+    {
+      AnimationClip clip = MakeClip({ 0.1f, 0.5f, 0.25f, 0.15f });
+      Assert::AreEqual(1.0f, clip.duration);
+
+      Assert::AreEqual(0, clip.FrameAt(0.0f));
+      Assert::AreEqual(0, clip.FrameAt(0.05f));
+      Assert::AreEqual(1, clip.FrameAt(0.1f));
+      Assert::AreEqual(1, clip.FrameAt(0.5f));
+      Assert::AreEqual(2, clip.FrameAt(0.7f));
+      Assert::AreEqual(3, clip.FrameAt(0.9f));
+
+      // clamped to the ends
+      Assert::AreEqual(0, clip.FrameAt(-1.0f));
+      Assert::AreEqual(3, clip.FrameAt(5.0f));
+
+      Assert::AreEqual(0.6f, clip.FrameStart(2));
+      Assert::AreEqual(0.25f, clip.FrameTime(2));
+    }
+
+    TEST_METHOD(T_FrameAtDividesUniformFrames)
+    {
+      AnimationClip clip = MakeClip({ 0.25f, 0.25f, 0.25f, 0.25f });
+      clip.uniform_frame_time = 0.25f;
+
+      // same frames as the search
+      for (float time = 0.0f; time < 1.5f; time += 0.05f)
+      {
+        AnimationClip searched = clip;
+        searched.uniform_frame_time = 0.0f;
+        Assert::AreEqual(searched.FrameAt(time), clip.FrameAt(time));
+      }
+    }
+
+  };
+
+}
+
+namespace T_Settings
+{
+
+  // Only works in memory, FlexPrefs is never loaded or saved here
+  TEST_CLASS(T_SettingsRegistry)
+  {
+  public:
+
+    TEST_METHOD(T_DeclareUsesDefaultsAndRange)
+    {
+      Setting<float> volume = Settings::DeclareFloat("test.settings.volume", 2.0f, 0.0f, 1.0f);
+      Assert::IsTrue(volume.IsValid());
+      Assert::AreEqual(1.0f, volume.Get());
+
+      Settings::Set(volume, 0.25f);
+      Assert::AreEqual(0.25f, volume.Get());
+      Assert::AreEqual(0.25f, FlexPrefs::GetFloat("test.settings.volume"));
+
+      Settings::Set(volume, -5.0f);
+      Assert::AreEqual(0.0f, volume.Get());
+
+      // same key, same value
+      Setting<float> again = Settings::DeclareFloat("test.settings.volume", 0.5f, 0.0f, 1.0f);
+      Assert::IsTrue(&volume.Get() == &again.Get());
+    }
+
+    TEST_METHOD(T_DeclareReadsSavedValue)
+    {
+      FlexPrefs::SetInt("test.settings.saved", 42);
+      Setting<int> saved = Settings::DeclareInt("test.settings.saved", 0, 0, 100);
+      Assert::AreEqual(42, saved.Get());
+
+      // the wrong type falls back to the default
+      FlexPrefs::SetString("test.settings.wrong", "yes");
+      Setting<bool> wrong = Settings::DeclareBool("test.settings.wrong", true);
+      Assert::IsTrue(wrong.Get());
+    }
+
+    TEST_METHOD(T_ListenersOnlyRunOnChange)
+    {
+      Setting<int> quality = Settings::DeclareInt("test.settings.quality", 1, 0, 3);
+
+      int calls = 0;
+      int last = -1;
+      Settings::ListenerID id = Settings::AddListener(quality, [&](int value) { ++calls; last = value; });
+
+      Settings::Set(quality, 1);
+      Assert::AreEqual(0, calls);
+
+      Settings::Set(quality, 9);
+      Assert::AreEqual(1, calls);
+      Assert::AreEqual(3, last);
+
+      Settings::RemoveListener(id);
+      Settings::Set(quality, 0);
+      Assert::AreEqual(1, calls);
+    }
+
+  };
+
+}
+
+namespace T_ReflectionLayout
+{
+
+  struct TestPoint
+  { FLX_REFL_SERIALIZABLE
+    float x = 0.0f;
+    float y = 0.0f;
+  };
+
+  struct TestBody
+  { FLX_REFL_SERIALIZABLE
+    TestPoint position;
+    float angle = 0.0f;
+    bool is_static = false;
+    int layer = 0;
+    std::vector<TestPoint> points;
+  };
+
+  FLX_REFL_REGISTER_START(TestPoint)
+    FLX_REFL_REGISTER_PROPERTY(x)
+    FLX_REFL_REGISTER_PROPERTY(y)
+  FLX_REFL_REGISTER_END;
+
+  FLX_REFL_REGISTER_START(TestBody)
+    FLX_REFL_REGISTER_PROPERTY(position)
+    FLX_REFL_REGISTER_PROPERTY(angle)
+    FLX_REFL_REGISTER_PROPERTY(is_static)
+    FLX_REFL_REGISTER_PROPERTY(layer)
+    FLX_REFL_REGISTER_PROPERTY(points)
+  FLX_REFL_REGISTER_END;
+
+  static Reflection::TypeDescriptor_Struct* GetStruct(Reflection::TypeDescriptor* type_desc)
+  {
+    return static_cast<Reflection::TypeDescriptor_Struct*>(type_desc);
+  }
+
+  TEST_CLASS(T_BinaryLayout)
+  {
+  public:
+
+    TEST_METHOD(T_RawMembersAreMerged)
+    {
+      Reflection::TypeDescriptor_Struct* point = GetStruct(Reflection::TypeResolver<TestPoint>::Get());
+      Assert::IsTrue(point->IsRawBinary());
+      Assert::AreEqual((size_t)1, point->GetBinaryLayout().size());
+
+      // position and angle are one run, the rest go through their types
+      const std::vector<Reflection::BinaryStep>& layout = GetStruct(Reflection::TypeResolver<TestBody>::Get())->GetBinaryLayout();
+      Assert::AreEqual((size_t)4, layout.size());
+      Assert::IsTrue(layout[0].type == nullptr);
+      Assert::AreEqual((size_t)0, layout[0].offset);
+      Assert::AreEqual(sizeof(TestPoint) + sizeof(float), layout[0].size);
+      Assert::IsFalse(Reflection::TypeResolver<TestBody>::Get()->IsRawBinary());
+
+      // vectors pad to 16 bytes, the first 12 are still one run
+      Assert::AreEqual((size_t)1, GetStruct(Reflection::TypeResolver<Position>::Get())->GetBinaryLayout().size());
+    }
+
+    TEST_METHOD(T_SameDataAsMembers)
+    {
+      TestBody body;
+      body.position = { 1.5f, -2.0f };
+      body.angle = 0.25f;
+      body.is_static = true;
+      body.layer = -300;
+      body.points = { { 1.0f, 2.0f }, { 3.0f, 4.0f }, { 5.0f, 6.0f } };
+
+      Reflection::TypeDescriptor_Struct* type_desc = GetStruct(Reflection::TypeResolver<TestBody>::Get());
+
+      Reflection::BinaryWriter fast;
+      type_desc->SerializeBinary(&body, fast);
+      Reflection::BinaryWriter members;
+      type_desc->Internal_SerializeBinaryMembers(&body, members);
+      Assert::IsTrue(fast.GetBuffer() == members.GetBuffer());
+
+      TestBody loaded;
+      Reflection::BinaryReader in(fast.GetBuffer());
+      type_desc->DeserializeBinary(&loaded, in);
+      Assert::IsFalse(in.Failed());
+      Assert::AreEqual((size_t)0, in.Remaining());
+      Assert::AreEqual(body.position.y, loaded.position.y);
+      Assert::AreEqual(body.angle, loaded.angle);
+      Assert::AreEqual(body.is_static, loaded.is_static);
+      Assert::AreEqual(body.layer, loaded.layer);
+      Assert::AreEqual(body.points.size(), loaded.points.size());
+      Assert::AreEqual(body.points[2].x, loaded.points[2].x);
+
+      // every prefix of the data must fail cleanly
+      for (std::size_t size = 0; size < fast.Size(); ++size)
+      {
+        TestBody truncated;
+        Reflection::BinaryReader truncated_in(fast.GetBuffer().data(), size);
+        type_desc->DeserializeBinary(&truncated, truncated_in);
+        Assert::IsTrue(truncated_in.Failed());
+      }
+    }
+
+    TEST_METHOD(T_EngineComponentsSameAsMembers)
+    {
+      Position position;
+      position.position = Vector3(1.0f, 2.0f, 3.0f);
+      Scale scale;
+      Rigidbody body;
+      body.velocity = Vector2(1.0f, -4.0f);
+
+      std::pair<Reflection::TypeDescriptor_Struct*, const void*> components[] = {
+        { GetStruct(Reflection::TypeResolver<Position>::Get()), &position },
+        { GetStruct(Reflection::TypeResolver<Scale>::Get()), &scale },
+        { GetStruct(Reflection::TypeResolver<Rigidbody>::Get()), &body }
+      };
+      for (auto& [type_desc, data] : components)
+      {
+        Reflection::BinaryWriter fast;
+        type_desc->SerializeBinary(data, fast);
+        Reflection::BinaryWriter members;
+        type_desc->Internal_SerializeBinaryMembers(data, members);
+        Assert::IsTrue(fast.GetBuffer() == members.GetBuffer());
+      }
+    }
+
+  };
+
+}
+
+namespace T_SystemSchedule
+{
+
+  // Stand-in resources, the schedule only compares the types
+  struct ResourceA {};
+  struct ResourceB {};
+  struct ResourceC {};
+
+  TEST_CLASS(T_Schedule)
+  {
+  public:
+
+    TEST_METHOD_CLEANUP(Cleanup)
+    {
+      SystemSchedule::SetSerial(false);
+      SystemSchedule::Shutdown();
+    }
+
+    TEST_METHOD(T_DependenciesFollowConflicts)
+    {
+      SystemSchedule schedule("Test");
+      schedule.Add("Write A", []() {}).Writes<ResourceA>();
+      schedule.Add("Write B", []() {}).Writes<ResourceB>();
+      schedule.Add("Read A", []() {}).Reads<ResourceA>();
+      schedule.Add("Read A Again", []() {}).Reads<ResourceA>();
+      schedule.Add("Read B Write C", []() {}).Reads<ResourceB>().Writes<ResourceC>();
+      schedule.Add("Exclusive", []() {}).Exclusive();
+
+      Assert::AreEqual(6ull, static_cast<unsigned long long>(schedule.GetSystemCount()));
+      Assert::IsTrue(schedule.GetDependencies(0).empty());
+      Assert::IsTrue(schedule.GetDependencies(1).empty());
+      Assert::IsTrue(schedule.GetDependencies(2) == std::vector<std::size_t>{ 0 });
+
+      // readers do not wait for each other
+      Assert::IsTrue(schedule.GetDependencies(3) == std::vector<std::size_t>{ 0 });
+      Assert::IsTrue(schedule.GetDependencies(4) == std::vector<std::size_t>{ 1 });
+      Assert::IsTrue(schedule.GetDependencies(5) == std::vector<std::size_t>{ 0, 1, 2, 3, 4 });
+    }
+
+    TEST_METHOD(T_ParallelMatchesSerial)
+    {
+      std::vector<int> a, b, c;
+
+      SystemSchedule schedule("Test");
+      schedule.Add("Fill A", [&]() { for (int i = 0; i < 1000; ++i) a.push_back(i); }).Writes<ResourceA>();
+      schedule.Add("Fill B", [&]() { for (int i = 0; i < 1000; ++i) b.push_back(i * 2); }).Writes<ResourceB>();
+      schedule.Add("Sum", [&]()
+      {
+        for (std::size_t i = 0; i < a.size(); ++i) c.push_back(a[i] + b[i]);
+      }).Reads<ResourceA, ResourceB>().Writes<ResourceC>();
+      schedule.Add("Double A", [&]() { for (int& value : a) value *= 2; }).Writes<ResourceA>();
+
+      schedule.Run();
+      std::vector<int> parallel_a = a, parallel_c = c;
+
+      a.clear(); b.clear(); c.clear();
+      SystemSchedule::SetSerial(true);
+      schedule.Run();
+
+      Assert::IsTrue(parallel_a == a);
+      Assert::IsTrue(parallel_c == c);
+      Assert::AreEqual(1000ull, static_cast<unsigned long long>(c.size()));
+      Assert::AreEqual(3 * 999, c.back());
+      Assert::AreEqual(2 * 999, a.back());
+    }
+
+    TEST_METHOD(T_ReadOnlyDeclarations)
+    {
+      bool a_read_only = false;
+      bool b_read_only = true;
+
+      SystemSchedule schedule("Test");
+      schedule.Add("Read A Write B", [&]()
+      {
+        a_read_only = SystemSchedule::Internal_IsDeclaredReadOnly(typeid(ResourceA));
+        b_read_only = SystemSchedule::Internal_IsDeclaredReadOnly(typeid(ResourceB));
+      }).Reads<ResourceA, ResourceB>().Writes<ResourceB>();
+      schedule.Run();
+
+      Assert::IsTrue(a_read_only);
+      Assert::IsFalse(b_read_only);
+
+      // outside of a system nothing is read-only
+      Assert::IsFalse(SystemSchedule::Internal_IsDeclaredReadOnly(typeid(ResourceA)));
+    }
+
+    TEST_METHOD(T_ExceptionIsRethrown)
+    {
+      std::atomic<int> ran{ 0 };
+
+      SystemSchedule schedule("Test");
+      schedule.Add("Throw", []() { throw std::runtime_error("system failed"); }).Writes<ResourceA>();
+      schedule.Add("Other", [&]() { ++ran; }).Writes<ResourceB>();
+      schedule.Add("Main Thread", [&]() { ++ran; }).Writes<ResourceC>().MainThread();
+
+      bool thrown = false;
+      try
+      {
+        schedule.Run();
+      }
+      catch (const std::runtime_error&)
+      {
+        thrown = true;
+      }
+
+      Assert::IsTrue(thrown);
+      Assert::AreEqual(2, ran.load());
+    }
+
+  };
+
+}
+
+namespace T_TextReveal
+{
+
+  TEST_CLASS(T_GlyphAlpha)
+  {
+  public:
+
+    TEST_METHOD(T_NegativeShowsEverything)
+    {
+      Renderer2DText text;
+      Assert::AreEqual(1.0f, text.GetGlyphAlpha(0));
+      Assert::AreEqual(1.0f, text.GetGlyphAlpha(1000));
+
+      // the component defaults to the whole text as well
+      Text component;
+      Assert::IsTrue(component.visible_glyphs < 0.0f);
+    }
+
+    TEST_METHOD(T_WithoutFadeMatchesSubstr)
+    {
+      // the old typewriter showed substr(0, static_cast<size_t>(visible))
+      Renderer2DText text;
+      text.m_visible_glyphs = 3.7f;
+      Assert::AreEqual(1.0f, text.GetGlyphAlpha(0));
+      Assert::AreEqual(1.0f, text.GetGlyphAlpha(2));
+      Assert::AreEqual(0.0f, text.GetGlyphAlpha(3));
+      Assert::AreEqual(0.0f, text.GetGlyphAlpha(4));
+
+      text.m_visible_glyphs = 0.0f;
+      Assert::AreEqual(0.0f, text.GetGlyphAlpha(0));
+    }
+
+    TEST_METHOD(T_FadeIsSpreadOverGlyphs)
+    {
+      Renderer2DText text;
+      text.m_visible_glyphs = 5.0f;
+      text.m_glyph_fade = 2.0f;
+      Assert::AreEqual(1.0f, text.GetGlyphAlpha(2));
+      Assert::AreEqual(1.0f, text.GetGlyphAlpha(3));
+      Assert::AreEqual(0.5f, text.GetGlyphAlpha(4));
+      Assert::AreEqual(0.0f, text.GetGlyphAlpha(5));
+    }
+
+  };
+
+}
@@ -7,9 +7,10 @@ in vec2 tex_coord;
 // font
 uniform sampler2D text;
 uniform vec3 u_color;
+uniform float u_alpha; // typewriter fade in of the glyph
 
 void main()
 {
    vec4 sampled = vec4(1.0, 1.0, 1.0, texture(text, tex_coord).r);
-   fragment_color = vec4(u_color, 1.0) * sampled;
+   fragment_color = vec4(u_color, u_alpha) * sampled;
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #version 460 core
 
 in vec2 TexCoord;
+in float GlyphAlpha;
 out vec4 FragColor;
 
 uniform sampler2D u_texture; // The atlas texture
@@ -11,5 +12,5 @@ void main()
     // Sample the atlas texture (we assume the glyph bitmap is stored in the red channel)
     float sampled = texture(u_texture, TexCoord).r;
     // Multiply the glyphs alpha by u_color
-    FragColor = vec4(u_color, sampled);
+    FragColor = vec4(u_color, sampled * GlyphAlpha);
 }
\ No newline at end of file
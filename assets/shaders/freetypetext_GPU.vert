@@ -12,6 +12,11 @@ uniform vec2 u_lineOffset;
 uniform int u_text[256];
 uniform int u_textLength;
 
+// Typewriter reveal, see Renderer2DText::GetGlyphAlpha
+uniform int u_firstGlyph;      // index in the whole text of the first glyph of this line
+uniform float u_visibleGlyphs; // negative shows every glyph
+uniform float u_glyphFade;     // glyphs each glyph takes to fade in, 0 shows each one at once
+
 struct Glyph {
     float advance;
     vec2 size;
@@ -22,9 +27,11 @@ struct Glyph {
 uniform Glyph u_glyphs[128];
 
 out vec2 TexCoord;
+out float GlyphAlpha;
 
 void main() {
     int idx = gl_InstanceID;
+    GlyphAlpha = 0.0;
     if (idx >= u_textLength) {
         gl_Position = vec4(0.0);
         TexCoord = vec2(0.0);
@@ -37,6 +44,20 @@ void main() {
         TexCoord = vec2(0.0);
         return;
     }
+
+    // Do not render glyphs that are not revealed yet.
+    float glyphIndex = float(u_firstGlyph + idx);
+    if (u_visibleGlyphs < 0.0)
+        GlyphAlpha = 1.0;
+    else if (u_glyphFade <= 0.0)
+        GlyphAlpha = (u_visibleGlyphs >= glyphIndex + 1.0) ? 1.0 : 0.0;
+    else
+        GlyphAlpha = clamp((u_visibleGlyphs - glyphIndex) / u_glyphFade, 0.0, 1.0);
+    if (GlyphAlpha <= 0.0) {
+        gl_Position = vec4(0.0);
+        TexCoord = vec2(0.0);
+        return;
+    }
     
     // Compute the horizontal position for this glyph by accumulating advances
     float xPos = 0.0;